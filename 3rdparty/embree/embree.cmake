@@ -80,9 +80,10 @@ ExternalProject_Add(
         -DEMBREE_STATIC_LIB=ON
         -DEMBREE_GEOMETRY_CURVE=OFF
         -DEMBREE_GEOMETRY_GRID=OFF
-        -DEMBREE_GEOMETRY_INSTANCE=OFF
+        -DEMBREE_GEOMETRY_INSTANCE=ON
         -DEMBREE_GEOMETRY_QUAD=OFF
         -DEMBREE_GEOMETRY_SUBDIVISION=OFF
+        -DEMBREE_RAY_MASK=ON
         -DEMBREE_TASKING_SYSTEM=INTERNAL
         ${WIN_CMAKE_ARGS}
     BUILD_BYPRODUCTS
@@ -0,0 +1,250 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/Open3D.h"
+
+namespace open3d {
+namespace apps {
+namespace offline_reconstruction {
+
+/// Initial value of the 64-bit FNV-1a hash.
+static constexpr uint64_t kHashSeed = 14695981039346656037ull;
+
+/// 64-bit FNV-1a hash of \p size bytes, continuing from \p seed.
+inline uint64_t HashBytes(const void* data,
+                          size_t size,
+                          uint64_t seed = kHashSeed) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        seed ^= bytes[i];
+        seed *= 1099511628211ull;
+    }
+    return seed;
+}
+
+inline uint64_t HashString(const std::string& value,
+                           uint64_t seed = kHashSeed) {
+    // Hash the size too, so that concatenations can't collide.
+    const uint64_t size = value.size();
+    return HashBytes(value.data(), value.size(),
+                     HashBytes(&size, sizeof(size), seed));
+}
+
+/// \class ReconstructionCache
+/// \brief On-disk cache of intermediate results of the reconstruction stages.
+///
+/// Entries are keyed by a hash of everything they are computed from: the
+/// content of the input files and the relevant parameters. Reruns with changed
+/// parameters of later stages load the results of earlier stages instead of
+/// recomputing them. The cache can be shared by concurrent tasks.
+class ReconstructionCache {
+public:
+    /// \param folder Folder of the cache files, created if needed.
+    /// \param enabled If false, nothing is loaded or stored.
+    ReconstructionCache(const std::string& folder, bool enabled)
+        : folder_(folder), enabled_(enabled) {
+        if (enabled_ && !utility::filesystem::DirectoryExists(folder_)) {
+            utility::filesystem::MakeDirectoryHierarchy(folder_);
+        }
+    }
+
+    bool IsEnabled() const { return enabled_; }
+
+    /// Returns the hash of the content of a file, computed once per path.
+    uint64_t HashFile(const std::string& path) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = file_hashes_.find(path);
+            if (it != file_hashes_.end()) return it->second;
+        }
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            utility::LogError("Failed to open {} for hashing.", path);
+        }
+        uint64_t hash = kHashSeed;
+        std::vector<char> buffer(1 << 20);
+        while (file) {
+            file.read(buffer.data(), buffer.size());
+            hash = HashBytes(buffer.data(), size_t(file.gcount()), hash);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        file_hashes_[path] = hash;
+        return hash;
+    }
+
+    bool LoadRegistration(const std::string& stage,
+                          uint64_t key,
+                          bool& success,
+                          Eigen::Matrix4d& transformation,
+                          Eigen::Matrix6d& information) const {
+        if (!enabled_) return false;
+        std::ifstream file(GetPath(stage, key, ".bin"), std::ios::binary);
+        if (!file.is_open()) return false;
+        // Outputs are only written after a complete read.
+        uint8_t flag = 0;
+        Eigen::Matrix4d trans;
+        Eigen::Matrix6d info;
+        file.read(reinterpret_cast<char*>(&flag), sizeof(flag));
+        file.read(reinterpret_cast<char*>(trans.data()),
+                  sizeof(double) * trans.size());
+        file.read(reinterpret_cast<char*>(info.data()),
+                  sizeof(double) * info.size());
+        if (!file) return false;
+        success = flag != 0;
+        transformation = trans;
+        information = info;
+        return true;
+    }
+
+    void StoreRegistration(const std::string& stage,
+                           uint64_t key,
+                           bool success,
+                           const Eigen::Matrix4d& transformation,
+                           const Eigen::Matrix6d& information) const {
+        if (!enabled_) return;
+        const std::string path = GetPath(stage, key, ".bin");
+        const std::string tmp_path = GetTemporaryPath(path);
+        {
+            std::ofstream file(tmp_path, std::ios::binary);
+            const uint8_t flag = success ? 1 : 0;
+            file.write(reinterpret_cast<const char*>(&flag), sizeof(flag));
+            file.write(reinterpret_cast<const char*>(transformation.data()),
+                       sizeof(double) * transformation.size());
+            file.write(reinterpret_cast<const char*>(information.data()),
+                       sizeof(double) * information.size());
+        }
+        Commit(tmp_path, path);
+    }
+
+    /// Loads a point cloud and its features. Points, normals and colors are
+    /// cached as raw doubles, so that a warm run sees exactly the data of a
+    /// cold one.
+    bool LoadPointCloudAndFeature(
+            const std::string& stage,
+            uint64_t key,
+            geometry::PointCloud& pcd,
+            pipelines::registration::Feature& feature) const {
+        if (!enabled_) return false;
+        std::ifstream file(GetPath(stage, key, ".bin"), std::ios::binary);
+        if (!file.is_open()) return false;
+        // Outputs are only written after a complete read.
+        uint64_t magic = 0;
+        int64_t rows = 0, cols = 0;
+        file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        file.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+        file.read(reinterpret_cast<char*>(&cols), sizeof(cols));
+        if (!file || magic != kPointCloudEntryMagic || rows < 0 || cols < 0) {
+            return false;
+        }
+        pipelines::registration::Feature entry_feature;
+        entry_feature.Resize(int(rows), int(cols));
+        file.read(reinterpret_cast<char*>(entry_feature.data_.data()),
+                  sizeof(double) * entry_feature.data_.size());
+        geometry::PointCloud entry_pcd;
+        if (!ReadVectors(file, entry_pcd.points_) ||
+            !ReadVectors(file, entry_pcd.normals_) ||
+            !ReadVectors(file, entry_pcd.colors_) ||
+            int64_t(entry_pcd.points_.size()) != cols) {
+            return false;
+        }
+        pcd = std::move(entry_pcd);
+        feature = std::move(entry_feature);
+        return true;
+    }
+
+    void StorePointCloudAndFeature(
+            const std::string& stage,
+            uint64_t key,
+            const geometry::PointCloud& pcd,
+            const pipelines::registration::Feature& feature) const {
+        if (!enabled_) return;
+        const std::string path = GetPath(stage, key, ".bin");
+        const std::string tmp_path = GetTemporaryPath(path);
+        {
+            std::ofstream file(tmp_path, std::ios::binary);
+            const uint64_t magic = kPointCloudEntryMagic;
+            const int64_t rows = feature.data_.rows();
+            const int64_t cols = feature.data_.cols();
+            file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+            file.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+            file.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
+            file.write(reinterpret_cast<const char*>(feature.data_.data()),
+                       sizeof(double) * feature.data_.size());
+            WriteVectors(file, pcd.points_);
+            WriteVectors(file, pcd.normals_);
+            WriteVectors(file, pcd.colors_);
+        }
+        Commit(tmp_path, path);
+    }
+
+private:
+    std::string GetPath(const std::string& stage,
+                        uint64_t key,
+                        const std::string& extension) const {
+        return utility::filesystem::JoinPath(
+                folder_, fmt::format("{}_{:016x}{}", stage, key, extension));
+    }
+
+    /// Tags point cloud entries, so that entries of an older layout are
+    /// recomputed instead of misread.
+    static constexpr uint64_t kPointCloudEntryMagic = 0x31445043334f0001ull;
+
+    static void WriteVectors(std::ofstream& file,
+                             const std::vector<Eigen::Vector3d>& vectors) {
+        const int64_t size = vectors.size();
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        file.write(reinterpret_cast<const char*>(vectors.data()),
+                   sizeof(Eigen::Vector3d) * vectors.size());
+    }
+
+    static bool ReadVectors(std::ifstream& file,
+                            std::vector<Eigen::Vector3d>& vectors) {
+        int64_t size = 0;
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        if (!file || size < 0) return false;
+        vectors.resize(size);
+        file.read(reinterpret_cast<char*>(vectors.data()),
+                  sizeof(Eigen::Vector3d) * vectors.size());
+        return bool(file);
+    }
+
+    /// Entries are written to a temporary file and renamed, so that readers
+    /// never see partial files.
+    static std::string GetTemporaryPath(const std::string& path) {
+        return fmt::format(
+                "{}.{:x}.tmp", path,
+                std::hash<std::thread::id>()(std::this_thread::get_id()));
+    }
+
+    static void Commit(const std::string& tmp_path, const std::string& path) {
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+            utility::LogWarning("Failed to write cache entry {}.", path);
+            std::remove(tmp_path.c_str());
+        }
+    }
+
+    std::string folder_;
+    bool enabled_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, uint64_t> file_hashes_;
+};
+
+}  // namespace offline_reconstruction
+}  // namespace apps
+}  // namespace open3d
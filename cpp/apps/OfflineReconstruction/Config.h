@@ -55,6 +55,11 @@ void InitConfig(Json::Value& config) {
     SetDefaultValue(config, "icp_method", "color");
     SetDefaultValue(config, "global_registration", "ransac");
     SetDefaultValue(config, "multi_threading", true);
+    // Maximum number of concurrent tasks, 0 to use all cores.
+    SetDefaultValue(config, "max_workers", 0);
+    SetDefaultValue(config, "use_cache", true);
+    // Number of frames integrated into the scene TSDF volume at once.
+    SetDefaultValue(config, "integrate_batch_size", 32);
 
     // `slac` and `slac_integrate` related parameters. `voxel_size` and
     // `depth_min` parameters from previous section, are also used in `slac`
@@ -82,6 +87,7 @@ void InitConfig(Json::Value& config) {
                     "fragments/");
     SetDefaultValue(config, "template_fragment_pointcloud", "fragments/");
     SetDefaultValue(config, "folder_scene", "scene/");
+    SetDefaultValue(config, "folder_cache", "cache/");
     SetDefaultValue(config, "template_global_posegraph",
                     "scene/global_registration.json");
     SetDefaultValue(config, "template_global_posegraph_optimized",
@@ -9,8 +9,12 @@
 
 #include <json/json.h>
 
+#include <exception>
+
+#include "CacheUtil.h"
 #include "DebugUtil.h"
 #include "FileSystemUtil.h"
+#include "TaskGraphUtil.h"
 #include "open3d/Open3D.h"
 
 namespace open3d {
@@ -39,6 +43,18 @@ public:
     Eigen::Matrix6d information_;
 };
 
+/// \class PointCloudFeatures
+/// \brief Downsampled point cloud with normals and FPFH features of a frame
+/// or a fragment, used for global registration.
+///
+class PointCloudFeatures {
+public:
+    /// Hash of the inputs the point cloud was computed from.
+    uint64_t hash_ = 0;
+    geometry::PointCloud pcd_down_;
+    pipelines::registration::Feature features_;
+};
+
 class ReconstructionPipeline {
 public:
     /// \brief Construct a new Reconstruction Pipeline object
@@ -46,12 +62,17 @@ public:
     /// \param config Json object that contains the configuration of the
     /// pipeline.
     explicit ReconstructionPipeline(const Json::Value& config)
-        : config_(config) {}
+        : config_(config),
+          cache_(utility::filesystem::JoinPath(
+                         config["path_dataset"].asString(),
+                         config["folder_cache"].asString()),
+                 config["use_cache"].asBool()) {}
 
     virtual ~ReconstructionPipeline() {}
 
 private:
     Json::Value config_;
+    ReconstructionCache cache_;
     int n_fragments_;
 
 public:
@@ -69,22 +90,68 @@ public:
 
         n_fragments_ = (int)ceil((float)color_files.size() /
                                  config_["n_frames_per_fragment"].asFloat());
+        const camera::PinholeCameraIntrinsic intrinsic = GetCameraIntrinsic();
+        const int n_keyframes_per_n_frame =
+                config_["n_keyframes_per_n_frame"].asInt();
 
-        if (config_["multi_threading"].asBool()) {
-            std::vector<std::thread> thread_list;
-            for (int i = 0; i < n_fragments_; i++) {
-                thread_list.push_back(std::thread(
-                        &ReconstructionPipeline::ProcessSingleFragment, this, i,
-                        color_files, depth_files));
-            }
-            for (auto& thread : thread_list) {
-                thread.join();
-            }
-        } else {
-            for (int i = 0; i < n_fragments_; i++) {
-                ProcessSingleFragment(i, color_files, depth_files);
+        // Keyframe features, frame pairs and the fragments are separate tasks,
+        // so that all of them share the same bounded set of threads.
+        TaskGraph task_graph;
+        std::vector<PointCloudFeatures> keyframes(color_files.size());
+        std::vector<TaskGraph::TaskId> keyframe_tasks(color_files.size());
+        for (int i = 0; i < (int)color_files.size();
+             i += n_keyframes_per_n_frame) {
+            keyframe_tasks[i] = task_graph.AddTask([&, i]() {
+                keyframes[i] = PreProcessFrame(i, color_files, depth_files,
+                                               intrinsic);
+            });
+        }
+
+        std::vector<std::vector<std::tuple<int, int>>> pairs(n_fragments_);
+        std::vector<std::vector<
+                std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d>>>
+                results(n_fragments_);
+        for (int fragment_id = 0; fragment_id < n_fragments_; fragment_id++) {
+            const int sid =
+                    fragment_id * config_["n_frames_per_fragment"].asInt();
+            const int eid =
+                    std::min(sid + config_["n_frames_per_fragment"].asInt(),
+                             (int)color_files.size());
+            pairs[fragment_id] = GetFragmentFramePairs(sid, eid);
+            results[fragment_id].resize(pairs[fragment_id].size());
+
+            std::vector<TaskGraph::TaskId> pair_tasks;
+            for (size_t i = 0; i < pairs[fragment_id].size(); i++) {
+                const int s = std::get<0>(pairs[fragment_id][i]);
+                const int t = std::get<1>(pairs[fragment_id][i]);
+                std::vector<TaskGraph::TaskId> dependencies;
+                if (t != s + 1) {
+                    dependencies = {keyframe_tasks[s], keyframe_tasks[t]};
+                }
+                pair_tasks.push_back(task_graph.AddTask(
+                        [&, fragment_id, i, s, t]() {
+                            utility::LogInfo(
+                                    "Fragment {:03d} / {:03d} :: RGBD {} "
+                                    "between frame : {} and {}",
+                                    fragment_id, n_fragments_ - 1,
+                                    t == s + 1 ? "odometry" : "loop closure",
+                                    s, t);
+                            results[fragment_id][i] = RegisterRGBDPair(
+                                    s, t, color_files, depth_files, intrinsic,
+                                    keyframes);
+                        },
+                        dependencies));
             }
+            task_graph.AddTask(
+                    [&, fragment_id, sid]() {
+                        MakePoseGraphForFragment(
+                                fragment_id, sid, pairs[fragment_id],
+                                results[fragment_id], color_files, depth_files,
+                                intrinsic);
+                    },
+                    pair_tasks);
         }
+        task_graph.Run(GetNumWorkers());
     }
 
     /// \brief Register fragments and compute global odometry.
@@ -423,23 +490,65 @@ private:
         io::WritePinholeCameraTrajectory(trajectory_file, camera_trajectory);
     }
 
-    void ProcessSingleFragment(int fragment_id,
-                               const std::vector<std::string>& color_files,
-                               const std::vector<std::string>& depth_files) {
-        const camera::PinholeCameraIntrinsic intrinsic = GetCameraIntrinsic();
+    /// Returns the number of tasks running at the same time.
+    int GetNumWorkers() const {
+        if (!config_["multi_threading"].asBool()) {
+            return 1;
+        }
+        const int max_workers = config_["max_workers"].asInt();
+        return max_workers > 0 ? max_workers : utility::EstimateMaxThreads();
+    }
 
-        const int sid = fragment_id * config_["n_frames_per_fragment"].asInt();
-        const int eid = std::min(sid + config_["n_frames_per_fragment"].asInt(),
-                                 (int)color_files.size());
+    /// Combines \p seed with the values of the parameters \p keys.
+    uint64_t HashConfig(uint64_t seed,
+                        const std::vector<std::string>& keys) const {
+        for (const auto& key : keys) {
+            seed = HashString(key + "=" + config_[key].toStyledString(), seed);
+        }
+        return seed;
+    }
 
-        MakePoseGraphForFragment(fragment_id, sid, eid, color_files,
-                                 depth_files, intrinsic);
+    /// Combines \p seed with the content hash of \p files.
+    uint64_t HashFiles(uint64_t seed, const std::vector<std::string>& files) {
+        for (const auto& file : files) {
+            const uint64_t hash = cache_.HashFile(file);
+            seed = HashBytes(&hash, sizeof(hash), seed);
+        }
+        return seed;
+    }
+
+    uint64_t HashIntrinsic(uint64_t seed,
+                           const camera::PinholeCameraIntrinsic& intrinsic) {
+        const int size[2] = {intrinsic.width_, intrinsic.height_};
+        seed = HashBytes(size, sizeof(size), seed);
+        return HashBytes(intrinsic.intrinsic_matrix_.data(),
+                         sizeof(double) * intrinsic.intrinsic_matrix_.size(),
+                         seed);
+    }
+
+    /// Returns the odometry and keyframe loop closure frame pairs of a
+    /// fragment, in the order their edges are added to the pose graph.
+    std::vector<std::tuple<int, int>> GetFragmentFramePairs(int sid, int eid) {
+        const int n_keyframes_per_n_frame =
+                config_["n_keyframes_per_n_frame"].asInt();
+        std::vector<std::tuple<int, int>> pairs;
+        for (int s = sid; s < eid; ++s) {
+            for (int t = s + 1; t < eid; ++t) {
+                if (t == s + 1 || (s % n_keyframes_per_n_frame == 0 &&
+                                   t % n_keyframes_per_n_frame == 0)) {
+                    pairs.emplace_back(s, t);
+                }
+            }
+        }
+        return pairs;
     }
 
     void MakePoseGraphForFragment(
             int fragment_id,
             int sid,
-            int eid,
+            const std::vector<std::tuple<int, int>>& pairs,
+            const std::vector<std::tuple<bool, Eigen::Matrix4d,
+                                         Eigen::Matrix6d>>& results,
             const std::vector<std::string>& color_files,
             const std::vector<std::string>& depth_files,
             const camera::PinholeCameraIntrinsic& intrinsic) {
@@ -447,46 +556,27 @@ private:
         Eigen::Matrix4d trans_odometry = Eigen::Matrix4d::Identity();
         pose_graph.nodes_.push_back(
                 pipelines::registration::PoseGraphNode(trans_odometry));
-        const int n_keyframes_per_n_frame =
-                config_["n_keyframes_per_n_frame"].asInt();
 
-        for (int s = sid; s < eid; ++s) {
-            for (int t = s + 1; t < eid; ++t) {
-                // Compute odometry.
-                if (t == s + 1) {
-                    utility::LogInfo(
-                            "Fragment {:03d} / {:03d} :: RGBD odometry between "
-                            "frame : "
-                            "{} and {}",
-                            fragment_id, n_fragments_ - 1, s, t);
-                    const auto result = RegisterRGBDPair(
-                            s, t, color_files, depth_files, intrinsic);
-                    trans_odometry = std::get<1>(result) * trans_odometry;
-                    pose_graph.nodes_.push_back(
-                            pipelines::registration::PoseGraphNode(
-                                    trans_odometry.inverse()));
-                    pose_graph.edges_.push_back(
-                            pipelines::registration::PoseGraphEdge(
-                                    s - sid, t - sid, std::get<1>(result),
-                                    std::get<2>(result), false));
-                    // Keyframe loop closure.
-                } else if (s % n_keyframes_per_n_frame == 0 &&
-                           t % n_keyframes_per_n_frame == 0) {
-                    utility::LogInfo(
-                            "Fragment {:03d} / {:03d} :: RGBD loop closure "
-                            "between "
-                            "frame : "
-                            "{} and {}",
-                            fragment_id, n_fragments_ - 1, s, t);
-                    const auto result = RegisterRGBDPair(
-                            s, t, color_files, depth_files, intrinsic);
-                    if (std::get<0>(result)) {
-                        pose_graph.edges_.push_back(
-                                pipelines::registration::PoseGraphEdge(
-                                        s - sid, t - sid, std::get<1>(result),
-                                        std::get<2>(result), true));
-                    }
-                }
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            const int s = std::get<0>(pairs[i]);
+            const int t = std::get<1>(pairs[i]);
+            const auto& result = results[i];
+            // Odometry.
+            if (t == s + 1) {
+                trans_odometry = std::get<1>(result) * trans_odometry;
+                pose_graph.nodes_.push_back(
+                        pipelines::registration::PoseGraphNode(
+                                trans_odometry.inverse()));
+                pose_graph.edges_.push_back(
+                        pipelines::registration::PoseGraphEdge(
+                                s - sid, t - sid, std::get<1>(result),
+                                std::get<2>(result), false));
+                // Keyframe loop closure.
+            } else if (std::get<0>(result)) {
+                pose_graph.edges_.push_back(
+                        pipelines::registration::PoseGraphEdge(
+                                s - sid, t - sid, std::get<1>(result),
+                                std::get<2>(result), true));
             }
         }
 
@@ -545,21 +635,27 @@ private:
             }
         }
 
+        // Each fragment is preprocessed once, and each pair starts as soon as
+        // both of its fragments are ready.
         const size_t num_pairs = fragment_matching_results.size();
-        if (config_["multi_threading"].asBool()) {
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
-            for (int i = 0; i < (int)num_pairs; i++) {
-                RegisterFragmentPair(ply_files, fragment_matching_results[i].s_,
-                                     fragment_matching_results[i].t_,
-                                     fragment_matching_results[i]);
-            }
-        } else {
-            for (size_t i = 0; i < num_pairs; i++) {
-                RegisterFragmentPair(ply_files, fragment_matching_results[i].s_,
-                                     fragment_matching_results[i].t_,
-                                     fragment_matching_results[i]);
-            }
+        TaskGraph task_graph;
+        std::vector<PointCloudFeatures> fragments(n_fragments_);
+        std::vector<TaskGraph::TaskId> fragment_tasks;
+        for (int i = 0; i < n_fragments_; i++) {
+            fragment_tasks.push_back(task_graph.AddTask([&, i]() {
+                fragments[i] = PreProcessFragment(ply_files[i]);
+            }));
         }
+        for (size_t i = 0; i < num_pairs; i++) {
+            MatchingResult& result = fragment_matching_results[i];
+            task_graph.AddTask(
+                    [&]() {
+                        RegisterFragmentPair(ply_files, fragments, result.s_,
+                                             result.t_, result);
+                    },
+                    {fragment_tasks[result.s_], fragment_tasks[result.t_]});
+        }
+        task_graph.Run(GetNumWorkers());
 
         for (size_t i = 0; i < num_pairs; i++) {
             if (fragment_matching_results[i].success_) {
@@ -634,22 +730,24 @@ private:
             fragment_matching_results.push_back(mr);
         }
 
-        if (config_["multi_threading"].asBool()) {
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
-            for (int i = 0; i < (int)fragment_matching_results.size(); i++) {
-                const int s = fragment_matching_results[i].s_;
-                const int t = fragment_matching_results[i].t_;
-                RefineFragmentPair(ply_files, s, t,
-                                   fragment_matching_results[i]);
-            }
-        } else {
-            for (size_t i = 0; i < fragment_matching_results.size(); i++) {
-                const int s = fragment_matching_results[i].s_;
-                const int t = fragment_matching_results[i].t_;
-                RefineFragmentPair(ply_files, s, t,
-                                   fragment_matching_results[i]);
-            }
+        TaskGraph task_graph;
+        std::vector<PointCloudFeatures> fragments(ply_files.size());
+        std::vector<TaskGraph::TaskId> fragment_tasks;
+        for (size_t i = 0; i < ply_files.size(); i++) {
+            fragment_tasks.push_back(task_graph.AddTask([&, i]() {
+                fragments[i] = PreProcessFragment(ply_files[i]);
+            }));
+        }
+        for (auto& result : fragment_matching_results) {
+            task_graph.AddTask(
+                    [&]() {
+                        RefineFragmentPair(fragments, result.s_, result.t_,
+                                           result);
+                    },
+                    {fragment_tasks.at(result.s_),
+                     fragment_tasks.at(result.t_)});
         }
+        task_graph.Run(GetNumWorkers());
 
         // Update scene pose graph.
         scene_pose_graph.edges_.clear();
@@ -696,30 +794,35 @@ private:
                 scene_pose_graph);
     }
 
-    void RefineFragmentPair(const std::vector<std::string>& pcd_files,
+    void RefineFragmentPair(const std::vector<PointCloudFeatures>& fragments,
                             int s,
                             int t,
                             MatchingResult& matched_result) {
-        geometry::PointCloud source_pcd, target_pcd;
-        io::ReadPointCloud(pcd_files[s], source_pcd);
-        io::ReadPointCloud(pcd_files[t], target_pcd);
         const double voxel_size = config_["voxel_size"].asDouble();
+        const auto& init_trans = matched_result.transformation_;
 
-        // Preprocessing the fragments point clouds.
-        geometry::PointCloud source_pcd_down, target_pcd_down;
-        pipelines::registration::Feature source_features, target_features;
-        std::tie(source_pcd_down, source_features) =
-                PreProcessPointCloud(source_pcd, voxel_size);
-        std::tie(target_pcd_down, target_features) =
-                PreProcessPointCloud(target_pcd, voxel_size);
+        uint64_t key = HashString("refine_pair");
+        key = HashBytes(&fragments[s].hash_, sizeof(uint64_t), key);
+        key = HashBytes(&fragments[t].hash_, sizeof(uint64_t), key);
+        key = HashBytes(init_trans.data(), sizeof(double) * init_trans.size(),
+                        key);
+        key = HashConfig(key, {"voxel_size", "icp_method"});
+        bool success;
+        if (cache_.LoadRegistration("refine_pair", key, success,
+                                    matched_result.transformation_,
+                                    matched_result.information_)) {
+            return;
+        }
 
-        const auto& init_trans = matched_result.transformation_;
         const auto result =
-                MultiScaleICP(source_pcd_down, target_pcd_down,
+                MultiScaleICP(fragments[s].pcd_down_, fragments[t].pcd_down_,
                               {voxel_size, voxel_size / 2.0, voxel_size / 4.0},
                               {50, 30, 15}, init_trans);
         matched_result.transformation_ = std::get<0>(result);
         matched_result.information_ = std::get<1>(result);
+        cache_.StoreRegistration("refine_pair", key, true,
+                                 matched_result.transformation_,
+                                 matched_result.information_);
     }
 
     void IntegrateFragmentRGBD(
@@ -731,6 +834,9 @@ private:
         geometry::PointCloud fragment;
         const size_t graph_num = pose_graph.nodes_.size();
 
+        // Exceptions must not escape the parallel region, the first one is
+        // rethrown after it.
+        std::exception_ptr error;
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
         for (int i = 0; i < int(graph_num); ++i) {
@@ -742,14 +848,24 @@ private:
                     "of "
                     "{:d}).",
                     fragment_id, n_fragments_ - 1, i_abs, i + 1, graph_num);
-            const geometry::RGBDImage rgbd = ReadRGBDImage(
-                    color_files[i_abs], depth_files[i_abs], false);
-            auto pcd = geometry::PointCloud::CreateFromRGBDImage(
-                    rgbd, intrinsic, Eigen::Matrix4d::Identity(), true);
-            pcd->Transform(pose_graph.nodes_[i].pose_);
+            std::shared_ptr<geometry::PointCloud> pcd;
+            try {
+                const geometry::RGBDImage rgbd = ReadRGBDImage(
+                        color_files[i_abs], depth_files[i_abs], false);
+                pcd = geometry::PointCloud::CreateFromRGBDImage(
+                        rgbd, intrinsic, Eigen::Matrix4d::Identity(), true);
+                pcd->Transform(pose_graph.nodes_[i].pose_);
+            } catch (...) {
+#pragma omp critical
+                {
+                    if (!error) error = std::current_exception();
+                }
+                continue;
+            }
 #pragma omp critical
             { fragment += *pcd; }
         }
+        if (error) std::rethrow_exception(error);
 
         const geometry::PointCloud fragment_down = *fragment.VoxelDownSample(
                 config_["tsdf_cubic_size"].asDouble() / 512.0);
@@ -774,14 +890,35 @@ private:
 
         const auto color_files = std::get<0>(rgbd_files);
         const auto depth_files = std::get<1>(rgbd_files);
-        const size_t num = color_files.size();
-        for (size_t i = 0; i < num; i++) {
-            utility::LogInfo("Scene :: Integrate rgbd frame {} | {}", i, num);
-            const geometry::RGBDImage rgbd =
-                    ReadRGBDImage(color_files[i], depth_files[i], false);
-            volume.Integrate(
-                    rgbd, intrinsic,
-                    camera_trajectory.parameters_[i].extrinsic_.inverse());
+        const int num = int(color_files.size());
+        const int batch_size =
+                std::max(config_["integrate_batch_size"].asInt(), 1);
+        for (int start = 0; start < num; start += batch_size) {
+            const int end = std::min(start + batch_size, num);
+            utility::LogInfo("Scene :: Integrate rgbd frames {} - {} | {}",
+                             start, end - 1, num);
+            std::vector<geometry::RGBDImage> rgbds(end - start);
+            std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    extrinsics(end - start);
+            // Exceptions must not escape the parallel region, the first one
+            // is rethrown after it.
+            std::exception_ptr error;
+#pragma omp parallel for schedule(static) num_threads(GetNumWorkers())
+            for (int i = start; i < end; i++) {
+                try {
+                    rgbds[i - start] = ReadRGBDImage(color_files[i],
+                                                     depth_files[i], false);
+                    extrinsics[i - start] = camera_trajectory.parameters_[i]
+                                                    .extrinsic_.inverse();
+                } catch (...) {
+#pragma omp critical
+                    {
+                        if (!error) error = std::current_exception();
+                    }
+                }
+            }
+            if (error) std::rethrow_exception(error);
+            volume.IntegrateMany(rgbds, intrinsic, extrinsics);
         }
 
         const auto mesh = volume.ExtractTriangleMesh();
@@ -798,49 +935,94 @@ private:
                 *mesh, false, true);
     }
 
+    /// \brief Registers two frames with RGBD odometry.
+    ///
+    /// Loop closures between keyframes are initialized with global
+    /// registration of the precomputed \p keyframes features.
     std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> RegisterRGBDPair(
             int s,
             int t,
             const std::vector<std::string>& color_files,
             const std::vector<std::string>& depth_files,
-            const camera::PinholeCameraIntrinsic& intrinsic) {
+            const camera::PinholeCameraIntrinsic& intrinsic,
+            const std::vector<PointCloudFeatures>& keyframes) {
+        uint64_t key = HashString("rgbd_pair");
+        key = HashFiles(key, {color_files[s], depth_files[s], color_files[t],
+                              depth_files[t]});
+        key = HashIntrinsic(key, intrinsic);
+        key = HashConfig(key, {"depth_scale", "depth_max", "depth_diff_max"});
+        if (abs(s - t) != 1) {
+            key = HashConfig(key, {"voxel_size", "global_registration"});
+        }
+        bool success;
+        Eigen::Matrix4d trans;
+        Eigen::Matrix6d info;
+        if (cache_.LoadRegistration("rgbd_pair", key, success, trans, info)) {
+            return std::make_tuple(success, trans, info);
+        }
+
         const geometry::RGBDImage source_rgbd_image =
                 ReadRGBDImage(color_files[s], depth_files[s], true);
         const geometry::RGBDImage target_rgbd_image =
                 ReadRGBDImage(color_files[t], depth_files[t], true);
 
+        std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> result;
         if (abs(s - t) != 1) {
-            Eigen::Matrix4d odo_init = PoseEstimation(
-                    source_rgbd_image, target_rgbd_image, intrinsic);
+            Eigen::Matrix4d odo_init =
+                    PoseEstimation(keyframes.at(s), keyframes.at(t));
             if (!odo_init.isIdentity(1e-8)) {
-                return ComputeOdometry(source_rgbd_image, target_rgbd_image,
-                                       odo_init, intrinsic);
+                result = ComputeOdometry(source_rgbd_image, target_rgbd_image,
+                                         odo_init, intrinsic);
             } else {
-                return std::make_tuple(false, Eigen::Matrix4d::Identity(),
-                                       Eigen::Matrix6d::Identity());
+                result = std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                                         Eigen::Matrix6d::Identity());
             }
         } else {
-            return ComputeOdometry(source_rgbd_image, target_rgbd_image,
-                                   Eigen::Matrix4d::Identity(), intrinsic);
+            result = ComputeOdometry(source_rgbd_image, target_rgbd_image,
+                                     Eigen::Matrix4d::Identity(), intrinsic);
         }
+        cache_.StoreRegistration("rgbd_pair", key, std::get<0>(result),
+                                 std::get<1>(result), std::get<2>(result));
+        return result;
     }
 
     void RegisterFragmentPair(const std::vector<std::string>& pcd_files,
+                              const std::vector<PointCloudFeatures>& fragments,
                               int s,
                               int t,
                               MatchingResult& matched_result) {
-        geometry::PointCloud source_pcd, target_pcd;
-        io::ReadPointCloud(pcd_files[s], source_pcd);
-        io::ReadPointCloud(pcd_files[t], target_pcd);
         const double voxel_size = config_["voxel_size"].asDouble();
+        const std::string fragment_pose_graph_file =
+                utility::filesystem::JoinPath(
+                        config_["path_dataset"].asString(),
+                        config_["template_fragment_posegraph_optimized"]
+                                        .asString() +
+                                "fragment_optimized_" + PadZeroToNumber(s, 3) +
+                                ".json");
+
+        uint64_t key = HashString("fragment_pair");
+        key = HashBytes(&fragments[s].hash_, sizeof(uint64_t), key);
+        key = HashBytes(&fragments[t].hash_, sizeof(uint64_t), key);
+        key = HashConfig(key, {"voxel_size"});
+        if (s + 1 == t) {
+            key = HashFiles(key, {fragment_pose_graph_file});
+            key = HashConfig(key, {"icp_method"});
+        } else {
+            key = HashConfig(key, {"global_registration"});
+        }
+        if (cache_.LoadRegistration("fragment_pair", key,
+                                    matched_result.success_,
+                                    matched_result.transformation_,
+                                    matched_result.information_)) {
+            return;
+        }
 
-        // Preprocessing the fragments point clouds.
-        geometry::PointCloud source_pcd_down, target_pcd_down;
-        pipelines::registration::Feature source_features, target_features;
-        std::tie(source_pcd_down, source_features) =
-                PreProcessPointCloud(source_pcd, voxel_size);
-        std::tie(target_pcd_down, target_features) =
-                PreProcessPointCloud(target_pcd, voxel_size);
+        const geometry::PointCloud& source_pcd_down = fragments[s].pcd_down_;
+        const geometry::PointCloud& target_pcd_down = fragments[t].pcd_down_;
+        const pipelines::registration::Feature& source_features =
+                fragments[s].features_;
+        const pipelines::registration::Feature& target_features =
+                fragments[t].features_;
 
         Eigen::Matrix4d pose;
         Eigen::Matrix6d info;
@@ -849,14 +1031,7 @@ private:
         if (s + 1 == t) {
             utility::LogInfo("Fragment odometry {} and {}", s, t);
             pipelines::registration::PoseGraph pose_graph_frag;
-            io::ReadPoseGraph(
-                    utility::filesystem::JoinPath(
-                            config_["path_dataset"].asString(),
-                            config_["template_fragment_posegraph_optimized"]
-                                            .asString() +
-                                    "fragment_optimized_" +
-                                    PadZeroToNumber(s, 3) + ".json"),
-                    pose_graph_frag);
+            io::ReadPoseGraph(fragment_pose_graph_file, pose_graph_frag);
             const int n_nodes = pose_graph_frag.nodes_.size();
             const Eigen::Matrix4d init_trans =
                     pose_graph_frag.nodes_[n_nodes - 1].pose_.inverse();
@@ -890,9 +1065,64 @@ private:
             }
         }
 
+        cache_.StoreRegistration("fragment_pair", key, matched_result.success_,
+                                 matched_result.transformation_,
+                                 matched_result.information_);
+
         if (config_["debug_mode"].asBool()) {
-            DrawRegistrationResult(source_pcd, target_pcd, pose);
+            geometry::PointCloud source_pcd, target_pcd;
+            io::ReadPointCloud(pcd_files[s], source_pcd);
+            io::ReadPointCloud(pcd_files[t], target_pcd);
+            DrawRegistrationResult(source_pcd, target_pcd,
+                                   matched_result.transformation_);
+        }
+    }
+
+    /// Returns the downsampled point cloud and features of a fragment.
+    PointCloudFeatures PreProcessFragment(const std::string& ply_file) {
+        PointCloudFeatures fragment;
+        fragment.hash_ = HashFiles(HashString("fragment"), {ply_file});
+        const uint64_t key = HashConfig(fragment.hash_, {"voxel_size"});
+        if (!cache_.LoadPointCloudAndFeature("fragment", key,
+                                             fragment.pcd_down_,
+                                             fragment.features_)) {
+            geometry::PointCloud pcd;
+            io::ReadPointCloud(ply_file, pcd);
+            std::tie(fragment.pcd_down_, fragment.features_) =
+                    PreProcessPointCloud(pcd, config_["voxel_size"].asDouble());
+            cache_.StorePointCloudAndFeature("fragment", key,
+                                             fragment.pcd_down_,
+                                             fragment.features_);
+        }
+        return fragment;
+    }
+
+    /// Returns the downsampled point cloud and features of a keyframe, used
+    /// to initialize loop closures.
+    PointCloudFeatures PreProcessFrame(
+            int i,
+            const std::vector<std::string>& color_files,
+            const std::vector<std::string>& depth_files,
+            const camera::PinholeCameraIntrinsic& intrinsic) {
+        PointCloudFeatures frame;
+        frame.hash_ = HashFiles(HashString("frame"),
+                                {color_files[i], depth_files[i]});
+        uint64_t key = HashIntrinsic(frame.hash_, intrinsic);
+        key = HashConfig(key, {"depth_scale", "depth_max", "voxel_size"});
+        if (!cache_.LoadPointCloudAndFeature("frame", key, frame.pcd_down_,
+                                             frame.features_)) {
+            const geometry::RGBDImage rgbd =
+                    ReadRGBDImage(color_files[i], depth_files[i], true);
+            const auto pcd = geometry::PointCloud::CreateFromRGBDImage(
+                    rgbd, intrinsic, Eigen::Matrix4d::Identity(), true);
+            // Increase the voxel size to accelerate the point cloud FPFH
+            // features extraction.
+            std::tie(frame.pcd_down_, frame.features_) = PreProcessPointCloud(
+                    *pcd, config_["voxel_size"].asDouble() * 1.5);
+            cache_.StorePointCloudAndFeature("frame", key, frame.pcd_down_,
+                                             frame.features_);
         }
+        return frame;
     }
 
     std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d>
@@ -934,31 +1164,14 @@ private:
         return std::make_tuple(*pcd_down, *fpfh);
     }
 
-    Eigen::Matrix4d PoseEstimation(
-            const geometry::RGBDImage& src,
-            const geometry::RGBDImage& dst,
-            const camera::PinholeCameraIntrinsic& intrinsic) {
-        const auto src_pcd = geometry::PointCloud::CreateFromRGBDImage(
-                src, intrinsic, Eigen::Matrix4d::Identity(), true);
-        const auto dst_pcd = geometry::PointCloud::CreateFromRGBDImage(
-                dst, intrinsic, Eigen::Matrix4d::Identity(), true);
-
-        geometry::PointCloud src_pcd_down, dst_pcd_down;
-        pipelines::registration::Feature src_features, dst_features;
-
-        // Increase the voxel size to accelerate the point cloud FPFH features
-        // extraction.
-        std::tie(src_pcd_down, src_features) = PreProcessPointCloud(
-                *src_pcd, config_["voxel_size"].asDouble() * 1.5);
-        std::tie(dst_pcd_down, dst_features) = PreProcessPointCloud(
-                *dst_pcd, config_["voxel_size"].asDouble() * 1.5);
-
+    Eigen::Matrix4d PoseEstimation(const PointCloudFeatures& src,
+                                   const PointCloudFeatures& dst) {
         const double distance_threshold =
                 config_["voxel_size"].asDouble() * 1.4;
 
-        const auto registration =
-                GlobalRegistration(src_pcd_down, dst_pcd_down, src_features,
-                                   dst_features, distance_threshold);
+        const auto registration = GlobalRegistration(
+                src.pcd_down_, dst.pcd_down_, src.features_, dst.features_,
+                distance_threshold);
         return std::get<1>(registration);
     }
 
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace open3d {
+namespace apps {
+namespace offline_reconstruction {
+
+/// \class TaskGraph
+/// \brief Runs tasks with dependencies on a bounded number of threads.
+///
+/// A task starts once all the tasks it depends on have finished. After a task
+/// throws, no new tasks are started and the exception is rethrown by Run().
+class TaskGraph {
+public:
+    using TaskId = size_t;
+
+    /// \brief Adds a task.
+    ///
+    /// \param task Function to run.
+    /// \param dependencies Tasks that must finish before \p task starts.
+    /// \return Id of the task.
+    TaskId AddTask(std::function<void()> task,
+                   const std::vector<TaskId>& dependencies = {}) {
+        const TaskId id = tasks_.size();
+        tasks_.push_back({std::move(task), {}, int(dependencies.size())});
+        for (const TaskId dependency : dependencies) {
+            tasks_.at(dependency).dependents_.push_back(id);
+        }
+        return id;
+    }
+
+    /// \brief Runs all tasks and returns when they have finished.
+    ///
+    /// \param num_threads Maximum number of tasks running at the same time,
+    /// including the calling thread.
+    void Run(int num_threads) {
+        const size_t num_tasks = tasks_.size();
+        std::mutex mutex;
+        std::condition_variable task_finished;
+        std::deque<TaskId> ready;
+        std::vector<int> num_pending(num_tasks);
+        size_t num_finished = 0;
+        std::exception_ptr error;
+        for (TaskId id = 0; id < num_tasks; ++id) {
+            num_pending[id] = tasks_[id].num_dependencies_;
+            if (num_pending[id] == 0) ready.push_back(id);
+        }
+
+        auto worker = [&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                task_finished.wait(lock, [&] {
+                    return error || num_finished == num_tasks ||
+                           !ready.empty();
+                });
+                if (error || num_finished == num_tasks) return;
+                const TaskId id = ready.front();
+                ready.pop_front();
+
+                lock.unlock();
+                std::exception_ptr task_error;
+                try {
+                    tasks_[id].task_();
+                } catch (...) {
+                    task_error = std::current_exception();
+                }
+                lock.lock();
+
+                if (task_error) {
+                    if (!error) error = task_error;
+                } else {
+                    for (const TaskId dependent : tasks_[id].dependents_) {
+                        if (--num_pending[dependent] == 0) {
+                            ready.push_back(dependent);
+                        }
+                    }
+                }
+                ++num_finished;
+                task_finished.notify_all();
+            }
+        };
+
+        const size_t num_workers = std::max<size_t>(
+                1, std::min<size_t>(std::max(num_threads, 1), num_tasks));
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < num_workers; ++i) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        tasks_.clear();
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    struct Task {
+        std::function<void()> task_;
+        std::vector<TaskId> dependents_;
+        int num_dependencies_;
+    };
+
+    std::vector<Task> tasks_;
+};
+
+}  // namespace offline_reconstruction
+}  // namespace apps
+}  // namespace open3d
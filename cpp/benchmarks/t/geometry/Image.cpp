@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Image.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/t/geometry/kernel/Image.h"
+#include "open3d/t/io/ImageIO.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// Default dispatches through Image, i.e. IPP when Open3D is built with it.
+// Native calls the portable CPU kernels directly.
+enum class ImageBackend { Default, Native };
+
+static Image LoadImage(core::Dtype dtype) {
+    data::SampleRedwoodRGBDImages redwood_data;
+    if (dtype == core::UInt8) {
+        return *t::io::CreateImageFromFile(redwood_data.GetColorPaths()[0]);
+    }
+    Image depth = *t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[0]);
+    return dtype == core::UInt16 ? depth : depth.To(dtype, false, 1e-3);
+}
+
+static bool SkipUnavailable(benchmark::State& state, ImageBackend backend) {
+    if (backend == ImageBackend::Default && !Image::HAVE_IPPICV) {
+        state.SkipWithError("Open3D is built without IPP.");
+        return true;
+    }
+    return false;
+}
+
+static void FilterGaussian(benchmark::State& state,
+                           ImageBackend backend,
+                           core::Dtype dtype) {
+    if (SkipUnavailable(state, backend)) return;
+    Image im = LoadImage(dtype);
+    core::Tensor dst = core::Tensor::EmptyLike(im.AsTensor());
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            kernel::image::FilterGaussianCPU(im.AsTensor(), dst, 5, 1.0f);
+        } else {
+            im.FilterGaussian(5, 1.0f);
+        }
+    }
+}
+
+static void FilterBilateral(benchmark::State& state,
+                            ImageBackend backend,
+                            core::Dtype dtype) {
+    if (SkipUnavailable(state, backend)) return;
+    Image im = LoadImage(dtype);
+    core::Tensor dst = core::Tensor::EmptyLike(im.AsTensor());
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            kernel::image::FilterBilateralCPU(im.AsTensor(), dst, 5, 20.0f,
+                                              10.0f);
+        } else {
+            im.FilterBilateral(5, 20.0f, 10.0f);
+        }
+    }
+}
+
+static void Filter(benchmark::State& state,
+                   ImageBackend backend,
+                   core::Dtype dtype) {
+    if (SkipUnavailable(state, backend)) return;
+    Image im = LoadImage(dtype);
+    core::Tensor kernel = core::Tensor::Ones({5, 5}, core::Float32) / 25;
+    core::Tensor dst = core::Tensor::EmptyLike(im.AsTensor());
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            kernel::image::FilterCPU(im.AsTensor(), dst, kernel);
+        } else {
+            im.Filter(kernel);
+        }
+    }
+}
+
+static void FilterSobel(benchmark::State& state,
+                        ImageBackend backend,
+                        core::Dtype dtype) {
+    if (SkipUnavailable(state, backend)) return;
+    Image im = LoadImage(dtype);
+    if (dtype == core::UInt8) {
+        im = im.RGBToGray();
+    }
+    core::Dtype dst_dtype = dtype == core::UInt8 ? core::Int16 : dtype;
+    core::Tensor dx = core::Tensor::Empty(im.AsTensor().GetShape(), dst_dtype);
+    core::Tensor dy = core::Tensor::Empty(im.AsTensor().GetShape(), dst_dtype);
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            kernel::image::FilterSobelCPU(im.AsTensor(), dx, dy, 3);
+        } else {
+            im.FilterSobel(3);
+        }
+    }
+}
+
+static void Dilate(benchmark::State& state,
+                   ImageBackend backend,
+                   core::Dtype dtype) {
+    if (SkipUnavailable(state, backend)) return;
+    Image im = LoadImage(dtype);
+    core::Tensor dst = core::Tensor::EmptyLike(im.AsTensor());
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            kernel::image::DilateCPU(im.AsTensor(), dst, 5);
+        } else {
+            im.Dilate(5);
+        }
+    }
+}
+
+static void Resize(benchmark::State& state,
+                   ImageBackend backend,
+                   core::Dtype dtype,
+                   Image::InterpType interp_type) {
+    if (SkipUnavailable(state, backend)) return;
+    Image im = LoadImage(dtype);
+    core::Tensor dst = core::Tensor::Empty(
+            {im.GetRows() / 2, im.GetCols() / 2, im.GetChannels()}, dtype);
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            kernel::image::ResizeCPU(im.AsTensor(), dst, interp_type);
+        } else {
+            im.Resize(0.5f, interp_type);
+        }
+    }
+}
+
+#define ENUM_BM_BACKEND(FN, NAME, DTYPE, ...)                             \
+    BENCHMARK_CAPTURE(FN, IPP_##NAME, ImageBackend::Default, core::DTYPE, \
+                      ##__VA_ARGS__)                                      \
+            ->Unit(benchmark::kMillisecond);                              \
+    BENCHMARK_CAPTURE(FN, Native_##NAME, ImageBackend::Native,            \
+                      core::DTYPE, ##__VA_ARGS__)                         \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_BACKEND(FilterGaussian, UInt8, UInt8)
+ENUM_BM_BACKEND(FilterGaussian, UInt16, UInt16)
+ENUM_BM_BACKEND(FilterGaussian, Float32, Float32)
+ENUM_BM_BACKEND(FilterBilateral, UInt8, UInt8)
+ENUM_BM_BACKEND(FilterBilateral, Float32, Float32)
+ENUM_BM_BACKEND(Filter, UInt8, UInt8)
+ENUM_BM_BACKEND(Filter, UInt16, UInt16)
+ENUM_BM_BACKEND(Filter, Float32, Float32)
+ENUM_BM_BACKEND(FilterSobel, UInt8, UInt8)
+ENUM_BM_BACKEND(FilterSobel, Float32, Float32)
+ENUM_BM_BACKEND(Dilate, UInt8, UInt8)
+ENUM_BM_BACKEND(Dilate, Float32, Float32)
+ENUM_BM_BACKEND(Resize, Linear_UInt8, UInt8, Image::InterpType::Linear)
+ENUM_BM_BACKEND(Resize, Linear_Float32, Float32, Image::InterpType::Linear)
+ENUM_BM_BACKEND(Resize, Super_UInt8, UInt8, Image::InterpType::Super)
+ENUM_BM_BACKEND(Resize, Super_Float32, Float32, Image::InterpType::Super)
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -110,6 +110,30 @@ void UniformDownSample(benchmark::State& state,
     }
 }
 
+void LegacyFarthestPointDownSample(benchmark::State& state,
+                                   size_t num_samples) {
+    auto pcd = open3d::io::CreatePointCloudFromFile(path);
+    for (auto _ : state) {
+        pcd->FarthestPointDownSample(num_samples);
+    }
+}
+
+void FarthestPointDownSample(benchmark::State& state,
+                             const core::Device& device,
+                             size_t num_samples) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warm up.
+    pcd.FarthestPointDownSample(num_samples);
+
+    for (auto _ : state) {
+        pcd.FarthestPointDownSample(num_samples);
+        core::cuda::Synchronize(device);
+    }
+}
+
 void LegacyTransform(benchmark::State& state, const int no_use) {
     open3d::geometry::PointCloud pcd;
     open3d::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
@@ -307,6 +331,65 @@ void LegacyRemoveRadiusOutliers(benchmark::State& state,
     }
 }
 
+void ClusterDBSCAN(benchmark::State& state,
+                   const core::Device& device,
+                   const double eps,
+                   const size_t min_points) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+
+    pcd = pcd.To(device).VoxelDownSample(0.01);
+
+    // Warm up.
+    pcd.ClusterDBSCAN(eps, min_points);
+    for (auto _ : state) {
+        pcd.ClusterDBSCAN(eps, min_points);
+    }
+}
+
+void SegmentPlane(benchmark::State& state,
+                  const core::Device& device,
+                  const int num_iterations) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+
+    pcd = pcd.To(device).VoxelDownSample(0.01);
+
+    // Warm up.
+    pcd.SegmentPlane(0.01, 3, num_iterations);
+    for (auto _ : state) {
+        pcd.SegmentPlane(0.01, 3, num_iterations);
+    }
+}
+
+void LegacyClusterDBSCAN(benchmark::State& state,
+                         const double eps,
+                         const size_t min_points) {
+    open3d::geometry::PointCloud pcd;
+    open3d::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+
+    auto pcd_down = pcd.VoxelDownSample(0.01);
+
+    // Warm up.
+    pcd_down->ClusterDBSCAN(eps, min_points);
+    for (auto _ : state) {
+        pcd_down->ClusterDBSCAN(eps, min_points);
+    }
+}
+
+void LegacySegmentPlane(benchmark::State& state, const int num_iterations) {
+    open3d::geometry::PointCloud pcd;
+    open3d::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+
+    auto pcd_down = pcd.VoxelDownSample(0.01);
+
+    // Warm up.
+    pcd_down->SegmentPlane(0.01, 3, num_iterations);
+    for (auto _ : state) {
+        pcd_down->SegmentPlane(0.01, 3, num_iterations);
+    }
+}
+
 void CropByAxisAlignedBox(benchmark::State& state, const core::Device& device) {
     t::geometry::PointCloud pcd;
     t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
@@ -408,13 +491,19 @@ BENCHMARK_CAPTURE(ToLegacyPointCloud, CUDA, core::Device("CUDA:0"))
             ->Unit(benchmark::kMillisecond);
 
 const std::string kReductionMean = "mean";
+const std::string kReductionFirst = "first";
+const std::string kReductionCenter = "center";
 #ifdef BUILD_CUDA_MODULE
-#define ENUM_VOXELDOWNSAMPLE_REDUCTION()                  \
-    ENUM_VOXELSIZE(core::Device("CPU:0"), kReductionMean) \
+#define ENUM_VOXELDOWNSAMPLE_REDUCTION()                    \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), kReductionMean)   \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), kReductionFirst)  \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), kReductionCenter) \
     ENUM_VOXELSIZE(core::Device("CUDA:0"), kReductionMean)
 #else
-#define ENUM_VOXELDOWNSAMPLE_REDUCTION() \
-    ENUM_VOXELSIZE(core::Device("CPU:0"), kReductionMean)
+#define ENUM_VOXELDOWNSAMPLE_REDUCTION()                    \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), kReductionMean)   \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), kReductionFirst)  \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), kReductionCenter)
 #endif
 
 BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_01, 0.01)
@@ -444,6 +533,14 @@ BENCHMARK_CAPTURE(UniformDownSample, CPU_5, core::Device("CPU:0"), 5)
 BENCHMARK_CAPTURE(UniformDownSample, CPU_10, core::Device("CPU:0"), 10)
         ->Unit(benchmark::kMillisecond);
 
+BENCHMARK_CAPTURE(LegacyFarthestPointDownSample, Legacy_1024, 1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FarthestPointDownSample,
+                  CPU_1024,
+                  core::Device("CPU:0"),
+                  1024)
+        ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_CAPTURE(Transform, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
@@ -599,6 +696,11 @@ BENCHMARK_CAPTURE(
         ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(RemoveStatisticalOutliers, CPU[30], core::Device("CPU:0"), 30)
         ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(
+        ClusterDBSCAN, CPU[0.02 | 10], core::Device("CPU:0"), 0.02, 10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentPlane, CPU[1000], core::Device("CPU:0"), 1000)
+        ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(CropByAxisAlignedBox, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(CropByOrientedBox, CPU, core::Device("CPU:0"))
@@ -621,6 +723,9 @@ BENCHMARK_CAPTURE(ComputeBoundaryPoints,
 BENCHMARK_CAPTURE(
         RemoveRadiusOutliers, CUDA[50 | 0.05], core::Device("CUDA:0"), 50, 0.03)
         ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(
+        ClusterDBSCAN, CUDA[0.02 | 10], core::Device("CUDA:0"), 0.02, 10)
+        ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(CropByAxisAlignedBox, CUDA, core::Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(CropByOrientedBox, CUDA, core::Device("CUDA:0"))
@@ -650,6 +755,10 @@ BENCHMARK_CAPTURE(LegacyRemoveRadiusOutliers, Legacy[50 | 0.05], 50, 0.03)
         ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(LegacyRemoveStatisticalOutliers, Legacy[30], 30)
         ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LegacyClusterDBSCAN, Legacy[0.02 | 10], 0.02, 10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LegacySegmentPlane, Legacy[1000], 1000)
+        ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(LegacyCropByAxisAlignedBox, Legacy, 1)
         ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(LegacyCropByOrientedBox, Legacy, 1)
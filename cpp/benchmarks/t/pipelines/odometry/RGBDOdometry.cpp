@@ -36,10 +36,6 @@ static core::Tensor CreateIntrisicTensor() {
 
 static void ComputeOdometryResultPointToPlane(benchmark::State& state,
                                               const core::Device& device) {
-    if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-        return;
-    }
-
     const float depth_scale = 1000.0;
     const float depth_diff = 0.07;
     const float depth_max = 3.0;
@@ -97,10 +93,6 @@ static void RGBDOdometryMultiScale(
         benchmark::State& state,
         const core::Device& device,
         const t::pipelines::odometry::Method& method) {
-    if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-        return;
-    }
-
     const float depth_scale = 1000.0;
     const float depth_max = 3.0;
     const float depth_diff = 0.07;
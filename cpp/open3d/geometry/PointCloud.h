@@ -362,6 +362,29 @@ public:
             const int num_iterations = 100,
             const double probability = 0.99999999) const;
 
+    /// \brief Segment several planes one after another using the RANSAC
+    /// algorithm.
+    ///
+    /// After each plane is found its inliers are removed and the next plane is
+    /// segmented from the remaining points, without copying the point cloud.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param max_num_planes Maximum number of planes to segment.
+    /// \param min_num_inliers Stop once the best plane has fewer inliers.
+    /// \return Returns the plane models ax + by + cz + d = 0 and the indices of
+    /// the plane inliers in the order the planes were segmented.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const double probability = 0.99999999,
+                  const int max_num_planes = 10,
+                  const size_t min_num_inliers = 100) const;
+
     /// \brief Robustly detect planar patches in the point cloud using.
     /// Araújo and Oliveira, “A robust statistics approach for plane
     /// detection in unorganized point clouds,” Pattern Recognition, 2020.
@@ -5,6 +5,8 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include "open3d/geometry/PointCloudSegmentation.h"
+
 #include <Eigen/Dense>
 #include <algorithm>
 #include <iostream>
@@ -15,6 +17,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Random.h"
 
 namespace open3d {
@@ -65,57 +68,29 @@ public:
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total squared point-to-plane distance.
-// These numbers are then used to evaluate how well the plane model fits the
-// given points.
-RANSACResult EvaluateRANSACBasedOnDistance(
-        const std::vector<Eigen::Vector3d> &points,
-        const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold) {
-    RANSACResult result;
-
-    double error = 0;
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
-
-        if (distance < distance_threshold) {
-            error += distance * distance;
-            inliers.emplace_back(idx);
-        }
-    }
-
-    size_t inlier_num = inliers.size();
-    if (inlier_num == 0) {
-        result.fitness_ = 0;
-        result.inlier_rmse_ = 0;
-    } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
-        result.inlier_rmse_ = std::sqrt(error / (double)inlier_num);
-    }
-    return result;
-}
 
 // Find the plane such that the summed squared distance from the
 // plane to all points is minimized.
 //
 // Reference:
 // https://www.ilikebigbits.com/2015_03_04_plane_from_points.html
-Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
-                                   const std::vector<size_t> &inliers) {
+template <typename scalar_t>
+static Eigen::Vector4d GetPlaneFromPoints(const scalar_t *points,
+                                          const std::vector<size_t> &inliers) {
     Eigen::Vector3d centroid(0, 0, 0);
     for (size_t idx : inliers) {
-        centroid += points[idx];
+        centroid += Eigen::Vector3d(points[3 * idx], points[3 * idx + 1],
+                                    points[3 * idx + 2]);
     }
     centroid /= double(inliers.size());
 
     double xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
 
     for (size_t idx : inliers) {
-        Eigen::Vector3d r = points[idx] - centroid;
+        Eigen::Vector3d r = Eigen::Vector3d(points[3 * idx],
+                                            points[3 * idx + 1],
+                                            points[3 * idx + 2]) -
+                            centroid;
         xx += r(0) * r(0);
         xy += r(0) * r(1);
         xz += r(0) * r(2);
@@ -147,117 +122,398 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */,
-        const double probability /* = 0.99999999 */) const {
-    if (probability <= 0 || probability > 1) {
-        utility::LogError("Probability must be > 0 and <= 1.0");
+/// \class PlaneRANSAC
+///
+/// \brief Batched RANSAC plane fitting on a subset of the points of a point
+/// cloud.
+///
+/// The points are read from a raw buffer of N x 3 coordinates, so that the
+/// legacy and the tensor point clouds share this kernel without converting
+/// their positions. The coordinates of the active points are stored as
+/// structure of arrays, so that a batch of plane hypotheses is scored in a
+/// single pass over the points with a branch-free inner loop the compiler can
+/// vectorize. The points are split into a fixed number of chunks that are
+/// scored in parallel and summed in a fixed order, which keeps the result
+/// independent of the number of threads. Points of segmented planes can be
+/// removed to extract several planes one after another.
+template <typename scalar_t>
+class PlaneRANSAC {
+public:
+    PlaneRANSAC(const scalar_t *points, size_t num_points) : points_(points) {
+        x_.resize(num_points);
+        y_.resize(num_points);
+        z_.resize(num_points);
+        indices_.resize(num_points);
+        for (size_t idx = 0; idx < num_points; ++idx) {
+            x_[idx] = points[3 * idx];
+            y_[idx] = points[3 * idx + 1];
+            z_[idx] = points[3 * idx + 2];
+            indices_[idx] = idx;
+        }
     }
 
-    RANSACResult result;
+    /// Number of active points.
+    size_t Size() const { return indices_.size(); }
+
+    /// Segments the plane with the most inliers among the active points.
+    /// Returns the plane model and the positions of the inliers in the active
+    /// points.
+    std::tuple<Eigen::Vector4d, std::vector<size_t>> Run(
+            double distance_threshold,
+            int ransac_n,
+            int num_iterations,
+            double probability) {
+        const size_t num_points = Size();
+        RandomSampler<size_t> sampler(num_points);
+        // Pre-generate all random samples, the batches are scored in parallel
+        std::vector<std::vector<size_t>> all_sampled_indices;
+        all_sampled_indices.reserve(num_iterations);
+        for (int i = 0; i < num_iterations; i++) {
+            all_sampled_indices.push_back(sampler(ransac_n));
+        }
+
+        RANSACResult result;
+        Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+
+        // Use size_t here to avoid large integer which acceed max of int.
+        size_t break_iteration = std::numeric_limits<size_t>::max();
+        int iteration_count = 0;
+
+        std::vector<Eigen::Vector4d> plane_models;
+        std::vector<RANSACResult> results;
+        while (iteration_count < num_iterations &&
+               (size_t)iteration_count <= break_iteration) {
+            // Fit models to ransac_n randomly selected points for a batch of
+            // iterations.
+            plane_models.clear();
+            const int batch_end =
+                    std::min(iteration_count + kBatchSize, num_iterations);
+            for (; iteration_count < batch_end &&
+                   (size_t)iteration_count <= break_iteration;
+                 ++iteration_count) {
+                const Eigen::Vector4d plane_model = FitPlane(
+                        all_sampled_indices[iteration_count], ransac_n);
+                if (!plane_model.isZero(0)) {
+                    plane_models.push_back(plane_model);
+                }
+            }
+            Evaluate(plane_models, distance_threshold, results);
+
+            int best_in_batch = -1;
+            for (int pidx = 0; pidx < int(plane_models.size()); ++pidx) {
+                if (IsBetter(results[pidx], result)) {
+                    result = results[pidx];
+                    best_in_batch = pidx;
+                }
+            }
+            if (best_in_batch < 0) {
+                continue;
+            }
+            best_plane_model = plane_models[best_in_batch];
+
+            // Local optimization: refit the new best model to all of its
+            // inliers and keep the refined model if it explains the points
+            // better.
+            const Eigen::Vector4d refined_model = GetPlaneFromPoints(
+                    points_,
+                    ToPointIndices(FindInliers(best_plane_model,
+                                               distance_threshold)));
+            if (!refined_model.isZero(0)) {
+                Evaluate({refined_model}, distance_threshold, results);
+                if (IsBetter(results[0], result)) {
+                    result = results[0];
+                    best_plane_model = refined_model;
+                }
+            }
 
-    // Initialize the best plane model.
-    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+            if (result.fitness_ < 1.0) {
+                break_iteration = std::min(
+                        log(1 - probability) /
+                                log(1 - pow(result.fitness_, ransac_n)),
+                        (double)num_iterations);
+            } else {
+                // Set break_iteration to 0 to force to break the loop.
+                break_iteration = 0;
+            }
+        }
 
-    size_t num_points = points_.size();
-    RandomSampler<size_t> sampler(num_points);
-    // Pre-generate all random samples before entering the parallel region
-    std::vector<std::vector<size_t>> all_sampled_indices;
-    all_sampled_indices.reserve(num_iterations);
-    for (int i = 0; i < num_iterations; i++) {
-        all_sampled_indices.push_back(sampler(ransac_n));
-    }
+        // Find the final inliers using best_plane_model.
+        std::vector<size_t> final_inliers;
+        if (!best_plane_model.isZero(0)) {
+            final_inliers = FindInliers(best_plane_model, distance_threshold);
+        }
 
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(Eigen::Vector4d(0, 0, 0, 0),
-                               std::vector<size_t>{});
-    }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(Eigen::Vector4d(0, 0, 0, 0),
-                               std::vector<size_t>{});
+        // Improve best_plane_model using the final inliers.
+        best_plane_model =
+                GetPlaneFromPoints(points_, ToPointIndices(final_inliers));
+
+        utility::LogDebug(
+                "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, "
+                "Iteration: {:d}",
+                final_inliers.size(), result.fitness_, result.inlier_rmse_,
+                iteration_count);
+        return std::make_tuple(best_plane_model, final_inliers);
     }
 
-    // Use size_t here to avoid large integer which acceed max of int.
-    size_t break_iteration = std::numeric_limits<size_t>::max();
-    int iteration_count = 0;
+    /// Maps positions in the active points to indices of the point cloud.
+    std::vector<size_t> ToPointIndices(
+            const std::vector<size_t> &positions) const {
+        std::vector<size_t> point_indices(positions.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            point_indices[i] = indices_[positions[i]];
+        }
+        return point_indices;
+    }
 
-#pragma omp parallel for schedule(static)
-    for (int itr = 0; itr < num_iterations; itr++) {
-        if ((size_t)iteration_count > break_iteration) {
-            continue;
+    /// Removes the active points at the sorted \p positions.
+    void Remove(const std::vector<size_t> &positions) {
+        size_t to_idx = 0;
+        size_t next = 0;
+        for (size_t idx = 0; idx < Size(); ++idx) {
+            if (next < positions.size() && positions[next] == idx) {
+                ++next;
+                continue;
+            }
+            x_[to_idx] = x_[idx];
+            y_[to_idx] = y_[idx];
+            z_[to_idx] = z_[idx];
+            indices_[to_idx] = indices_[idx];
+            ++to_idx;
         }
+        x_.resize(to_idx);
+        y_.resize(to_idx);
+        z_.resize(to_idx);
+        indices_.resize(to_idx);
+    }
 
-        // Access the pre-generated sampled indices
-        std::vector<size_t> inliers = all_sampled_indices[itr];
+private:
+    static bool IsBetter(const RANSACResult &result,
+                         const RANSACResult &best) {
+        return result.fitness_ > best.fitness_ ||
+               (result.fitness_ == best.fitness_ &&
+                result.inlier_rmse_ < best.inlier_rmse_);
+    }
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        Eigen::Vector4d plane_model;
+    Eigen::Vector3d GetPoint(size_t idx) const {
+        return Eigen::Vector3d(points_[3 * idx], points_[3 * idx + 1],
+                               points_[3 * idx + 2]);
+    }
+
+    Eigen::Vector4d FitPlane(const std::vector<size_t> &sample,
+                             int ransac_n) const {
+        const std::vector<size_t> point_indices = ToPointIndices(sample);
         if (ransac_n == 3) {
-            plane_model = TriangleMesh::ComputeTrianglePlane(
-                    points_[inliers[0]], points_[inliers[1]],
-                    points_[inliers[2]]);
-        } else {
-            plane_model = GetPlaneFromPoints(points_, inliers);
+            return TriangleMesh::ComputeTrianglePlane(
+                    GetPoint(point_indices[0]), GetPoint(point_indices[1]),
+                    GetPoint(point_indices[2]));
         }
+        return GetPlaneFromPoints(points_, point_indices);
+    }
 
-        if (plane_model.isZero(0)) {
-            continue;
+    /// Scores all \p plane_models in one pass over the active points.
+    void Evaluate(const std::vector<Eigen::Vector4d> &plane_models,
+                  double distance_threshold,
+                  std::vector<RANSACResult> &results) const {
+        const int num_models = int(plane_models.size());
+        const int64_t num_points = int64_t(Size());
+        const int64_t chunk_size =
+                std::max<int64_t>(1, (num_points + kNumChunks - 1) /
+                                             kNumChunks);
+        std::vector<int64_t> chunk_counts(kNumChunks * num_models, 0);
+        std::vector<double> chunk_errors(kNumChunks * num_models, 0);
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int chunk = 0; chunk < kNumChunks; ++chunk) {
+            const int64_t begin = chunk * chunk_size;
+            const int64_t end = std::min(num_points, begin + chunk_size);
+            for (int m = 0; m < num_models; ++m) {
+                const double a = plane_models[m](0);
+                const double b = plane_models[m](1);
+                const double c = plane_models[m](2);
+                const double d = plane_models[m](3);
+                int64_t count = 0;
+                double error = 0;
+                for (int64_t idx = begin; idx < end; ++idx) {
+                    const double distance =
+                            std::abs(a * x_[idx] + b * y_[idx] +
+                                     c * z_[idx] + d);
+                    const bool inlier = distance < distance_threshold;
+                    count += inlier;
+                    error += inlier ? distance * distance : 0.0;
+                }
+                chunk_counts[chunk * num_models + m] = count;
+                chunk_errors[chunk * num_models + m] = error;
+            }
         }
 
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold);
-#pragma omp critical
-        {
-            if (this_result.fitness_ > result.fitness_ ||
-                (this_result.fitness_ == result.fitness_ &&
-                 this_result.inlier_rmse_ < result.inlier_rmse_)) {
-                result = this_result;
-                best_plane_model = plane_model;
-                if (result.fitness_ < 1.0) {
-                    break_iteration = std::min(
-                            log(1 - probability) /
-                                    log(1 - pow(result.fitness_, ransac_n)),
-                            (double)num_iterations);
-                } else {
-                    // Set break_iteration to 0 to force to break the loop.
-                    break_iteration = 0;
-                }
+        results.assign(num_models, RANSACResult());
+        for (int m = 0; m < num_models; ++m) {
+            int64_t inlier_num = 0;
+            double error = 0;
+            for (int chunk = 0; chunk < kNumChunks; ++chunk) {
+                inlier_num += chunk_counts[chunk * num_models + m];
+                error += chunk_errors[chunk * num_models + m];
+            }
+            if (inlier_num > 0) {
+                results[m].fitness_ = double(inlier_num) / double(num_points);
+                results[m].inlier_rmse_ = std::sqrt(error / double(inlier_num));
             }
-            iteration_count++;
         }
     }
 
-    // Find the final inliers using best_plane_model.
-    std::vector<size_t> final_inliers;
-    if (!best_plane_model.isZero(0)) {
-        for (size_t idx = 0; idx < points_.size(); ++idx) {
-            Eigen::Vector4d point(points_[idx](0), points_[idx](1),
-                                  points_[idx](2), 1);
-            double distance = std::abs(best_plane_model.dot(point));
-
+    /// Returns the positions of the active points closer than \p
+    /// distance_threshold to \p plane_model.
+    std::vector<size_t> FindInliers(const Eigen::Vector4d &plane_model,
+                                    double distance_threshold) const {
+        std::vector<size_t> inliers;
+        for (size_t idx = 0; idx < Size(); ++idx) {
+            const double distance =
+                    std::abs(plane_model(0) * x_[idx] +
+                             plane_model(1) * y_[idx] +
+                             plane_model(2) * z_[idx] + plane_model(3));
             if (distance < distance_threshold) {
-                final_inliers.emplace_back(idx);
+                inliers.emplace_back(idx);
             }
         }
+        return inliers;
+    }
+
+    /// Number of hypotheses scored together in one pass over the points.
+    static constexpr int kBatchSize = 8;
+    /// Number of chunks the points are split into for parallel scoring.
+    static constexpr int kNumChunks = 64;
+
+    /// N x 3 coordinates of all the points.
+    const scalar_t *points_;
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<double> z_;
+    /// Index into points_ for every active point.
+    std::vector<size_t> indices_;
+};
+
+static void CheckSegmentPlaneParameters(const int ransac_n,
+                                        const double probability,
+                                        const size_t num_points) {
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("Probability must be > 0 and <= 1.0");
+    }
+    // Return if ransac_n is less than the required plane model parameters.
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (num_points < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+}
+
+template <typename scalar_t>
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const scalar_t *points,
+        size_t num_points,
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability) {
+    CheckSegmentPlaneParameters(ransac_n, probability, num_points);
+
+    PlaneRANSAC<scalar_t> ransac(points, num_points);
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = ransac.Run(distance_threshold, ransac_n,
+                                                num_iterations, probability);
+    return std::make_tuple(plane_model, ransac.ToPointIndices(inliers));
+}
+
+template <typename scalar_t>
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+SegmentPlanesRANSAC(const scalar_t *points,
+                    size_t num_points,
+                    const double distance_threshold,
+                    const int ransac_n,
+                    const int num_iterations,
+                    const double probability,
+                    const int max_num_planes,
+                    const size_t min_num_inliers) {
+    CheckSegmentPlaneParameters(ransac_n, probability, num_points);
+
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    PlaneRANSAC<scalar_t> ransac(points, num_points);
+    while (int(planes.size()) < max_num_planes &&
+           ransac.Size() >= std::max(size_t(ransac_n), min_num_inliers)) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) = ransac.Run(
+                distance_threshold, ransac_n, num_iterations, probability);
+        if (inliers.size() < std::max<size_t>(min_num_inliers, 1)) {
+            break;
+        }
+        planes.emplace_back(plane_model, ransac.ToPointIndices(inliers));
+        ransac.Remove(inliers);
     }
+    utility::LogDebug("SegmentPlanes | {:d} planes, {:d} points remaining",
+                      planes.size(), ransac.Size());
+    return planes;
+}
 
-    // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, final_inliers);
+template std::tuple<Eigen::Vector4d, std::vector<size_t>>
+SegmentPlaneRANSAC<float>(const float *points,
+                          size_t num_points,
+                          double distance_threshold,
+                          int ransac_n,
+                          int num_iterations,
+                          double probability);
+template std::tuple<Eigen::Vector4d, std::vector<size_t>>
+SegmentPlaneRANSAC<double>(const double *points,
+                           size_t num_points,
+                           double distance_threshold,
+                           int ransac_n,
+                           int num_iterations,
+                           double probability);
+template std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+SegmentPlanesRANSAC<float>(const float *points,
+                           size_t num_points,
+                           double distance_threshold,
+                           int ransac_n,
+                           int num_iterations,
+                           double probability,
+                           int max_num_planes,
+                           size_t min_num_inliers);
+template std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+SegmentPlanesRANSAC<double>(const double *points,
+                            size_t num_points,
+                            double distance_threshold,
+                            int ransac_n,
+                            int num_iterations,
+                            double probability,
+                            int max_num_planes,
+                            size_t min_num_inliers);
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
+    // Eigen::Vector3d is not a vectorizable type, the points are stored as
+    // consecutive x, y, z coordinates.
+    return SegmentPlaneRANSAC(points_.empty() ? nullptr : points_[0].data(),
+                              points_.size(), distance_threshold, ransac_n,
+                              num_iterations, probability);
+}
 
-    utility::LogDebug(
-            "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, Iteration: "
-            "{:d}",
-            final_inliers.size(), result.fitness_, result.inlier_rmse_,
-            iteration_count);
-    return std::make_tuple(best_plane_model, final_inliers);
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const double probability /* = 0.99999999 */,
+                          const int max_num_planes /* = 10 */,
+                          const size_t min_num_inliers /* = 100 */) const {
+    return SegmentPlanesRANSAC(points_.empty() ? nullptr : points_[0].data(),
+                               points_.size(), distance_threshold, ransac_n,
+                               num_iterations, probability, max_num_planes,
+                               min_num_inliers);
 }
 
 }  // namespace geometry
@@ -0,0 +1,55 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <tuple>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \brief Segment a plane using the RANSAC algorithm on a raw point buffer.
+///
+/// Shared by the legacy and the tensor point clouds, see
+/// PointCloud::SegmentPlane for the parameters. Instantiated for float and
+/// double.
+/// \param points Point coordinates, stored as \p num_points consecutive
+/// x, y, z triplets on the CPU.
+/// \param num_points Number of points.
+template <typename scalar_t>
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const scalar_t *points,
+        size_t num_points,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability);
+
+/// \brief Segment several planes one after another using the RANSAC algorithm
+/// on a raw point buffer.
+///
+/// Shared by the legacy and the tensor point clouds, see
+/// PointCloud::SegmentPlanes for the parameters. Instantiated for float and
+/// double.
+/// \param points Point coordinates, stored as \p num_points consecutive
+/// x, y, z triplets on the CPU.
+/// \param num_points Number of points.
+template <typename scalar_t>
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+SegmentPlanesRANSAC(const scalar_t *points,
+                    size_t num_points,
+                    double distance_threshold,
+                    int ransac_n,
+                    int num_iterations,
+                    double probability,
+                    int max_num_planes,
+                    size_t min_num_inliers);
+
+}  // namespace geometry
+}  // namespace open3d
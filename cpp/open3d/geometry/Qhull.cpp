@@ -7,27 +7,160 @@
 
 #include "open3d/geometry/Qhull.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "libqhullcpp/PointCoordinates.h"
 #include "libqhullcpp/Qhull.h"
 #include "libqhullcpp/QhullFacet.h"
 #include "libqhullcpp/QhullFacetList.h"
+#include "libqhullcpp/QhullHyperplane.h"
 #include "libqhullcpp/QhullVertexSet.h"
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+/// Inputs with fewer points are passed to Qhull directly, culling does not
+/// pay off for them.
+static constexpr size_t kConvexHullCullingMinPoints = 10000;
+
+/// Akl-Toussaint heuristic: the points that are extreme along a fixed set of
+/// directions span a polytope inside the convex hull. Points strictly inside
+/// this polytope can not be vertices of the convex hull. Returns false if the
+/// polytope is degenerate and nothing can be culled.
+static bool ComputeConvexHullCandidates(
+        const std::vector<Eigen::Vector3d>& points,
+        std::vector<size_t>& candidates) {
+    // The 26 directions towards the faces, edges and corners of a cube.
+    std::vector<Eigen::Vector3d> directions;
+    for (int x = -1; x <= 1; ++x) {
+        for (int y = -1; y <= 1; ++y) {
+            for (int z = -1; z <= 1; ++z) {
+                if (x != 0 || y != 0 || z != 0) {
+                    directions.emplace_back(x, y, z);
+                }
+            }
+        }
+    }
+    const int num_directions = static_cast<int>(directions.size());
+    const int64_t num_points = static_cast<int64_t>(points.size());
+
+    std::vector<int64_t> extreme_idx(num_directions, 0);
+    std::vector<double> extreme_val(num_directions,
+                                    std::numeric_limits<double>::lowest());
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<int64_t> local_idx(num_directions, 0);
+        std::vector<double> local_val(num_directions,
+                                      std::numeric_limits<double>::lowest());
+#pragma omp for schedule(static) nowait
+        for (int64_t pidx = 0; pidx < num_points; ++pidx) {
+            for (int d = 0; d < num_directions; ++d) {
+                const double val = directions[d].dot(points[pidx]);
+                if (val > local_val[d]) {
+                    local_val[d] = val;
+                    local_idx[d] = pidx;
+                }
+            }
+        }
+#pragma omp critical(ComputeConvexHullCandidates)
+        for (int d = 0; d < num_directions; ++d) {
+            // Ties are broken by the point index to stay deterministic.
+            if (local_val[d] > extreme_val[d] ||
+                (local_val[d] == extreme_val[d] &&
+                 local_idx[d] < extreme_idx[d])) {
+                extreme_val[d] = local_val[d];
+                extreme_idx[d] = local_idx[d];
+            }
+        }
+    }
+
+    std::sort(extreme_idx.begin(), extreme_idx.end());
+    extreme_idx.erase(std::unique(extreme_idx.begin(), extreme_idx.end()),
+                      extreme_idx.end());
+    if (extreme_idx.size() < 4) {
+        return false;
+    }
+
+    std::vector<double> extreme_points_data;
+    extreme_points_data.reserve(extreme_idx.size() * 3);
+    for (int64_t pidx : extreme_idx) {
+        const double* coords = points[pidx].data();
+        extreme_points_data.insert(extreme_points_data.end(), coords,
+                                   coords + 3);
+    }
+    // Facet planes of the polytope, n.dot(p) + offset > 0 is outside.
+    std::vector<Eigen::Vector4d> planes;
+    try {
+        orgQhull::Qhull qhull;
+        qhull.runQhull("", 3, static_cast<int>(extreme_idx.size()),
+                       extreme_points_data.data(), "Qt");
+        orgQhull::QhullFacetList facets = qhull.facetList();
+        for (orgQhull::QhullFacetList::iterator it = facets.begin();
+             it != facets.end(); ++it) {
+            if (!(*it).isGood()) continue;
+            orgQhull::QhullHyperplane plane = (*it).hyperplane();
+            const double* normal = plane.coordinates();
+            planes.emplace_back(normal[0], normal[1], normal[2],
+                                plane.offset());
+        }
+    } catch (const std::exception& e) {
+        utility::LogDebug("[ComputeConvexHull] culling skipped: {}", e.what());
+        return false;
+    }
+
+    // Tolerance relative to the magnitude of the coordinates, so that points
+    // on the boundary of the polytope are always kept.
+    double scale = 1.0;
+    for (double val : extreme_val) {
+        scale = std::max(scale, std::abs(val));
+    }
+    const double eps = 1e-9 * scale;
+    std::vector<uint8_t> keep(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t pidx = 0; pidx < num_points; ++pidx) {
+        const Eigen::Vector4d point = points[pidx].homogeneous();
+        keep[pidx] = 0;
+        for (const Eigen::Vector4d& plane : planes) {
+            if (plane.dot(point) > -eps) {
+                keep[pidx] = 1;
+                break;
+            }
+        }
+    }
+
+    candidates.clear();
+    for (int64_t pidx = 0; pidx < num_points; ++pidx) {
+        if (keep[pidx]) {
+            candidates.push_back(static_cast<size_t>(pidx));
+        }
+    }
+    utility::LogDebug("[ComputeConvexHull] {:d} of {:d} points are candidates",
+                      candidates.size(), points.size());
+    return true;
+}
+
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
 Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points,
                          bool joggle_inputs) {
     auto convex_hull = std::make_shared<TriangleMesh>();
     std::vector<size_t> pt_map;
 
-    std::vector<double> qhull_points_data(points.size() * 3);
-    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
-        const auto& pt = points[pidx];
+    // Only the candidates are passed to Qhull for large inputs, Qhull point
+    // ids are then indices into candidates.
+    std::vector<size_t> candidates;
+    const bool culled = points.size() >= kConvexHullCullingMinPoints &&
+                        ComputeConvexHullCandidates(points, candidates);
+    const size_t num_qhull_points = culled ? candidates.size() : points.size();
+
+    std::vector<double> qhull_points_data(num_qhull_points * 3);
+    for (size_t pidx = 0; pidx < num_qhull_points; ++pidx) {
+        const auto& pt = points[culled ? candidates[pidx] : pidx];
         qhull_points_data[pidx * 3 + 0] = pt(0);
         qhull_points_data[pidx * 3 + 1] = pt(1);
         qhull_points_data[pidx * 3 + 2] = pt(2);
@@ -74,7 +207,7 @@ Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points,
                 double* coords = p.coordinates();
                 convex_hull->vertices_.push_back(
                         Eigen::Vector3d(coords[0], coords[1], coords[2]));
-                pt_map.push_back(vidx);
+                pt_map.push_back(culled ? candidates[vidx] : vidx);
             }
         }
 
@@ -104,80 +237,68 @@ Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points,
     return std::make_tuple(convex_hull, pt_map);
 }
 
-std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
-Qhull::ComputeDelaunayTetrahedralization(
-        const std::vector<Eigen::Vector3d>& points) {
-    typedef decltype(TetraMesh::tetras_)::value_type Vector4i;
-    auto delaunay_triangulation = std::make_shared<TetraMesh>();
-    std::vector<size_t> pt_map;
+std::vector<Eigen::Vector4i, utility::Vector4i_allocator>
+Qhull::ComputeDelaunayTetras(const double* points, size_t num_points) {
+    std::vector<Eigen::Vector4i, utility::Vector4i_allocator> tetras;
 
-    if (points.size() < 4) {
+    if (num_points < 4) {
         utility::LogError("Not enough points to create a tetrahedral mesh.");
     }
 
     // qhull cannot deal with this case
-    if (points.size() == 4) {
-        delaunay_triangulation->vertices_ = points;
-        delaunay_triangulation->tetras_.push_back(Vector4i(0, 1, 2, 3));
-        pt_map.insert(pt_map.end(), {0, 1, 2, 3});
-        return std::make_tuple(delaunay_triangulation, pt_map);
-    }
-
-    std::vector<double> qhull_points_data(points.size() * 3);
-    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
-        const auto& pt = points[pidx];
-        qhull_points_data[pidx * 3 + 0] = pt(0);
-        qhull_points_data[pidx * 3 + 1] = pt(1);
-        qhull_points_data[pidx * 3 + 2] = pt(2);
+    if (num_points == 4) {
+        tetras.push_back(Eigen::Vector4i(0, 1, 2, 3));
+        return tetras;
     }
 
-    orgQhull::PointCoordinates qhull_points(3, "");
-    qhull_points.append(qhull_points_data);
-
     orgQhull::Qhull qhull;
-    qhull.runQhull(qhull_points.comment().c_str(), qhull_points.dimension(),
-                   qhull_points.count(), qhull_points.coordinates(),
-                   "d Qbb Qt");
+    qhull.runQhull("", 3, int(num_points), points, "d Qbb Qt");
 
     orgQhull::QhullFacetList facets = qhull.facetList();
-    delaunay_triangulation->tetras_.resize(facets.count());
-    std::unordered_map<int, int> vert_map;
-    std::unordered_set<int> inserted_vertices;
-    int tidx = 0;
+    tetras.reserve(facets.count());
     for (orgQhull::QhullFacetList::iterator it = facets.begin();
          it != facets.end(); ++it) {
         if (!(*it).isGood()) continue;
 
         orgQhull::QhullFacet f = *it;
         orgQhull::QhullVertexSet vSet = f.vertices();
+        Eigen::Vector4i tetra;
         int tetra_subscript = 0;
         for (orgQhull::QhullVertexSet::iterator vIt = vSet.begin();
              vIt != vSet.end(); ++vIt) {
-            orgQhull::QhullVertex v = *vIt;
-            orgQhull::QhullPoint p = v.point();
-
-            int vidx = p.id();
-            delaunay_triangulation->tetras_[tidx](tetra_subscript) = vidx;
+            tetra(tetra_subscript) = (*vIt).point().id();
             tetra_subscript++;
-
-            if (inserted_vertices.count(vidx) == 0) {
-                inserted_vertices.insert(vidx);
-                vert_map[vidx] = int(delaunay_triangulation->vertices_.size());
-                double* coords = p.coordinates();
-                delaunay_triangulation->vertices_.push_back(
-                        Eigen::Vector3d(coords[0], coords[1], coords[2]));
-                pt_map.push_back(vidx);
-            }
         }
-
-        tidx++;
+        tetras.push_back(tetra);
     }
+    return tetras;
+}
+
+std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
+Qhull::ComputeDelaunayTetrahedralization(
+        const std::vector<Eigen::Vector3d>& points) {
+    auto delaunay_triangulation = std::make_shared<TetraMesh>();
+    std::vector<size_t> pt_map;
+
+    // Eigen::Vector3d is not a vectorizable type, the points are stored as
+    // consecutive x, y, z coordinates.
+    delaunay_triangulation->tetras_ = ComputeDelaunayTetras(
+            points.empty() ? nullptr : points[0].data(), points.size());
 
+    // Keep only the points that are part of a tetrahedron, in the order they
+    // are first referenced.
+    std::unordered_map<int, int> vert_map;
     for (auto& tetra : delaunay_triangulation->tetras_) {
-        tetra(0) = vert_map[tetra(0)];
-        tetra(1) = vert_map[tetra(1)];
-        tetra(2) = vert_map[tetra(2)];
-        tetra(3) = vert_map[tetra(3)];
+        for (int i = 0; i < 4; ++i) {
+            const int vidx = tetra(i);
+            auto it = vert_map.find(vidx);
+            if (it == vert_map.end()) {
+                it = vert_map.emplace(vidx, int(pt_map.size())).first;
+                delaunay_triangulation->vertices_.push_back(points[vidx]);
+                pt_map.push_back(vidx);
+            }
+            tetra(i) = it->second;
+        }
     }
 
     return std::make_tuple(delaunay_triangulation, pt_map);
@@ -11,6 +11,8 @@
 #include <memory>
 #include <vector>
 
+#include "open3d/utility/Eigen.h"
+
 namespace open3d {
 namespace geometry {
 
@@ -33,6 +35,14 @@ public:
     static std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
     ComputeDelaunayTetrahedralization(
             const std::vector<Eigen::Vector3d>& points);
+
+    /// Computes the tetrahedra of the Delaunay triangulation
+    /// \param points Input points, stored as \p num_points consecutive
+    ///        x, y, z coordinates.
+    /// \param num_points Number of input points.
+    /// \returns The tetrahedra as indices into the input points.
+    static std::vector<Eigen::Vector4i, utility::Vector4i_allocator>
+    ComputeDelaunayTetras(const double* points, size_t num_points);
 };
 
 }  // namespace geometry
@@ -18,108 +18,79 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/VtkUtils.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
-        const PointCloud& pcd,
-        double alpha,
-        std::shared_ptr<TetraMesh> tetra_mesh,
-        std::vector<size_t>* pt_map) {
-    std::vector<size_t> pt_map_computed;
-    if (tetra_mesh == nullptr) {
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] "
-                "ComputeDelaunayTetrahedralization");
-        std::tie(tetra_mesh, pt_map_computed) =
-                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
-        pt_map = &pt_map_computed;
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] done "
-                "ComputeDelaunayTetrahedralization");
-    }
+namespace {
 
-    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
-    auto mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_ = tetra_mesh->vertices_;
-    if (pcd.HasNormals()) {
-        mesh->vertex_normals_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
-        }
-    }
-    if (pcd.HasColors()) {
-        mesh->vertex_colors_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
-        }
-    }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
-
-    std::vector<double> vsqn(tetra_mesh->vertices_.size());
-    for (size_t vidx = 0; vidx < vsqn.size(); ++vidx) {
-        vsqn[vidx] = tetra_mesh->vertices_[vidx].squaredNorm();
+/// Computes the circumsphere of the tetrahedron (v0, v1, v2, v3). Returns false
+/// if the tetrahedron is degenerate.
+bool ComputeTetraCircumsphere(const Eigen::Vector3d& v0,
+                              const Eigen::Vector3d& v1,
+                              const Eigen::Vector3d& v2,
+                              const Eigen::Vector3d& v3,
+                              double& radius,
+                              Eigen::Vector3d& center) {
+    const double s0 = v0.squaredNorm();
+    const double s1 = v1.squaredNorm();
+    const double s2 = v2.squaredNorm();
+    const double s3 = v3.squaredNorm();
+    // clang-format off
+    Eigen::Matrix4d tmp;
+    tmp << v0(0), v0(1), v0(2), 1,
+            v1(0), v1(1), v1(2), 1,
+            v2(0), v2(1), v2(2), 1,
+            v3(0), v3(1), v3(2), 1;
+    double a = tmp.determinant();
+    tmp << s0, v0(0), v0(1), v0(2),
+            s1, v1(0), v1(1), v1(2),
+            s2, v2(0), v2(1), v2(2),
+            s3, v3(0), v3(1), v3(2);
+    double c = tmp.determinant();
+    tmp << s0, v0(1), v0(2), 1,
+            s1, v1(1), v1(2), 1,
+            s2, v2(1), v2(2), 1,
+            s3, v3(1), v3(2), 1;
+    double dx = tmp.determinant();
+    tmp << s0, v0(0), v0(2), 1,
+            s1, v1(0), v1(2), 1,
+            s2, v2(0), v2(2), 1,
+            s3, v3(0), v3(2), 1;
+    double dy = tmp.determinant();
+    tmp << s0, v0(0), v0(1), 1,
+            s1, v1(0), v1(1), 1,
+            s2, v2(0), v2(1), 1,
+            s3, v3(0), v3(1), 1;
+    double dz = tmp.determinant();
+    // clang-format on
+    if (a == 0) {
+        return false;
     }
+    radius = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
+             (2 * std::abs(a));
+    center = Eigen::Vector3d(dx, -dy, dz) / (2 * a);
+    return true;
+}
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
-            "satisfy constraint");
-    const auto& verts = tetra_mesh->vertices_;
-    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
-        const auto& tetra = tetra_mesh->tetras_[tidx];
-        // clang-format off
-        Eigen::Matrix4d tmp;
-        tmp << verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2), 1,
-                verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2), 1,
-                verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2), 1,
-                verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2), 1;
-        double a = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2),
-                vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), verts[tetra(1)](2),
-                vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), verts[tetra(2)](2),
-                vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), verts[tetra(3)](2);
-        double c = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](1), verts[tetra(0)](2), 1,
-                vsqn[tetra(1)], verts[tetra(1)](1), verts[tetra(1)](2), 1,
-                vsqn[tetra(2)], verts[tetra(2)](1), verts[tetra(2)](2), 1,
-                vsqn[tetra(3)], verts[tetra(3)](1), verts[tetra(3)](2), 1;
-        double dx = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](2), 1,
-                vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](2), 1,
-                vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](2), 1,
-                vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](2), 1;
-        double dy = tmp.determinant();
-        tmp << vsqn[tetra(0)], verts[tetra(0)](0), verts[tetra(0)](1), 1,
-                vsqn[tetra(1)], verts[tetra(1)](0), verts[tetra(1)](1), 1,
-                vsqn[tetra(2)], verts[tetra(2)](0), verts[tetra(2)](1), 1,
-                vsqn[tetra(3)], verts[tetra(3)](0), verts[tetra(3)](1), 1;
-        double dz = tmp.determinant();
-        // clang-format on
-        if (a == 0) {
-            utility::LogWarning(
-                    "[CreateFromPointCloudAlphaShape] invalid tetra in "
-                    "TetraMesh");
-        } else {
-            double r = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
-                       (2 * std::abs(a));
-
-            if (r <= alpha) {
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(1), tetra(2)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(1), tetra(3)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(2), tetra(3)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(1), tetra(2), tetra(3)));
-            }
-        }
+/// Builds the alpha shape from the vertices of \p mesh and the tetras of the
+/// Delaunay tetrahedralization that satisfy the alpha constraint. Triangles
+/// that are shared by two tetras are inside the shape and removed.
+std::shared_ptr<TriangleMesh> AlphaShapeFromTetras(
+        std::shared_ptr<TriangleMesh> mesh,
+        const std::vector<Eigen::Vector4i, utility::Vector4i_allocator>&
+                tetras) {
+    for (const Eigen::Vector4i& tetra : tetras) {
+        mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
+                tetra(0), tetra(1), tetra(2)));
+        mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
+                tetra(0), tetra(1), tetra(3)));
+        mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
+                tetra(0), tetra(2), tetra(3)));
+        mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
+                tetra(1), tetra(2), tetra(3)));
     }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done add triangles from tetras "
-            "that satisfy constraint");
 
     utility::LogDebug(
             "[CreateFromPointCloudAlphaShape] remove triangles within "
@@ -185,5 +156,207 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
     return mesh;
 }
 
+/// Tiles of the auto sized tiling hold roughly this many points.
+constexpr double kAlphaShapePointsPerTile = 100000;
+
+}  // unnamed namespace
+
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
+        const PointCloud& pcd,
+        double alpha,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t>* pt_map) {
+    std::vector<size_t> pt_map_computed;
+    if (tetra_mesh == nullptr) {
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] "
+                "ComputeDelaunayTetrahedralization");
+        std::tie(tetra_mesh, pt_map_computed) =
+                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+        pt_map = &pt_map_computed;
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] done "
+                "ComputeDelaunayTetrahedralization");
+    }
+
+    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = tetra_mesh->vertices_;
+    if (pcd.HasNormals()) {
+        mesh->vertex_normals_.resize(mesh->vertices_.size());
+        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
+            mesh->vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
+        }
+    }
+    if (pcd.HasColors()) {
+        mesh->vertex_colors_.resize(mesh->vertices_.size());
+        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
+            mesh->vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
+        }
+    }
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
+
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
+            "satisfy constraint");
+    const auto& verts = tetra_mesh->vertices_;
+    std::vector<Eigen::Vector4i, utility::Vector4i_allocator> alpha_tetras;
+    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
+        const auto& tetra = tetra_mesh->tetras_[tidx];
+        double r;
+        Eigen::Vector3d center;
+        if (!ComputeTetraCircumsphere(verts[tetra(0)], verts[tetra(1)],
+                                      verts[tetra(2)], verts[tetra(3)], r,
+                                      center)) {
+            utility::LogWarning(
+                    "[CreateFromPointCloudAlphaShape] invalid tetra in "
+                    "TetraMesh");
+        } else if (r <= alpha) {
+            alpha_tetras.push_back(tetra);
+        }
+    }
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] done add triangles from tetras "
+            "that satisfy constraint");
+
+    return AlphaShapeFromTetras(mesh, alpha_tetras);
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShapeTiled(
+        const PointCloud& pcd, double alpha, double tile_size, int n_threads) {
+    if (alpha <= 0) {
+        utility::LogError("alpha must be positive, but got {}.", alpha);
+    }
+    if (pcd.points_.size() < 4) {
+        utility::LogError("Not enough points to create a tetrahedral mesh.");
+    }
+    if (n_threads <= 0) {
+        n_threads = utility::EstimateMaxThreads();
+    }
+
+    const Eigen::Vector3d min_bound = pcd.GetMinBound();
+    const Eigen::Vector3d extent = pcd.GetMaxBound() - min_bound;
+    if (tile_size <= 0) {
+        const double tiles_per_axis = std::ceil(std::cbrt(
+                double(pcd.points_.size()) / kAlphaShapePointsPerTile));
+        tile_size = extent.maxCoeff() / tiles_per_axis;
+    }
+    // Tetras with a circumradius of at most alpha whose circumcenter lies in a
+    // tile only have points within alpha of the tile in their circumsphere.
+    // With these points the local Delaunay tetrahedralization of the tile
+    // contains exactly the alpha tetras of the global one.
+    const double margin = alpha * (1 + 1e-6);
+    Eigen::Vector3i num_tiles = Eigen::Vector3i::Ones();
+    if (tile_size > 0) {
+        num_tiles = (extent / tile_size).array().floor().cast<int>() + 1;
+    }
+    auto TileIndex = [&](int x, int y, int z) {
+        return (int64_t(z) * num_tiles(1) + y) * num_tiles(0) + x;
+    };
+    auto TileCoord = [&](double val, int d) {
+        return std::max(
+                0, std::min(static_cast<int>((val - min_bound(d)) / tile_size),
+                            num_tiles(d) - 1));
+    };
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShapeTiled] {:d} x {:d} x {:d} tiles",
+            num_tiles(0), num_tiles(1), num_tiles(2));
+
+    std::unordered_map<int64_t, std::vector<int>> tiles;
+    for (size_t pidx = 0; pidx < pcd.points_.size(); ++pidx) {
+        const Eigen::Vector3d& point = pcd.points_[pidx];
+        Eigen::Vector3i lo, hi;
+        for (int d = 0; d < 3; ++d) {
+            lo(d) = TileCoord(point(d) - margin, d);
+            hi(d) = TileCoord(point(d) + margin, d);
+        }
+        for (int z = lo(2); z <= hi(2); ++z) {
+            for (int y = lo(1); y <= hi(1); ++y) {
+                for (int x = lo(0); x <= hi(0); ++x) {
+                    tiles[TileIndex(x, y, z)].push_back(int(pidx));
+                }
+            }
+        }
+    }
+    std::vector<std::pair<int64_t, std::vector<int>>> tile_list(
+            std::make_move_iterator(tiles.begin()),
+            std::make_move_iterator(tiles.end()));
+    tiles.clear();
+    std::sort(tile_list.begin(), tile_list.end(),
+              [](const std::pair<int64_t, std::vector<int>>& a,
+                 const std::pair<int64_t, std::vector<int>>& b) {
+                  return a.first < b.first;
+              });
+
+    std::vector<std::vector<Eigen::Vector4i, utility::Vector4i_allocator>>
+            tile_tetras(tile_list.size());
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+    for (int tidx = 0; tidx < static_cast<int>(tile_list.size()); ++tidx) {
+        const int64_t tile = tile_list[tidx].first;
+        const std::vector<int>& indices = tile_list[tidx].second;
+        if (indices.size() < 4) {
+            continue;
+        }
+        const Eigen::Vector3i tile_coord(
+                int(tile % num_tiles(0)),
+                int((tile / num_tiles(0)) % num_tiles(1)),
+                int(tile / (int64_t(num_tiles(0)) * num_tiles(1))));
+
+        std::vector<Eigen::Vector3d> points;
+        points.reserve(indices.size());
+        for (int pidx : indices) {
+            points.push_back(pcd.points_[pidx]);
+        }
+        std::shared_ptr<TetraMesh> tetra_mesh;
+        std::vector<size_t> pt_map;
+        try {
+            std::tie(tetra_mesh, pt_map) =
+                    Qhull::ComputeDelaunayTetrahedralization(points);
+        } catch (const std::exception& e) {
+            // Tiles with degenerate point sets, e.g. a few coplanar points in
+            // the margin, do not have any tetras.
+            utility::LogDebug(
+                    "[CreateFromPointCloudAlphaShapeTiled] skip tile: {}",
+                    e.what());
+            continue;
+        }
+
+        const auto& verts = tetra_mesh->vertices_;
+        for (const auto& tetra : tetra_mesh->tetras_) {
+            double r;
+            Eigen::Vector3d center;
+            if (!ComputeTetraCircumsphere(verts[tetra(0)], verts[tetra(1)],
+                                          verts[tetra(2)], verts[tetra(3)], r,
+                                          center) ||
+                r > alpha) {
+                continue;
+            }
+            // Every tetra is owned by the tile containing its circumcenter.
+            if (TileCoord(center(0), 0) != tile_coord(0) ||
+                TileCoord(center(1), 1) != tile_coord(1) ||
+                TileCoord(center(2), 2) != tile_coord(2)) {
+                continue;
+            }
+            tile_tetras[tidx].emplace_back(indices[pt_map[tetra(0)]],
+                                           indices[pt_map[tetra(1)]],
+                                           indices[pt_map[tetra(2)]],
+                                           indices[pt_map[tetra(3)]]);
+        }
+    }
+
+    std::vector<Eigen::Vector4i, utility::Vector4i_allocator> alpha_tetras;
+    for (const auto& tetras : tile_tetras) {
+        alpha_tetras.insert(alpha_tetras.end(), tetras.begin(), tetras.end());
+    }
+    tile_tetras.clear();
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = pcd.points_;
+    mesh->vertex_normals_ = pcd.normals_;
+    mesh->vertex_colors_ = pcd.colors_;
+    return AlphaShapeFromTetras(mesh, alpha_tetras);
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -6,6 +6,8 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <deque>
 #include <iostream>
 #include <list>
 
@@ -14,6 +16,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -22,9 +25,11 @@ class BallPivotingVertex;
 class BallPivotingEdge;
 class BallPivotingTriangle;
 
+// Vertices, edges and triangles are owned by pools in BallPivoting, the
+// pointers below are non-owning.
 typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+typedef BallPivotingEdge* BallPivotingEdgePtr;
+typedef BallPivotingTriangle* BallPivotingTrianglePtr;
 
 class BallPivotingVertex {
 public:
@@ -35,13 +40,16 @@ public:
                        const Eigen::Vector3d& normal)
         : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
 
+    void AddEdge(BallPivotingEdgePtr edge);
     void UpdateType();
 
 public:
     int idx_;
     const Eigen::Vector3d& point_;
     const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
+    // A vertex has only a handful of incident edges, a flat vector is cheaper
+    // than a hash set here.
+    std::vector<BallPivotingEdgePtr> edges_;
     Type type_;
 };
 
@@ -50,7 +58,11 @@ public:
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
     BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
+        : source_(source),
+          target_(target),
+          triangle0_(nullptr),
+          triangle1_(nullptr),
+          type_(Type::Front) {}
 
     void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
     BallPivotingVertexPtr GetOppositeVertex();
@@ -81,11 +93,17 @@ public:
     Eigen::Vector3d ball_center_;
 };
 
+void BallPivotingVertex::AddEdge(BallPivotingEdgePtr edge) {
+    if (std::find(edges_.begin(), edges_.end(), edge) == edges_.end()) {
+        edges_.push_back(edge);
+    }
+}
+
 void BallPivotingVertex::UpdateType() {
     if (edges_.empty()) {
         type_ = Type::Orphan;
     } else {
-        for (const BallPivotingEdgePtr& edge : edges_) {
+        for (const BallPivotingEdgePtr edge : edges_) {
             if (edge->type_ != BallPivotingEdge::Type::Inner) {
                 type_ = Type::Front;
                 return;
@@ -148,18 +166,16 @@ public:
         mesh_->vertices_ = pcd.points_;
         mesh_->vertex_normals_ = pcd.normals_;
         mesh_->vertex_colors_ = pcd.colors_;
+        vertex_pool_.reserve(pcd.points_.size());
+        vertices.reserve(pcd.points_.size());
         for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
+            vertex_pool_.emplace_back(static_cast<int>(vidx), pcd.points_[vidx],
+                                      pcd.normals_[vidx]);
+            vertices.push_back(&vertex_pool_.back());
         }
     }
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
-        }
-    }
+    virtual ~BallPivoting() {}
 
     bool ComputeBallCenter(int vidx1,
                            int vidx2,
@@ -214,10 +230,16 @@ public:
         return false;
     }
 
+    BallPivotingEdgePtr NewEdge(BallPivotingVertexPtr source,
+                                BallPivotingVertexPtr target) {
+        edge_pool_.emplace_back(source, target);
+        return &edge_pool_.back();
+    }
+
     BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
                                        const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
+        for (const BallPivotingEdgePtr edge0 : v0->edges_) {
+            for (const BallPivotingEdgePtr edge1 : v1->edges_) {
                 if (edge0->source_->idx_ == edge1->source_->idx_ &&
                     edge0->target_->idx_ == edge1->target_->idx_) {
                     return edge0;
@@ -234,32 +256,32 @@ public:
         utility::LogDebug(
                 "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
                 v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
+        triangle_pool_.emplace_back(v0, v1, v2, center);
+        BallPivotingTrianglePtr triangle = &triangle_pool_.back();
 
         BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
         if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
+            e0 = NewEdge(v0, v1);
         }
         e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
+        v0->AddEdge(e0);
+        v1->AddEdge(e0);
 
         BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
         if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
+            e1 = NewEdge(v1, v2);
         }
         e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
+        v1->AddEdge(e1);
+        v2->AddEdge(e1);
 
         BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
         if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
+            e2 = NewEdge(v2, v0);
         }
         e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
+        v2->AddEdge(e2);
+        v0->AddEdge(e2);
 
         v0->UpdateType();
         v1->UpdateType();
@@ -653,6 +675,52 @@ public:
         }
     }
 
+    /// Re-activates the border edges that can be pivoted with the new, larger
+    /// \p radius and moves them back to the front.
+    void ReactivateBorderEdges(double radius) {
+        for (auto it = border_edges_.begin(); it != border_edges_.end();) {
+            BallPivotingEdgePtr edge = *it;
+            BallPivotingTrianglePtr triangle = edge->triangle0_;
+            utility::LogDebug(
+                    "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
+                    edge->source_->idx_, edge->target_->idx_,
+                    triangle->vert0_->idx_, triangle->vert1_->idx_,
+                    triangle->vert2_->idx_);
+
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle->vert0_->idx_,
+                                  triangle->vert1_->idx_,
+                                  triangle->vert2_->idx_, radius, center)) {
+                utility::LogDebug("[Run]   yes, we can work on this");
+                std::vector<int> indices;
+                std::vector<double> dists2;
+                kdtree_.SearchRadius(center, radius, indices, dists2);
+                bool empty_ball = true;
+                for (auto idx : indices) {
+                    if (idx != triangle->vert0_->idx_ &&
+                        idx != triangle->vert1_->idx_ &&
+                        idx != triangle->vert2_->idx_) {
+                        utility::LogDebug(
+                                "[Run]   but no, the ball is not empty");
+                        empty_ball = false;
+                        break;
+                    }
+                }
+
+                if (empty_ball) {
+                    utility::LogDebug(
+                            "[Run]   yeah, add edge to edge_front_: {:d}",
+                            edge_front_.size());
+                    edge->type_ = BallPivotingEdge::Type::Front;
+                    edge_front_.push_back(edge);
+                    it = border_edges_.erase(it);
+                    continue;
+                }
+            }
+            ++it;
+        }
+    }
+
     std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
         if (!has_normals_) {
             utility::LogError("ReconstructBallPivoting requires normals");
@@ -669,47 +737,7 @@ public:
             }
 
             // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
-                }
-                ++it;
-            }
+            ReactivateBorderEdges(radius);
 
             // do the reconstruction
             if (edge_front_.empty()) {
@@ -725,19 +753,224 @@ public:
         return mesh_;
     }
 
+    /// Adds a triangle that was reconstructed independently (e.g. in a tile)
+    /// together with the center of the ball that touches its vertices.
+    void AddTriangle(int vidx0,
+                     int vidx1,
+                     int vidx2,
+                     const Eigen::Vector3d& center) {
+        CreateTriangle(vertices[vidx0], vertices[vidx1], vertices[vidx2],
+                       center);
+    }
+
+    /// Closes the gaps between the triangles added with AddTriangle. All edges
+    /// with only one adjacent triangle form the initial front, which is
+    /// expanded for every radius. As in Run, points that are not yet part of
+    /// the mesh are then seeded with every radius.
+    std::shared_ptr<TriangleMesh> Stitch(const std::vector<double>& radii) {
+        for (BallPivotingEdge& edge : edge_pool_) {
+            if (edge.type_ == BallPivotingEdge::Type::Front) {
+                edge_front_.push_back(&edge);
+            }
+        }
+
+        for (double radius : radii) {
+            utility::LogDebug("[Stitch] change to radius {:.4f}", radius);
+            ReactivateBorderEdges(radius);
+            ExpandTriangulation(radius);
+            FindSeedTriangle(radius);
+        }
+        return mesh_;
+    }
+
+    const std::deque<BallPivotingTriangle>& GetTriangles() const {
+        return triangle_pool_;
+    }
+
 private:
     bool has_normals_;
     KDTreeFlann kdtree_;
     std::list<BallPivotingEdgePtr> edge_front_;
     std::list<BallPivotingEdgePtr> border_edges_;
     std::vector<BallPivotingVertexPtr> vertices;
+    std::vector<BallPivotingVertex> vertex_pool_;
+    // std::deque never relocates its elements on emplace_back, so the pools
+    // hand out stable pointers without a heap allocation per element.
+    std::deque<BallPivotingEdge> edge_pool_;
+    std::deque<BallPivotingTriangle> triangle_pool_;
     std::shared_ptr<TriangleMesh> mesh_;
 };
 
+namespace {
+
+/// Tiles are at least this many times the margin (twice the largest radius)
+/// wide, which keeps the points duplicated into the margins of neighbouring
+/// tiles at a small fraction.
+constexpr double kBallPivotingMinTileSizeInMargins = 8.0;
+/// Upper bound on the number of tiles along the longest bounding box axis.
+constexpr double kBallPivotingMaxTilesPerAxis = 16.0;
+
+struct BallPivotingTileTriangle {
+    Eigen::Vector3i vertices_;
+    Eigen::Vector3d center_;
+};
+
+/// Splits \p pcd into a regular grid of tiles. For every tile the indices of
+/// the points inside the tile (core) come first, followed by the indices of
+/// the points of the neighbouring tiles that are closer than \p margin to the
+/// tile (margin). Empty tiles are dropped.
+void SplitBallPivotingTiles(const PointCloud& pcd,
+                            double tile_size,
+                            double margin,
+                            const Eigen::Vector3i& num_tiles,
+                            std::vector<std::vector<int>>& tile_indices,
+                            std::vector<size_t>& tile_num_core) {
+    const Eigen::Vector3d min_bound = pcd.GetMinBound();
+    const int num_all_tiles = num_tiles.prod();
+    auto TileIndex = [&](const Eigen::Vector3i& tile) {
+        return (tile(2) * num_tiles(1) + tile(1)) * num_tiles(0) + tile(0);
+    };
+    auto CoreTile = [&](const Eigen::Vector3d& point) {
+        Eigen::Vector3i tile;
+        for (int d = 0; d < 3; ++d) {
+            tile(d) = std::min(
+                    static_cast<int>((point(d) - min_bound(d)) / tile_size),
+                    num_tiles(d) - 1);
+        }
+        return tile;
+    };
+
+    std::vector<std::vector<int>> core(num_all_tiles);
+    std::vector<std::vector<int>> border(num_all_tiles);
+    for (size_t pidx = 0; pidx < pcd.points_.size(); ++pidx) {
+        const Eigen::Vector3d& point = pcd.points_[pidx];
+        const Eigen::Vector3i tile = CoreTile(point);
+        core[TileIndex(tile)].push_back(static_cast<int>(pidx));
+
+        // Range of tiles per axis whose margin contains the point.
+        Eigen::Vector3i lo = tile, hi = tile;
+        for (int d = 0; d < 3; ++d) {
+            const double offset = point(d) - min_bound(d) - tile(d) * tile_size;
+            if (offset < margin && tile(d) > 0) {
+                lo(d) = tile(d) - 1;
+            }
+            if (tile_size - offset < margin && tile(d) + 1 < num_tiles(d)) {
+                hi(d) = tile(d) + 1;
+            }
+        }
+        for (int z = lo(2); z <= hi(2); ++z) {
+            for (int y = lo(1); y <= hi(1); ++y) {
+                for (int x = lo(0); x <= hi(0); ++x) {
+                    const Eigen::Vector3i other(x, y, z);
+                    if (other != tile) {
+                        border[TileIndex(other)].push_back(
+                                static_cast<int>(pidx));
+                    }
+                }
+            }
+        }
+    }
+
+    tile_indices.clear();
+    tile_num_core.clear();
+    for (int tidx = 0; tidx < num_all_tiles; ++tidx) {
+        if (core[tidx].empty()) {
+            continue;
+        }
+        tile_num_core.push_back(core[tidx].size());
+        core[tidx].insert(core[tidx].end(), border[tidx].begin(),
+                          border[tidx].end());
+        tile_indices.push_back(std::move(core[tidx]));
+    }
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
-        const PointCloud& pcd, const std::vector<double>& radii) {
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        int n_threads) {
+    if (!pcd.HasNormals()) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    double max_radius = 0;
+    for (double radius : radii) {
+        if (radius <= 0) {
+            utility::LogError("got an invalid, negative radius as parameter");
+        }
+        max_radius = std::max(max_radius, radius);
+    }
+    if (n_threads <= 0) {
+        n_threads = utility::EstimateMaxThreads();
+    }
+
+    // Every point that can lie inside a ball touching a point of the tile, or
+    // that is visited while pivoting around an edge of the tile, is at most
+    // two radii away from the tile.
+    const double margin = 2 * max_radius;
+    const Eigen::Vector3d extent = pcd.GetMaxBound() - pcd.GetMinBound();
+    const double tile_size =
+            std::max(kBallPivotingMinTileSizeInMargins * margin,
+                     extent.maxCoeff() / kBallPivotingMaxTilesPerAxis);
+    Eigen::Vector3i num_tiles = Eigen::Vector3i::Ones();
+    if (tile_size > 0) {
+        num_tiles = (extent / tile_size).array().floor().cast<int>() + 1;
+    }
+
+    if (n_threads == 1 || num_tiles.prod() == 1) {
+        BallPivoting bp(pcd);
+        return bp.Run(radii);
+    }
+
+    std::vector<std::vector<int>> tile_indices;
+    std::vector<size_t> tile_num_core;
+    SplitBallPivotingTiles(pcd, tile_size, margin, num_tiles, tile_indices,
+                           tile_num_core);
+    utility::LogDebug("[CreateFromPointCloudBallPivoting] {:d} tiles",
+                      tile_indices.size());
+
+    // Reconstruct the tiles independently. Only triangles whose vertices are
+    // all in the core of the tile are kept, their empty ball property is
+    // exact as the margin contains all points that could violate it.
+    std::vector<std::vector<BallPivotingTileTriangle>> tile_triangles(
+            tile_indices.size());
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+    for (int tidx = 0; tidx < static_cast<int>(tile_indices.size()); ++tidx) {
+        const std::vector<int>& indices = tile_indices[tidx];
+        PointCloud tile_pcd;
+        tile_pcd.points_.reserve(indices.size());
+        tile_pcd.normals_.reserve(indices.size());
+        for (int pidx : indices) {
+            tile_pcd.points_.push_back(pcd.points_[pidx]);
+            tile_pcd.normals_.push_back(pcd.normals_[pidx]);
+        }
+
+        BallPivoting tile_bp(tile_pcd);
+        tile_bp.Run(radii);
+
+        const int num_core = static_cast<int>(tile_num_core[tidx]);
+        for (const BallPivotingTriangle& triangle : tile_bp.GetTriangles()) {
+            const int v0 = triangle.vert0_->idx_;
+            const int v1 = triangle.vert1_->idx_;
+            const int v2 = triangle.vert2_->idx_;
+            if (v0 < num_core && v1 < num_core && v2 < num_core) {
+                tile_triangles[tidx].push_back(
+                        {Eigen::Vector3i(indices[v0], indices[v1],
+                                         indices[v2]),
+                         triangle.ball_center_});
+            }
+        }
+    }
+
+    // Stitch the tiles along their boundaries.
     BallPivoting bp(pcd);
-    return bp.Run(radii);
+    for (const auto& triangles : tile_triangles) {
+        for (const BallPivotingTileTriangle& triangle : triangles) {
+            bp.AddTriangle(triangle.vertices_(0), triangle.vertices_(1),
+                           triangle.vertices_(2), triangle.center_);
+        }
+    }
+    return bp.Stitch(radii);
 }
 
 }  // namespace geometry
@@ -12,10 +12,16 @@
 #include <cstdlib>
 #include <iostream>
 #include <list>
+#include <numeric>
+#include <unordered_map>
 
+#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Timer.h"
 
 // clang-format off
 #ifdef _MSC_VER
@@ -262,6 +268,18 @@ XForm<Real, Dim + 1> GetPointXForm(InputPointStream<Real, Dim>& stream,
     return GetBoundingBoxXForm(min, max, scaleFactor);
 }
 
+template <class Real, unsigned int Dim>
+XForm<Real, Dim + 1> GetCubeXForm(const Eigen::Vector3d& cube_min,
+                                  double cube_width) {
+    XForm<Real, Dim + 1> tXForm = XForm<Real, Dim + 1>::Identity(),
+                         sXForm = XForm<Real, Dim + 1>::Identity();
+    for (unsigned int i = 0; i < Dim; i++) {
+        sXForm(i, i) = (Real)(1. / cube_width);
+        tXForm(Dim, i) = (Real)-cube_min(i);
+    }
+    return sXForm * tXForm;
+}
+
 template <unsigned int Dim, typename Real>
 struct ConstraintDual {
     Real target, weight;
@@ -400,6 +418,8 @@ void Execute(const open3d::geometry::PointCloud& pcd,
              float width,
              float scale,
              bool linear_fit,
+             const Eigen::Vector3d* cube_min,
+             double cube_width,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -448,7 +468,11 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     {
         Open3DPointStream<Real> pointStream(&pcd);
 
-        if (width > 0.0f) {
+        if (cube_min) {
+            // Solve inside a prescribed cube, e.g. one block of the tiled
+            // reconstruction, instead of the bounding cube of the samples.
+            xForm = GetCubeXForm<Real, Dim>(*cube_min, cube_width) * xForm;
+        } else if (width > 0.0f) {
             xForm = GetPointXForm<Real, Dim>(pointStream, (Real)width,
                                              (Real)(scale > 0 ? scale : 1.),
                                              depth) *
@@ -715,6 +739,386 @@ void Execute(const open3d::geometry::PointCloud& pcd,
 
 }  // namespace poisson
 
+namespace {
+
+// Rough PoissonRecon memory model used to bound the size of a block: every
+// sample stores its position, weight and Open3DData, and the octree of a
+// surface-like input has in the order of 24 * 4^d nodes at depth d, each
+// carrying FEM coefficients, constraints and multigrid data.
+constexpr double kPoissonBytesPerSample = 128.0;
+constexpr double kPoissonBytesPerNode = 256.0;
+constexpr double kPoissonNodesPerSurfaceCell = 24.0;
+// Blocks are never split below this depth because of the memory limit alone.
+constexpr int kPoissonMinBlockDepth = 5;
+
+double EstimatePoissonMemoryMB(size_t num_points, int depth) {
+    const double num_nodes =
+            kPoissonNodesPerSurfaceCell * std::pow(4.0, double(depth));
+    return (double(num_points) * kPoissonBytesPerSample +
+            num_nodes * kPoissonBytesPerNode) /
+           double(1 << 20);
+}
+
+/// Cube of the hierarchical domain decomposition. Every block solves the
+/// Poisson problem at the same finest resolution as the global cube would,
+/// so the depth decreases by one per subdivision level.
+struct PoissonBlock {
+    Eigen::Vector3d min_bound_;
+    double width_;
+    /// Depth of the core of the block, i.e., without the padding.
+    int depth_;
+    /// Points inside the block padded by the overlap.
+    std::vector<size_t> indices_;
+};
+
+bool IsInsideCube(const Eigen::Vector3d& p,
+                  const Eigen::Vector3d& min_bound,
+                  double width,
+                  double padding) {
+    return (p.array() >= (min_bound.array() - padding)).all() &&
+           (p.array() < (min_bound.array() + width + padding)).all();
+}
+
+/// Number of levels by which the solve cube of a block is larger than its
+/// core. The padded block is rounded up to a power of two multiple of its
+/// width, so that the cells of the block solve coincide with the cells of the
+/// global solve.
+int GetPoissonPaddingDepth(double overlap) {
+    return static_cast<int>(std::ceil(std::log2(1 + 2 * overlap) - 1e-9));
+}
+
+/// Partition of unity weight of \p block at \p p, before normalization. It
+/// ramps linearly from 1 at \p padding inside the core of the block to 0 at
+/// \p padding outside, so it is 0.5 on the faces of the core.
+double GetPoissonBlendWeight(const PoissonBlock& block,
+                             double padding,
+                             const Eigen::Vector3d& p) {
+    const double dist = std::min(
+            (p.array() - (block.min_bound_.array() - padding)).minCoeff(),
+            ((block.min_bound_.array() + block.width_ + padding) - p.array())
+                    .minCoeff());
+    return std::min(std::max(dist / (2 * padding), 0.0), 1.0);
+}
+
+/// Recursively splits \p root into octants until every block satisfies the
+/// depth and memory limits, which apply to the depth of the solve cube. Blocks
+/// without points in their padded cube are dropped; the others are kept even
+/// if their core is empty, as the surface reconstructed from the padding may
+/// still pass through it.
+std::vector<PoissonBlock> SplitPoissonBlocks(const PointCloud& pcd,
+                                             PoissonBlock root,
+                                             int max_block_depth,
+                                             double max_block_memory_mb,
+                                             double overlap) {
+    const int padding_depth = GetPoissonPaddingDepth(overlap);
+    std::vector<PoissonBlock> blocks;
+    std::vector<PoissonBlock> stack;
+    stack.push_back(std::move(root));
+    while (!stack.empty()) {
+        PoissonBlock block = std::move(stack.back());
+        stack.pop_back();
+        if (block.indices_.empty()) {
+            continue;
+        }
+        const int solve_depth = block.depth_ + padding_depth;
+        const bool exceeds_depth = solve_depth > max_block_depth;
+        const bool exceeds_memory =
+                max_block_memory_mb > 0 &&
+                solve_depth > kPoissonMinBlockDepth &&
+                EstimatePoissonMemoryMB(block.indices_.size(), solve_depth) >
+                        max_block_memory_mb;
+        if (!exceeds_depth && !exceeds_memory) {
+            blocks.push_back(std::move(block));
+            continue;
+        }
+        const double child_width = block.width_ / 2;
+        const double child_padding = overlap * child_width;
+        for (int octant = 0; octant < 8; ++octant) {
+            PoissonBlock child;
+            child.min_bound_ =
+                    block.min_bound_ +
+                    child_width * Eigen::Vector3d(octant & 1, (octant >> 1) & 1,
+                                                  (octant >> 2) & 1);
+            child.width_ = child_width;
+            child.depth_ = block.depth_ - 1;
+            for (size_t idx : block.indices_) {
+                const Eigen::Vector3d& p = pcd.points_[idx];
+                if (IsInsideCube(p, child.min_bound_, child_width,
+                                 child_padding)) {
+                    child.indices_.push_back(idx);
+                }
+            }
+            stack.push_back(std::move(child));
+        }
+    }
+    return blocks;
+}
+
+/// Mesh of a solved block before blending, with a KD-tree over its vertices
+/// if the blending of a neighbor needs it.
+struct PoissonBlockMesh {
+    std::shared_ptr<TriangleMesh> mesh_;
+    std::vector<double> densities_;
+    std::unique_ptr<KDTreeFlann> kdtree_;
+};
+
+/// Indices of the blocks whose padded cubes intersect the padded cube of each
+/// block. The relation is symmetric.
+std::vector<std::vector<int>> FindPoissonBlockNeighbors(
+        const std::vector<PoissonBlock>& blocks, double overlap) {
+    auto padded_min = [&](size_t bidx) -> Eigen::Array3d {
+        return blocks[bidx].min_bound_.array() - overlap * blocks[bidx].width_;
+    };
+    auto padded_max = [&](size_t bidx) -> Eigen::Array3d {
+        return blocks[bidx].min_bound_.array() +
+               (1 + overlap) * blocks[bidx].width_;
+    };
+    std::vector<std::vector<int>> neighbors(blocks.size());
+    if (overlap <= 0) {
+        return neighbors;
+    }
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        for (size_t j = 0; j < blocks.size(); ++j) {
+            if (i != j && (padded_min(i) < padded_max(j)).all() &&
+                (padded_min(j) < padded_max(i)).all()) {
+                neighbors[i].push_back(int(j));
+            }
+        }
+    }
+    return neighbors;
+}
+
+/// Blends the mesh of block \p bidx with the meshes of its \p neighbors
+/// across the overlap and returns the blended copy in \p out and \p
+/// out_densities. Every vertex in the overlap is moved to the weighted average
+/// of its projections onto the meshes of the blocks covering it, using the
+/// partition of unity weights of GetPoissonBlendWeight. A projection is the
+/// closest point on the tangent plane of the closest vertex, and blocks
+/// without a vertex within \p max_distance are ignored. Normals, colors and
+/// densities are blended with the same weights. Adjacent blocks thus converge
+/// to the same surface on their shared face, and only the discretization of
+/// the seam differs.
+void BlendPoissonBlock(
+        const std::vector<PoissonBlock>& blocks,
+        int bidx,
+        const std::vector<int>& neighbors,
+        double overlap,
+        double max_distance,
+        const std::vector<std::unique_ptr<PoissonBlockMesh>>& block_meshes,
+        TriangleMesh& out,
+        std::vector<double>& out_densities) {
+    const TriangleMesh& mesh = *block_meshes[bidx]->mesh_;
+    const std::vector<double>& densities = block_meshes[bidx]->densities_;
+    out = mesh;
+    out_densities = densities;
+    if (neighbors.empty()) {
+        return;
+    }
+    const double padding = overlap * blocks[bidx].width_;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < int(mesh.vertices_.size()); ++vidx) {
+        const Eigen::Vector3d& v = mesh.vertices_[vidx];
+        const double weight = GetPoissonBlendWeight(blocks[bidx], padding, v);
+        if (weight <= 0 || weight >= 1) {
+            continue;
+        }
+        std::vector<int> indices(1);
+        std::vector<double> dists2(1);
+        double weight_sum = weight;
+        Eigen::Vector3d vertex = weight * v;
+        Eigen::Vector3d normal = weight * mesh.vertex_normals_[vidx];
+        Eigen::Vector3d color = weight * mesh.vertex_colors_[vidx];
+        double density = weight * densities[vidx];
+        for (int nidx : neighbors) {
+            const PoissonBlockMesh& block_mesh_n = *block_meshes[nidx];
+            const double weight_n = GetPoissonBlendWeight(
+                    blocks[nidx], overlap * blocks[nidx].width_, v);
+            if (weight_n <= 0 || !block_mesh_n.kdtree_ ||
+                block_mesh_n.kdtree_->SearchKNN(v, 1, indices, dists2) < 1 ||
+                dists2[0] > max_distance * max_distance) {
+                continue;
+            }
+            const TriangleMesh& mesh_n = *block_mesh_n.mesh_;
+            const Eigen::Vector3d& q = mesh_n.vertices_[indices[0]];
+            Eigen::Vector3d n = mesh_n.vertex_normals_[indices[0]];
+            Eigen::Vector3d projection = q;
+            if (n.norm() > 0) {
+                n.normalize();
+                projection = v - (v - q).dot(n) * n;
+            }
+            weight_sum += weight_n;
+            vertex += weight_n * projection;
+            normal += weight_n * mesh_n.vertex_normals_[indices[0]];
+            color += weight_n * mesh_n.vertex_colors_[indices[0]];
+            density += weight_n * block_mesh_n.densities_[indices[0]];
+        }
+        out.vertices_[vidx] = vertex / weight_sum;
+        out.vertex_normals_[vidx] = normal / weight_sum;
+        out.vertex_colors_[vidx] = color / weight_sum;
+        out_densities[vidx] = density / weight_sum;
+    }
+}
+
+/// Keeps the triangles of \p mesh whose centroid lies in the core of \p
+/// block and drops the vertices that are no longer referenced.
+void CropToPoissonBlock(const PoissonBlock& block,
+                        TriangleMesh& mesh,
+                        std::vector<double>& densities) {
+    std::vector<int> vertex_map(mesh.vertices_.size(), -1);
+    std::vector<Eigen::Vector3i> triangles;
+    for (const Eigen::Vector3i& triangle : mesh.triangles_) {
+        const Eigen::Vector3d centroid = (mesh.vertices_[triangle(0)] +
+                                          mesh.vertices_[triangle(1)] +
+                                          mesh.vertices_[triangle(2)]) /
+                                         3.0;
+        if (!IsInsideCube(centroid, block.min_bound_, block.width_, 0)) {
+            continue;
+        }
+        triangles.push_back(triangle);
+        for (int i = 0; i < 3; ++i) {
+            vertex_map[triangle(i)] = 0;
+        }
+    }
+    int num_vertices = 0;
+    for (size_t vidx = 0; vidx < vertex_map.size(); ++vidx) {
+        if (vertex_map[vidx] < 0) {
+            continue;
+        }
+        vertex_map[vidx] = num_vertices;
+        mesh.vertices_[num_vertices] = mesh.vertices_[vidx];
+        mesh.vertex_normals_[num_vertices] = mesh.vertex_normals_[vidx];
+        mesh.vertex_colors_[num_vertices] = mesh.vertex_colors_[vidx];
+        densities[num_vertices] = densities[vidx];
+        num_vertices++;
+    }
+    mesh.vertices_.resize(num_vertices);
+    mesh.vertex_normals_.resize(num_vertices);
+    mesh.vertex_colors_.resize(num_vertices);
+    densities.resize(num_vertices);
+    for (Eigen::Vector3i& triangle : triangles) {
+        for (int i = 0; i < 3; ++i) {
+            triangle(i) = vertex_map[triangle(i)];
+        }
+    }
+    mesh.triangles_ = std::move(triangles);
+}
+
+/// Stitches the seams between blended blocks: every border vertex is merged
+/// with the closest border vertex of a different block within \p tolerance.
+/// Merged vertices get the average position, normal, color and density.
+void WeldPoissonBlocks(const std::vector<int>& vertex_block,
+                       double tolerance,
+                       TriangleMesh& mesh,
+                       std::vector<double>& densities) {
+    // Border vertices are the ones adjacent to an edge with a single triangle.
+    std::unordered_map<Eigen::Vector2i, int,
+                       utility::hash_eigen<Eigen::Vector2i>>
+            edge_counts;
+    for (const Eigen::Vector3i& triangle : mesh.triangles_) {
+        for (int i = 0; i < 3; ++i) {
+            int v0 = triangle(i);
+            int v1 = triangle((i + 1) % 3);
+            edge_counts[Eigen::Vector2i(std::min(v0, v1), std::max(v0, v1))]++;
+        }
+    }
+    std::vector<bool> is_border(mesh.vertices_.size(), false);
+    for (const auto& edge_count : edge_counts) {
+        if (edge_count.second == 1) {
+            is_border[edge_count.first(0)] = true;
+            is_border[edge_count.first(1)] = true;
+        }
+    }
+    PointCloud border;
+    std::vector<int> border_vertices;
+    for (size_t vidx = 0; vidx < mesh.vertices_.size(); ++vidx) {
+        if (is_border[vidx]) {
+            border.points_.push_back(mesh.vertices_[vidx]);
+            border_vertices.push_back(int(vidx));
+        }
+    }
+    if (border_vertices.empty()) {
+        return;
+    }
+
+    KDTreeFlann kdtree(border);
+    std::vector<int> partner(border_vertices.size(), -1);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int bidx = 0; bidx < int(border_vertices.size()); ++bidx) {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+        kdtree.SearchRadius(border.points_[bidx], tolerance, indices, dists2);
+        const int block = vertex_block[border_vertices[bidx]];
+        double best_dist2 = std::numeric_limits<double>::max();
+        for (size_t k = 0; k < indices.size(); ++k) {
+            if (vertex_block[border_vertices[indices[k]]] != block &&
+                dists2[k] < best_dist2) {
+                best_dist2 = dists2[k];
+                partner[bidx] = indices[k];
+            }
+        }
+    }
+
+    // Union-find over the closest cross-block pairs.
+    std::vector<int> parent(border_vertices.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find_root = [&parent](int x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    };
+    for (size_t bidx = 0; bidx < partner.size(); ++bidx) {
+        if (partner[bidx] >= 0) {
+            parent[find_root(int(bidx))] = find_root(partner[bidx]);
+        }
+    }
+
+    std::vector<int> vertex_map(mesh.vertices_.size());
+    std::iota(vertex_map.begin(), vertex_map.end(), 0);
+    std::vector<int> cluster_size(mesh.vertices_.size(), 1);
+    for (size_t bidx = 0; bidx < border_vertices.size(); ++bidx) {
+        const int root = border_vertices[find_root(int(bidx))];
+        const int vidx = border_vertices[bidx];
+        if (root == vidx) {
+            continue;
+        }
+        vertex_map[vidx] = root;
+        mesh.vertices_[root] += mesh.vertices_[vidx];
+        mesh.vertex_normals_[root] += mesh.vertex_normals_[vidx];
+        mesh.vertex_colors_[root] += mesh.vertex_colors_[vidx];
+        densities[root] += densities[vidx];
+        cluster_size[root]++;
+    }
+    int num_vertices = 0;
+    std::vector<int> new_index(mesh.vertices_.size(), -1);
+    for (size_t vidx = 0; vidx < mesh.vertices_.size(); ++vidx) {
+        if (vertex_map[vidx] != int(vidx)) {
+            continue;
+        }
+        const double size = cluster_size[vidx];
+        new_index[vidx] = num_vertices;
+        mesh.vertices_[num_vertices] = mesh.vertices_[vidx] / size;
+        mesh.vertex_normals_[num_vertices] = mesh.vertex_normals_[vidx] / size;
+        mesh.vertex_colors_[num_vertices] = mesh.vertex_colors_[vidx] / size;
+        densities[num_vertices] = densities[vidx] / size;
+        num_vertices++;
+    }
+    mesh.vertices_.resize(num_vertices);
+    mesh.vertex_normals_.resize(num_vertices);
+    mesh.vertex_colors_.resize(num_vertices);
+    densities.resize(num_vertices);
+    for (Eigen::Vector3i& triangle : mesh.triangles_) {
+        for (int i = 0; i < 3; ++i) {
+            triangle(i) = new_index[vertex_map[triangle(i)]];
+        }
+    }
+}
+
+}  // namespace
+
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
 TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
                                           size_t depth,
@@ -747,9 +1151,235 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
     poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
+                            width, scale, linear_fit, nullptr, 0.,
+                            FEMSigs());
+
+    ThreadPool::Terminate();
+
+    return std::make_tuple(mesh, densities);
+}
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoissonTiled(const PointCloud& pcd,
+                                               size_t depth,
+                                               size_t max_block_depth,
+                                               double max_block_memory_mb,
+                                               double overlap,
+                                               float scale,
+                                               bool linear_fit,
+                                               int n_threads) {
+    static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
+    typedef IsotropicUIntPack<
+            poisson::DIMENSION,
+            FEMDegreeAndBType</* Degree */ 1, BType>::Signature>
+            FEMSigs;
+
+    if (!pcd.HasNormals()) {
+        utility::LogError("Point cloud has no normals");
+    }
+    if (depth < 2 || max_block_depth < 2) {
+        utility::LogError(
+                "depth (={}) and max_block_depth (={}) have to be >= 2", depth,
+                max_block_depth);
+    }
+    if (overlap < 0 || overlap > 0.5) {
+        utility::LogError("overlap (={}) has to be in [0, 0.5]", overlap);
+    }
+
+    if (n_threads <= 0) {
+        n_threads = (int)std::thread::hardware_concurrency();
+    }
+
+    utility::Timer timer;
+    double time_partition = 0;
+    double time_solve = 0;
+    double time_blend = 0;
+    double time_crop = 0;
+    double time_stitch = 0;
+
+    // Same bounding cube as CreateFromPointCloudPoisson.
+    timer.Start();
+    PoissonBlock root;
+    const Eigen::Vector3d min_bound = pcd.GetMinBound();
+    const Eigen::Vector3d max_bound = pcd.GetMaxBound();
+    root.width_ = (max_bound - min_bound).maxCoeff() * (scale > 0 ? scale : 1.);
+    if (root.width_ <= 0) {
+        root.width_ = 1;
+    }
+    root.min_bound_ = (min_bound + max_bound) / 2 -
+                      Eigen::Vector3d::Constant(root.width_ / 2);
+    root.depth_ = static_cast<int>(depth);
+    root.indices_.resize(pcd.points_.size());
+    std::iota(root.indices_.begin(), root.indices_.end(), 0);
+    const double root_width = root.width_;
+    const double cell_width = root_width / std::pow(2.0, double(depth));
+    std::vector<PoissonBlock> blocks = SplitPoissonBlocks(
+            pcd, std::move(root), static_cast<int>(max_block_depth),
+            max_block_memory_mb, overlap);
+    timer.Stop();
+    time_partition = timer.GetDurationInSecond();
+    utility::LogDebug("Tiled Poisson: {} blocks, cell width {:e}",
+                      blocks.size(), cell_width);
+
+    // Every block is solved in its padded cube, rounded up to a power of two
+    // multiple of its width, at the depth that gives the cube the cell width
+    // of the global solve. The cells of all blocks thus coincide with the
+    // global cells.
+    const int padding_depth = GetPoissonPaddingDepth(overlap);
+    const std::vector<std::vector<int>> neighbors =
+            FindPoissonBlockNeighbors(blocks, overlap);
+
+    // The blocks are solved one after another in the depth-first order of the
+    // split, so that neighbors are solved close in time. A block is blended,
+    // cropped and appended to the output as soon as it and all its neighbors
+    // are solved, and its unblended mesh is released as soon as it and all
+    // its neighbors are blended. Only the meshes on the front between solved
+    // and blended blocks are kept in memory.
+    std::vector<std::unique_ptr<PoissonBlockMesh>> block_meshes(blocks.size());
+    // Number of blocks among each block and its neighbors that are not solved
+    // or not blended yet.
+    std::vector<size_t> num_unsolved(blocks.size());
+    std::vector<size_t> num_unblended(blocks.size());
+    for (size_t bidx = 0; bidx < blocks.size(); ++bidx) {
+        num_unsolved[bidx] = neighbors[bidx].size() + 1;
+        num_unblended[bidx] = neighbors[bidx].size() + 1;
+    }
+    size_t num_resident = 0;
+    size_t max_resident = 0;
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    std::vector<double> densities;
+    std::vector<int> vertex_block;
+    auto blend_and_append = [&](int bidx) {
+        utility::Timer block_timer;
+        block_timer.Start();
+        TriangleMesh block_mesh;
+        std::vector<double> block_densities;
+        BlendPoissonBlock(blocks, bidx, neighbors[bidx], overlap,
+                          2 * cell_width, block_meshes, block_mesh,
+                          block_densities);
+        block_timer.Stop();
+        time_blend += block_timer.GetDurationInSecond();
+
+        block_timer.Start();
+        CropToPoissonBlock(blocks[bidx], block_mesh, block_densities);
+        const int offset = static_cast<int>(mesh->vertices_.size());
+        mesh->vertices_.insert(mesh->vertices_.end(),
+                               block_mesh.vertices_.begin(),
+                               block_mesh.vertices_.end());
+        mesh->vertex_normals_.insert(mesh->vertex_normals_.end(),
+                                     block_mesh.vertex_normals_.begin(),
+                                     block_mesh.vertex_normals_.end());
+        mesh->vertex_colors_.insert(mesh->vertex_colors_.end(),
+                                    block_mesh.vertex_colors_.begin(),
+                                    block_mesh.vertex_colors_.end());
+        densities.insert(densities.end(), block_densities.begin(),
+                         block_densities.end());
+        vertex_block.resize(mesh->vertices_.size(), bidx);
+        for (const Eigen::Vector3i& triangle : block_mesh.triangles_) {
+            mesh->triangles_.push_back(triangle +
+                                       Eigen::Vector3i::Constant(offset));
+        }
+        block_timer.Stop();
+        time_crop += block_timer.GetDurationInSecond();
+
+        // Release the unblended meshes that are no longer needed.
+        auto release = [&](int idx) {
+            if (--num_unblended[idx] == 0) {
+                block_meshes[idx].reset();
+                num_resident--;
+            }
+        };
+        release(bidx);
+        for (int nidx : neighbors[bidx]) {
+            release(nidx);
+        }
+    };
+
+#ifdef _OPENMP
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
+                     n_threads);
+#else
+    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
+                     n_threads);
+#endif
+
+    // PoissonRecon keeps its thread pool and some of its solver state in
+    // global variables, so the blocks are solved one at a time, each with all
+    // n_threads threads.
+    for (int bidx = 0; bidx < int(blocks.size()); ++bidx) {
+        const PoissonBlock& block = blocks[bidx];
+        const double cube_width =
+                block.width_ * std::pow(2.0, double(padding_depth));
+        const Eigen::Vector3d cube_min =
+                block.min_bound_ -
+                Eigen::Vector3d::Constant((cube_width - block.width_) / 2);
+        const int depth_offset = static_cast<int>(
+                std::lround(std::log2(cube_width / root_width)));
+        const int block_depth =
+                std::max(static_cast<int>(depth) + depth_offset, 2);
+
+        utility::Timer block_timer;
+        block_timer.Start();
+        auto block_pcd = pcd.SelectByIndex(block.indices_);
+        block_meshes[bidx] = std::make_unique<PoissonBlockMesh>();
+        PoissonBlockMesh& block_mesh = *block_meshes[bidx];
+        block_mesh.mesh_ = std::make_shared<TriangleMesh>();
+        poisson::Execute<float>(*block_pcd, block_mesh.mesh_,
+                                block_mesh.densities_, block_depth, 0.f, 0.f,
+                                linear_fit, &cube_min, cube_width, FEMSigs());
+        block_pcd.reset();
+        if (!neighbors[bidx].empty() && !block_mesh.mesh_->vertices_.empty()) {
+            PointCloud vertices;
+            vertices.points_ = block_mesh.mesh_->vertices_;
+            block_mesh.kdtree_ = std::make_unique<KDTreeFlann>(vertices);
+        }
+        block_timer.Stop();
+        time_solve += block_timer.GetDurationInSecond();
+        max_resident = std::max(max_resident, ++num_resident);
+        utility::LogDebug(
+                "Tiled Poisson: block {}/{} depth {}, {} points, {} "
+                "triangles, solved in {:.3f} (s)",
+                bidx + 1, blocks.size(), block_depth, block.indices_.size(),
+                block_mesh.mesh_->triangles_.size(),
+                block_timer.GetDurationInSecond());
+
+        // Blend the blocks whose neighborhood is complete.
+        if (--num_unsolved[bidx] == 0) {
+            blend_and_append(bidx);
+        }
+        for (int nidx : neighbors[bidx]) {
+            if (--num_unsolved[nidx] == 0) {
+                blend_and_append(nidx);
+            }
+        }
+    }
 
     ThreadPool::Terminate();
+    utility::LogDebug("Tiled Poisson: at most {} of {} block meshes in memory",
+                      max_resident, blocks.size());
+
+    timer.Start();
+    if (blocks.size() > 1) {
+        WeldPoissonBlocks(vertex_block, cell_width / 2, *mesh, densities);
+        // Drop the triangles collapsed by the welding.
+        mesh->triangles_.erase(
+                std::remove_if(mesh->triangles_.begin(),
+                               mesh->triangles_.end(),
+                               [](const Eigen::Vector3i& triangle) {
+                                   return triangle(0) == triangle(1) ||
+                                          triangle(1) == triangle(2) ||
+                                          triangle(2) == triangle(0);
+                               }),
+                mesh->triangles_.end());
+    }
+    timer.Stop();
+    time_stitch = timer.GetDurationInSecond();
+
+    utility::LogDebug(
+            "Tiled Poisson timings: partition {:.3f} (s), solve {:.3f} (s), "
+            "blend {:.3f} (s), crop {:.3f} (s), stitch {:.3f} (s)",
+            time_partition, time_solve, time_blend, time_crop, time_stitch);
 
     return std::make_tuple(mesh, densities);
 }
@@ -8,6 +8,7 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <functional>
 #include <numeric>
 #include <queue>
 #include <tuple>
@@ -153,234 +154,244 @@ TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
     return *this;
 }
 
-std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
-        int number_of_iterations, double strength, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
+namespace {
 
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
-                }
-            }
+/// Vertex adjacency of a triangle mesh in compressed sparse row format. The
+/// neighbours of vertex i are col_idx_[row_ptr_[i]], ...,
+/// col_idx_[row_ptr_[i + 1] - 1].
+struct VertexAdjacencyCSR {
+    std::vector<int64_t> row_ptr_;
+    std::vector<int> col_idx_;
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        prev_vertices[vidx] +
-                        strength * (prev_vertices[vidx] * nb_size - vertex_sum);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        prev_vertex_normals[vidx] +
-                        strength * (prev_vertex_normals[vidx] * nb_size -
-                                    normal_sum);
-            }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        prev_vertex_colors[vidx] +
-                        strength * (prev_vertex_colors[vidx] * nb_size -
-                                    color_sum);
-            }
+    int64_t NumNeighbours(size_t vidx) const {
+        return row_ptr_[vidx + 1] - row_ptr_[vidx];
+    }
+};
+
+/// Builds the CSR adjacency from the adjacency list if the mesh has one,
+/// otherwise directly from the triangles with sorted, unique neighbours. The
+/// adjacency list acts as the cache of the mesh topology: it is kept up to
+/// date by the Remove* functions and carried over to the filtered mesh, so
+/// chained filters only copy it.
+VertexAdjacencyCSR ComputeVertexAdjacencyCSR(const TriangleMesh &mesh) {
+    const size_t num_vertices = mesh.vertices_.size();
+    VertexAdjacencyCSR adjacency;
+    adjacency.row_ptr_.assign(num_vertices + 1, 0);
+    if (mesh.HasAdjacencyList()) {
+        for (size_t vidx = 0; vidx < num_vertices; ++vidx) {
+            adjacency.row_ptr_[vidx + 1] = adjacency.row_ptr_[vidx] +
+                                           mesh.adjacency_list_[vidx].size();
         }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
+        adjacency.col_idx_.resize(adjacency.row_ptr_.back());
+        for (size_t vidx = 0; vidx < num_vertices; ++vidx) {
+            std::copy(mesh.adjacency_list_[vidx].begin(),
+                      mesh.adjacency_list_[vidx].end(),
+                      adjacency.col_idx_.begin() + adjacency.row_ptr_[vidx]);
         }
+        return adjacency;
     }
 
-    return mesh;
-}
+    // Every triangle adds two (possibly duplicate) neighbours per corner.
+    std::vector<int64_t> row_ptr(num_vertices + 1, 0);
+    for (const auto &triangle : mesh.triangles_) {
+        for (int i = 0; i < 3; ++i) {
+            row_ptr[triangle(i) + 1] += 2;
+        }
+    }
+    std::partial_sum(row_ptr.begin(), row_ptr.end(), row_ptr.begin());
+    std::vector<int> col_idx(row_ptr.back());
+    std::vector<int64_t> fill(row_ptr.begin(), row_ptr.end() - 1);
+    for (const auto &triangle : mesh.triangles_) {
+        for (int i = 0; i < 3; ++i) {
+            col_idx[fill[triangle(i)]++] = triangle((i + 1) % 3);
+            col_idx[fill[triangle(i)]++] = triangle((i + 2) % 3);
+        }
+    }
 
-std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
-        int number_of_iterations, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
+    // Sort and deduplicate every row in place, then compact the rows.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t vidx = 0; vidx < int64_t(num_vertices); ++vidx) {
+        auto begin = col_idx.begin() + row_ptr[vidx];
+        auto end = col_idx.begin() + row_ptr[vidx + 1];
+        std::sort(begin, end);
+        adjacency.row_ptr_[vidx + 1] = std::unique(begin, end) - begin;
+    }
+    std::partial_sum(adjacency.row_ptr_.begin(), adjacency.row_ptr_.end(),
+                     adjacency.row_ptr_.begin());
+    adjacency.col_idx_.resize(adjacency.row_ptr_.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t vidx = 0; vidx < int64_t(num_vertices); ++vidx) {
+        std::copy_n(col_idx.begin() + row_ptr[vidx],
+                    adjacency.NumNeighbours(vidx),
+                    adjacency.col_idx_.begin() + adjacency.row_ptr_[vidx]);
+    }
+    return adjacency;
+}
 
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
+/// Linear vertex filter \f$x_o = a_i x_i + b_i \sum_{n \in N} w_n x_n\f$
+/// evaluated as a sparse matrix-vector product over the CSR adjacency. If
+/// \p weights is empty, all neighbours have weight one.
+struct VertexFilter {
+    std::vector<double> weights_;
+    std::vector<double> a_;
+    std::vector<double> b_;
+
+    void Apply(const VertexAdjacencyCSR &adjacency,
+               const std::vector<Eigen::Vector3d> &input,
+               std::vector<Eigen::Vector3d> &output) const {
+        output.resize(input.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t vidx = 0; vidx < int64_t(input.size()); ++vidx) {
+            Eigen::Vector3d sum(0, 0, 0);
+            for (int64_t k = adjacency.row_ptr_[vidx];
+                 k < adjacency.row_ptr_[vidx + 1]; ++k) {
+                if (weights_.empty()) {
+                    sum += input[adjacency.col_idx_[k]];
+                } else {
+                    sum += weights_[k] * input[adjacency.col_idx_[k]];
                 }
             }
-
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        (prev_vertex_normals[vidx] + normal_sum) /
-                        (1 + nb_size);
-            }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        (prev_vertex_colors[vidx] + color_sum) / (1 + nb_size);
-            }
-        }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
+            output[vidx] = a_[vidx] * input[vidx] + b_[vidx] * sum;
         }
     }
-    return mesh;
-}
+};
 
-void TriangleMesh::FilterSmoothLaplacianHelper(
-        std::shared_ptr<TriangleMesh> &mesh,
-        const std::vector<Eigen::Vector3d> &prev_vertices,
-        const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-        const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
-        double lambda_filter,
-        bool filter_vertex,
-        bool filter_normal,
-        bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-        Eigen::Vector3d vertex_sum(0, 0, 0);
-        Eigen::Vector3d normal_sum(0, 0, 0);
-        Eigen::Vector3d color_sum(0, 0, 0);
+/// Sets \p filter to one Laplacian step with inverse distance weights of the
+/// current \p vertices: \f$x_o = x_i + \lambda (\sum_{n \in N} w_n x_n /
+/// \sum_{n \in N} w_n - x_i)\f$. Isolated vertices are kept.
+void SetLaplacianFilter(const VertexAdjacencyCSR &adjacency,
+                        const std::vector<Eigen::Vector3d> &vertices,
+                        double lambda_filter,
+                        VertexFilter &filter) {
+    filter.weights_.resize(adjacency.col_idx_.size());
+    filter.a_.resize(vertices.size());
+    filter.b_.resize(vertices.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t vidx = 0; vidx < int64_t(vertices.size()); ++vidx) {
         double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
-            auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
-            double dist = diff.norm();
-            double weight = 1. / (dist + 1e-12);
-            total_weight += weight;
-
-            if (filter_vertex) {
-                vertex_sum += weight * prev_vertices[nbidx];
-            }
-            if (filter_normal) {
-                normal_sum += weight * prev_vertex_normals[nbidx];
-            }
-            if (filter_color) {
-                color_sum += weight * prev_vertex_colors[nbidx];
-            }
+        for (int64_t k = adjacency.row_ptr_[vidx];
+             k < adjacency.row_ptr_[vidx + 1]; ++k) {
+            double dist =
+                    (vertices[vidx] - vertices[adjacency.col_idx_[k]]).norm();
+            filter.weights_[k] = 1. / (dist + 1e-12);
+            total_weight += filter.weights_[k];
+        }
+        if (total_weight > 0) {
+            filter.a_[vidx] = 1 - lambda_filter;
+            filter.b_[vidx] = lambda_filter / total_weight;
+        } else {
+            filter.a_[vidx] = 1;
+            filter.b_[vidx] = 0;
         }
+    }
+}
 
+/// Applies \p number_of_steps filter steps to the attributes selected by
+/// \p scope. Before every step, \p update_filter sets the coefficients from
+/// the current mesh and the step index. All attributes of a step are filtered
+/// with the same coefficients.
+std::shared_ptr<TriangleMesh> FilterVertexAttributes(
+        const TriangleMesh &input,
+        int number_of_steps,
+        MeshBase::FilterScope scope,
+        const std::function<void(const TriangleMesh &,
+                                 const VertexAdjacencyCSR &,
+                                 int,
+                                 VertexFilter &)> &update_filter) {
+    bool filter_vertex = scope == MeshBase::FilterScope::All ||
+                         scope == MeshBase::FilterScope::Vertex;
+    bool filter_normal = (scope == MeshBase::FilterScope::All ||
+                          scope == MeshBase::FilterScope::Normal) &&
+                         input.HasVertexNormals();
+    bool filter_color = (scope == MeshBase::FilterScope::All ||
+                         scope == MeshBase::FilterScope::Color) &&
+                        input.HasVertexColors();
+
+    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = input.vertices_;
+    mesh->vertex_normals_ = input.vertex_normals_;
+    mesh->vertex_colors_ = input.vertex_colors_;
+    mesh->triangles_ = input.triangles_;
+    mesh->adjacency_list_ = input.adjacency_list_;
+
+    // The sparsity pattern is built once and reused by all steps.
+    const VertexAdjacencyCSR adjacency = ComputeVertexAdjacencyCSR(input);
+    VertexFilter filter;
+    std::vector<Eigen::Vector3d> buffer;
+    auto apply = [&](std::vector<Eigen::Vector3d> &values) {
+        filter.Apply(adjacency, values, buffer);
+        std::swap(values, buffer);
+    };
+    for (int step = 0; step < number_of_steps; ++step) {
+        update_filter(*mesh, adjacency, step, filter);
         if (filter_vertex) {
-            mesh->vertices_[vidx] = prev_vertices[vidx] +
-                                    lambda_filter * (vertex_sum / total_weight -
-                                                     prev_vertices[vidx]);
+            apply(mesh->vertices_);
         }
         if (filter_normal) {
-            mesh->vertex_normals_[vidx] =
-                    prev_vertex_normals[vidx] +
-                    lambda_filter * (normal_sum / total_weight -
-                                     prev_vertex_normals[vidx]);
+            apply(mesh->vertex_normals_);
         }
         if (filter_color) {
-            mesh->vertex_colors_[vidx] =
-                    prev_vertex_colors[vidx] +
-                    lambda_filter * (color_sum / total_weight -
-                                     prev_vertex_colors[vidx]);
+            apply(mesh->vertex_colors_);
         }
     }
+    return mesh;
+}
+
+}  // namespace
+
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
+        int number_of_iterations, double strength, FilterScope scope) const {
+    return FilterVertexAttributes(
+            *this, number_of_iterations, scope,
+            [strength](const TriangleMesh &mesh,
+                       const VertexAdjacencyCSR &adjacency, int step,
+                       VertexFilter &filter) {
+                if (step > 0) {
+                    return;
+                }
+                filter.a_.resize(mesh.vertices_.size());
+                filter.b_.assign(mesh.vertices_.size(), -strength);
+                for (size_t vidx = 0; vidx < mesh.vertices_.size(); ++vidx) {
+                    filter.a_[vidx] =
+                            1 + strength * adjacency.NumNeighbours(vidx);
+                }
+            });
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
+        int number_of_iterations, FilterScope scope) const {
+    return FilterVertexAttributes(
+            *this, number_of_iterations, scope,
+            [](const TriangleMesh &mesh, const VertexAdjacencyCSR &adjacency,
+               int step, VertexFilter &filter) {
+                if (step > 0) {
+                    return;
+                }
+                filter.a_.resize(mesh.vertices_.size());
+                for (size_t vidx = 0; vidx < mesh.vertices_.size(); ++vidx) {
+                    filter.a_[vidx] =
+                            1. / (1 + adjacency.NumNeighbours(vidx));
+                }
+                filter.b_ = filter.a_;
+            });
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
         int number_of_iterations,
         double lambda_filter,
         FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda_filter, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
-    }
-    return mesh;
+    return FilterVertexAttributes(
+            *this, number_of_iterations, scope,
+            [lambda_filter](const TriangleMesh &mesh,
+                            const VertexAdjacencyCSR &adjacency, int,
+                            VertexFilter &filter) {
+                SetLaplacianFilter(adjacency, mesh.vertices_, lambda_filter,
+                                   filter);
+            });
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
@@ -388,47 +399,14 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
         double lambda_filter,
         double mu,
         FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda_filter, filter_vertex, filter_normal,
-                                    filter_color);
-        std::swap(mesh->vertices_, prev_vertices);
-        std::swap(mesh->vertex_normals_, prev_vertex_normals);
-        std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
-    }
-    return mesh;
+    return FilterVertexAttributes(
+            *this, 2 * number_of_iterations, scope,
+            [lambda_filter, mu](const TriangleMesh &mesh,
+                                const VertexAdjacencyCSR &adjacency, int step,
+                                VertexFilter &filter) {
+                SetLaplacianFilter(adjacency, mesh.vertices_,
+                                   step % 2 == 0 ? lambda_filter : mu, filter);
+            });
 }
 
 std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
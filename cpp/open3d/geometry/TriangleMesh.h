@@ -511,6 +511,25 @@ public:
             std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
             std::vector<size_t> *pt_map = nullptr);
 
+    /// \brief Computes the same alpha shape as CreateFromPointCloudAlphaShape,
+    /// but tetrahedralizes overlapping spatial tiles of the point cloud in
+    /// parallel instead of the full point set. Each tile contains all points
+    /// within alpha of it, so the union of the alpha tetrahedra of the tiles
+    /// equals the global one while memory is bounded by the tile size.
+    /// \param pcd PointCloud for what the alpha shape should be computed.
+    /// \param alpha parameter to control the shape. A very big value will
+    /// give a shape close to the convex hull.
+    /// \param tile_size Edge length of the cubic tiles. Set to 0 to choose it
+    /// from the number of points.
+    /// \param n_threads Number of threads used for the tiles. Set to -1 to
+    /// automatically determine it.
+    /// \return TriangleMesh of the alpha shape.
+    static std::shared_ptr<TriangleMesh> CreateFromPointCloudAlphaShapeTiled(
+            const PointCloud &pcd,
+            double alpha,
+            double tile_size = 0,
+            int n_threads = -1);
+
     /// Function that computes a triangle mesh from an oriented PointCloud \p
     /// pcd. This implements the Ball Pivoting algorithm proposed in F.
     /// Bernardini et al., "The ball-pivoting algorithm for surface
@@ -524,8 +543,14 @@ public:
     /// reconstructed. Has to contain normals.
     /// \param radii defines the radii of
     /// the ball that are used for the surface reconstruction.
+    /// \param n_threads Number of threads used for reconstruction. The default
+    /// 1 grows a single front sequentially. With more threads, or -1 to
+    /// automatically determine it, large point clouds are split into spatial
+    /// tiles that are reconstructed in parallel and stitched afterwards.
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
-            const PointCloud &pcd, const std::vector<double> &radii);
+            const PointCloud &pcd,
+            const std::vector<double> &radii,
+            int n_threads = 1);
 
     /// \brief Function that computes a triangle mesh from an oriented
     /// PointCloud pcd. This implements the Screened Poisson Reconstruction
@@ -557,6 +582,48 @@ public:
                                 bool linear_fit = false,
                                 int n_threads = -1);
 
+    /// \brief Function that computes a triangle mesh from an oriented
+    /// PointCloud pcd with a tiled variant of the Screened Poisson
+    /// Reconstruction (cf. CreateFromPointCloudPoisson) that bounds the memory
+    /// usage. The bounding cube is recursively split into octants until every
+    /// block fits the depth and memory limits. Each block is solved
+    /// independently on its points, padded by \p overlap, with the cell size
+    /// of the global tree at \p depth. The meshes of adjacent blocks are
+    /// blended across the overlap with partition of unity weights, cropped to
+    /// their blocks and stitched at the seams. The blocks are solved one at a
+    /// time and each block is blended as soon as its neighbors are solved, so
+    /// only the meshes of the blocks on the front of the solve are kept in
+    /// memory besides the output.
+    ///
+    /// \param pcd PointCloud with normals and optionally colors.
+    /// \param depth Maximum depth of the global tree, i.e., the finest cells
+    /// have the same size as with CreateFromPointCloudPoisson at this depth.
+    /// \param max_block_depth Maximum depth of the tree of a single block. The
+    /// tree of a block with overlap spans twice its width, so it is one level
+    /// deeper than the block itself.
+    /// \param max_block_memory_mb Estimated memory limit of a single block in
+    /// MB. Blocks exceeding it are split further. Set to 0 to only use \p
+    /// max_block_depth.
+    /// \param overlap Padding of each block relative to its width, in [0,
+    /// 0.5].
+    /// \param scale Specifies the ratio between the diameter of the cube used
+    /// for reconstruction and the diameter of the samples' bounding cube.
+    /// \param linear_fit If true, the reconstructor use linear interpolation to
+    /// estimate the positions of iso-vertices.
+    /// \param n_threads Number of threads used to solve each block. Set to -1
+    /// to automatically determine it.
+    /// \return The estimated TriangleMesh, and per vertex density values that
+    /// can be used to to trim the mesh.
+    static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+    CreateFromPointCloudPoissonTiled(const PointCloud &pcd,
+                                     size_t depth = 10,
+                                     size_t max_block_depth = 8,
+                                     double max_block_memory_mb = 0,
+                                     double overlap = 0.125,
+                                     float scale = 1.1f,
+                                     bool linear_fit = false,
+                                     int n_threads = -1);
+
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \p radius defines the
     /// distance from the center to the mesh vertices.
@@ -736,17 +803,6 @@ protected:
     // Forward child class type to avoid indirect nonvirtual base
     TriangleMesh(Geometry::GeometryType type) : MeshBase(type) {}
 
-    void FilterSmoothLaplacianHelper(
-            std::shared_ptr<TriangleMesh> &mesh,
-            const std::vector<Eigen::Vector3d> &prev_vertices,
-            const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-            const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
-            double lambda_filter,
-            bool filter_vertex,
-            bool filter_normal,
-            bool filter_color) const;
-
     /// \brief Function that computes for each edge in the triangle mesh and
     /// passed as parameter edges_to_vertices the cot weight.
     ///
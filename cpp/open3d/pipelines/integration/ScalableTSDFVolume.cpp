@@ -13,6 +13,7 @@
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -36,63 +37,71 @@ void ScalableTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
-    if ((image.depth_.num_of_channels_ != 1) ||
-        (image.depth_.bytes_per_channel_ != 4) ||
-        (color_type_ == TSDFVolumeColorType::RGB8 &&
-         image.color_.num_of_channels_ != 3) ||
-        (color_type_ == TSDFVolumeColorType::RGB8 &&
-         image.color_.bytes_per_channel_ != 1) ||
-        (color_type_ == TSDFVolumeColorType::Gray32 &&
-         image.color_.num_of_channels_ != 1) ||
-        (color_type_ == TSDFVolumeColorType::Gray32 &&
-         image.color_.bytes_per_channel_ != 4)) {
-        utility::LogError("Unsupported image format.");
+    CheckImage(image, intrinsic);
+    auto depth2cameradistance =
+            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
+                    intrinsic);
+    for (const auto &index :
+         GetTouchedVolumeUnits(image, intrinsic, extrinsic)) {
+        auto volume = OpenVolumeUnit(index);
+        volume->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance);
     }
-    if ((image.depth_.width_ != intrinsic.width_) ||
-        (image.depth_.height_ != intrinsic.height_)) {
+}
+
+void ScalableTSDFVolume::IntegrateMany(
+        const std::vector<geometry::RGBDImage> &images,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &extrinsics) {
+    if (images.size() != extrinsics.size()) {
         utility::LogError(
-                "Depth image size is ({} x {}), but got ({} x {}) from "
-                "intrinsic.",
-                image.depth_.width_, image.depth_.height_, intrinsic.width_,
-                intrinsic.height_);
+                "Number of images ({}) and extrinsics ({}) differ.",
+                images.size(), extrinsics.size());
     }
-    if (color_type_ != TSDFVolumeColorType::NoColor &&
-        (image.color_.width_ != intrinsic.width_ ||
-         image.color_.height_ != intrinsic.height_)) {
-        utility::LogError(
-                "Color image size is ({} x {}), but got ({} x {}) from "
-                "intrinsic.",
-                image.color_.width_, image.color_.height_, intrinsic.width_,
-                intrinsic.height_);
+    for (const auto &image : images) {
+        CheckImage(image, intrinsic);
     }
-
     auto depth2cameradistance =
             geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
                     intrinsic);
-    auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
-            image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
-            depth_sampling_stride_);
-    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
-                    }
-                }
+
+    const int num_images = int(images.size());
+    std::vector<std::vector<Eigen::Vector3i>> touched_volume_units(
+            num_images);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_images; i++) {
+        touched_volume_units[i] =
+                GetTouchedVolumeUnits(images[i], intrinsic, extrinsics[i]);
+    }
+
+    // Open the touched units serially and list the images touching each of
+    // them in order. Units are then integrated in parallel, each applying its
+    // images in the same order as successive calls to Integrate().
+    std::unordered_map<Eigen::Vector3i, size_t,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            unit_to_task;
+    std::vector<std::pair<UniformTSDFVolume *, std::vector<int>>> tasks;
+    for (int i = 0; i < num_images; i++) {
+        for (const auto &index : touched_volume_units[i]) {
+            auto it = unit_to_task.find(index);
+            if (it == unit_to_task.end()) {
+                it = unit_to_task.emplace(index, tasks.size()).first;
+                tasks.emplace_back(OpenVolumeUnit(index).get(),
+                                   std::vector<int>());
             }
+            tasks[it->second].second.push_back(i);
+        }
+    }
+
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int k = 0; k < int(tasks.size()); k++) {
+        for (int i : tasks[k].second) {
+            tasks[k].first->IntegrateWithDepthToCameraDistanceMultiplier(
+                    images[i], intrinsic, extrinsics[i],
+                    *depth2cameradistance);
         }
     }
 }
@@ -361,6 +370,69 @@ ScalableTSDFVolume::ExtractVoxelPointCloud() {
     return voxel;
 }
 
+void ScalableTSDFVolume::CheckImage(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic) const {
+    if ((image.depth_.num_of_channels_ != 1) ||
+        (image.depth_.bytes_per_channel_ != 4) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.num_of_channels_ != 3) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.bytes_per_channel_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.num_of_channels_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.bytes_per_channel_ != 4)) {
+        utility::LogError("Unsupported image format.");
+    }
+    if ((image.depth_.width_ != intrinsic.width_) ||
+        (image.depth_.height_ != intrinsic.height_)) {
+        utility::LogError(
+                "Depth image size is ({} x {}), but got ({} x {}) from "
+                "intrinsic.",
+                image.depth_.width_, image.depth_.height_, intrinsic.width_,
+                intrinsic.height_);
+    }
+    if (color_type_ != TSDFVolumeColorType::NoColor &&
+        (image.color_.width_ != intrinsic.width_ ||
+         image.color_.height_ != intrinsic.height_)) {
+        utility::LogError(
+                "Color image size is ({} x {}), but got ({} x {}) from "
+                "intrinsic.",
+                image.color_.width_, image.color_.height_, intrinsic.width_,
+                intrinsic.height_);
+    }
+}
+
+std::vector<Eigen::Vector3i> ScalableTSDFVolume::GetTouchedVolumeUnits(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic) const {
+    auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
+            image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
+            depth_sampling_stride_);
+    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
+            touched_set;
+    std::vector<Eigen::Vector3i> touched_volume_units;
+    for (const auto &point : pointcloud->points_) {
+        auto min_bound = LocateVolumeUnit(
+                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+        auto max_bound = LocateVolumeUnit(
+                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+        for (auto x = min_bound(0); x <= max_bound(0); x++) {
+            for (auto y = min_bound(1); y <= max_bound(1); y++) {
+                for (auto z = min_bound(2); z <= max_bound(2); z++) {
+                    auto loc = Eigen::Vector3i(x, y, z);
+                    if (touched_set.insert(loc).second) {
+                        touched_volume_units.push_back(loc);
+                    }
+                }
+            }
+        }
+    }
+    return touched_volume_units;
+}
+
 std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
         const Eigen::Vector3i &index) {
     auto &unit = volume_units_[index];
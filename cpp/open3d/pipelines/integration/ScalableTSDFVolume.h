@@ -9,8 +9,10 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/pipelines/integration/TSDFVolume.h"
+#include "open3d/utility/Eigen.h"
 #include "open3d/utility/Helper.h"
 
 namespace open3d {
@@ -61,6 +63,21 @@ public:
     void Integrate(const geometry::RGBDImage &image,
                    const camera::PinholeCameraIntrinsic &intrinsic,
                    const Eigen::Matrix4d &extrinsic) override;
+    /// \brief Integrates several frames in parallel.
+    ///
+    /// The volume units touched by the frames are allocated first. The units
+    /// are then updated in parallel, each integrating the frames that touch it
+    /// in the given order, so the result equals calling Integrate() on each
+    /// frame in turn.
+    ///
+    /// \param images RGBD frames sharing the same \p intrinsic.
+    /// \param intrinsic Camera intrinsic.
+    /// \param extrinsics Camera extrinsic of each frame.
+    void IntegrateMany(
+            const std::vector<geometry::RGBDImage> &images,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &extrinsics);
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
     /// Debug function to extract the voxel data into a point cloud.
@@ -80,12 +97,22 @@ public:
             volume_units_;
 
 private:
-    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) {
+    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) const {
         return Eigen::Vector3i((int)std::floor(point(0) / volume_unit_length_),
                                (int)std::floor(point(1) / volume_unit_length_),
                                (int)std::floor(point(2) / volume_unit_length_));
     }
 
+    /// Throws if \p image does not match \p intrinsic and the color type.
+    void CheckImage(const geometry::RGBDImage &image,
+                    const camera::PinholeCameraIntrinsic &intrinsic) const;
+
+    /// Indices of the volume units within sdf_trunc_ of the depth samples.
+    std::vector<Eigen::Vector3i> GetTouchedVolumeUnits(
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic) const;
+
     std::shared_ptr<UniformTSDFVolume> OpenVolumeUnit(
             const Eigen::Vector3i &index);
 
@@ -9,94 +9,19 @@
 
 #include <Eigen/Dense>
 #include <memory>
+#include <vector>
 
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace pipelines {
 namespace odometry {
 
-static std::tuple<geometry::Image, geometry::Image> InitializeCorrespondenceMap(
-        int width, int height) {
-    // initialization: filling with any (u,v) to (-1,-1)
-    geometry::Image correspondence_map;
-    geometry::Image depth_buffer;
-    correspondence_map.Prepare(width, height, 2, 4);
-    depth_buffer.Prepare(width, height, 1, 4);
-    for (int v = 0; v < correspondence_map.height_; v++) {
-        for (int u = 0; u < correspondence_map.width_; u++) {
-            *correspondence_map.PointerAt<int>(u, v, 0) = -1;
-            *correspondence_map.PointerAt<int>(u, v, 1) = -1;
-            *depth_buffer.PointerAt<float>(u, v, 0) = -1.0f;
-        }
-    }
-    return std::make_tuple(correspondence_map, depth_buffer);
-}
-
-static inline void AddElementToCorrespondenceMap(
-        geometry::Image &correspondence_map,
-        geometry::Image &depth_buffer,
-        int u_s,
-        int v_s,
-        int u_t,
-        int v_t,
-        float transformed_d_t) {
-    int exist_u_t, exist_v_t;
-    double exist_d_t;
-    exist_u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-    exist_v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-    if (exist_u_t != -1 && exist_v_t != -1) {
-        exist_d_t = *depth_buffer.PointerAt<float>(u_s, v_s);
-        if (transformed_d_t <
-            exist_d_t) {  // update nearer point as correspondence
-            *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-            *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-            *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-        }
-    } else {  // register correspondence
-        *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-        *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-        *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-    }
-}
-
-static void MergeCorrespondenceMaps(geometry::Image &correspondence_map,
-                                    geometry::Image &depth_buffer,
-                                    geometry::Image &correspondence_map_part,
-                                    geometry::Image &depth_buffer_part) {
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                float transformed_d_t =
-                        *depth_buffer_part.PointerAt<float>(u_s, v_s);
-                AddElementToCorrespondenceMap(correspondence_map, depth_buffer,
-                                              u_s, v_s, u_t, v_t,
-                                              transformed_d_t);
-            }
-        }
-    }
-}
-
-static int CountCorrespondence(const geometry::Image &correspondence_map) {
-    int correspondence_count = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                correspondence_count++;
-            }
-        }
-    }
-    return correspondence_count;
-}
-
 CorrespondenceSetPixelWise ComputeCorrespondence(
         const Eigen::Matrix3d &intrinsic_matrix,
         const Eigen::Matrix4d &extrinsic,
@@ -107,65 +32,65 @@ CorrespondenceSetPixelWise ComputeCorrespondence(
     const Eigen::Matrix3d K_inv = K.inverse();
     const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
     const Eigen::Matrix3d KRK_inv = K * R * K_inv;
-    Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
-
-    geometry::Image correspondence_map;
-    geometry::Image depth_buffer;
-    std::tie(correspondence_map, depth_buffer) =
-            InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-
-#pragma omp parallel
-    {
-        geometry::Image correspondence_map_private;
-        geometry::Image depth_buffer_private;
-        std::tie(correspondence_map_private, depth_buffer_private) =
-                InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-#pragma omp for nowait
-        for (int v_s = 0; v_s < depth_s.height_; v_s++) {
-            for (int u_s = 0; u_s < depth_s.width_; u_s++) {
-                double d_s = *depth_s.PointerAt<float>(u_s, v_s);
-                if (!std::isnan(d_s)) {
-                    Eigen::Vector3d uv_in_s =
-                            d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
-                    double transformed_d_s = uv_in_s(2);
-                    int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
-                    int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
-                    if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
-                        v_t < depth_t.height_) {
-                        double d_t = *depth_t.PointerAt<float>(u_t, v_t);
-                        if (!std::isnan(d_t) &&
-                            std::abs(transformed_d_s - d_t) <=
-                                    option.depth_diff_max_) {
-                            AddElementToCorrespondenceMap(
-                                    correspondence_map_private,
-                                    depth_buffer_private, u_s, v_s, u_t, v_t,
-                                    (float)d_s);
-                        }
-                    }
-                }
+    const Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
+
+    // Each source pixel has at most one correspondence, so the rows are
+    // processed independently into a flat image of target pixel indices (-1
+    // for none) and compacted in a second pass.
+    const int width_s = depth_s.width_;
+    const int height_s = depth_s.height_;
+    const int width_t = depth_t.width_;
+    const int height_t = depth_t.height_;
+    const double depth_diff_max = option.depth_diff_max_;
+    std::vector<int> correspondence_map(size_t(width_s) * height_s);
+    std::vector<int> row_offsets(height_s + 1, 0);
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int v_s = 0; v_s < height_s; v_s++) {
+        const float *depth_s_row = depth_s.PointerAt<float>(0, v_s);
+        int *map_row = correspondence_map.data() + size_t(v_s) * width_s;
+        // K R K^-1 (u_s, v_s, 1) = u_s * ray_du + ray_row.
+        const Eigen::Vector3d ray_du = KRK_inv.col(0);
+        const Eigen::Vector3d ray_row =
+                KRK_inv.col(1) * double(v_s) + KRK_inv.col(2);
+        int count = 0;
+        for (int u_s = 0; u_s < width_s; u_s++) {
+            map_row[u_s] = -1;
+            const double d_s = depth_s_row[u_s];
+            if (std::isnan(d_s)) continue;
+            const Eigen::Vector3d uv_in_s =
+                    d_s * (ray_du * double(u_s) + ray_row) + Kt;
+            const double transformed_d_s = uv_in_s(2);
+            const int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
+            const int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
+            if (u_t < 0 || u_t >= width_t || v_t < 0 || v_t >= height_t) {
+                continue;
+            }
+            const float d_t = *depth_t.PointerAt<float>(u_t, v_t);
+            if (!std::isnan(d_t) &&
+                std::abs(transformed_d_s - d_t) <= depth_diff_max) {
+                map_row[u_s] = v_t * width_t + u_t;
+                count++;
             }
         }
-#pragma omp critical(ComputeCorrespondence)
-        {
-            MergeCorrespondenceMaps(correspondence_map, depth_buffer,
-                                    correspondence_map_private,
-                                    depth_buffer_private);
-
-        }  //    omp critical
-    }      //    omp parallel
-
-    CorrespondenceSetPixelWise correspondence;
-    int correspondence_count = CountCorrespondence(correspondence_map);
-    correspondence.resize(correspondence_count);
-    int cnt = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                Eigen::Vector4i pixel_correspondence(u_s, v_s, u_t, v_t);
-                correspondence[cnt] = pixel_correspondence;
-                cnt++;
+        row_offsets[v_s + 1] = count;
+    }
+    for (int v_s = 0; v_s < height_s; v_s++) {
+        row_offsets[v_s + 1] += row_offsets[v_s];
+    }
+
+    CorrespondenceSetPixelWise correspondence(row_offsets[height_s]);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int v_s = 0; v_s < height_s; v_s++) {
+        const int *map_row = correspondence_map.data() + size_t(v_s) * width_s;
+        int cnt = row_offsets[v_s];
+        for (int u_s = 0; u_s < width_s; u_s++) {
+            const int idx_t = map_row[u_s];
+            if (idx_t >= 0) {
+                correspondence[cnt++] = Eigen::Vector4i(
+                        u_s, v_s, idx_t % width_t, idx_t / width_t);
             }
         }
     }
@@ -406,24 +331,13 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         const OdometryOption &option) {
     CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
             intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
-    int corresps_count = (int)correspondence.size();
-
-    auto f_lambda =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r, std::vector<double> &w) {
-                jacobian_method.ComputeJacobianAndResidual(
-                        i, J_r, r, w, source, target, source_xyz, target_dx,
-                        target_dy, intrinsic, extrinsic_initial,
-                        correspondence);
-            };
     utility::LogDebug("Iter : {:d}, Level : {:d}, ", iter, level);
     Eigen::Matrix6d JTJ;
     Eigen::Vector6d JTr;
     double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    f_lambda, corresps_count);
+    std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+            source, target, source_xyz, target_dx, target_dy, intrinsic,
+            extrinsic_initial, correspondence);
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
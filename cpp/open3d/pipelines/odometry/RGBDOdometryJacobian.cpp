@@ -10,6 +10,8 @@
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/Odometry.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 
@@ -18,10 +20,208 @@ namespace {
 const double SOBEL_SCALE = 0.125;
 const double LAMBDA_HYBRID_DEPTH = 0.968;
 
+/// Inlined counterpart of Image::PointerAt for float images.
+inline float FloatAt(const geometry::Image &image, int u, int v, int ch = 0) {
+    return reinterpret_cast<const float *>(
+            image.data_.data())[(v * image.width_ + u) *
+                                        image.num_of_channels_ +
+                                ch];
+}
+
+/// Per-call constants shared by the Jacobians of all correspondences.
+struct JacobianContext {
+    JacobianContext(const geometry::RGBDImage &source,
+                    const geometry::RGBDImage &target,
+                    const geometry::Image &source_xyz,
+                    const geometry::RGBDImage &target_dx,
+                    const geometry::RGBDImage &target_dy,
+                    const Eigen::Matrix3d &intrinsic,
+                    const Eigen::Matrix4d &extrinsic)
+        : source_(source),
+          target_(target),
+          source_xyz_(source_xyz),
+          target_dx_(target_dx),
+          target_dy_(target_dy),
+          R_(extrinsic.block<3, 3>(0, 0)),
+          t_(extrinsic.block<3, 1>(0, 3)),
+          fx_(intrinsic(0, 0)),
+          fy_(intrinsic(1, 1)) {}
+
+    /// Source point of pixel (u_s, v_s) transformed to the target frame.
+    Eigen::Vector3d TransformedPoint(int u_s, int v_s) const {
+        return R_ * Eigen::Vector3d(FloatAt(source_xyz_, u_s, v_s, 0),
+                                    FloatAt(source_xyz_, u_s, v_s, 1),
+                                    FloatAt(source_xyz_, u_s, v_s, 2)) +
+               t_;
+    }
+
+    const geometry::RGBDImage &source_;
+    const geometry::RGBDImage &target_;
+    const geometry::Image &source_xyz_;
+    const geometry::RGBDImage &target_dx_;
+    const geometry::RGBDImage &target_dy_;
+    const Eigen::Matrix3d R_;
+    const Eigen::Vector3d t_;
+    const double fx_;
+    const double fy_;
+};
+
+/// Jacobian \p J and residual \p r of the color term of a correspondence.
+inline void ComputeColorJacobianAndResidual(const JacobianContext &ctx,
+                                            const Eigen::Vector4i &corresp,
+                                            Eigen::Vector6d &J,
+                                            double &r) {
+    const int u_s = corresp(0);
+    const int v_s = corresp(1);
+    const int u_t = corresp(2);
+    const int v_t = corresp(3);
+    const double diff = FloatAt(ctx.target_.color_, u_t, v_t) -
+                        FloatAt(ctx.source_.color_, u_s, v_s);
+    const double dIdx = SOBEL_SCALE * FloatAt(ctx.target_dx_.color_, u_t, v_t);
+    const double dIdy = SOBEL_SCALE * FloatAt(ctx.target_dy_.color_, u_t, v_t);
+    const Eigen::Vector3d p3d_trans = ctx.TransformedPoint(u_s, v_s);
+    const double invz = 1. / p3d_trans(2);
+    const double c0 = dIdx * ctx.fx_ * invz;
+    const double c1 = dIdy * ctx.fy_ * invz;
+    const double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
+
+    J(0) = -p3d_trans(2) * c1 + p3d_trans(1) * c2;
+    J(1) = p3d_trans(2) * c0 - p3d_trans(0) * c2;
+    J(2) = -p3d_trans(1) * c0 + p3d_trans(0) * c1;
+    J(3) = c0;
+    J(4) = c1;
+    J(5) = c2;
+    r = diff;
+}
+
+/// Jacobians \p J and residuals \p r of the color (0) and depth (1) terms of
+/// a correspondence.
+inline void ComputeHybridJacobianAndResidual(const JacobianContext &ctx,
+                                             const Eigen::Vector4i &corresp,
+                                             Eigen::Vector6d *J,
+                                             double *r) {
+    static const double sqrt_lamba_dep = sqrt(LAMBDA_HYBRID_DEPTH);
+    static const double sqrt_lambda_img = sqrt(1.0 - LAMBDA_HYBRID_DEPTH);
+
+    const int u_s = corresp(0);
+    const int v_s = corresp(1);
+    const int u_t = corresp(2);
+    const int v_t = corresp(3);
+    const double diff_photo = FloatAt(ctx.target_.color_, u_t, v_t) -
+                              FloatAt(ctx.source_.color_, u_s, v_s);
+    const double dIdx = SOBEL_SCALE * FloatAt(ctx.target_dx_.color_, u_t, v_t);
+    const double dIdy = SOBEL_SCALE * FloatAt(ctx.target_dy_.color_, u_t, v_t);
+    double dDdx = SOBEL_SCALE * FloatAt(ctx.target_dx_.depth_, u_t, v_t);
+    double dDdy = SOBEL_SCALE * FloatAt(ctx.target_dy_.depth_, u_t, v_t);
+    if (std::isnan(dDdx)) dDdx = 0;
+    if (std::isnan(dDdy)) dDdy = 0;
+    const Eigen::Vector3d p3d_trans = ctx.TransformedPoint(u_s, v_s);
+
+    const double diff_geo =
+            FloatAt(ctx.target_.depth_, u_t, v_t) - p3d_trans(2);
+    const double invz = 1. / p3d_trans(2);
+    const double c0 = dIdx * ctx.fx_ * invz;
+    const double c1 = dIdy * ctx.fy_ * invz;
+    const double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
+    const double d0 = dDdx * ctx.fx_ * invz;
+    const double d1 = dDdy * ctx.fy_ * invz;
+    const double d2 = -(d0 * p3d_trans(0) + d1 * p3d_trans(1)) * invz;
+
+    J[0](0) = sqrt_lambda_img * (-p3d_trans(2) * c1 + p3d_trans(1) * c2);
+    J[0](1) = sqrt_lambda_img * (p3d_trans(2) * c0 - p3d_trans(0) * c2);
+    J[0](2) = sqrt_lambda_img * (-p3d_trans(1) * c0 + p3d_trans(0) * c1);
+    J[0](3) = sqrt_lambda_img * (c0);
+    J[0](4) = sqrt_lambda_img * (c1);
+    J[0](5) = sqrt_lambda_img * (c2);
+    r[0] = sqrt_lambda_img * diff_photo;
+
+    J[1](0) = sqrt_lamba_dep *
+              ((-p3d_trans(2) * d1 + p3d_trans(1) * d2) - p3d_trans(1));
+    J[1](1) = sqrt_lamba_dep *
+              ((p3d_trans(2) * d0 - p3d_trans(0) * d2) + p3d_trans(0));
+    J[1](2) = sqrt_lamba_dep * ((-p3d_trans(1) * d0 + p3d_trans(0) * d1));
+    J[1](3) = sqrt_lamba_dep * (d0);
+    J[1](4) = sqrt_lamba_dep * (d1);
+    J[1](5) = sqrt_lamba_dep * (d2 - 1.0f);
+    r[1] = sqrt_lamba_dep * diff_geo;
+}
+
+/// Adds the upper triangle of J J^T (21 entries), J r (6) and r^2 (1) to \p A.
+inline void AccumulateJTJandJTr(const Eigen::Vector6d &J, double r, double *A) {
+    int offset = 0;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j <= i; j++) {
+            A[offset++] += J(i) * J(j);
+        }
+    }
+    for (int i = 0; i < 6; i++) {
+        A[21 + i] += J(i) * r;
+    }
+    A[27] += r * r;
+}
+
+/// Reduces \p accumulate(row, A) over all rows with per-thread sums, which
+/// are merged once per thread.
+template <typename Func>
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ReduceJTJandJTr(
+        int num_rows, Func accumulate) {
+    double A[28] = {0};
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        double A_private[28] = {0};
+#pragma omp for schedule(static) nowait
+        for (int row = 0; row < num_rows; row++) {
+            accumulate(row, A_private);
+        }
+#pragma omp critical(ReduceJTJandJTr)
+        {
+            for (int k = 0; k < 28; k++) {
+                A[k] += A_private[k];
+            }
+        }
+    }
+
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    int offset = 0;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j <= i; j++) {
+            JTJ(i, j) = JTJ(j, i) = A[offset++];
+        }
+        JTr(i) = A[21 + i];
+    }
+    utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                      A[27] / (double)num_rows, num_rows);
+    return std::make_tuple(JTJ, JTr, A[27]);
+}
+
 }  // unnamed namespace
 
 namespace pipelines {
 namespace odometry {
+
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobian::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    auto f_lambda =
+            [&](int i,
+                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+                std::vector<double> &r, std::vector<double> &w) {
+                ComputeJacobianAndResidual(i, J_r, r, w, source, target,
+                                           source_xyz, target_dx, target_dy,
+                                           intrinsic, extrinsic, corresps);
+            };
+    return utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+            f_lambda, int(corresps.size()));
+}
+
 void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
         int row,
         std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
@@ -35,39 +235,35 @@ void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
         const Eigen::Matrix3d &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const CorrespondenceSetPixelWise &corresps) const {
-    Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
-    Eigen::Vector3d t = extrinsic.block<3, 1>(0, 3);
-
-    int u_s = corresps[row](0);
-    int v_s = corresps[row](1);
-    int u_t = corresps[row](2);
-    int v_t = corresps[row](3);
-    double diff = *target.color_.PointerAt<float>(u_t, v_t) -
-                  *source.color_.PointerAt<float>(u_s, v_s);
-    double dIdx = SOBEL_SCALE * (*target_dx.color_.PointerAt<float>(u_t, v_t));
-    double dIdy = SOBEL_SCALE * (*target_dy.color_.PointerAt<float>(u_t, v_t));
-    Eigen::Vector3d p3d_mat(*source_xyz.PointerAt<float>(u_s, v_s, 0),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 1),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 2));
-    Eigen::Vector3d p3d_trans = R * p3d_mat + t;
-    double invz = 1. / p3d_trans(2);
-    double c0 = dIdx * intrinsic(0, 0) * invz;
-    double c1 = dIdy * intrinsic(1, 1) * invz;
-    double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
-
+    const JacobianContext ctx(source, target, source_xyz, target_dx, target_dy,
+                              intrinsic, extrinsic);
     J_r.resize(1);
-    J_r[0](0) = -p3d_trans(2) * c1 + p3d_trans(1) * c2;
-    J_r[0](1) = p3d_trans(2) * c0 - p3d_trans(0) * c2;
-    J_r[0](2) = -p3d_trans(1) * c0 + p3d_trans(0) * c1;
-    J_r[0](3) = c0;
-    J_r[0](4) = c1;
-    J_r[0](5) = c2;
     r.resize(1);
-    r[0] = diff;
     w.resize(1);
+    ComputeColorJacobianAndResidual(ctx, corresps[row], J_r[0], r[0]);
     w[0] = 1.0;
 }
 
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromColorTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    const JacobianContext ctx(source, target, source_xyz, target_dx, target_dy,
+                              intrinsic, extrinsic);
+    return ReduceJTJandJTr(int(corresps.size()), [&](int row, double *A) {
+        Eigen::Vector6d J;
+        double r;
+        ComputeColorJacobianAndResidual(ctx, corresps[row], J, r);
+        AccumulateJTJandJTr(J, r, A);
+    });
+}
+
 void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
         int row,
         std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
@@ -81,67 +277,38 @@ void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
         const Eigen::Matrix3d &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const CorrespondenceSetPixelWise &corresps) const {
-    double sqrt_lamba_dep, sqrt_lambda_img;
-    sqrt_lamba_dep = sqrt(LAMBDA_HYBRID_DEPTH);
-    sqrt_lambda_img = sqrt(1.0 - LAMBDA_HYBRID_DEPTH);
-
-    const double fx = intrinsic(0, 0);
-    const double fy = intrinsic(1, 1);
-    Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
-    Eigen::Vector3d t = extrinsic.block<3, 1>(0, 3);
-
-    int u_s = corresps[row](0);
-    int v_s = corresps[row](1);
-    int u_t = corresps[row](2);
-    int v_t = corresps[row](3);
-    double diff_photo = (*target.color_.PointerAt<float>(u_t, v_t) -
-                         *source.color_.PointerAt<float>(u_s, v_s));
-    double dIdx = SOBEL_SCALE * (*target_dx.color_.PointerAt<float>(u_t, v_t));
-    double dIdy = SOBEL_SCALE * (*target_dy.color_.PointerAt<float>(u_t, v_t));
-    double dDdx = SOBEL_SCALE * (*target_dx.depth_.PointerAt<float>(u_t, v_t));
-    double dDdy = SOBEL_SCALE * (*target_dy.depth_.PointerAt<float>(u_t, v_t));
-    if (std::isnan(dDdx)) dDdx = 0;
-    if (std::isnan(dDdy)) dDdy = 0;
-    Eigen::Vector3d p3d_mat(*source_xyz.PointerAt<float>(u_s, v_s, 0),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 1),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 2));
-    Eigen::Vector3d p3d_trans = R * p3d_mat + t;
-
-    double diff_geo = *target.depth_.PointerAt<float>(u_t, v_t) - p3d_trans(2);
-    double invz = 1. / p3d_trans(2);
-    double c0 = dIdx * fx * invz;
-    double c1 = dIdy * fy * invz;
-    double c2 = -(c0 * p3d_trans(0) + c1 * p3d_trans(1)) * invz;
-    double d0 = dDdx * fx * invz;
-    double d1 = dDdy * fy * invz;
-    double d2 = -(d0 * p3d_trans(0) + d1 * p3d_trans(1)) * invz;
-
+    const JacobianContext ctx(source, target, source_xyz, target_dx, target_dy,
+                              intrinsic, extrinsic);
     J_r.resize(2);
     r.resize(2);
     w.resize(2);
-    J_r[0](0) = sqrt_lambda_img * (-p3d_trans(2) * c1 + p3d_trans(1) * c2);
-    J_r[0](1) = sqrt_lambda_img * (p3d_trans(2) * c0 - p3d_trans(0) * c2);
-    J_r[0](2) = sqrt_lambda_img * (-p3d_trans(1) * c0 + p3d_trans(0) * c1);
-    J_r[0](3) = sqrt_lambda_img * (c0);
-    J_r[0](4) = sqrt_lambda_img * (c1);
-    J_r[0](5) = sqrt_lambda_img * (c2);
-    double r_photo = sqrt_lambda_img * diff_photo;
-    r[0] = r_photo;
+    ComputeHybridJacobianAndResidual(ctx, corresps[row], J_r.data(),
+                                     r.data());
     w[0] = 1.0;
-
-    J_r[1](0) = sqrt_lamba_dep *
-                ((-p3d_trans(2) * d1 + p3d_trans(1) * d2) - p3d_trans(1));
-    J_r[1](1) = sqrt_lamba_dep *
-                ((p3d_trans(2) * d0 - p3d_trans(0) * d2) + p3d_trans(0));
-    J_r[1](2) = sqrt_lamba_dep * ((-p3d_trans(1) * d0 + p3d_trans(0) * d1));
-    J_r[1](3) = sqrt_lamba_dep * (d0);
-    J_r[1](4) = sqrt_lamba_dep * (d1);
-    J_r[1](5) = sqrt_lamba_dep * (d2 - 1.0f);
-    double r_geo = sqrt_lamba_dep * diff_geo;
-    r[1] = r_geo;
     w[1] = 1.0;
 }
 
+std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+RGBDOdometryJacobianFromHybridTerm::ComputeJTJandJTr(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    const JacobianContext ctx(source, target, source_xyz, target_dx, target_dy,
+                              intrinsic, extrinsic);
+    return ReduceJTJandJTr(int(corresps.size()), [&](int row, double *A) {
+        Eigen::Vector6d J[2];
+        double r[2];
+        ComputeHybridJacobianAndResidual(ctx, corresps[row], J, r);
+        AccumulateJTJandJTr(J[0], r[0], A);
+        AccumulateJTJandJTr(J[1], r[1], A);
+    });
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
@@ -58,6 +58,22 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const = 0;
+
+    /// \brief Function to compute J^T J, J^T r and the sum of squared
+    /// residuals over all correspondences.
+    ///
+    /// The default implementation calls ComputeJacobianAndResidual() for each
+    /// correspondence. Derived classes can override it with a fused loop.
+    virtual std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double>
+    ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const;
 };
 
 /// \class RGBDOdometryJacobianFromColorTerm
@@ -90,6 +106,18 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const override;
+
+    /// \brief Function to compute J^T J, J^T r and the sum of squared
+    /// residuals in a single pass over the correspondences.
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
 };
 
 /// \class RGBDOdometryJacobianFromHybridTerm
@@ -126,6 +154,18 @@ public:
             const Eigen::Matrix3d &intrinsic,
             const Eigen::Matrix4d &extrinsic,
             const CorrespondenceSetPixelWise &corresps) const override;
+
+    /// \brief Function to compute J^T J, J^T r and the sum of squared
+    /// residuals in a single pass over the correspondences.
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
 };
 
 }  // namespace odometry
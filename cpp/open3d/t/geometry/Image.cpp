@@ -132,6 +132,11 @@ Image Image::RGBToGray() const {
             {core::UInt16, 3},
             {core::Float32, 3},
     };
+    static const dtype_channels_pairs cpu_supported{
+            {core::UInt8, 3},
+            {core::UInt16, 3},
+            {core::Float32, 3},
+    };
 
     Image dst_im;
     dst_im.data_ = core::Tensor::Empty({GetRows(), GetCols(), 1}, GetDtype(),
@@ -144,6 +149,10 @@ Image Image::RGBToGray() const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::RGBToGray, data_, dst_im.data_);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::RGBToGrayCPU(data_, dst_im.data_);
     } else {
         utility::LogError(
                 "RGBToGray with data type {} on device {} is not implemented!",
@@ -169,6 +178,11 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
             {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
+    static const dtype_channels_pairs cpu_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+            {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
+    };
 
     Image dst_im;
     dst_im.data_ = core::Tensor::Empty(
@@ -184,6 +198,10 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Resize, data_, dst_im.data_, interp_type);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::ResizeCPU(data_, dst_im.data_, interp_type);
     } else {
         utility::LogError(
                 "Resize with data type {} on device {} is not "
@@ -210,6 +228,12 @@ Image Image::Dilate(int kernel_size) const {
             {core::Float32, 1}, {core::Bool, 3},  {core::UInt8, 3},
             {core::Float32, 3}, {core::Bool, 4},  {core::UInt8, 4},
             {core::Float32, 4}};
+    static const dtype_channels_pairs cpu_supported{
+            {core::Bool, 1},    {core::UInt8, 1},   {core::UInt16, 1},
+            {core::Float32, 1}, {core::Bool, 3},    {core::UInt8, 3},
+            {core::UInt16, 3},  {core::Float32, 3}, {core::Bool, 4},
+            {core::UInt8, 4},   {core::UInt16, 4},  {core::Float32, 4},
+    };
 
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
@@ -221,6 +245,10 @@ Image Image::Dilate(int kernel_size) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Dilate, data_, dst_im.data_, kernel_size);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::DilateCPU(data_, dst_im.data_, kernel_size);
     } else {
         utility::LogError(
                 "Dilate with data type {} on device {} is not implemented!",
@@ -246,6 +274,10 @@ Image Image::FilterBilateral(int kernel_size,
             {core::UInt8, 3},
             {core::Float32, 3},
     };
+    static const dtype_channels_pairs cpu_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+    };
 
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
@@ -259,6 +291,11 @@ Image Image::FilterBilateral(int kernel_size,
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterBilateral, data_, dst_im.data_, kernel_size,
                  value_sigma, dist_sigma);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterBilateralCPU(data_, dst_im.data_, kernel_size,
+                                          value_sigma, dist_sigma);
     } else {
         utility::LogError(
                 "FilterBilateral with data type {} on device {} is not "
@@ -280,6 +317,12 @@ Image Image::Filter(const core::Tensor &kernel) const {
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
 
+    static const dtype_channels_pairs cpu_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+            {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
+    };
+
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
     if (data_.IsCUDA() &&
@@ -290,6 +333,10 @@ Image Image::Filter(const core::Tensor &kernel) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Filter, data_, dst_im.data_, kernel);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterCPU(data_, dst_im.data_, kernel);
     } else {
         utility::LogError(
                 "Filter with data type {} on device {} is not "
@@ -316,6 +363,12 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
 
+    static const dtype_channels_pairs cpu_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+            {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
+    };
+
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
     if (data_.IsCUDA() &&
@@ -326,6 +379,11 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterGaussian, data_, dst_im.data_, kernel_size, sigma);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterGaussianCPU(data_, dst_im.data_, kernel_size,
+                                         sigma);
     } else {
         utility::LogError(
                 "FilterGaussian with data type {} on device {} is not "
@@ -352,6 +410,10 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
             {core::UInt8, 1},
             {core::Float32, 1},
     };
+    static const dtype_channels_pairs cpu_supported{
+            {core::UInt8, 1},
+            {core::Float32, 1},
+    };
 
     // Routines: 8u16s, 32f
     Image dst_im_dx, dst_im_dy;
@@ -376,6 +438,11 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterSobel, data_, dst_im_dx.data_, dst_im_dy.data_,
                  kernel_size);
+    } else if (data_.IsCPU() &&
+               std::count(cpu_supported.begin(), cpu_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterSobelCPU(data_, dst_im_dx.data_, dst_im_dy.data_,
+                                      kernel_size);
     } else {
         utility::LogError(
                 "FilterSobel with data type {} on device {} is not "
@@ -188,7 +188,7 @@ public:
 
     /// \brief Return a new image after performing morphological dilation.
     ///
-    /// Supported datatypes are UInt8, UInt16 and Float32 with {1, 3, 4}
+    /// Supported datatypes are Bool, UInt8, UInt16 and Float32 with {1, 3, 4}
     /// channels. An 8-connected neighborhood is used to create the dilation
     /// mask.
     ///
@@ -203,8 +203,8 @@ public:
     /// \param value_sigma Standard deviation for the image content.
     /// \param distance_sigma Standard deviation for the image pixel positions.
     ///
-    /// Note: CPU (IPP) and CUDA (NPP) versions use different algorithms and
-    /// will give different results:\n
+    /// Note: CPU (IPP or native) and CUDA (NPP) versions use different
+    /// algorithms and will give different results:\n
     /// CPU uses a round kernel (radius = floor(kernel_size / 2)),\n
     /// while CUDA uses a square kernel (width = kernel_size).\n
     /// Make sure to tune parameters accordingly.
@@ -327,6 +327,7 @@ public:
     std::string ToString() const;
 
     /// Do we use IPP ICV for accelerating image processing operations?
+    /// Without it, CPU images fall back to native kernels.
 #ifdef WITH_IPPICV
     static constexpr bool HAVE_IPPICV = true;
 #else
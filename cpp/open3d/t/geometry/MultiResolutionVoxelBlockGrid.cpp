@@ -0,0 +1,277 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/MultiResolutionVoxelBlockGrid.h"
+
+#include <algorithm>
+
+#include "open3d/core/TensorFunction.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// Keeps the pixels of \p depth within [depth_min, depth_max) meters and sets
+/// the others to 0.
+static Image MaskDepthRange(const Image &depth,
+                            float depth_scale,
+                            float depth_min,
+                            float depth_max) {
+    const core::Tensor depth_tensor = depth.AsTensor();
+    const core::Tensor depth_m =
+            depth_tensor.To(core::Float32) * (1.0f / depth_scale);
+    const core::Tensor mask = depth_m.Ge(depth_min).LogicalAnd(
+            depth_m.Lt(depth_max));
+    return Image(depth_tensor * mask.To(depth_tensor.GetDtype()));
+}
+
+/// Returns the (3, M) coordinates of the blocks allocated in \p grid.
+static core::Tensor GetActiveBlockCoordinates(VoxelBlockGrid &grid) {
+    const core::HashMap hashmap = grid.GetHashMap();
+    return hashmap.GetKeyTensor()
+            .IndexGet({hashmap.GetActiveIndices().To(core::Int64)})
+            .T()
+            .Contiguous();
+}
+
+/// Appends the vertices and triangles of \p src to \p dst. Only the attributes
+/// of \p dst that \p src also has are kept.
+static TriangleMesh AppendTriangleMesh(const TriangleMesh &dst,
+                                       const TriangleMesh &src) {
+    if (dst.IsEmpty()) return src;
+    if (src.IsEmpty()) return dst;
+
+    TriangleMesh mesh(dst.GetDevice());
+    for (const auto &kv : dst.GetVertexAttr()) {
+        if (src.HasVertexAttr(kv.first)) {
+            mesh.SetVertexAttr(kv.first,
+                               kv.second.Append(src.GetVertexAttr(kv.first),
+                                                0));
+        }
+    }
+    const int64_t offset = dst.GetVertexPositions().GetLength();
+    for (const auto &kv : dst.GetTriangleAttr()) {
+        if (!src.HasTriangleAttr(kv.first)) continue;
+        core::Tensor src_attr = src.GetTriangleAttr(kv.first);
+        if (kv.first == "indices") {
+            src_attr = src_attr + offset;
+        }
+        mesh.SetTriangleAttr(kv.first, kv.second.Append(src_attr, 0));
+    }
+    return mesh;
+}
+
+MultiResolutionVoxelBlockGrid::MultiResolutionVoxelBlockGrid(
+        const std::vector<std::string> &attr_names,
+        const std::vector<core::Dtype> &attr_dtypes,
+        const std::vector<core::SizeVector> &attr_channels,
+        float voxel_size,
+        const std::vector<float> &level_depth_max,
+        int64_t block_resolution,
+        int64_t block_count,
+        const core::Device &device,
+        const core::HashBackendType &backend)
+    : voxel_size_(voxel_size),
+      block_resolution_(block_resolution),
+      level_depth_max_(level_depth_max) {
+    if (level_depth_max.empty()) {
+        utility::LogError("At least one level is required.");
+    }
+    for (size_t l = 0; l < level_depth_max.size(); ++l) {
+        const float depth_min = l == 0 ? 0.0f : level_depth_max[l - 1];
+        if (level_depth_max[l] <= depth_min) {
+            utility::LogError(
+                    "level_depth_max must be positive and increasing, but got "
+                    "{} after {}.",
+                    level_depth_max[l], depth_min);
+        }
+    }
+    for (size_t l = 0; l < level_depth_max.size(); ++l) {
+        levels_.emplace_back(attr_names, attr_dtypes, attr_channels,
+                             GetVoxelSize(l), block_resolution, block_count,
+                             device, backend);
+    }
+}
+
+VoxelBlockGrid &MultiResolutionVoxelBlockGrid::GetLevel(int64_t level) {
+    if (level < 0 || level >= GetNumLevels()) {
+        utility::LogError("Level {} is out of range [0, {}).", level,
+                          GetNumLevels());
+    }
+    return levels_[level];
+}
+
+float MultiResolutionVoxelBlockGrid::GetVoxelSize(int64_t level) const {
+    return voxel_size_ * float(int64_t(1) << level);
+}
+
+void MultiResolutionVoxelBlockGrid::Integrate(const Image &depth,
+                                              const Image &color,
+                                              const core::Tensor &intrinsic,
+                                              const core::Tensor &extrinsic,
+                                              float depth_scale,
+                                              float trunc_voxel_multiplier) {
+    IntegrateLevels(depth, color, intrinsic, extrinsic, depth_scale,
+                    trunc_voxel_multiplier);
+}
+
+void MultiResolutionVoxelBlockGrid::Integrate(const Image &depth,
+                                              const core::Tensor &intrinsic,
+                                              const core::Tensor &extrinsic,
+                                              float depth_scale,
+                                              float trunc_voxel_multiplier) {
+    IntegrateLevels(depth, Image(), intrinsic, extrinsic, depth_scale,
+                    trunc_voxel_multiplier);
+}
+
+void MultiResolutionVoxelBlockGrid::IntegrateLevels(
+        const Image &depth,
+        const Image &color,
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        float depth_scale,
+        float trunc_voxel_multiplier) {
+    if (levels_.empty()) {
+        utility::LogError(
+                "MultiResolutionVoxelBlockGrid is not initialized.");
+    }
+    for (int64_t l = 0; l < GetNumLevels(); ++l) {
+        const float trunc = GetVoxelSize(l) * trunc_voxel_multiplier;
+        const float depth_min = l == 0 ? 0.0f : level_depth_max_[l - 1] - trunc;
+        const float depth_max = level_depth_max_[l];
+        const Image depth_l =
+                l == 0 ? depth
+                       : MaskDepthRange(depth, depth_scale, depth_min,
+                                        depth_max);
+
+        const core::Tensor block_coords = levels_[l].GetUniqueBlockCoordinates(
+                depth_l, intrinsic, extrinsic, depth_scale, depth_max,
+                trunc_voxel_multiplier);
+        levels_[l].Integrate(block_coords, depth_l, color, intrinsic,
+                             extrinsic, depth_scale, depth_max,
+                             trunc_voxel_multiplier);
+    }
+}
+
+TensorMap MultiResolutionVoxelBlockGrid::RayCast(
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        int width,
+        int height,
+        const std::vector<std::string> attrs,
+        float depth_scale,
+        float depth_min,
+        float weight_threshold,
+        float trunc_voxel_multiplier,
+        int range_map_down_factor) {
+    for (const auto &attr : attrs) {
+        if (attr != "vertex" && attr != "depth" && attr != "color" &&
+            attr != "normal") {
+            utility::LogError(
+                    "Unsupported attribute {} for multi-resolution ray "
+                    "casting.",
+                    attr);
+        }
+    }
+    // Depth selects the level of each pixel.
+    std::vector<std::string> level_attrs = attrs;
+    if (std::find(attrs.begin(), attrs.end(), "depth") == attrs.end()) {
+        level_attrs.push_back("depth");
+    }
+
+    TensorMap result("range");
+    for (int64_t l = 0; l < GetNumLevels(); ++l) {
+        if (l > 0 && levels_[l].GetHashMap().Size() == 0) continue;
+
+        const float trunc = GetVoxelSize(l) * trunc_voxel_multiplier;
+        const float depth_min_l =
+                l == 0 ? depth_min
+                       : std::max(depth_min, level_depth_max_[l - 1] - trunc);
+        TensorMap rendering = levels_[l].RayCast(
+                GetActiveBlockCoordinates(levels_[l]), intrinsic, extrinsic,
+                width, height, level_attrs, depth_scale, depth_min_l,
+                level_depth_max_[l], weight_threshold, trunc_voxel_multiplier,
+                range_map_down_factor);
+        if (l == 0) {
+            result = rendering;
+            continue;
+        }
+
+        // Fill the pixels without a surface at finer levels.
+        const core::Tensor mask =
+                result["depth"].Eq(0).LogicalAnd(rendering["depth"].Gt(0));
+        const core::Tensor mask_2d = mask.Reshape({height, width});
+        for (const auto &attr : level_attrs) {
+            result[attr].IndexSet({mask_2d},
+                                  rendering[attr].IndexGet({mask_2d}));
+        }
+    }
+    if (std::find(attrs.begin(), attrs.end(), "depth") == attrs.end()) {
+        result.erase("depth");
+    }
+    return result;
+}
+
+core::Tensor MultiResolutionVoxelBlockGrid::GetUncoveredMask(
+        const core::Tensor &positions, int64_t level) {
+    core::Tensor mask = core::Tensor::Ones({positions.GetLength()},
+                                           core::Bool, positions.GetDevice());
+    for (int64_t k = 0; k < level; ++k) {
+        const float block_size = GetVoxelSize(k) * block_resolution_;
+        const core::Tensor keys =
+                (positions / block_size).Floor().To(core::Int32);
+        core::Tensor buf_indices, masks;
+        std::tie(buf_indices, masks) = levels_[k].GetHashMap().Find(keys);
+        mask = mask.LogicalAnd(masks.LogicalNot());
+    }
+    return mask;
+}
+
+PointCloud MultiResolutionVoxelBlockGrid::ExtractPointCloud(
+        float weight_threshold) {
+    PointCloud pcd;
+    for (int64_t l = 0; l < GetNumLevels(); ++l) {
+        if (levels_[l].GetHashMap().Size() == 0) continue;
+
+        PointCloud pcd_l = levels_[l].ExtractPointCloud(weight_threshold);
+        if (pcd_l.IsEmpty()) continue;
+        if (l > 0) {
+            pcd_l = pcd_l.SelectByMask(
+                    GetUncoveredMask(pcd_l.GetPointPositions(), l));
+        }
+        pcd = pcd.IsEmpty() ? pcd_l : pcd.Append(pcd_l);
+    }
+    return pcd;
+}
+
+TriangleMesh MultiResolutionVoxelBlockGrid::ExtractTriangleMesh(
+        float weight_threshold) {
+    TriangleMesh mesh;
+    for (int64_t l = 0; l < GetNumLevels(); ++l) {
+        if (levels_[l].GetHashMap().Size() == 0) continue;
+
+        TriangleMesh mesh_l = levels_[l].ExtractTriangleMesh(weight_threshold);
+        if (mesh_l.IsEmpty() || !mesh_l.HasTriangleIndices()) continue;
+        if (l > 0) {
+            const core::Tensor vertex_mask =
+                    GetUncoveredMask(mesh_l.GetVertexPositions(), l);
+            const core::Tensor triangle_mask =
+                    vertex_mask
+                            .IndexGet({mesh_l.GetTriangleIndices().To(
+                                    core::Int64)})
+                            .All(core::SizeVector{1});
+            mesh_l = mesh_l.SelectFacesByMask(triangle_mask);
+        }
+        mesh = AppendTriangleMesh(mesh, mesh_l);
+    }
+    return mesh;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// A stack of voxel block grids whose voxel size doubles from one level to
+/// the next, for TSDF volumes of large scenes.
+///
+/// Each level integrates the depth observations within its depth range, so
+/// that geometry near the sensor is stored at the finest level and distant
+/// geometry at coarser levels. Adjacent ranges overlap by the truncation
+/// distance of the coarser level. Ray casting and extraction prefer the finest
+/// level: geometry of a level that falls into a block allocated at a finer
+/// level is discarded. Surfaces at level boundaries are not stitched.
+class MultiResolutionVoxelBlockGrid {
+public:
+    MultiResolutionVoxelBlockGrid() = default;
+
+    /// \brief Default Constructor.
+    ///
+    /// Example:
+    /// MultiResolutionVoxelBlockGrid({"tsdf", "weight", "color"},
+    ///                               {core::Float32, core::UInt16,
+    ///                                core::UInt16},
+    ///                               {{1}, {1}, {3}},
+    ///                               0.005,
+    ///                               {2.0, 4.0, 8.0},
+    ///                               16,
+    ///                               10000,
+    ///                               core::Device("CUDA:0"));
+    /// stores depth observations up to 2m with 5mm voxels, observations
+    /// between 2m and 4m with 1cm voxels and observations between 4m and 8m
+    /// with 2cm voxels.
+    ///
+    /// \param voxel_size Voxel size of the finest level.
+    /// \param level_depth_max Increasing max depth (in meters) of the
+    /// observations integrated into each level. The number of levels is its
+    /// size.
+    MultiResolutionVoxelBlockGrid(
+            const std::vector<std::string> &attr_names,
+            const std::vector<core::Dtype> &attr_dtypes,
+            const std::vector<core::SizeVector> &attr_channels,
+            float voxel_size = 0.0058,
+            const std::vector<float> &level_depth_max = {3.0f},
+            int64_t block_resolution = 16,
+            int64_t block_count = 10000,
+            const core::Device &device = core::Device("CPU:0"),
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default);
+
+    /// Number of resolution levels.
+    int64_t GetNumLevels() const { return levels_.size(); }
+
+    /// Voxel block grid of \p level, with level 0 the finest.
+    VoxelBlockGrid &GetLevel(int64_t level);
+
+    /// Voxel size of \p level.
+    float GetVoxelSize(int64_t level) const;
+
+    /// \brief Integrates a depth image and a color image sharing the same
+    /// intrinsics into all levels.
+    ///
+    /// See VoxelBlockGrid::Integrate() for the supported attributes and image
+    /// types.
+    void Integrate(const Image &depth,
+                   const Image &color,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float trunc_voxel_multiplier = 8.0f);
+
+    /// Integrates a depth image into all levels.
+    void Integrate(const Image &depth,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float trunc_voxel_multiplier = 8.0f);
+
+    /// \brief Ray casts all levels and keeps, per pixel, the result of the
+    /// finest level with a surface.
+    ///
+    /// Supports the conventional rendering attributes of
+    /// VoxelBlockGrid::RayCast(): vertex, depth, color, normal. The "range"
+    /// entry is the range map of the finest level.
+    TensorMap RayCast(const core::Tensor &intrinsic,
+                      const core::Tensor &extrinsic,
+                      int width,
+                      int height,
+                      const std::vector<std::string> attrs = {"depth", "color"},
+                      float depth_scale = 1000.0f,
+                      float depth_min = 0.1f,
+                      float weight_threshold = 3.0f,
+                      float trunc_voxel_multiplier = 8.0f,
+                      int range_map_down_factor = 8);
+
+    /// Extracts the isosurface points of all levels, without the points of a
+    /// level that fall into blocks allocated at a finer level.
+    PointCloud ExtractPointCloud(float weight_threshold = 3.0f);
+
+    /// Extracts the marching cubes meshes of all levels, without the triangles
+    /// of a level that have a vertex in a block allocated at a finer level.
+    TriangleMesh ExtractTriangleMesh(float weight_threshold = 3.0f);
+
+private:
+    void IntegrateLevels(const Image &depth,
+                         const Image &color,
+                         const core::Tensor &intrinsic,
+                         const core::Tensor &extrinsic,
+                         float depth_scale,
+                         float trunc_voxel_multiplier);
+
+    /// (N,) Bool mask of the \p positions that are not in a block allocated at
+    /// a level finer than \p level.
+    core::Tensor GetUncoveredMask(const core::Tensor &positions,
+                                  int64_t level);
+
+    float voxel_size_ = -1;
+    int64_t block_resolution_ = -1;
+    std::vector<float> level_depth_max_;
+    std::vector<VoxelBlockGrid> levels_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
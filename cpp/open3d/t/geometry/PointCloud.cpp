@@ -30,6 +30,8 @@
 #include "open3d/core/hashmap/HashSet.h"
 #include "open3d/core/linalg/Matmul.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/geometry/PointCloudSegmentation.h"
+#include "open3d/geometry/Qhull.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/VtkUtils.h"
@@ -275,13 +277,77 @@ PointCloud PointCloud::SelectByIndex(
     return pcd;
 }
 
-PointCloud PointCloud::VoxelDownSample(double voxel_size,
-                                       const std::string &reduction) const {
+/// Parses the VoxelDownSample reduction \p reduction of attribute \p name.
+static kernel::pointcloud::VoxelReduction ParseVoxelReduction(
+        const std::string &reduction,
+        const std::string &name,
+        core::Dtype dtype) {
+    using kernel::pointcloud::VoxelReduction;
+    if (reduction == "mean") {
+        return VoxelReduction::Mean;
+    } else if (reduction == "first") {
+        return VoxelReduction::First;
+    } else if (reduction == "center") {
+        return VoxelReduction::Center;
+    } else if (reduction == "mode") {
+        if (dtype.IsObject() || dtype == core::Float32 ||
+            dtype == core::Float64) {
+            utility::LogError(
+                    "Reduction 'mode' of attribute {} requires an integer or "
+                    "boolean dtype, but got {}.",
+                    name, dtype.ToString());
+        }
+        return VoxelReduction::Mode;
+    }
+    utility::LogError("Unsupported reduction type {} of attribute {}.",
+                      reduction, name);
+}
+
+PointCloud PointCloud::VoxelDownSample(
+        double voxel_size,
+        const std::string &reduction,
+        const std::unordered_map<std::string, std::string> &attr_reductions)
+        const {
     if (voxel_size <= 0) {
         utility::LogError("voxel_size must be positive.");
     }
-    if (reduction != "mean") {
-        utility::LogError("Reduction can only be 'mean' for VoxelDownSample.");
+    for (const auto &kv : attr_reductions) {
+        if (!HasPointAttr(kv.first)) {
+            utility::LogError("Reduction of unknown attribute {}.", kv.first);
+        }
+    }
+
+    std::vector<std::string> names;
+    std::vector<core::Tensor> attrs;
+    std::vector<kernel::pointcloud::VoxelReduction> reductions;
+    bool all_mean = true;
+    for (const auto &kv : point_attr_) {
+        const auto it = attr_reductions.find(kv.first);
+        const std::string &attr_reduction =
+                it == attr_reductions.end() ? reduction : it->second;
+        if (attr_reduction == "mode" && it == attr_reductions.end()) {
+            utility::LogError(
+                    "Reduction 'mode' can only be set for individual "
+                    "attributes.");
+        }
+        names.push_back(kv.first);
+        attrs.push_back(kv.second);
+        reductions.push_back(ParseVoxelReduction(attr_reduction, kv.first,
+                                                 kv.second.GetDtype()));
+        all_mean &= attr_reduction == "mean";
+    }
+
+    // Sort based grouping with fused reduction, the hash set below is only
+    // faster on the GPU.
+    if (IsCPU() || !all_mean) {
+        const std::vector<core::Tensor> voxel_attrs =
+                kernel::pointcloud::VoxelDownSample(
+                        GetPointPositions(), voxel_size, attrs, reductions);
+        PointCloud pcd_down(device_);
+        for (size_t i = 0; i < names.size(); ++i) {
+            pcd_down.SetPointAttr(names[i], voxel_attrs[i]);
+        }
+        return pcd_down;
     }
 
     // Discretize voxels.
@@ -326,14 +392,10 @@ PointCloud PointCloud::VoxelDownSample(double voxel_size,
         attr_shape[0] = num_voxels;
         auto voxel_attr =
                 core::Tensor::Zeros(attr_shape, core::Float32, device_);
-        if (reduction == "mean") {
-            voxel_attr.IndexAdd_(0, index_map_point2voxel,
-                                 point_attr.To(core::Float32));
-            voxel_attr /= voxel_num_points.View({-1, 1});
-            voxel_attr = voxel_attr.To(attr_dtype);
-        } else {
-            utility::LogError("Unsupported reduction type {}.", reduction);
-        }
+        voxel_attr.IndexAdd_(0, index_map_point2voxel,
+                             point_attr.To(core::Float32));
+        voxel_attr /= voxel_num_points.View({-1, 1});
+        voxel_attr = voxel_attr.To(attr_dtype);
         pcd_down.SetPointAttr(attr_string, voxel_attr);
     }
 
@@ -384,11 +446,23 @@ PointCloud PointCloud::RandomDownSample(double sampling_ratio) const {
 }
 
 PointCloud PointCloud::FarthestPointDownSample(size_t num_samples) const {
-    // We want the sampled points has the attributes of the original point
-    // cloud, so full copy is needed.
-    const open3d::geometry::PointCloud lpcd = ToLegacy();
-    return FromLegacy(*lpcd.FarthestPointDownSample(num_samples),
-                      GetPointPositions().GetDtype(), GetDevice());
+    const int64_t num_points = GetPointPositions().GetLength();
+    if (num_samples == 0) {
+        return PointCloud(GetDevice());
+    } else if (static_cast<int64_t>(num_samples) == num_points) {
+        return Clone();
+    } else if (static_cast<int64_t>(num_samples) > num_points) {
+        utility::LogError(
+                "Illegal number of samples: {}, must <= point size: {}",
+                num_samples, num_points);
+    }
+
+    const core::Tensor indices = kernel::pointcloud::FarthestPointDownSample(
+            GetPointPositions(), core::Tensor::Init<int64_t>({0, num_points}),
+            static_cast<int64_t>(num_samples));
+    // Select through a mask to keep the original point order, as the legacy
+    // implementation does.
+    return SelectByIndex(indices, false, true);
 }
 
 std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
@@ -731,18 +805,61 @@ void PointCloud::OrientNormalsTowardsCameraLocation(
     }
 }
 
+/// Tetrahedra of the Delaunay triangulation of \p points, as Int64 point
+/// indices of shape {T, 4} on the CPU.
+static core::Tensor ComputeDelaunayTetras(const core::Tensor &points) {
+    // QHull needs double dtype on the CPU.
+    const core::Tensor coordinates =
+            points.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    const auto delaunay_tetras =
+            open3d::geometry::Qhull::ComputeDelaunayTetras(
+                    coordinates.GetDataPtr<double>(),
+                    size_t(coordinates.GetLength()));
+
+    const int64_t num_tetras = int64_t(delaunay_tetras.size());
+    core::Tensor tetras({num_tetras, 4}, core::Int64);
+    int64_t *tetras_ptr = tetras.GetDataPtr<int64_t>();
+    for (int64_t tidx = 0; tidx < num_tetras; ++tidx) {
+        for (int i = 0; i < 4; ++i) {
+            tetras_ptr[4 * tidx + i] = delaunay_tetras[tidx](i);
+        }
+    }
+    return tetras;
+}
+
 void PointCloud::OrientNormalsConsistentTangentPlane(
         size_t k,
         const double lambda /* = 0.0*/,
         const double cos_alpha_tol /* = 1.0*/) {
-    PointCloud tpcd(GetPointPositions());
-    tpcd.SetPointNormals(GetPointNormals());
+    if (!HasPointNormals()) {
+        utility::LogError(
+                "No normals in the PointCloud. Call EstimateNormals() first.");
+    }
+    const core::Tensor points = GetPointPositions().Contiguous();
+    if (GetPointNormals().GetDtype() != points.GetDtype() ||
+        !GetPointNormals().IsContiguous()) {
+        SetPointNormals(GetPointNormals().To(points.GetDtype()).Contiguous());
+    }
 
-    open3d::geometry::PointCloud lpcd = tpcd.ToLegacy();
-    lpcd.OrientNormalsConsistentTangentPlane(k, lambda, cos_alpha_tol);
+    // Riemannian graph: Euclidean MST, a subgraph of the Delaunay
+    // triangulation, and the k nearest neighbors.
+    const core::Tensor tetras = ComputeDelaunayTetras(points);
+    const int64_t knn = std::min(static_cast<int64_t>(k), points.GetLength());
+    core::Tensor knn_indices;
+    if (knn > 0) {
+        core::nns::NearestNeighborSearch nns(points, core::Int64);
+        if (!nns.KnnIndex()) {
+            utility::LogError("Knn search index is not set.");
+        }
+        knn_indices = nns.KnnSearch(points, static_cast<int>(knn)).first;
+    } else {
+        knn_indices = core::Tensor::Empty({points.GetLength(), 0}, core::Int64,
+                                          GetDevice());
+    }
 
-    SetPointNormals(core::eigen_converter::EigenVector3dVectorToTensor(
-            lpcd.normals_, GetPointPositions().GetDtype(), GetDevice()));
+    kernel::pointcloud::OrientNormalsConsistentTangentPlane(
+            points, GetPointNormals(), tetras, knn_indices, lambda,
+            cos_alpha_tol);
 }
 
 void PointCloud::EstimateColorGradients(
@@ -1106,38 +1223,61 @@ std::tuple<TriangleMesh, core::Tensor> PointCloud::HiddenPointRemoval(
         const core::Tensor &camera_location, double radius) const {
     core::AssertTensorShape(camera_location, {3});
     core::AssertTensorDevice(camera_location, GetDevice());
+    if (radius <= 0) {
+        utility::LogError("radius must be larger than zero.");
+    }
 
-    // The HiddenPointRemoval only need positions attribute.
-    PointCloud tpcd(GetPointPositions());
-    const open3d::geometry::PointCloud lpcd = tpcd.ToLegacy();
-    const Eigen::Vector3d camera_location_eigen =
-            core::eigen_converter::TensorToEigenMatrixXd(
-                    camera_location.Reshape({3, 1}));
-
-    std::shared_ptr<open3d::geometry::TriangleMesh> lmesh;
-    std::vector<size_t> pt_map;
-    std::tie(lmesh, pt_map) =
-            lpcd.HiddenPointRemoval(camera_location_eigen, radius);
-
-    // Convert pt_map into Int64 Tensor.
-    std::vector<int64_t> indices(pt_map.begin(), pt_map.end());
+    // Spherical flip of the points around the camera location.
+    const core::Tensor &points = GetPointPositions();
+    const int64_t num_points = points.GetLength();
+    core::Tensor projected = points - camera_location.To(points.GetDtype());
+    const core::Tensor norm =
+            (projected * projected).Sum({1}, /*keepdim=*/true).Sqrt();
+    projected += projected * (2 * (radius - norm) / norm);
+    // Add the origin.
+    projected = projected.Append(
+            core::Tensor::Zeros({1, 3}, points.GetDtype(), GetDevice()), 0);
+
+    // The convex hull of the spherical flip holds the visible points.
+    const TriangleMesh hull = PointCloud(projected).ComputeConvexHull();
+    core::Tensor pt_map = hull.GetVertexAttr("point_indices").To(core::Int64);
+    core::Tensor triangles = hull.GetTriangleIndices().To(core::Int64);
+
+    // Erase the origin if it is part of the mesh.
+    const core::Tensor is_origin = pt_map.Eq(num_points);
+    if (is_origin.Any().Item<bool>()) {
+        const int64_t origin_vidx =
+                is_origin.NonZero().Flatten()[0].Item<int64_t>();
+        const core::Tensor keep =
+                triangles.Ne(origin_vidx).All(core::SizeVector{1});
+        triangles = triangles.IndexGet({keep});
+        triangles -= triangles.Gt(origin_vidx).To(core::Int64);
+        pt_map = pt_map.IndexGet({is_origin.LogicalNot()});
+    }
 
-    return std::make_tuple(
-            TriangleMesh::FromLegacy(*lmesh, GetPointPositions().GetDtype(),
-                                     core::Int64, GetDevice()),
-            core::Tensor(std::move(indices)).To(GetDevice()));
+    TriangleMesh visible_mesh(points.IndexGet({pt_map}), triangles);
+    return std::make_tuple(visible_mesh, pt_map);
 }
 
 core::Tensor PointCloud::ClusterDBSCAN(double eps,
                                        size_t min_points,
                                        bool print_progress) const {
-    // Create a legacy point cloud with only points, no attributes to reduce
-    // copying.
-    PointCloud tpcd(GetPointPositions());
-    open3d::geometry::PointCloud lpcd = tpcd.ToLegacy();
-    std::vector<int> labels =
-            lpcd.ClusterDBSCAN(eps, min_points, print_progress);
-    return core::Tensor(std::move(labels)).To(GetDevice());
+    if (GetPointPositions().GetLength() == 0) {
+        return core::Tensor::Empty({0}, core::Int32, GetDevice());
+    }
+    // Search in double precision as the legacy implementation does, so that
+    // the points at a distance close to eps are neighbors in both.
+    const core::Tensor points =
+            GetPointPositions().To(core::Float64).Contiguous();
+    core::nns::NearestNeighborSearch nns(points);
+    if (!nns.FixedRadiusIndex(eps)) {
+        utility::LogError("Fixed radius search index is not set.");
+    }
+    core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            nns.FixedRadiusSearch(points, eps, /*sort=*/false);
+    return kernel::pointcloud::ClusterDBSCAN(indices, row_splits, min_points,
+                                             print_progress);
 }
 
 std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
@@ -1145,13 +1285,16 @@ std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
         const int ransac_n,
         const int num_iterations,
         const double probability) const {
-    // The RANSAC plane fitting only need positions attribute.
-    PointCloud tpcd(GetPointPositions());
-    const open3d::geometry::PointCloud lpcd = tpcd.ToLegacy();
-    std::vector<size_t> inliers;
+    // The RANSAC kernel runs on the CPU, directly on the positions.
+    const core::Tensor points =
+            GetPointPositions().To(core::Device("CPU:0")).Contiguous();
     Eigen::Vector4d plane;
-    std::tie(plane, inliers) = lpcd.SegmentPlane(distance_threshold, ransac_n,
-                                                 num_iterations, probability);
+    std::vector<size_t> inliers;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        std::tie(plane, inliers) = open3d::geometry::SegmentPlaneRANSAC(
+                points.GetDataPtr<scalar_t>(), size_t(points.GetLength()),
+                distance_threshold, ransac_n, num_iterations, probability);
+    });
 
     // Convert inliers into Int64 Tensor.
     std::vector<int64_t> indices(inliers.begin(), inliers.end());
@@ -1162,6 +1305,38 @@ std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
             core::Tensor(std::move(indices)).To(GetDevice()));
 }
 
+std::vector<std::tuple<core::Tensor, core::Tensor>> PointCloud::SegmentPlanes(
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        const int max_num_planes,
+        const size_t min_num_inliers) const {
+    // The RANSAC kernel runs on the CPU, directly on the positions.
+    const core::Tensor points =
+            GetPointPositions().To(core::Device("CPU:0")).Contiguous();
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        planes = open3d::geometry::SegmentPlanesRANSAC(
+                points.GetDataPtr<scalar_t>(), size_t(points.GetLength()),
+                distance_threshold, ransac_n, num_iterations, probability,
+                max_num_planes, min_num_inliers);
+    });
+
+    std::vector<std::tuple<core::Tensor, core::Tensor>> result;
+    result.reserve(planes.size());
+    for (const auto &plane : planes) {
+        const std::vector<size_t> &inliers = std::get<1>(plane);
+        std::vector<int64_t> indices(inliers.begin(), inliers.end());
+        result.emplace_back(
+                core::eigen_converter::EigenMatrixToTensor(std::get<0>(plane))
+                        .Flatten()
+                        .To(GetDevice()),
+                core::Tensor(std::move(indices)).To(GetDevice()));
+    }
+    return result;
+}
+
 TriangleMesh PointCloud::ComputeConvexHull(bool joggle_inputs) const {
     // QHull needs double dtype on the CPU.
     static_assert(std::is_same<realT, double>::value,
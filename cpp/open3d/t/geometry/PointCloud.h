@@ -328,10 +328,28 @@ public:
 
     /// \brief Downsamples a point cloud with a specified voxel size.
     ///
+    /// Supported reductions are
+    /// - "mean": average of the points in the voxel.
+    /// - "first": attributes of the point with the smallest index.
+    /// - "center": attributes of the point closest to the voxel center.
+    /// - "mode": most frequent value of each channel, the smallest one on
+    /// ties. Only for integer and boolean attributes, such as labels.
+    ///
+    /// On the CPU, and for reductions other than "mean" on other devices,
+    /// points are grouped by sorting their voxel coordinates and all
+    /// attributes are reduced in a single pass; the points are then ordered by
+    /// voxel coordinates.
+    ///
     /// \param voxel_size Voxel size. A positive number.
-    /// \param reduction Reduction type. Currently only support "mean".
-    PointCloud VoxelDownSample(double voxel_size,
-                               const std::string &reduction = "mean") const;
+    /// \param reduction Reduction type of the attributes that are not in \p
+    /// attr_reductions, one of "mean", "first" or "center".
+    /// \param attr_reductions Reduction type of individual attributes, by
+    /// attribute name.
+    PointCloud VoxelDownSample(
+            double voxel_size,
+            const std::string &reduction = "mean",
+            const std::unordered_map<std::string, std::string>
+                    &attr_reductions = {}) const;
 
     /// \brief Downsamples a point cloud by selecting every kth index point and
     /// its attributes.
@@ -351,7 +369,8 @@ public:
     /// points has farthest distance.
     ///
     /// The sampling is performed by selecting the farthest point from previous
-    /// selected points iteratively.
+    /// selected points iteratively, starting from the first point. All point
+    /// attributes are kept, in the original point order.
     ///
     /// \param num_samples Number of points to be sampled.
     PointCloud FarthestPointDownSample(size_t num_samples) const;
@@ -402,8 +421,8 @@ public:
     /// for noisy point clouds can be found in Mehra et. al. 'Visibility of
     /// Noisy Point Cloud Data', 2010.
     ///
-    /// This is a wrapper for a CPU implementation and a copy of the point cloud
-    /// data and resulting visible triangle mesh and indiecs will be made.
+    /// The spherical flip runs on the device of the point cloud, the convex
+    /// hull is computed on the CPU with qhull.
     ///
     /// \param camera_location All points not visible from that location will be
     /// removed.
@@ -416,8 +435,10 @@ public:
     /// \brief Cluster PointCloud using the DBSCAN algorithm
     /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
     /// in Large Spatial Databases with Noise", 1996
-    /// This is a wrapper for a CPU implementation and a copy of the point cloud
-    /// data and resulting labels will be made.
+    ///
+    /// Neighbors are found with core::nns on the device of the point cloud and
+    /// the clusters are formed in parallel on the CPU. The labels are the same
+    /// as the ones of the legacy implementation.
     ///
     /// \param eps Density parameter that is used to find neighbouring points.
     /// \param min_points Minimum number of points to form a cluster.
@@ -430,8 +451,7 @@ public:
                                bool print_progress = false) const;
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
-    /// This is a wrapper for a CPU implementation and a copy of the point cloud
-    /// data and resulting plane model and inlier indiecs will be made.
+    /// Batches of plane hypotheses are scored in parallel on the CPU.
     ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
@@ -447,6 +467,31 @@ public:
             const int num_iterations = 100,
             const double probability = 0.99999999) const;
 
+    /// \brief Segment several planes one after another using the RANSAC
+    /// algorithm.
+    ///
+    /// After each plane is found its inliers are removed and the next plane is
+    /// segmented from the remaining points. Batches of plane hypotheses are
+    /// scored in parallel on the CPU.
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param max_num_planes Maximum number of planes to segment.
+    /// \param min_num_inliers Stop once the best plane has fewer inliers.
+    /// \return List of tuples of the plane model ax + by + cz + d = 0 and the
+    /// indices of the plane inliers on the same device as the point cloud, in
+    /// the order the planes were segmented.
+    std::vector<std::tuple<core::Tensor, core::Tensor>> SegmentPlanes(
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const double probability = 0.99999999,
+            const int max_num_planes = 10,
+            const size_t min_num_inliers = 100) const;
+
     /// Compute the convex hull of a point cloud using qhull.
     ///
     /// This runs on the CPU.
@@ -521,6 +566,9 @@ public:
     /// Piazza, Valentini, Varetti, "Mesh Reconstruction from Point Cloud",
     /// 2023.
     ///
+    /// The nearest neighbors are found with core::nns on the device of the
+    /// point cloud, the spanning tree is computed on the CPU.
+    ///
     /// \param k k nearest neighbour for graph reconstruction for normal
     /// propagation.
     /// \param lambda penalty constant on the distance of a point from the
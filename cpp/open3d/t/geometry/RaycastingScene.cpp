@@ -13,10 +13,17 @@
 
 // This header is in the embree src dir (embree/src/ext_embree/..).
 #include <embree4/rtcore.h>
+#include <tbb/blocked_range2d.h>
 #include <tbb/parallel_for.h>
 
 #include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <Eigen/LU>
+#include <algorithm>
+#include <array>
+#include <random>
 #include <tuple>
+#include <unordered_map>
 #include <unsupported/Eigen/AlignedVector3>
 #include <vector>
 
@@ -60,6 +67,88 @@ void AssertTensorDtypeLastDimDeviceMinNDim(const open3d::core::Tensor& tensor,
                                     open3d::core::Dtype::FromType<DTYPE>());
 }
 
+// Returns the ID of the geometry in the top level scene. For hits with an
+// instance this is the ID of the instance and not of the instanced mesh.
+inline unsigned int HitGeometryID(const RTCHit& hit) {
+    return hit.instID[0] != RTC_INVALID_GEOMETRY_ID ? hit.instID[0]
+                                                    : hit.geomID;
+}
+
+// Dispatches to the embree functions for ray packets of size K.
+template <int K>
+struct RayPacket;
+
+template <>
+struct RayPacket<4> {
+    static void Intersect(const int* valid,
+                          RTCScene scene,
+                          RTCRayHit4* rayhit,
+                          RTCIntersectArguments* args) {
+        rtcIntersect4(valid, scene, rayhit, args);
+    }
+    static void Occluded(const int* valid,
+                         RTCScene scene,
+                         RTCRay4* ray,
+                         RTCOccludedArguments* args) {
+        rtcOccluded4(valid, scene, ray, args);
+    }
+};
+
+template <>
+struct RayPacket<8> {
+    static void Intersect(const int* valid,
+                          RTCScene scene,
+                          RTCRayHit8* rayhit,
+                          RTCIntersectArguments* args) {
+        rtcIntersect8(valid, scene, rayhit, args);
+    }
+    static void Occluded(const int* valid,
+                         RTCScene scene,
+                         RTCRay8* ray,
+                         RTCOccludedArguments* args) {
+        rtcOccluded8(valid, scene, ray, args);
+    }
+};
+
+template <>
+struct RayPacket<16> {
+    static void Intersect(const int* valid,
+                          RTCScene scene,
+                          RTCRayHit16* rayhit,
+                          RTCIntersectArguments* args) {
+        rtcIntersect16(valid, scene, rayhit, args);
+    }
+    static void Occluded(const int* valid,
+                         RTCScene scene,
+                         RTCRay16* ray,
+                         RTCOccludedArguments* args) {
+        rtcOccluded16(valid, scene, ray, args);
+    }
+};
+
+// Returns the row length of rays organized as images with shape
+// {.., height, width, 6}. The rays of an image are assumed to be coherent and
+// are traced as packets of neighboring pixels. Returns 0 for lists of rays.
+size_t CoherentRowLength(const open3d::core::Tensor& rays) {
+    return rays.NumDims() > 2 ? size_t(rays.GetShape(rays.NumDims() - 2)) : 0;
+}
+
+// Returns the tensor for key if it can be used as output with the given
+// shape and dtype and allocates a new tensor otherwise.
+open3d::core::Tensor& GetOutputTensor(
+        std::unordered_map<std::string, open3d::core::Tensor>& result,
+        const std::string& key,
+        const open3d::core::SizeVector& shape,
+        const open3d::core::Dtype& dtype) {
+    auto it = result.find(key);
+    if (it == result.end() || it->second.GetShape() != shape ||
+        it->second.GetDtype() != dtype ||
+        !it->second.GetDevice().IsCPU() || !it->second.IsContiguous()) {
+        result[key] = open3d::core::Tensor(shape, dtype);
+    }
+    return result[key];
+}
+
 struct CountIntersectionsContext {
     RTCRayQueryContext context;
     std::vector<std::tuple<uint32_t, uint32_t, float>>*
@@ -96,10 +185,11 @@ void CountIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
         RTCHit hit = rtcGetHitFromHitN(hitN, N, ui);
 
         unsigned int ray_id = ray.id;
-        std::tuple<uint32_t, uint32_t, float> gpID(hit.geomID, hit.primID,
+        const unsigned int geom_id = HitGeometryID(hit);
+        std::tuple<uint32_t, uint32_t, float> gpID(geom_id, hit.primID,
                                                    ray.tfar);
         auto& prev_gpIDtfar = previous_geom_prim_ID_tfar->operator[](ray_id);
-        if (std::get<0>(prev_gpIDtfar) != hit.geomID ||
+        if (std::get<0>(prev_gpIDtfar) != geom_id ||
             (std::get<1>(prev_gpIDtfar) != hit.primID &&
              std::get<2>(prev_gpIDtfar) != ray.tfar)) {
             ++(intersections[ray_id]);
@@ -158,15 +248,16 @@ void ListIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
         RTCHit hit = rtcGetHitFromHitN(hitN, N, ui);
 
         unsigned int ray_id = ray.id;
-        std::tuple<uint32_t, uint32_t, float> gpID(hit.geomID, hit.primID,
+        const unsigned int geom_id = HitGeometryID(hit);
+        std::tuple<uint32_t, uint32_t, float> gpID(geom_id, hit.primID,
                                                    ray.tfar);
         auto& prev_gpIDtfar = previous_geom_prim_ID_tfar->operator[](ray_id);
-        if (std::get<0>(prev_gpIDtfar) != hit.geomID ||
+        if (std::get<0>(prev_gpIDtfar) != geom_id ||
             (std::get<1>(prev_gpIDtfar) != hit.primID &&
              std::get<2>(prev_gpIDtfar) != ray.tfar)) {
             size_t idx = cumsum[ray_id] + track_intersections[ray_id];
             ray_ids[idx] = ray_id;
-            geometry_ids[idx] = hit.geomID;
+            geometry_ids[idx] = geom_id;
             primitive_ids[idx] = hit.primID;
             primitive_uvs[idx * 2 + 0] = hit.u;
             primitive_uvs[idx * 2 + 1] = hit.v;
@@ -179,6 +270,92 @@ void ListIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
     }
 }
 
+struct MultiHitContext {
+    RTCRayQueryContext context;
+    int max_hits;
+    int* num_hits;
+    float* t_hit;
+    unsigned int* geometry_ids;
+    unsigned int* primitive_ids;
+    float* primitive_uvs;
+    float* primitive_normals;
+};
+
+// Keeps the max_hits closest hits of each ray sorted by distance. Embree
+// reports hits in no particular order, so every hit is rejected to continue
+// the traversal.
+void MultiHitFunc(const RTCFilterFunctionNArguments* args) {
+    int* valid = args->valid;
+    const MultiHitContext* context =
+            reinterpret_cast<const MultiHitContext*>(args->context);
+    struct RTCRayN* rayN = args->ray;
+    struct RTCHitN* hitN = args->hit;
+    const unsigned int N = args->N;
+
+    // Avoid crashing when debug visualizations are used.
+    if (context == nullptr) return;
+
+    const int max_hits = context->max_hits;
+
+    // Iterate over all rays in ray packet.
+    for (unsigned int ui = 0; ui < N; ui += 1) {
+        // Ignore inactive rays.
+        if (valid[ui] != -1) continue;
+
+        // Read ray/hit from ray structure.
+        RTCRay ray = rtcGetRayFromRayN(rayN, N, ui);
+        RTCHit hit = rtcGetHitFromHitN(hitN, N, ui);
+        // Always ignore hit
+        valid[ui] = 0;
+
+        const size_t offset = size_t(ray.id) * max_hits;
+        const unsigned int geom_id = HitGeometryID(hit);
+        int& num_hits = context->num_hits[ray.id];
+        float* t_hit = context->t_hit + offset;
+        unsigned int* geometry_ids = context->geometry_ids + offset;
+        unsigned int* primitive_ids = context->primitive_ids + offset;
+        float* primitive_uvs = context->primitive_uvs + offset * 2;
+        float* primitive_normals = context->primitive_normals + offset * 3;
+
+        if (num_hits == max_hits && ray.tfar >= t_hit[max_hits - 1]) continue;
+
+        // Embree may report the same triangle more than once, and a ray
+        // through a shared edge or vertex hits every adjacent triangle at the
+        // same distance. As in CountIntersectionsFunc, such hits of the same
+        // geometry are counted once.
+        bool duplicate = false;
+        for (int i = 0; i < num_hits && !duplicate; ++i) {
+            duplicate = geometry_ids[i] == geom_id &&
+                        (primitive_ids[i] == hit.primID ||
+                         t_hit[i] == ray.tfar);
+        }
+        if (duplicate) continue;
+
+        // Insertion sort, the farthest hit drops out if the list is full.
+        int idx = std::min(num_hits, max_hits - 1);
+        for (; idx > 0 && t_hit[idx - 1] > ray.tfar; --idx) {
+            t_hit[idx] = t_hit[idx - 1];
+            geometry_ids[idx] = geometry_ids[idx - 1];
+            primitive_ids[idx] = primitive_ids[idx - 1];
+            std::copy_n(&primitive_uvs[(idx - 1) * 2], 2,
+                        &primitive_uvs[idx * 2]);
+            std::copy_n(&primitive_normals[(idx - 1) * 3], 3,
+                        &primitive_normals[idx * 3]);
+        }
+        t_hit[idx] = ray.tfar;
+        geometry_ids[idx] = geom_id;
+        primitive_ids[idx] = hit.primID;
+        primitive_uvs[idx * 2 + 0] = hit.u;
+        primitive_uvs[idx * 2 + 1] = hit.v;
+        // Normals are in object space for instances and are transformed after
+        // the traversal.
+        primitive_normals[idx * 3 + 0] = hit.Ng_x;
+        primitive_normals[idx * 3 + 1] = hit.Ng_y;
+        primitive_normals[idx * 3 + 2] = hit.Ng_z;
+        num_hits = std::min(num_hits + 1, max_hits);
+    }
+}
+
 // Adapted from common/math/closest_point.h
 inline Vec3fa closestPointTriangle(Vec3fa const& p,
                                    Vec3fa const& a,
@@ -263,13 +440,26 @@ struct ClosestPointResult {
             geometry_ptrs_ptr;
 };
 
+// Applies the column major 4x4 transformation matrix \p xfm to \p p.
+inline Vec3fa TransformPoint(const float* xfm, const Vec3fa& p) {
+    Eigen::Map<const Eigen::Matrix4f> M(xfm);
+    const Vec3f q = M.topLeftCorner<3, 3>() * Vec3f(p.x(), p.y(), p.z()) +
+                    M.topRightCorner<3, 1>();
+    return Vec3fa(q.x(), q.y(), q.z());
+}
+
 // Code adapted from the embree closest_point tutorial.
 bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
     assert(args->userPtr);
-    const unsigned int geomID = args->geomID;
     const unsigned int primID = args->primID;
-
-    // query position in world space
+    // For instances the geometry is described by the entry of the instance in
+    // the top level scene. Instanced scenes contain only a single mesh.
+    const bool instanced = args->context->instStackSize > 0;
+    const unsigned int geomID =
+            instanced ? args->context->instID[0] : args->geomID;
+
+    // Query position in instance space if the instance transform is a
+    // similarity transform and in world space otherwise.
     Vec3fa q(args->query->x, args->query->y, args->query->z);
 
     ClosestPointResult* result =
@@ -281,7 +471,8 @@ bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
     const void* ptr2 =
             std::get<2>(result->geometry_ptrs_ptr->operator[](geomID));
 
-    if (RTC_GEOMETRY_TYPE_TRIANGLE == geom_type) {
+    if (RTC_GEOMETRY_TYPE_TRIANGLE == geom_type ||
+        RTC_GEOMETRY_TYPE_INSTANCE == geom_type) {
         const float* vertex_positions = (const float*)ptr1;
         const uint32_t* triangle_indices = (const uint32_t*)ptr2;
 
@@ -295,6 +486,19 @@ bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
                   vertex_positions[3 * triangle_indices[3 * primID + 2] + 1],
                   vertex_positions[3 * triangle_indices[3 * primID + 2] + 2]);
 
+        const float* inst2world =
+                instanced ? args->context
+                                    ->inst2world[args->context->instStackSize -
+                                                 1]
+                          : nullptr;
+        if (instanced && args->similarityScale <= 0) {
+            // Embree does not transform the query for general affine
+            // transforms. Compute the closest point in world space instead.
+            v0 = TransformPoint(inst2world, v0);
+            v1 = TransformPoint(inst2world, v1);
+            v2 = TransformPoint(inst2world, v2);
+        }
+
         // Determine distance to closest point on triangle
         float u, v;
         const Vec3fa p = closestPointTriangle(q, v0, v1, v2, u, v);
@@ -305,7 +509,15 @@ bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
         // faster traversal (due to better culling).
         if (d < args->query->radius) {
             args->query->radius = d;
-            result->p = p;
+            if (instanced && args->similarityScale > 0) {
+                // Results are always returned in world space.
+                result->p = TransformPoint(inst2world, p);
+                v0 = TransformPoint(inst2world, v0);
+                v1 = TransformPoint(inst2world, v1);
+                v2 = TransformPoint(inst2world, v2);
+            } else {
+                result->p = p;
+            }
             result->primID = primID;
             result->geomID = geomID;
             Vec3fa e1 = v1 - v0;
@@ -328,6 +540,11 @@ namespace geometry {
 struct RaycastingScene::Impl {
     // The maximum number of rays used in calls to embree.
     const size_t BATCH_SIZE = 1024;
+    // The number of image rows of the tiles for tracing coherent rays.
+    const size_t TILE_ROWS = 16;
+    // The size of the ray packets for coherent rays or 1 if the device does
+    // not support packets.
+    int packet_size_;
     RTCDevice device_;
     RTCScene scene_;
     bool scene_committed_;  // true if the scene has been committed.
@@ -336,8 +553,114 @@ struct RaycastingScene::Impl {
             geometry_ptrs_;
     core::Device tensor_device_;  // cpu
 
+    // A prototype is a scene with a single mesh which can be placed multiple
+    // times in the scene as instance. All instances share the BVH of the
+    // prototype.
+    struct Prototype {
+        RTCScene scene;
+        const float* vertex_positions;
+        const uint32_t* triangle_indices;
+    };
+    std::vector<Prototype> prototypes_;
+    // The transformation of an instance to world space and the matrix for
+    // transforming the normals of the instanced mesh.
+    struct Instance {
+        Eigen::Matrix4f transform;
+        Eigen::Matrix3f normal_matrix;
+    };
+    // The instances of the scene. The key is the geometry ID of the instance.
+    std::unordered_map<uint32_t, Instance> instances_;
+    // true if the scene has been switched to a two-level BVH for cheap updates
+    // of the instance transforms.
+    bool dynamic_scene_;
+
     bool devprop_join_commit;
 
+    // Creates a new committed triangle geometry with copies of the vertex
+    // positions and triangle indices. The pointers to the copies are returned
+    // in \p vertex_buffer_ptr and \p index_buffer_ptr.
+    RTCGeometry NewTriangleGeometry(const core::Tensor& vertex_positions,
+                                    const core::Tensor& triangle_indices,
+                                    const float*& vertex_buffer_ptr,
+                                    const uint32_t*& index_buffer_ptr) {
+        core::AssertTensorDevice(vertex_positions, tensor_device_);
+        core::AssertTensorShape(vertex_positions, {utility::nullopt, 3});
+        core::AssertTensorDtype(vertex_positions, core::Float32);
+        core::AssertTensorDevice(triangle_indices, tensor_device_);
+        core::AssertTensorShape(triangle_indices, {utility::nullopt, 3});
+        core::AssertTensorDtype(triangle_indices, core::UInt32);
+
+        const size_t num_vertices = vertex_positions.GetLength();
+        const size_t num_triangles = triangle_indices.GetLength();
+
+        RTCGeometry geom = rtcNewGeometry(device_, RTC_GEOMETRY_TYPE_TRIANGLE);
+
+        // rtcSetNewGeometryBuffer will take care of alignment and padding
+        float* vertex_buffer = (float*)rtcSetNewGeometryBuffer(
+                geom, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3,
+                3 * sizeof(float), num_vertices);
+
+        uint32_t* index_buffer = (uint32_t*)rtcSetNewGeometryBuffer(
+                geom, RTC_BUFFER_TYPE_INDEX, 0, RTC_FORMAT_UINT3,
+                3 * sizeof(uint32_t), num_triangles);
+
+        {
+            auto data = vertex_positions.Contiguous();
+            memcpy(vertex_buffer, data.GetDataPtr(),
+                   sizeof(float) * 3 * num_vertices);
+        }
+        {
+            auto data = triangle_indices.Contiguous();
+            memcpy(index_buffer, data.GetDataPtr(),
+                   sizeof(uint32_t) * 3 * num_triangles);
+        }
+        rtcSetGeometryEnableFilterFunctionFromArguments(geom, true);
+        rtcCommitGeometry(geom);
+
+        vertex_buffer_ptr = vertex_buffer;
+        index_buffer_ptr = index_buffer;
+        return geom;
+    }
+
+    // Returns the instance geometry for the geometry ID or raises an error if
+    // the ID does not belong to an instance.
+    RTCGeometry GetInstanceGeometry(uint32_t geometry_id) {
+        if (!instances_.count(geometry_id)) {
+            utility::LogError("Geometry ID {} is not an instance.",
+                              geometry_id);
+        }
+        return rtcGetGeometry(scene_, geometry_id);
+    }
+
+    // Sets the transform of the instance geometry.
+    Instance SetInstanceTransform(RTCGeometry geom,
+                                  const core::Tensor& transform) {
+        core::AssertTensorDevice(transform, tensor_device_);
+        core::AssertTensorShape(transform, {4, 4});
+        const core::Tensor transform_contig =
+                transform.To(core::Float32).Contiguous();
+        const Eigen::Matrix4f xfm =
+                Eigen::Map<const Eigen::Matrix<float, 4, 4, Eigen::RowMajor>>(
+                        transform_contig.GetDataPtr<float>());
+        rtcSetGeometryTransform(geom, 0, RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,
+                                xfm.data());
+        rtcCommitGeometry(geom);
+        return {xfm, xfm.topLeftCorner<3, 3>().inverse().transpose()};
+    }
+
+    // Computes the normalized world space normal of the hit.
+    void GetHitNormal(const RTCHit& hit, float* normal) const {
+        Eigen::Vector3f n(hit.Ng_x, hit.Ng_y, hit.Ng_z);
+        // Embree returns the normals of instanced meshes in object space.
+        if (hit.instID[0] != RTC_INVALID_GEOMETRY_ID) {
+            n = instances_.at(hit.instID[0]).normal_matrix * n;
+        }
+        n.normalize();
+        normal[0] = n.x();
+        normal[1] = n.y();
+        normal[2] = n.z();
+    }
+
     void CommitScene() {
         if (!scene_committed_) {
             if (devprop_join_commit) {
@@ -349,14 +672,103 @@ struct RaycastingScene::Impl {
         }
     }
 
+    // Writes the hit information of a ray to the output arrays at idx.
+    void StoreHit(const RTCHit& hit,
+                  const float tfar,
+                  const size_t idx,
+                  float* t_hit,
+                  unsigned int* geometry_ids,
+                  unsigned int* primitive_ids,
+                  float* primitive_uvs,
+                  float* primitive_normals) const {
+        t_hit[idx] = tfar;
+        if (hit.geomID != RTC_INVALID_GEOMETRY_ID) {
+            geometry_ids[idx] = HitGeometryID(hit);
+            primitive_ids[idx] = hit.primID;
+            primitive_uvs[idx * 2 + 0] = hit.u;
+            primitive_uvs[idx * 2 + 1] = hit.v;
+            GetHitNormal(hit, &primitive_normals[idx * 3]);
+        } else {
+            geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+            primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+            primitive_uvs[idx * 2 + 0] = 0;
+            primitive_uvs[idx * 2 + 1] = 0;
+            primitive_normals[idx * 3 + 0] = 0;
+            primitive_normals[idx * 3 + 1] = 0;
+            primitive_normals[idx * 3 + 2] = 0;
+        }
+    }
+
+    // Runs LoopFn over the rays. Incoherent rays are processed in batches of
+    // consecutive rays. For coherent rays organized as image rows of length
+    // row_length the range is split into 2D tiles such that the ray packets
+    // traced by LoopFn contain neighboring pixels.
+    template <class Func1D, class Func2D>
+    void ParallelForRays(const size_t num_rays,
+                         const size_t row_length,
+                         const Func1D& LoopFn,
+                         const Func2D& TileLoopFn,
+                         const int nthreads) {
+        auto Run = [&]() {
+            if (row_length > 0) {
+                tbb::parallel_for(
+                        tbb::blocked_range2d<size_t>(
+                                0, num_rays / row_length, TILE_ROWS, 0,
+                                row_length, BATCH_SIZE / TILE_ROWS),
+                        TileLoopFn);
+            } else {
+                tbb::parallel_for(
+                        tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
+                        LoopFn);
+            }
+        };
+        if (nthreads > 0) {
+            tbb::task_arena arena(nthreads);
+            arena.execute(Run);
+        } else {
+            Run();
+        }
+    }
+
+    // Calls PacketFn for all packets of size K in the tile. PacketFn gets
+    // the valid mask of the packet and a function that maps the lanes of the
+    // packet to the linear ray index.
+    template <int K, class Func>
+    static void ForEachPacketInTile(const tbb::blocked_range2d<size_t>& tile,
+                                    const size_t row_length,
+                                    const Func& PacketFn) {
+        // Packets cover blocks of PW x PH pixels.
+        constexpr size_t PW = K == 4 ? 2 : 4;
+        constexpr size_t PH = K / PW;
+        std::array<int, K> valid;
+        std::array<size_t, K> ray_idx;
+        for (size_t y0 = tile.rows().begin(); y0 < tile.rows().end();
+             y0 += PH) {
+            for (size_t x0 = tile.cols().begin(); x0 < tile.cols().end();
+                 x0 += PW) {
+                for (size_t k = 0; k < K; ++k) {
+                    const size_t y = y0 + k / PW;
+                    const size_t x = x0 + k % PW;
+                    const bool inside =
+                            y < tile.rows().end() && x < tile.cols().end();
+                    valid[k] = inside ? -1 : 0;
+                    ray_idx[k] = inside ? y * row_length + x : 0;
+                }
+                PacketFn(valid.data(), ray_idx.data());
+            }
+        }
+    }
+
     template <bool LINE_INTERSECTION>
     void CastRays(const float* const rays,
                   const size_t num_rays,
+                  const size_t row_length,
                   float* t_hit,
                   unsigned int* geometry_ids,
                   unsigned int* primitive_ids,
                   float* primitive_uvs,
                   float* primitive_normals,
+                  const unsigned int ray_mask,
                   const int nthreads) {
         CommitScene();
 
@@ -384,7 +796,7 @@ struct RaycastingScene::Impl {
                 } else {
                     rh.ray.tfar = std::numeric_limits<float>::infinity();
                 }
-                rh.ray.mask = -1;
+                rh.ray.mask = ray_mask;
                 rh.ray.id = i - range.begin();
                 rh.ray.flags = 0;
                 rh.hit.geomID = RTC_INVALID_GEOMETRY_ID;
@@ -396,49 +808,106 @@ struct RaycastingScene::Impl {
             for (size_t i = range.begin(); i < range.end(); ++i) {
                 RTCRayHit rh = rayhits[i - range.begin()];
                 size_t idx = rh.ray.id + range.begin();
-                t_hit[idx] = rh.ray.tfar;
-                if (rh.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
-                    geometry_ids[idx] = rh.hit.geomID;
-                    primitive_ids[idx] = rh.hit.primID;
-                    primitive_uvs[idx * 2 + 0] = rh.hit.u;
-                    primitive_uvs[idx * 2 + 1] = rh.hit.v;
-                    float inv_norm = 1.f / std::sqrt(rh.hit.Ng_x * rh.hit.Ng_x +
-                                                     rh.hit.Ng_y * rh.hit.Ng_y +
-                                                     rh.hit.Ng_z * rh.hit.Ng_z);
-                    primitive_normals[idx * 3 + 0] = rh.hit.Ng_x * inv_norm;
-                    primitive_normals[idx * 3 + 1] = rh.hit.Ng_y * inv_norm;
-                    primitive_normals[idx * 3 + 2] = rh.hit.Ng_z * inv_norm;
-                } else {
-                    geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
-                    primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
-                    primitive_uvs[idx * 2 + 0] = 0;
-                    primitive_uvs[idx * 2 + 1] = 0;
-                    primitive_normals[idx * 3 + 0] = 0;
-                    primitive_normals[idx * 3 + 1] = 0;
-                    primitive_normals[idx * 3 + 2] = 0;
+                StoreHit(rh.hit, rh.ray.tfar, idx, t_hit, geometry_ids,
+                         primitive_ids, primitive_uvs, primitive_normals);
+            }
+        };
+
+        // Traces packets of neighboring pixels. Embree uses SIMD traversal
+        // for packets which is faster than single rays if the rays are
+        // coherent.
+        auto TileLoopFn = [&](const tbb::blocked_range2d<size_t>& tile) {
+            RTCIntersectArguments args;
+            rtcInitIntersectArguments(&args);
+            args.flags = RTC_RAY_QUERY_FLAG_COHERENT;
+
+            auto PacketFn = [&](auto& rh, const int* valid,
+                                const size_t* ray_idx) {
+                constexpr int K = sizeof(rh.ray.tfar) / sizeof(float);
+                for (int k = 0; k < K; ++k) {
+                    const float* r = &rays[ray_idx[k] * 6];
+                    rh.ray.org_x[k] = r[0];
+                    rh.ray.org_y[k] = r[1];
+                    rh.ray.org_z[k] = r[2];
+                    if (LINE_INTERSECTION) {
+                        rh.ray.dir_x[k] = r[3] - r[0];
+                        rh.ray.dir_y[k] = r[4] - r[1];
+                        rh.ray.dir_z[k] = r[5] - r[2];
+                        rh.ray.tfar[k] = 1.f;
+                    } else {
+                        rh.ray.dir_x[k] = r[3];
+                        rh.ray.dir_y[k] = r[4];
+                        rh.ray.dir_z[k] = r[5];
+                        rh.ray.tfar[k] = std::numeric_limits<float>::infinity();
+                    }
+                    rh.ray.tnear[k] = 0;
+                    rh.ray.mask[k] = ray_mask;
+                    rh.ray.id[k] = k;
+                    rh.ray.flags[k] = 0;
+                    rh.hit.geomID[k] = RTC_INVALID_GEOMETRY_ID;
+                    rh.hit.instID[0][k] = RTC_INVALID_GEOMETRY_ID;
+                }
+
+                RayPacket<K>::Intersect(valid, scene_, &rh, &args);
+
+                for (int k = 0; k < K; ++k) {
+                    if (!valid[k]) continue;
+                    RTCHit hit;
+                    hit.Ng_x = rh.hit.Ng_x[k];
+                    hit.Ng_y = rh.hit.Ng_y[k];
+                    hit.Ng_z = rh.hit.Ng_z[k];
+                    hit.u = rh.hit.u[k];
+                    hit.v = rh.hit.v[k];
+                    hit.primID = rh.hit.primID[k];
+                    hit.geomID = rh.hit.geomID[k];
+                    hit.instID[0] = rh.hit.instID[0][k];
+                    StoreHit(hit, rh.ray.tfar[k], ray_idx[k], t_hit,
+                             geometry_ids, primitive_ids, primitive_uvs,
+                             primitive_normals);
+                }
+            };
+
+            switch (packet_size_) {
+                case 16: {
+                    RTCRayHit16 rh;
+                    ForEachPacketInTile<16>(
+                            tile, row_length,
+                            [&](const int* valid, const size_t* ray_idx) {
+                                PacketFn(rh, valid, ray_idx);
+                            });
+                    break;
+                }
+                case 8: {
+                    RTCRayHit8 rh;
+                    ForEachPacketInTile<8>(
+                            tile, row_length,
+                            [&](const int* valid, const size_t* ray_idx) {
+                                PacketFn(rh, valid, ray_idx);
+                            });
+                    break;
+                }
+                default: {
+                    RTCRayHit4 rh;
+                    ForEachPacketInTile<4>(
+                            tile, row_length,
+                            [&](const int* valid, const size_t* ray_idx) {
+                                PacketFn(rh, valid, ray_idx);
+                            });
                 }
             }
         };
 
-        if (nthreads > 0) {
-            tbb::task_arena arena(nthreads);
-            arena.execute([&]() {
-                tbb::parallel_for(
-                        tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
-                        LoopFn);
-            });
-        } else {
-            tbb::parallel_for(
-                    tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
-                    LoopFn);
-        }
+        ParallelForRays(num_rays, packet_size_ > 1 ? row_length : 0, LoopFn,
+                        TileLoopFn, nthreads);
     }
 
     void TestOcclusions(const float* const rays,
                         const size_t num_rays,
+                        const size_t row_length,
                         const float tnear,
                         const float tfar,
                         int8_t* occluded,
+                        const unsigned int ray_mask,
                         const int nthreads) {
         CommitScene();
 
@@ -462,7 +931,7 @@ struct RaycastingScene::Impl {
                 ray.dir_z = r[5];
                 ray.tnear = tnear;
                 ray.tfar = tfar;
-                ray.mask = -1;
+                ray.mask = ray_mask;
                 ray.id = i - range.begin();
                 ray.flags = 0;
 
@@ -477,23 +946,77 @@ struct RaycastingScene::Impl {
             }
         };
 
-        if (nthreads > 0) {
-            tbb::task_arena arena(nthreads);
-            arena.execute([&]() {
-                tbb::parallel_for(
-                        tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
-                        LoopFn);
-            });
-        } else {
-            tbb::parallel_for(
-                    tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
-                    LoopFn);
-        }
+        auto TileLoopFn = [&](const tbb::blocked_range2d<size_t>& tile) {
+            RTCOccludedArguments packet_args;
+            rtcInitOccludedArguments(&packet_args);
+            packet_args.flags = RTC_RAY_QUERY_FLAG_COHERENT;
+
+            auto PacketFn = [&](auto& ray, const int* valid,
+                                const size_t* ray_idx) {
+                constexpr int K = sizeof(ray.tfar) / sizeof(float);
+                for (int k = 0; k < K; ++k) {
+                    const float* r = &rays[ray_idx[k] * 6];
+                    ray.org_x[k] = r[0];
+                    ray.org_y[k] = r[1];
+                    ray.org_z[k] = r[2];
+                    ray.dir_x[k] = r[3];
+                    ray.dir_y[k] = r[4];
+                    ray.dir_z[k] = r[5];
+                    ray.tnear[k] = tnear;
+                    ray.tfar[k] = tfar;
+                    ray.mask[k] = ray_mask;
+                    ray.id[k] = k;
+                    ray.flags[k] = 0;
+                }
+
+                RayPacket<K>::Occluded(valid, scene_, &ray, &packet_args);
+
+                for (int k = 0; k < K; ++k) {
+                    if (!valid[k]) continue;
+                    occluded[ray_idx[k]] = int8_t(
+                            -std::numeric_limits<float>::infinity() ==
+                            ray.tfar[k]);
+                }
+            };
+
+            switch (packet_size_) {
+                case 16: {
+                    RTCRay16 ray;
+                    ForEachPacketInTile<16>(
+                            tile, row_length,
+                            [&](const int* valid, const size_t* ray_idx) {
+                                PacketFn(ray, valid, ray_idx);
+                            });
+                    break;
+                }
+                case 8: {
+                    RTCRay8 ray;
+                    ForEachPacketInTile<8>(
+                            tile, row_length,
+                            [&](const int* valid, const size_t* ray_idx) {
+                                PacketFn(ray, valid, ray_idx);
+                            });
+                    break;
+                }
+                default: {
+                    RTCRay4 ray;
+                    ForEachPacketInTile<4>(
+                            tile, row_length,
+                            [&](const int* valid, const size_t* ray_idx) {
+                                PacketFn(ray, valid, ray_idx);
+                            });
+                }
+            }
+        };
+
+        ParallelForRays(num_rays, packet_size_ > 1 ? row_length : 0, LoopFn,
+                        TileLoopFn, nthreads);
     }
 
     void CountIntersections(const float* const rays,
                             const size_t num_rays,
                             int* intersections,
+                            const unsigned int ray_mask,
                             const int nthreads) {
         CommitScene();
 
@@ -530,7 +1053,7 @@ struct RaycastingScene::Impl {
                 rh->ray.dir_z = r[5];
                 rh->ray.tnear = 0;
                 rh->ray.tfar = std::numeric_limits<float>::infinity();
-                rh->ray.mask = -1;
+                rh->ray.mask = ray_mask;
                 rh->ray.flags = 0;
                 rh->ray.id = i;
                 rh->hit.geomID = RTC_INVALID_GEOMETRY_ID;
@@ -564,6 +1087,7 @@ struct RaycastingScene::Impl {
                            unsigned int* primitive_ids,
                            float* primitive_uvs,
                            float* t_hit,
+                           const unsigned int ray_mask,
                            const int nthreads) {
         CommitScene();
 
@@ -611,7 +1135,7 @@ struct RaycastingScene::Impl {
                 rh->ray.dir_z = r[5];
                 rh->ray.tnear = 0;
                 rh->ray.tfar = std::numeric_limits<float>::infinity();
-                rh->ray.mask = -1;
+                rh->ray.mask = ray_mask;
                 rh->ray.flags = 0;
                 rh->ray.id = i;
                 rh->hit.geomID = RTC_INVALID_GEOMETRY_ID;
@@ -635,6 +1159,89 @@ struct RaycastingScene::Impl {
         }
     }
 
+    void CastRaysMultiHit(const float* const rays,
+                          const size_t num_rays,
+                          const int max_hits,
+                          int* num_hits,
+                          float* t_hit,
+                          unsigned int* geometry_ids,
+                          unsigned int* primitive_ids,
+                          float* primitive_uvs,
+                          float* primitive_normals,
+                          const unsigned int ray_mask,
+                          const int nthreads) {
+        CommitScene();
+
+        const size_t num_slots = num_rays * max_hits;
+        memset(num_hits, 0, sizeof(int) * num_rays);
+        std::fill_n(t_hit, num_slots, std::numeric_limits<float>::infinity());
+        std::fill_n(geometry_ids, num_slots, RTC_INVALID_GEOMETRY_ID);
+        std::fill_n(primitive_ids, num_slots, RTC_INVALID_GEOMETRY_ID);
+        memset(primitive_uvs, 0, sizeof(float) * num_slots * 2);
+        memset(primitive_normals, 0, sizeof(float) * num_slots * 3);
+
+        MultiHitContext context;
+        rtcInitRayQueryContext(&context.context);
+        context.max_hits = max_hits;
+        context.num_hits = num_hits;
+        context.t_hit = t_hit;
+        context.geometry_ids = geometry_ids;
+        context.primitive_ids = primitive_ids;
+        context.primitive_uvs = primitive_uvs;
+        context.primitive_normals = primitive_normals;
+
+        RTCIntersectArguments args;
+        rtcInitIntersectArguments(&args);
+        args.filter = MultiHitFunc;
+        args.context = &context.context;
+
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            std::vector<RTCRayHit> rayhits(range.size());
+
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                RTCRayHit* rh = &rayhits[i - range.begin()];
+                const float* r = &rays[i * 6];
+                rh->ray.org_x = r[0];
+                rh->ray.org_y = r[1];
+                rh->ray.org_z = r[2];
+                rh->ray.dir_x = r[3];
+                rh->ray.dir_y = r[4];
+                rh->ray.dir_z = r[5];
+                rh->ray.tnear = 0;
+                rh->ray.tfar = std::numeric_limits<float>::infinity();
+                rh->ray.mask = ray_mask;
+                rh->ray.flags = 0;
+                rh->ray.id = i;
+                rh->hit.geomID = RTC_INVALID_GEOMETRY_ID;
+                rh->hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
+
+                rtcIntersect1(scene_, rh, &args);
+
+                for (int k = 0; k < num_hits[i]; ++k) {
+                    const size_t idx = i * max_hits + k;
+                    Eigen::Map<Eigen::Vector3f> n(&primitive_normals[idx * 3]);
+                    if (instances_.count(geometry_ids[idx])) {
+                        n = instances_.at(geometry_ids[idx]).normal_matrix * n;
+                    }
+                    n.normalize();
+                }
+            }
+        };
+
+        if (nthreads > 0) {
+            tbb::task_arena arena(nthreads);
+            arena.execute([&]() {
+                tbb::parallel_for(
+                        tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
+                        LoopFn);
+            });
+        } else {
+            tbb::parallel_for(
+                    tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
+                    LoopFn);
+        }
+    }
+
     void ComputeClosestPoints(const float* const query_points,
                               const size_t num_query_points,
                               float* closest_points,
@@ -642,7 +1249,9 @@ struct RaycastingScene::Impl {
                               unsigned int* primitive_ids,
                               float* primitive_uvs,
                               float* primitive_normals,
-                              const int nthreads) {
+                              const int nthreads,
+                              const float radius =
+                                      std::numeric_limits<float>::infinity()) {
         CommitScene();
 
         auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
@@ -651,7 +1260,7 @@ struct RaycastingScene::Impl {
                 query.x = query_points[i * 3 + 0];
                 query.y = query_points[i * 3 + 1];
                 query.z = query_points[i * 3 + 2];
-                query.radius = std::numeric_limits<float>::infinity();
+                query.radius = radius;
                 query.time = 0.f;
 
                 ClosestPointResult result;
@@ -688,6 +1297,240 @@ struct RaycastingScene::Impl {
                     LoopFn);
         }
     }
+
+    // Runs fn(i) for i in [0, n) in parallel.
+    template <class Func>
+    static void ParallelFor(const size_t n,
+                            const Func& fn,
+                            const int nthreads) {
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                fn(i);
+            }
+        };
+        if (nthreads > 0) {
+            tbb::task_arena arena(nthreads);
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, n), LoopFn);
+            });
+        } else {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, n), LoopFn);
+        }
+    }
+
+    // Computes the closest point to q on the triangle primitive_id of the
+    // geometry geometry_id. Instanced triangles are transformed to world
+    // space.
+    Vec3f ClosestPointOnTriangle(const uint32_t geometry_id,
+                                 const uint32_t primitive_id,
+                                 const Vec3f& q) const {
+        const auto& geometry = geometry_ptrs_[geometry_id];
+        const float* vertex_positions = (const float*)std::get<1>(geometry);
+        const uint32_t* triangle_indices =
+                (const uint32_t*)std::get<2>(geometry);
+        Vec3fa v[3];
+        for (int c = 0; c < 3; ++c) {
+            const float* p =
+                    &vertex_positions[3 * triangle_indices[3 * primitive_id +
+                                                           c]];
+            v[c] = Vec3fa(p[0], p[1], p[2]);
+        }
+        if (RTC_GEOMETRY_TYPE_INSTANCE == std::get<0>(geometry)) {
+            const Eigen::Matrix4f& xfm = instances_.at(geometry_id).transform;
+            for (int c = 0; c < 3; ++c) {
+                v[c] = TransformPoint(xfm.data(), v[c]);
+            }
+        }
+        float u, w;
+        const Vec3fa p = closestPointTriangle(Vec3fa(q.x(), q.y(), q.z()),
+                                              v[0], v[1], v[2], u, w);
+        return Vec3f(p.x(), p.y(), p.z());
+    }
+
+    // Propagates the closest triangles of the seed voxels to all voxels of
+    // the grid with the jump flooding algorithm and a final pass with step 1
+    // (JFA+1). Voxels take the closest of the triangles of the neighbors at
+    // the current step distance. Propagating triangles instead of points
+    // keeps the distances exact unless the closest triangle of a voxel is not
+    // closest to any of the neighbors. Voxels without seed have the geometry
+    // ID RTC_INVALID_GEOMETRY_ID.
+    void JumpFlood(const float* const query_points,
+                   const int64_t nx,
+                   const int64_t ny,
+                   const int64_t nz,
+                   std::vector<uint32_t>& geometry_ids,
+                   std::vector<uint32_t>& primitive_ids,
+                   const int nthreads) const {
+        std::vector<uint32_t> next_geometry_ids(geometry_ids);
+        std::vector<uint32_t> next_primitive_ids(primitive_ids);
+
+        std::vector<int64_t> steps;
+        int64_t step = 1;
+        while (2 * step < std::max({nx, ny, nz})) step *= 2;
+        for (; step >= 1; step /= 2) steps.push_back(step);
+        steps.push_back(1);
+
+        for (const int64_t step : steps) {
+            ParallelFor(
+                    nx,
+                    [&](size_t i) {
+                        for (int64_t j = 0; j < ny; ++j) {
+                            for (int64_t k = 0; k < nz; ++k) {
+                                const int64_t idx = (i * ny + j) * nz + k;
+                                const Vec3f q = Eigen::Map<const Vec3f>(
+                                        &query_points[3 * idx]);
+                                uint32_t best_geom = geometry_ids[idx];
+                                uint32_t best_prim = primitive_ids[idx];
+                                float best_dist2 =
+                                        std::numeric_limits<float>::infinity();
+                                if (best_geom != RTC_INVALID_GEOMETRY_ID) {
+                                    best_dist2 = (ClosestPointOnTriangle(
+                                                          best_geom, best_prim,
+                                                          q) -
+                                                  q)
+                                                         .squaredNorm();
+                                }
+                                for (int n = 0; n < 27; ++n) {
+                                    const int64_t ni = i + (n / 9 - 1) * step;
+                                    const int64_t nj =
+                                            j + ((n / 3) % 3 - 1) * step;
+                                    const int64_t nk = k + (n % 3 - 1) * step;
+                                    if (ni < 0 || ni >= nx || nj < 0 ||
+                                        nj >= ny || nk < 0 || nk >= nz) {
+                                        continue;
+                                    }
+                                    const int64_t nidx =
+                                            (ni * ny + nj) * nz + nk;
+                                    const uint32_t geom = geometry_ids[nidx];
+                                    const uint32_t prim = primitive_ids[nidx];
+                                    if (geom == RTC_INVALID_GEOMETRY_ID ||
+                                        (geom == best_geom &&
+                                         prim == best_prim)) {
+                                        continue;
+                                    }
+                                    const float dist2 =
+                                            (ClosestPointOnTriangle(geom, prim,
+                                                                    q) -
+                                             q)
+                                                    .squaredNorm();
+                                    if (dist2 < best_dist2) {
+                                        best_dist2 = dist2;
+                                        best_geom = geom;
+                                        best_prim = prim;
+                                    }
+                                }
+                                next_geometry_ids[idx] = best_geom;
+                                next_primitive_ids[idx] = best_prim;
+                            }
+                        }
+                    },
+                    nthreads);
+            geometry_ids.swap(next_geometry_ids);
+            primitive_ids.swap(next_primitive_ids);
+        }
+    }
+
+    // Computes the unsigned distance for the voxel centers of the grid
+    // origin + voxel_size * (i, j, k). Voxels farther away from the surface
+    // than band_width get the value band_width.
+    void ComputeDistanceGrid(const Vec3f& origin,
+                             const float voxel_size,
+                             const int64_t nx,
+                             const int64_t ny,
+                             const int64_t nz,
+                             const float band_width,
+                             float* distance,
+                             const int nthreads) {
+        const size_t num_voxels = nx * ny * nz;
+        std::vector<float> query_points(3 * num_voxels);
+        ParallelFor(
+                nx,
+                [&](size_t i) {
+                    for (int64_t j = 0; j < ny; ++j) {
+                        for (int64_t k = 0; k < nz; ++k) {
+                            const int64_t idx = (i * ny + j) * nz + k;
+                            Eigen::Map<Vec3f> query(&query_points[3 * idx]);
+                            query = origin + voxel_size * Vec3f(i, j, k);
+                        }
+                    }
+                },
+                nthreads);
+
+        // Compute the exact closest points for all voxels within the band.
+        // Point queries with a small radius are cheap because embree culls
+        // most of the BVH. Without a band only the voxels next to the surface
+        // are seeded and the closest triangles are propagated with jump
+        // flooding.
+        const bool bounded = std::isfinite(band_width);
+        const float radius =
+                bounded ? band_width : std::sqrt(3.f) * voxel_size;
+        std::vector<float> closest_points(3 * num_voxels);
+        std::vector<uint32_t> geometry_ids(num_voxels);
+        std::vector<uint32_t> primitive_ids(num_voxels);
+        std::vector<float> primitive_uvs(2 * num_voxels);
+        std::vector<float> primitive_normals(3 * num_voxels);
+        ComputeClosestPoints(query_points.data(), num_voxels,
+                             closest_points.data(), geometry_ids.data(),
+                             primitive_ids.data(), primitive_uvs.data(),
+                             primitive_normals.data(), nthreads, radius);
+
+        if (!bounded) {
+            // Seed the boundary of the grid with exact closest points such
+            // that surfaces outside of the grid are propagated too.
+            std::vector<int64_t> boundary;
+            for (int64_t i = 0; i < nx; ++i) {
+                for (int64_t j = 0; j < ny; ++j) {
+                    const bool ij_boundary =
+                            i == 0 || i == nx - 1 || j == 0 || j == ny - 1;
+                    for (int64_t k = 0; k < nz;
+                         k += (ij_boundary || nz == 1) ? 1 : nz - 1) {
+                        const int64_t idx = (i * ny + j) * nz + k;
+                        if (geometry_ids[idx] == RTC_INVALID_GEOMETRY_ID) {
+                            boundary.push_back(idx);
+                        }
+                    }
+                }
+            }
+            const size_t num_boundary = boundary.size();
+            std::vector<float> boundary_points(3 * num_boundary);
+            for (size_t b = 0; b < num_boundary; ++b) {
+                std::copy_n(&query_points[3 * boundary[b]], 3,
+                            &boundary_points[3 * b]);
+            }
+            std::vector<uint32_t> boundary_geometry_ids(num_boundary);
+            std::vector<uint32_t> boundary_primitive_ids(num_boundary);
+            ComputeClosestPoints(boundary_points.data(), num_boundary,
+                                 closest_points.data(),
+                                 boundary_geometry_ids.data(),
+                                 boundary_primitive_ids.data(),
+                                 primitive_uvs.data(),
+                                 primitive_normals.data(), nthreads);
+            for (size_t b = 0; b < num_boundary; ++b) {
+                geometry_ids[boundary[b]] = boundary_geometry_ids[b];
+                primitive_ids[boundary[b]] = boundary_primitive_ids[b];
+            }
+
+            JumpFlood(query_points.data(), nx, ny, nz, geometry_ids,
+                      primitive_ids, nthreads);
+        }
+
+        ParallelFor(
+                num_voxels,
+                [&](size_t idx) {
+                    if (geometry_ids[idx] == RTC_INVALID_GEOMETRY_ID) {
+                        distance[idx] = band_width;
+                    } else {
+                        const Vec3f q = Eigen::Map<const Vec3f>(
+                                &query_points[3 * idx]);
+                        distance[idx] =
+                                (ClosestPointOnTriangle(geometry_ids[idx],
+                                                        primitive_ids[idx], q) -
+                                 q)
+                                        .norm();
+                    }
+                },
+                nthreads);
+    }
 };
 
 RaycastingScene::RaycastingScene(int64_t nthreads)
@@ -709,53 +1552,43 @@ RaycastingScene::RaycastingScene(int64_t nthreads)
     impl_->devprop_join_commit = rtcGetDeviceProperty(
             impl_->device_, RTC_DEVICE_PROPERTY_JOIN_COMMIT_SUPPORTED);
 
+    // Use the widest packets with native SIMD support for coherent rays.
+    if (rtcGetDeviceProperty(impl_->device_,
+                             RTC_DEVICE_PROPERTY_NATIVE_RAY16_SUPPORTED)) {
+        impl_->packet_size_ = 16;
+    } else if (rtcGetDeviceProperty(
+                       impl_->device_,
+                       RTC_DEVICE_PROPERTY_NATIVE_RAY8_SUPPORTED)) {
+        impl_->packet_size_ = 8;
+    } else if (rtcGetDeviceProperty(
+                       impl_->device_,
+                       RTC_DEVICE_PROPERTY_NATIVE_RAY4_SUPPORTED)) {
+        impl_->packet_size_ = 4;
+    } else {
+        impl_->packet_size_ = 1;
+    }
+
     impl_->scene_committed_ = false;
+    impl_->dynamic_scene_ = false;
 }
 
 RaycastingScene::~RaycastingScene() {
     rtcReleaseScene(impl_->scene_);
+    for (const auto& prototype : impl_->prototypes_) {
+        rtcReleaseScene(prototype.scene);
+    }
     rtcReleaseDevice(impl_->device_);
 }
 
 uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
                                        const core::Tensor& triangle_indices) {
-    core::AssertTensorDevice(vertex_positions, impl_->tensor_device_);
-    core::AssertTensorShape(vertex_positions, {utility::nullopt, 3});
-    core::AssertTensorDtype(vertex_positions, core::Float32);
-    core::AssertTensorDevice(triangle_indices, impl_->tensor_device_);
-    core::AssertTensorShape(triangle_indices, {utility::nullopt, 3});
-    core::AssertTensorDtype(triangle_indices, core::UInt32);
-
-    const size_t num_vertices = vertex_positions.GetLength();
-    const size_t num_triangles = triangle_indices.GetLength();
+    const float* vertex_buffer;
+    const uint32_t* index_buffer;
+    RTCGeometry geom = impl_->NewTriangleGeometry(
+            vertex_positions, triangle_indices, vertex_buffer, index_buffer);
 
     // scene needs to be recommitted
     impl_->scene_committed_ = false;
-    RTCGeometry geom =
-            rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_TRIANGLE);
-
-    // rtcSetNewGeometryBuffer will take care of alignment and padding
-    float* vertex_buffer = (float*)rtcSetNewGeometryBuffer(
-            geom, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3,
-            3 * sizeof(float), num_vertices);
-
-    uint32_t* index_buffer = (uint32_t*)rtcSetNewGeometryBuffer(
-            geom, RTC_BUFFER_TYPE_INDEX, 0, RTC_FORMAT_UINT3,
-            3 * sizeof(uint32_t), num_triangles);
-
-    {
-        auto data = vertex_positions.Contiguous();
-        memcpy(vertex_buffer, data.GetDataPtr(),
-               sizeof(float) * 3 * num_vertices);
-    }
-    {
-        auto data = triangle_indices.Contiguous();
-        memcpy(index_buffer, data.GetDataPtr(),
-               sizeof(uint32_t) * 3 * num_triangles);
-    }
-    rtcSetGeometryEnableFilterFunctionFromArguments(geom, true);
-    rtcCommitGeometry(geom);
-
     uint32_t geom_id = rtcAttachGeometry(impl_->scene_, geom);
     rtcReleaseGeometry(geom);
 
@@ -776,8 +1609,106 @@ uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
                         mesh.GetTriangleIndices().To(core::UInt32));
 }
 
+uint32_t RaycastingScene::AddPrototype(const core::Tensor& vertex_positions,
+                                       const core::Tensor& triangle_indices) {
+    Impl::Prototype prototype;
+    RTCGeometry geom = impl_->NewTriangleGeometry(
+            vertex_positions, triangle_indices, prototype.vertex_positions,
+            prototype.triangle_indices);
+
+    // The BVH of the prototype is built once and shared by all instances.
+    prototype.scene = rtcNewScene(impl_->device_);
+    rtcSetSceneFlags(prototype.scene,
+                     RTC_SCENE_FLAG_ROBUST |
+                             RTC_SCENE_FLAG_FILTER_FUNCTION_IN_ARGUMENTS);
+    rtcAttachGeometry(prototype.scene, geom);
+    rtcReleaseGeometry(geom);
+    rtcCommitScene(prototype.scene);
+
+    impl_->prototypes_.push_back(prototype);
+    return uint32_t(impl_->prototypes_.size() - 1);
+}
+
+uint32_t RaycastingScene::AddPrototype(const TriangleMesh& mesh) {
+    size_t num_verts = mesh.GetVertexPositions().GetLength();
+    if (num_verts > std::numeric_limits<uint32_t>::max()) {
+        utility::LogError(
+                "Cannot add mesh with more than {} vertices to the scene",
+                std::numeric_limits<uint32_t>::max());
+    }
+    return AddPrototype(mesh.GetVertexPositions(),
+                        mesh.GetTriangleIndices().To(core::UInt32));
+}
+
+uint32_t RaycastingScene::AddInstance(uint32_t prototype_id,
+                                      const core::Tensor& transform) {
+    if (prototype_id >= impl_->prototypes_.size()) {
+        utility::LogError(
+                "Invalid prototype ID {}. The scene has {} prototypes.",
+                prototype_id, impl_->prototypes_.size());
+    }
+    const Impl::Prototype& prototype = impl_->prototypes_[prototype_id];
+
+    // scene needs to be recommitted
+    impl_->scene_committed_ = false;
+    RTCGeometry geom =
+            rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_INSTANCE);
+    rtcSetGeometryInstancedScene(geom, prototype.scene);
+    const Impl::Instance instance =
+            impl_->SetInstanceTransform(geom, transform);
+
+    uint32_t geom_id = rtcAttachGeometry(impl_->scene_, geom);
+    rtcReleaseGeometry(geom);
+
+    impl_->instances_[geom_id] = instance;
+    impl_->geometry_ptrs_.push_back(
+            std::make_tuple(RTC_GEOMETRY_TYPE_INSTANCE,
+                            (const void*)prototype.vertex_positions,
+                            (const void*)prototype.triangle_indices));
+    return geom_id;
+}
+
+void RaycastingScene::SetInstanceTransform(uint32_t geometry_id,
+                                           const core::Tensor& transform) {
+    RTCGeometry geom = impl_->GetInstanceGeometry(geometry_id);
+    impl_->instances_[geometry_id] =
+            impl_->SetInstanceTransform(geom, transform);
+
+    // With a dynamic scene embree builds a BVH per geometry and recommitting
+    // after moving instances only rebuilds the small top level BVH.
+    if (!impl_->dynamic_scene_) {
+        rtcSetSceneFlags(impl_->scene_,
+                         RTC_SCENE_FLAG_ROBUST | RTC_SCENE_FLAG_DYNAMIC |
+                                 RTC_SCENE_FLAG_FILTER_FUNCTION_IN_ARGUMENTS);
+        impl_->dynamic_scene_ = true;
+    }
+    impl_->scene_committed_ = false;
+}
+
+void RaycastingScene::SetGeometryMask(uint32_t geometry_id, uint32_t mask) {
+    if (geometry_id >= impl_->geometry_ptrs_.size()) {
+        utility::LogError(
+                "Invalid geometry ID {}. The scene has {} geometries.",
+                geometry_id, impl_->geometry_ptrs_.size());
+    }
+    RTCGeometry geom = rtcGetGeometry(impl_->scene_, geometry_id);
+    rtcSetGeometryMask(geom, mask);
+    rtcCommitGeometry(geom);
+    impl_->scene_committed_ = false;
+}
+
 std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
-        const core::Tensor& rays, const int nthreads) {
+        const core::Tensor& rays, const int nthreads, const uint32_t ray_mask) {
+    std::unordered_map<std::string, core::Tensor> result;
+    CastRays(rays, result, nthreads, ray_mask);
+    return result;
+}
+
+void RaycastingScene::CastRays(
+        const core::Tensor& rays,
+        std::unordered_map<std::string, core::Tensor>& result,
+        const int nthreads,
+        const uint32_t ray_mask) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
                                                  impl_->tensor_device_);
     auto shape = rays.GetShape();
@@ -785,31 +1716,45 @@ std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
                        // results.
     size_t num_rays = shape.NumElements();
 
-    std::unordered_map<std::string, core::Tensor> result;
-    result["t_hit"] = core::Tensor(shape, core::Float32);
-    result["geometry_ids"] = core::Tensor(shape, core::UInt32);
-    result["primitive_ids"] = core::Tensor(shape, core::UInt32);
+    core::Tensor& t_hit =
+            GetOutputTensor(result, "t_hit", shape, core::Float32);
+    core::Tensor& geometry_ids =
+            GetOutputTensor(result, "geometry_ids", shape, core::UInt32);
+    core::Tensor& primitive_ids =
+            GetOutputTensor(result, "primitive_ids", shape, core::UInt32);
     shape.push_back(2);
-    result["primitive_uvs"] = core::Tensor(shape, core::Float32);
+    core::Tensor& primitive_uvs =
+            GetOutputTensor(result, "primitive_uvs", shape, core::Float32);
     shape.back() = 3;
-    result["primitive_normals"] = core::Tensor(shape, core::Float32);
+    core::Tensor& primitive_normals =
+            GetOutputTensor(result, "primitive_normals", shape, core::Float32);
 
     auto data = rays.Contiguous();
     impl_->CastRays<false>(data.GetDataPtr<float>(), num_rays,
-                           result["t_hit"].GetDataPtr<float>(),
-                           result["geometry_ids"].GetDataPtr<uint32_t>(),
-                           result["primitive_ids"].GetDataPtr<uint32_t>(),
-                           result["primitive_uvs"].GetDataPtr<float>(),
-                           result["primitive_normals"].GetDataPtr<float>(),
+                           CoherentRowLength(rays), t_hit.GetDataPtr<float>(),
+                           geometry_ids.GetDataPtr<uint32_t>(),
+                           primitive_ids.GetDataPtr<uint32_t>(),
+                           primitive_uvs.GetDataPtr<float>(),
+                           primitive_normals.GetDataPtr<float>(), ray_mask,
                            nthreads);
-
-    return result;
 }
 
 core::Tensor RaycastingScene::TestOcclusions(const core::Tensor& rays,
                                              const float tnear,
                                              const float tfar,
-                                             const int nthreads) {
+                                             const int nthreads,
+                                             const uint32_t ray_mask) {
+    core::Tensor result;
+    TestOcclusions(rays, result, tnear, tfar, nthreads, ray_mask);
+    return result;
+}
+
+void RaycastingScene::TestOcclusions(const core::Tensor& rays,
+                                     core::Tensor& occluded,
+                                     const float tnear,
+                                     const float tfar,
+                                     const int nthreads,
+                                     const uint32_t ray_mask) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
                                                  impl_->tensor_device_);
     auto shape = rays.GetShape();
@@ -817,18 +1762,21 @@ core::Tensor RaycastingScene::TestOcclusions(const core::Tensor& rays,
                        // results.
     size_t num_rays = shape.NumElements();
 
-    core::Tensor result(shape, core::Bool);
+    if (occluded.GetShape() != shape || occluded.GetDtype() != core::Bool ||
+        !occluded.GetDevice().IsCPU() || !occluded.IsContiguous()) {
+        occluded = core::Tensor(shape, core::Bool);
+    }
 
     auto data = rays.Contiguous();
-    impl_->TestOcclusions(data.GetDataPtr<float>(), num_rays, tnear, tfar,
-                          reinterpret_cast<int8_t*>(result.GetDataPtr<bool>()),
-                          nthreads);
-
-    return result;
+    impl_->TestOcclusions(
+            data.GetDataPtr<float>(), num_rays, CoherentRowLength(rays), tnear,
+            tfar, reinterpret_cast<int8_t*>(occluded.GetDataPtr<bool>()),
+            ray_mask, nthreads);
 }
 
 core::Tensor RaycastingScene::CountIntersections(const core::Tensor& rays,
-                                                 const int nthreads) {
+                                                 const int nthreads,
+                                                 const uint32_t ray_mask) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
                                                  impl_->tensor_device_);
     auto shape = rays.GetShape();
@@ -841,13 +1789,15 @@ core::Tensor RaycastingScene::CountIntersections(const core::Tensor& rays,
     auto data = rays.Contiguous();
 
     impl_->CountIntersections(data.GetDataPtr<float>(), num_rays,
-                              intersections.GetDataPtr<int>(), nthreads);
+                              intersections.GetDataPtr<int>(), ray_mask,
+                              nthreads);
     return intersections;
 }
 
 std::unordered_map<std::string, core::Tensor>
 RaycastingScene::ListIntersections(const core::Tensor& rays,
-                                   const int nthreads) {
+                                   const int nthreads,
+                                   const uint32_t ray_mask) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
                                                  impl_->tensor_device_);
 
@@ -861,7 +1811,8 @@ RaycastingScene::ListIntersections(const core::Tensor& rays,
     core::Tensor track_intersections(shape, core::Dtype::FromType<uint32_t>());
     auto data = rays.Contiguous();
     impl_->CountIntersections(data.GetDataPtr<float>(), num_rays,
-                              intersections.GetDataPtr<int>(), nthreads);
+                              intersections.GetDataPtr<int>(), ray_mask,
+                              nthreads);
 
     // prepare shape with that number of elements
     Eigen::Map<Eigen::VectorXi> intersections_vector(
@@ -899,7 +1850,46 @@ RaycastingScene::ListIntersections(const core::Tensor& rays,
                              result["geometry_ids"].GetDataPtr<uint32_t>(),
                              result["primitive_ids"].GetDataPtr<uint32_t>(),
                              result["primitive_uvs"].GetDataPtr<float>(),
-                             result["t_hit"].GetDataPtr<float>(), nthreads);
+                             result["t_hit"].GetDataPtr<float>(), ray_mask,
+                             nthreads);
+    return result;
+}
+
+std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRaysMultiHit(
+        const core::Tensor& rays,
+        const int max_hits,
+        const int nthreads,
+        const uint32_t ray_mask) {
+    AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
+                                                 impl_->tensor_device_);
+    if (max_hits < 1) {
+        utility::LogError("max_hits must be positive but is {}", max_hits);
+    }
+    auto shape = rays.GetShape();
+    shape.pop_back();  // Remove last dim, we want to use this shape for the
+                       // results.
+    size_t num_rays = shape.NumElements();
+
+    std::unordered_map<std::string, core::Tensor> result;
+    result["num_hits"] = core::Tensor(shape, core::Int32);
+    shape.push_back(max_hits);
+    result["t_hit"] = core::Tensor(shape, core::Float32);
+    result["geometry_ids"] = core::Tensor(shape, core::UInt32);
+    result["primitive_ids"] = core::Tensor(shape, core::UInt32);
+    shape.push_back(2);
+    result["primitive_uvs"] = core::Tensor(shape, core::Float32);
+    shape.back() = 3;
+    result["primitive_normals"] = core::Tensor(shape, core::Float32);
+
+    auto data = rays.Contiguous();
+    impl_->CastRaysMultiHit(data.GetDataPtr<float>(), num_rays, max_hits,
+                            result["num_hits"].GetDataPtr<int>(),
+                            result["t_hit"].GetDataPtr<float>(),
+                            result["geometry_ids"].GetDataPtr<uint32_t>(),
+                            result["primitive_ids"].GetDataPtr<uint32_t>(),
+                            result["primitive_uvs"].GetDataPtr<float>(),
+                            result["primitive_normals"].GetDataPtr<float>(),
+                            ray_mask, nthreads);
     return result;
 }
 
@@ -1071,6 +2061,125 @@ core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
     return result.To(core::Float32);
 }
 
+namespace {
+// Checks the grid parameters and returns the origin as Eigen vector.
+Eigen::Vector3f CheckGridParameters(const core::Tensor& origin,
+                                    const float voxel_size,
+                                    const core::SizeVector& grid_size) {
+    core::AssertTensorDevice(origin, core::Device());
+    core::AssertTensorShape(origin, {3});
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be > 0 but is {}", voxel_size);
+    }
+    if (grid_size.size() != 3 || grid_size.NumElements() <= 0) {
+        utility::LogError(
+                "grid_size must have 3 positive elements but is {}",
+                grid_size.ToString());
+    }
+    const core::Tensor origin_contig = origin.To(core::Float32).Contiguous();
+    return Eigen::Map<const Eigen::Vector3f>(origin_contig.GetDataPtr<float>());
+}
+}  // namespace
+
+core::Tensor RaycastingScene::ComputeDistanceGrid(
+        const core::Tensor& origin,
+        const float voxel_size,
+        const core::SizeVector& grid_size,
+        const float band_width,
+        const int nthreads) {
+    const Eigen::Vector3f origin_vec =
+            CheckGridParameters(origin, voxel_size, grid_size);
+    if (band_width <= 0) {
+        utility::LogError("band_width must be > 0 but is {}", band_width);
+    }
+
+    core::Tensor distance(grid_size, core::Float32);
+    impl_->ComputeDistanceGrid(origin_vec, voxel_size, grid_size[0],
+                               grid_size[1], grid_size[2], band_width,
+                               distance.GetDataPtr<float>(), nthreads);
+    return distance;
+}
+
+core::Tensor RaycastingScene::ComputeSignedDistanceGrid(
+        const core::Tensor& origin,
+        const float voxel_size,
+        const core::SizeVector& grid_size,
+        const float band_width,
+        const int nthreads,
+        const int nsamples) {
+    if (nsamples < 1 || (nsamples % 2) != 1) {
+        open3d::utility::LogError("nsamples must be odd and >= 1 but is {}",
+                                  nsamples);
+    }
+    core::Tensor distance = ComputeDistanceGrid(origin, voxel_size, grid_size,
+                                                band_width, nthreads);
+    const Eigen::Vector3f origin_vec =
+            CheckGridParameters(origin, voxel_size, grid_size);
+    const int64_t nx = grid_size[0];
+    const int64_t ny = grid_size[1];
+    const int64_t nz = grid_size[2];
+    const int64_t num_rows = nx * ny;
+
+    // Determine the inside with one ray per grid row along z instead of one
+    // ray per voxel. The rays start at the first voxel of a row and the
+    // direction has the length of a voxel such that the voxel k of the row
+    // is inside if the number of hits with t_hit > k is odd. The origins are
+    // jittered deterministically to avoid hitting edges and vertices exactly.
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-0.001, 0.001);
+    Eigen::MatrixXf jitter(2, nsamples);
+    jitter = jitter.unaryExpr([&](float) { return voxel_size * dist(gen); });
+
+    core::Tensor rays({num_rows * nsamples, 6}, core::Float32);
+    Eigen::Map<Eigen::MatrixXf> rays_map(rays.GetDataPtr<float>(), 6,
+                                         num_rows * nsamples);
+    for (int64_t i = 0; i < nx; ++i) {
+        for (int64_t j = 0; j < ny; ++j) {
+            for (int s = 0; s < nsamples; ++s) {
+                const int64_t r = (i * ny + j) * nsamples + s;
+                rays_map.col(r).topRows<3>() =
+                        origin_vec + voxel_size * Eigen::Vector3f(i, j, 0);
+                rays_map.col(r).topRows<2>() += jitter.col(s);
+                rays_map.col(r).bottomRows<3>() =
+                        Eigen::Vector3f(0, 0, voxel_size);
+            }
+        }
+    }
+    auto intersections = ListIntersections(rays, nthreads);
+    const uint32_t* ray_splits =
+            intersections["ray_splits"].GetDataPtr<uint32_t>();
+    float* t_hit = intersections["t_hit"].GetDataPtr<float>();
+
+    float* distance_ptr = distance.GetDataPtr<float>();
+    Impl::ParallelFor(
+            num_rows,
+            [&](size_t row) {
+                std::vector<int> votes(nz, 0);
+                for (int s = 0; s < nsamples; ++s) {
+                    const int64_t r = row * nsamples + s;
+                    std::sort(t_hit + ray_splits[r], t_hit + ray_splits[r + 1]);
+                    // Walk backwards over the row and count the hits behind
+                    // the voxel.
+                    int64_t h = int64_t(ray_splits[r + 1]) - 1;
+                    int hits_behind = 0;
+                    for (int64_t k = nz - 1; k >= 0; --k) {
+                        while (h >= int64_t(ray_splits[r]) && t_hit[h] > k) {
+                            ++hits_behind;
+                            --h;
+                        }
+                        votes[k] += hits_behind % 2;
+                    }
+                }
+                for (int64_t k = 0; k < nz; ++k) {
+                    if (votes[k] > nsamples / 2) {
+                        distance_ptr[row * nz + k] *= -1;
+                    }
+                }
+            },
+            nthreads);
+    return distance;
+}
+
 core::Tensor RaycastingScene::CreateRaysPinhole(
         const core::Tensor& intrinsic_matrix,
         const core::Tensor& extrinsic_matrix,
@@ -1169,6 +2278,77 @@ core::Tensor RaycastingScene::CreateRaysPinhole(double fov_deg,
                              height_px);
 }
 
+core::Tensor RaycastingScene::CreateRaysLidar(
+        const core::Tensor& elevations_deg,
+        double azimuth_resolution_deg,
+        const core::Tensor& extrinsic_matrix,
+        const utility::optional<core::Tensor>& extrinsic_matrix_end) {
+    core::AssertTensorDevice(elevations_deg, core::Device());
+    core::AssertTensorShape(elevations_deg, {utility::nullopt});
+    core::AssertTensorDevice(extrinsic_matrix, core::Device());
+    core::AssertTensorShape(extrinsic_matrix, {4, 4});
+    if (azimuth_resolution_deg <= 0 || azimuth_resolution_deg > 360) {
+        utility::LogError(
+                "azimuth_resolution_deg must be in (0, 360] but is {}",
+                azimuth_resolution_deg);
+    }
+
+    // Returns the sensor to world transformation.
+    auto GetPose = [](const core::Tensor& extrinsic) {
+        const core::Tensor extrinsic_contig =
+                extrinsic.To(core::Float64).Contiguous();
+        const Eigen::Matrix4d T =
+                Eigen::Map<const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+                        extrinsic_contig.GetDataPtr<double>());
+        return Eigen::Isometry3d(T).inverse();
+    };
+    const Eigen::Isometry3d pose_start = GetPose(extrinsic_matrix);
+    Eigen::Isometry3d pose_end = pose_start;
+    if (extrinsic_matrix_end.has_value()) {
+        core::AssertTensorDevice(extrinsic_matrix_end.value(), core::Device());
+        core::AssertTensorShape(extrinsic_matrix_end.value(), {4, 4});
+        pose_end = GetPose(extrinsic_matrix_end.value());
+    }
+    const Eigen::Quaterniond q_start(pose_start.rotation());
+    const Eigen::Quaterniond q_end(pose_end.rotation());
+
+    const int64_t num_beams = elevations_deg.GetLength();
+    const int64_t num_columns = std::max<int64_t>(
+            1, std::llround(360.0 / azimuth_resolution_deg));
+    const core::Tensor elevations_contig =
+            elevations_deg.To(core::Float64).Contiguous();
+    const double* elevations = elevations_contig.GetDataPtr<double>();
+
+    core::Tensor rays({num_beams, num_columns, 6}, core::Float32);
+    Eigen::Map<Eigen::MatrixXf> rays_map(rays.GetDataPtr<float>(), 6,
+                                         num_beams * num_columns);
+
+    // All beams of a column are fired at the same time. The pose of the sensor
+    // moves linearly from the start to the end pose during the sweep.
+    std::vector<Eigen::Matrix3d> rotations(num_columns);
+    std::vector<Eigen::Vector3d> origins(num_columns);
+    for (int64_t x = 0; x < num_columns; ++x) {
+        const double t = double(x) / num_columns;
+        rotations[x] = q_start.slerp(t, q_end).toRotationMatrix();
+        origins[x] = (1 - t) * pose_start.translation() +
+                     t * pose_end.translation();
+    }
+
+    for (int64_t y = 0; y < num_beams; ++y) {
+        const double elevation = (M_PI / 180) * elevations[y];
+        for (int64_t x = 0; x < num_columns; ++x) {
+            const double azimuth = (M_PI / 180) * azimuth_resolution_deg * x;
+            const Eigen::Vector3d dir(std::cos(elevation) * std::cos(azimuth),
+                                      std::cos(elevation) * std::sin(azimuth),
+                                      std::sin(elevation));
+            auto r = rays_map.col(y * num_columns + x);
+            r.topRows<3>() = origins[x].cast<float>();
+            r.bottomRows<3>() = (rotations[x] * dir).cast<float>();
+        }
+    }
+    return rays;
+}
+
 uint32_t RaycastingScene::INVALID_ID() { return RTC_INVALID_GEOMETRY_ID; }
 
 }  // namespace geometry
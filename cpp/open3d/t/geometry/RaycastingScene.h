@@ -13,6 +13,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 namespace t {
@@ -46,7 +47,59 @@ public:
     /// \return The geometry ID of the added mesh.
     uint32_t AddTriangles(const TriangleMesh &mesh);
 
+    /// \brief Add a triangle mesh as prototype for instances.
+    ///
+    /// Prototypes are not part of the scene. They can be placed multiple
+    /// times in the scene with AddInstance(). The acceleration structure of a
+    /// prototype is built once and shared by all its instances.
+    /// \param vertex_positions Vertices as Tensor of dim {N,3} and dtype float.
+    /// \param triangle_indices Triangles as Tensor of dim {M,3} and dtype
+    /// uint32_t.
+    /// \return The prototype ID of the added mesh.
+    uint32_t AddPrototype(const core::Tensor &vertex_positions,
+                          const core::Tensor &triangle_indices);
+
+    /// \brief Add a triangle mesh as prototype for instances.
+    /// \param mesh A triangle mesh.
+    /// \return The prototype ID of the added mesh.
+    uint32_t AddPrototype(const TriangleMesh &mesh);
+
+    /// \brief Add an instance of a prototype to the scene.
+    ///
+    /// Query results for hits with the instance report the geometry ID of the
+    /// instance and the primitive IDs of the prototype mesh.
+    /// \param prototype_id The ID returned by AddPrototype().
+    /// \param transform The 4x4 transformation from the prototype coordinate
+    /// system to the scene.
+    /// \return The geometry ID of the instance.
+    uint32_t AddInstance(uint32_t prototype_id, const core::Tensor &transform);
+
+    /// \brief Changes the transformation of an instance.
+    ///
+    /// Moving instances switches the scene to a two-level acceleration
+    /// structure such that only the top level is rebuilt on the next query.
+    /// \param geometry_id The geometry ID returned by AddInstance().
+    /// \param transform The 4x4 transformation from the prototype coordinate
+    /// system to the scene.
+    void SetInstanceTransform(uint32_t geometry_id,
+                              const core::Tensor &transform);
+
+    /// \brief Sets the mask of a geometry or instance.
+    ///
+    /// Rays only intersect geometries for which the bitwise AND of the ray
+    /// mask and the geometry mask is not 0. The default mask of a geometry is
+    /// 0xFFFFFFFF. Closest point queries ignore masks.
+    /// \param geometry_id The geometry ID.
+    /// \param mask The 32 bit mask.
+    void SetGeometryMask(uint32_t geometry_id, uint32_t mask);
+
     /// \brief Computes the first intersection of the rays with the scene.
+    ///
+    /// Rays with 3 or more dims are treated as images with shape
+    /// {.., height, width, 6} and are traced as SIMD packets of neighboring
+    /// pixels, which is faster for coherent rays like the rays generated by
+    /// CreateRaysPinhole(). Rays with shape {N, 6} are traced individually.
+    ///
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
     /// describing the rays.
     /// {..} can be any number of dimensions, e.g., to organize rays for
@@ -56,6 +109,7 @@ public:
     /// necessary to normalize the direction but the returned hit distance uses
     /// the length of the direction vector as unit.
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param ray_mask The mask of the rays. See SetGeometryMask().
     /// \return The returned dictionary contains:
     ///         - \b t_hit A tensor with the distance to the first hit. The
     ///           shape is {..}. If there is no intersection the hit distance
@@ -70,7 +124,25 @@ public:
     ///         - \b primitive_normals A tensor with the normals of the hit
     ///           triangles. The shape is {.., 3}.
     std::unordered_map<std::string, core::Tensor> CastRays(
-            const core::Tensor &rays, const int nthreads = 0);
+            const core::Tensor &rays,
+            const int nthreads = 0,
+            const uint32_t ray_mask = 0xFFFFFFFF);
+
+    /// \brief Computes the first intersection of the rays with the scene and
+    /// writes the results to \p result.
+    ///
+    /// Tensors in \p result with the expected shape and dtype are reused and
+    /// all other tensors are allocated. This avoids allocations when casting
+    /// rays repeatedly, e.g., for every frame of a sequence.
+    /// \param rays The rays. See CastRays() above.
+    /// \param result The dictionary with the output tensors. See CastRays()
+    /// above for the keys.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param ray_mask The mask of the rays. See SetGeometryMask().
+    void CastRays(const core::Tensor &rays,
+                  std::unordered_map<std::string, core::Tensor> &result,
+                  const int nthreads = 0,
+                  const uint32_t ray_mask = 0xFFFFFFFF);
 
     /// \brief Checks if the rays have any intersection with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
@@ -83,13 +155,34 @@ public:
     /// \param tnear The tnear offset for the rays. The default is 0.
     /// \param tfar The tfar value for the ray. The default is infinity.
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param ray_mask The mask of the rays. See SetGeometryMask().
     /// \return A boolean tensor which indicates if the ray is occluded by the
     /// scene (true) or not (false).
     core::Tensor TestOcclusions(
             const core::Tensor &rays,
             const float tnear = 0.f,
             const float tfar = std::numeric_limits<float>::infinity(),
-            const int nthreads = 0);
+            const int nthreads = 0,
+            const uint32_t ray_mask = 0xFFFFFFFF);
+
+    /// \brief Checks if the rays have any intersection with the scene and
+    /// writes the result to \p occluded.
+    ///
+    /// \p occluded is reused if it has the expected shape and dtype Bool and
+    /// is allocated otherwise.
+    /// \param rays The rays. See TestOcclusions() above.
+    /// \param occluded The output tensor.
+    /// \param tnear The tnear offset for the rays. The default is 0.
+    /// \param tfar The tfar value for the ray. The default is infinity.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param ray_mask The mask of the rays. See SetGeometryMask().
+    void TestOcclusions(
+            const core::Tensor &rays,
+            core::Tensor &occluded,
+            const float tnear = 0.f,
+            const float tfar = std::numeric_limits<float>::infinity(),
+            const int nthreads = 0,
+            const uint32_t ray_mask = 0xFFFFFFFF);
 
     /// \brief Computes the number of intersection of the rays with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
@@ -100,9 +193,11 @@ public:
     /// with [ox,oy,oz] as the origin and [dx,dy,dz] as the direction. It is not
     /// necessary to normalize the direction.
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param ray_mask The mask of the rays. See SetGeometryMask().
     /// \return A tensor with the number of intersections. The shape is {..}.
     core::Tensor CountIntersections(const core::Tensor &rays,
-                                    const int nthreads = 0);
+                                    const int nthreads = 0,
+                                    const uint32_t ray_mask = 0xFFFFFFFF);
 
     /// \brief Lists the intersections of the rays with the scene
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
@@ -112,6 +207,7 @@ public:
     /// necessary to normalize the direction although it should be normalised if
     /// t_hit is to be calculated in coordinate units.
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param ray_mask The mask of the rays. See SetGeometryMask().
     /// \return The returned dictionary contains:    ///
     ///         - \b ray_splits A tensor with ray intersection splits. Can be
     ///         used to iterate over all intersections for each ray. The shape
@@ -129,7 +225,47 @@ public:
     ///           the intersection points within the triangles. The shape is
     ///           {num_intersections, 2}.
     std::unordered_map<std::string, core::Tensor> ListIntersections(
-            const core::Tensor &rays, const int nthreads = 0);
+            const core::Tensor &rays,
+            const int nthreads = 0,
+            const uint32_t ray_mask = 0xFFFFFFFF);
+
+    /// \brief Computes the first intersections along the rays.
+    ///
+    /// In contrast to CastRays(), which only returns the closest hit, this
+    /// function returns up to \p max_hits intersections per ray sorted by
+    /// distance, e.g., to simulate multi-return sensors. Rays are traced
+    /// through the whole scene and a filter callback keeps the nearest hits.
+    /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
+    /// describing the rays; {..} can be any number of dimensions.
+    /// The last dimension must be 6 and has the format [ox, oy, oz, dx, dy, dz]
+    /// with [ox,oy,oz] as the origin and [dx,dy,dz] as the direction. It is not
+    /// necessary to normalize the direction although it should be normalised if
+    /// t_hit is to be calculated in coordinate units.
+    /// \param max_hits The maximum number of intersections K to return per
+    /// ray.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param ray_mask The mask of the rays. See SetGeometryMask().
+    /// \return The returned dictionary contains:
+    ///         - \b num_hits A tensor with the number of returned hits. The
+    ///           shape is {..}.
+    ///         - \b t_hit A tensor with the distance to the hits. Unused
+    ///           entries are inf. The shape is {.., K}.
+    ///         - \b geometry_ids A tensor with the geometry IDs. Unused entries
+    ///           are set to the invalid value (see INVALID_ID()). The shape is
+    ///           {.., K}.
+    ///         - \b primitive_ids A tensor with the primitive IDs, which
+    ///           corresponds to the triangle index. Unused entries are set to
+    ///           the invalid value. The shape is {.., K}.
+    ///         - \b primitive_uvs A tensor with the barycentric coordinates of
+    ///           the hit points within the hit triangles. The shape is
+    ///           {.., K, 2}.
+    ///         - \b primitive_normals A tensor with the normals of the hit
+    ///           triangles. The shape is {.., K, 3}.
+    std::unordered_map<std::string, core::Tensor> CastRaysMultiHit(
+            const core::Tensor &rays,
+            const int max_hits,
+            const int nthreads = 0,
+            const uint32_t ray_mask = 0xFFFFFFFF);
 
     /// \brief Computes the closest points on the surfaces of the scene.
     /// \param query_points A tensor with >=2 dims, shape {.., 3} and Dtype
@@ -216,6 +352,60 @@ public:
                                   const int nthreads = 0,
                                   const int nsamples = 1);
 
+    /// \brief Computes the distance to the surface for all voxels of a dense
+    /// grid.
+    ///
+    /// This is much faster than ComputeDistance() for the grid points. Exact
+    /// closest points are computed for the voxels close to the surface and
+    /// the grid boundary and are propagated to the remaining voxels with the
+    /// jump flooding algorithm. The propagated distances are approximations
+    /// which are exact in most cases.
+    ///
+    /// \param origin The position of the voxel (0,0,0) as tensor with shape
+    /// {3}.
+    /// \param voxel_size The distance between neighboring voxels.
+    /// \param grid_size The number of voxels {nx, ny, nz} in x, y and z.
+    /// \param band_width Only distances smaller than band_width are computed
+    /// and all other voxels are set to band_width. The distances in the band
+    /// are exact and no propagation is needed. The default computes the
+    /// distance for all voxels.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \return A Float32 tensor with shape {nx, ny, nz}. The element [i,j,k]
+    /// is the distance of the point origin + voxel_size * (i,j,k).
+    core::Tensor ComputeDistanceGrid(
+            const core::Tensor &origin,
+            const float voxel_size,
+            const core::SizeVector &grid_size,
+            const float band_width = std::numeric_limits<float>::infinity(),
+            const int nthreads = 0);
+
+    /// \brief Computes the signed distance to the surface for all voxels of
+    /// a dense grid.
+    ///
+    /// The distances are computed as in ComputeDistanceGrid(). Like
+    /// ComputeSignedDistance() this function assumes watertight meshes and
+    /// determines the sign by counting intersections but uses a single ray
+    /// for all voxels of a grid row.
+    ///
+    /// \param origin The position of the voxel (0,0,0) as tensor with shape
+    /// {3}.
+    /// \param voxel_size The distance between neighboring voxels.
+    /// \param grid_size The number of voxels {nx, ny, nz} in x, y and z.
+    /// \param band_width Only distances smaller than band_width are computed
+    /// and all other voxels are set to +-band_width.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param nsamples The number of rays per grid row used for determining
+    /// the inside. This must be an odd number.
+    /// \return A Float32 tensor with shape {nx, ny, nz}. Negative distances
+    /// mean a point is inside a closed surface.
+    core::Tensor ComputeSignedDistanceGrid(
+            const core::Tensor &origin,
+            const float voxel_size,
+            const core::SizeVector &grid_size,
+            const float band_width = std::numeric_limits<float>::infinity(),
+            const int nthreads = 0,
+            const int nsamples = 1);
+
     /// \brief Creates rays for the given camera parameters.
     ///
     /// \param intrinsic_matrix The upper triangular intrinsic matrix with
@@ -245,6 +435,31 @@ public:
                                           int width_px,
                                           int height_px);
 
+    /// \brief Creates rays for a rotating multi-beam lidar.
+    ///
+    /// The sensor rotates about its z axis and fires all beams at each
+    /// azimuth step. The azimuth of column j is j * azimuth_resolution_deg
+    /// measured from the x axis of the sensor.
+    ///
+    /// \param elevations_deg A tensor with shape {num_beams} with the
+    /// elevation angle of each beam in degree.
+    /// \param azimuth_resolution_deg The angle between two azimuth steps in
+    /// degree. The number of columns is round(360 / azimuth_resolution_deg).
+    /// \param extrinsic_matrix The 4x4 world to sensor SE(3) transformation
+    /// matrix at the start of the sweep.
+    /// \param extrinsic_matrix_end The optional 4x4 world to sensor
+    /// transformation at the end of the sweep. If given, the sensor pose is
+    /// interpolated over the sweep to simulate the rolling shutter effect of a
+    /// moving sensor.
+    /// \return A tensor of shape {num_beams, num_columns, 6} with the rays.
+    /// The directions have unit length such that t_hit is the range.
+    static core::Tensor CreateRaysLidar(
+            const core::Tensor &elevations_deg,
+            double azimuth_resolution_deg,
+            const core::Tensor &extrinsic_matrix,
+            const utility::optional<core::Tensor> &extrinsic_matrix_end =
+                    utility::nullopt);
+
     /// \brief The value for invalid IDs.
     static uint32_t INVALID_ID();
 
@@ -9,13 +9,11 @@
 
 #include <vtkBooleanOperationPolyDataFilter.h>
 #include <vtkCleanPolyData.h>
-#include <vtkClipPolyData.h>
-#include <vtkCutter.h>
 #include <vtkFillHolesFilter.h>
-#include <vtkPlane.h>
-#include <vtkQuadricDecimation.h>
 
 #include <Eigen/Core>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <unordered_map>
 
@@ -24,6 +22,9 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashSet.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/LineSet.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/RaycastingScene.h"
@@ -33,6 +34,7 @@
 #include "open3d/t/geometry/kernel/Transform.h"
 #include "open3d/t/geometry/kernel/TriangleMesh.h"
 #include "open3d/t/geometry/kernel/UVUnwrapping.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
@@ -316,6 +318,559 @@ double TriangleMesh::GetSurfaceArea() const {
     return surface_area;
 }
 
+namespace {
+
+/// Computes the vertex adjacency of \p triangles in CSR format on the host
+/// and returns the row splits and column indices as Int64 tensors on
+/// \p device.
+///
+/// The adjacency is rebuilt by every filter call rather than cached on the
+/// mesh: the triangle tensor can be modified in place through
+/// GetTriangleIndices(), so a cached adjacency could not be invalidated
+/// reliably. Building it is a single pass over the triangles plus a sort of
+/// every vertex's neighbours, which is small compared to the filter steps.
+std::pair<core::Tensor, core::Tensor> ComputeVertexAdjacencyCSR(
+        const core::Tensor &triangles,
+        int64_t num_vertices,
+        const core::Device &device) {
+    const core::Tensor triangles_cpu =
+            triangles.To(core::Device("CPU:0"), core::Int64).Contiguous();
+    const int64_t *triangle_ptr = triangles_cpu.GetDataPtr<int64_t>();
+    const int64_t num_triangles = triangles_cpu.GetLength();
+
+    // Every triangle adds two (possibly duplicate) neighbours per corner.
+    std::vector<int64_t> row_splits(num_vertices + 1, 0);
+    for (int64_t i = 0; i < 3 * num_triangles; ++i) {
+        row_splits[triangle_ptr[i] + 1] += 2;
+    }
+    std::partial_sum(row_splits.begin(), row_splits.end(),
+                     row_splits.begin());
+    std::vector<int64_t> col_idx(row_splits.back());
+    std::vector<int64_t> fill(row_splits.begin(), row_splits.end() - 1);
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        const int64_t *triangle = triangle_ptr + 3 * t;
+        for (int i = 0; i < 3; ++i) {
+            col_idx[fill[triangle[i]]++] = triangle[(i + 1) % 3];
+            col_idx[fill[triangle[i]]++] = triangle[(i + 2) % 3];
+        }
+    }
+
+    std::vector<int64_t> unique_splits(num_vertices + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        auto begin = col_idx.begin() + row_splits[vidx];
+        auto end = col_idx.begin() + row_splits[vidx + 1];
+        std::sort(begin, end);
+        unique_splits[vidx + 1] = std::unique(begin, end) - begin;
+    }
+    std::partial_sum(unique_splits.begin(), unique_splits.end(),
+                     unique_splits.begin());
+    core::Tensor unique_col_idx({unique_splits.back()}, core::Int64);
+    int64_t *unique_col_ptr = unique_col_idx.GetDataPtr<int64_t>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        std::copy_n(col_idx.begin() + row_splits[vidx],
+                    unique_splits[vidx + 1] - unique_splits[vidx],
+                    unique_col_ptr + unique_splits[vidx]);
+    }
+
+    return std::make_pair(
+            core::Tensor(unique_splits, {num_vertices + 1}, core::Int64)
+                    .To(device),
+            unique_col_idx.To(device));
+}
+
+/// Coefficients of the linear vertex filter
+/// \f$v_o = a_i v_i + b_i \sum_{n \in N} w_n v_n\f$. An empty \p weights
+/// tensor gives all neighbours weight one.
+struct VertexFilterCoefficients {
+    core::Tensor weights;
+    core::Tensor diag_scale;
+    core::Tensor neighbour_scale;
+};
+
+/// Applies \p number_of_steps filter steps to the vertex positions, normals
+/// and colors. Before every step, \p update_filter sets the coefficients from
+/// the current positions and the step index.
+TriangleMesh FilterVertexAttributes(
+        const TriangleMesh &mesh,
+        int number_of_steps,
+        const std::function<void(const core::Tensor &,
+                                 const core::Tensor &,
+                                 const core::Tensor &,
+                                 int,
+                                 VertexFilterCoefficients &)> &update_filter) {
+    TriangleMesh filtered = mesh.Clone();
+    if (!mesh.HasVertexPositions() || !mesh.HasTriangleIndices()) {
+        utility::LogWarning("TriangleMesh has no vertices or triangles.");
+        return filtered;
+    }
+
+    const core::Device device = mesh.GetDevice();
+    core::Tensor row_splits, col_idx;
+    std::tie(row_splits, col_idx) = ComputeVertexAdjacencyCSR(
+            mesh.GetTriangleIndices(), mesh.GetVertexPositions().GetLength(),
+            device);
+
+    std::vector<std::string> attrs;
+    for (const std::string &attr : {"positions", "normals", "colors"}) {
+        if (filtered.HasVertexAttr(attr) &&
+            (filtered.GetVertexAttr(attr).GetDtype() == core::Float32 ||
+             filtered.GetVertexAttr(attr).GetDtype() == core::Float64)) {
+            filtered.SetVertexAttr(attr,
+                                   filtered.GetVertexAttr(attr).Contiguous());
+            attrs.push_back(attr);
+        }
+    }
+
+    VertexFilterCoefficients filter;
+    for (int step = 0; step < number_of_steps; ++step) {
+        update_filter(filtered.GetVertexPositions(), row_splits, col_idx, step,
+                      filter);
+        for (const std::string &attr : attrs) {
+            const core::Tensor &input = filtered.GetVertexAttr(attr);
+            core::Tensor output = core::Tensor::Empty(
+                    input.GetShape(), input.GetDtype(), device);
+            if (device.IsCPU()) {
+                kernel::trianglemesh::FilterVertexAttrCPU(
+                        row_splits, col_idx, filter.weights, filter.diag_scale,
+                        filter.neighbour_scale, input, output);
+            } else if (device.IsCUDA()) {
+                CUDA_CALL(kernel::trianglemesh::FilterVertexAttrCUDA,
+                          row_splits, col_idx, filter.weights,
+                          filter.diag_scale, filter.neighbour_scale, input,
+                          output);
+            } else {
+                utility::LogError("Unimplemented device");
+            }
+            filtered.SetVertexAttr(attr, output);
+        }
+    }
+    return filtered;
+}
+
+/// Sets \p filter to one Laplacian step with inverse distance weights.
+void SetLaplacianFilter(const core::Tensor &positions,
+                        const core::Tensor &row_splits,
+                        const core::Tensor &col_idx,
+                        double lambda_filter,
+                        VertexFilterCoefficients &filter) {
+    const core::Device device = positions.GetDevice();
+    const int64_t num_vertices = positions.GetLength();
+    filter.weights =
+            core::Tensor::Empty({col_idx.GetLength()}, core::Float64, device);
+    filter.diag_scale =
+            core::Tensor::Empty({num_vertices}, core::Float64, device);
+    filter.neighbour_scale =
+            core::Tensor::Empty({num_vertices}, core::Float64, device);
+    if (device.IsCPU()) {
+        kernel::trianglemesh::ComputeLaplacianFilterCPU(
+                row_splits, col_idx, positions, lambda_filter, filter.weights,
+                filter.diag_scale, filter.neighbour_scale);
+    } else if (device.IsCUDA()) {
+        CUDA_CALL(kernel::trianglemesh::ComputeLaplacianFilterCUDA, row_splits,
+                  col_idx, positions, lambda_filter, filter.weights,
+                  filter.diag_scale, filter.neighbour_scale);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+/// Number of neighbours of every vertex as Float64 tensor.
+core::Tensor NumNeighbours(const core::Tensor &row_splits) {
+    const int64_t num_vertices = row_splits.GetLength() - 1;
+    return (row_splits.Slice(0, 1, num_vertices + 1) -
+            row_splits.Slice(0, 0, num_vertices))
+            .To(core::Float64);
+}
+
+}  // namespace
+
+TriangleMesh TriangleMesh::FilterSharpen(int number_of_iterations,
+                                         double strength) const {
+    return FilterVertexAttributes(
+            *this, number_of_iterations,
+            [strength](const core::Tensor &, const core::Tensor &row_splits,
+                       const core::Tensor &, int step,
+                       VertexFilterCoefficients &filter) {
+                if (step > 0) {
+                    return;
+                }
+                core::Tensor num_neighbours = NumNeighbours(row_splits);
+                filter.diag_scale = num_neighbours * strength + 1.0;
+                filter.neighbour_scale =
+                        core::Tensor::Full(num_neighbours.GetShape(),
+                                           -strength, core::Float64,
+                                           num_neighbours.GetDevice());
+            });
+}
+
+TriangleMesh TriangleMesh::FilterSmoothSimple(int number_of_iterations) const {
+    return FilterVertexAttributes(
+            *this, number_of_iterations,
+            [](const core::Tensor &, const core::Tensor &row_splits,
+               const core::Tensor &, int step,
+               VertexFilterCoefficients &filter) {
+                if (step > 0) {
+                    return;
+                }
+                filter.diag_scale = 1.0 / (NumNeighbours(row_splits) + 1.0);
+                filter.neighbour_scale = filter.diag_scale;
+            });
+}
+
+TriangleMesh TriangleMesh::FilterSmoothLaplacian(int number_of_iterations,
+                                                 double lambda_filter) const {
+    return FilterVertexAttributes(
+            *this, number_of_iterations,
+            [lambda_filter](const core::Tensor &positions,
+                            const core::Tensor &row_splits,
+                            const core::Tensor &col_idx, int,
+                            VertexFilterCoefficients &filter) {
+                SetLaplacianFilter(positions, row_splits, col_idx,
+                                   lambda_filter, filter);
+            });
+}
+
+TriangleMesh TriangleMesh::FilterSmoothTaubin(int number_of_iterations,
+                                              double lambda_filter,
+                                              double mu) const {
+    return FilterVertexAttributes(
+            *this, 2 * number_of_iterations,
+            [lambda_filter, mu](const core::Tensor &positions,
+                                const core::Tensor &row_splits,
+                                const core::Tensor &col_idx, int step,
+                                VertexFilterCoefficients &filter) {
+                SetLaplacianFilter(positions, row_splits, col_idx,
+                                   step % 2 == 0 ? lambda_filter : mu, filter);
+            });
+}
+
+namespace {
+
+/// Areas of all triangles of \p mesh as Float64 tensor on the host.
+core::Tensor ComputeTriangleAreasHost(const TriangleMesh &mesh) {
+    static const core::Device host("CPU:0");
+    const core::Tensor vertices =
+            mesh.GetVertexPositions().To(host).Contiguous();
+    const core::Tensor triangles =
+            mesh.GetTriangleIndices().To(host).Contiguous();
+    core::Tensor triangle_areas({triangles.GetLength()}, vertices.GetDtype(),
+                                host);
+    kernel::trianglemesh::ComputeTriangleAreasCPU(vertices, triangles,
+                                                  triangle_areas);
+    return triangle_areas.To(core::Float64);
+}
+
+/// Hash set buffer index of every row of the Int64 \p keys. Equal rows get
+/// the same index.
+core::Tensor ComputeKeyBufIndices(const core::Tensor &keys) {
+    if (keys.GetLength() == 0) {
+        return core::Tensor::Empty({0}, core::Int32, keys.GetDevice());
+    }
+    core::HashSet key_set(keys.GetLength(), core::Int64, {keys.GetShape(1)},
+                          keys.GetDevice());
+    core::Tensor buf_indices, masks;
+    key_set.Insert(keys, buf_indices, masks);
+    key_set.Find(keys, buf_indices, masks);
+    return buf_indices;
+}
+
+/// Hash set buffer index of the ordered edges (v0, v1), (v1, v2), (v2, v0) of
+/// all triangles. Shared edges get the same index.
+core::Tensor ComputeEdgeBufIndices(const core::Tensor &triangles) {
+    const core::Tensor next = core::Concatenate(
+            {triangles.Slice(1, 1, 3), triangles.Slice(1, 0, 1)}, 1);
+    return ComputeKeyBufIndices(core::Concatenate(
+            {core::Minimum(triangles, next).Reshape({-1, 1}),
+             core::Maximum(triangles, next).Reshape({-1, 1})},
+            1));
+}
+
+/// Rows \p sources of \p attr interpolated with weights 1 - w and w. Attributes
+/// that are not floating point take the first source.
+core::Tensor InterpolateAttr(const core::Tensor &attr,
+                             const core::Tensor &sources,
+                             const core::Tensor &weights) {
+    const core::Tensor first =
+            attr.IndexGet({sources.Slice(1, 0, 1).Reshape({-1})});
+    const core::Dtype dtype = attr.GetDtype();
+    if (dtype != core::Float32 && dtype != core::Float64) {
+        return first;
+    }
+    const core::Tensor second =
+            attr.IndexGet({sources.Slice(1, 1, 2).Reshape({-1})});
+    core::SizeVector shape(attr.NumDims(), 1);
+    shape[0] = weights.GetLength();
+    return first + (second - first) * weights.To(dtype).Reshape(shape);
+}
+
+/// Signed distances of the vertices of \p mesh to the plane through \p point
+/// with \p normal, as Float64 tensor on the host. The normal is not
+/// normalized.
+core::Tensor ComputePlaneDistancesHost(const TriangleMesh &mesh,
+                                       const core::Tensor &point,
+                                       const core::Tensor &normal) {
+    core::AssertTensorShape(point, {3});
+    core::AssertTensorShape(normal, {3});
+    // allow int types for convenience
+    core::AssertTensorDtypes(
+            point, {core::Float32, core::Float64, core::Int32, core::Int64});
+    core::AssertTensorDtypes(
+            normal, {core::Float32, core::Float64, core::Int32, core::Int64});
+
+    const core::Device &device = mesh.GetDevice();
+    const core::Tensor point_ = point.To(device, core::Float64).Reshape({1, 3});
+    const core::Tensor normal_ =
+            normal.To(device, core::Float64).Reshape({1, 3});
+    return ((mesh.GetVertexPositions().To(core::Float64) - point_) * normal_)
+            .Sum({1})
+            .To(core::Device("CPU:0"));
+}
+
+/// Samples points on the host copy \p mesh of a mesh, see
+/// TriangleMesh::SamplePointsUniformly.
+PointCloud SamplePointsUniformlyHost(const TriangleMesh &mesh,
+                                     const core::Tensor &triangle_areas,
+                                     int64_t number_of_points,
+                                     bool use_triangle_normal) {
+    std::vector<std::string> vertex_names;
+    std::vector<core::Tensor> vertex_attrs;
+    for (const auto &kv : mesh.GetVertexAttr()) {
+        const core::Dtype dtype = kv.second.GetDtype();
+        if ((dtype != core::Float32 && dtype != core::Float64) ||
+            (use_triangle_normal && kv.first == "normals")) {
+            continue;
+        }
+        vertex_names.push_back(kv.first);
+        vertex_attrs.push_back(kv.second);
+    }
+    std::vector<core::Tensor> triangle_attrs;
+    if (use_triangle_normal) {
+        if (mesh.HasTriangleNormals()) {
+            triangle_attrs.push_back(mesh.GetTriangleNormals());
+        } else {
+            TriangleMesh mesh_normals = mesh;
+            triangle_attrs.push_back(mesh_normals.ComputeTriangleNormals(true)
+                                             .GetTriangleNormals());
+        }
+    }
+
+    std::vector<core::Tensor> vertex_samples, triangle_samples;
+    kernel::trianglemesh::SamplePointsUniformlyCPU(
+            mesh.GetTriangleIndices(), triangle_areas, number_of_points,
+            vertex_attrs, triangle_attrs, vertex_samples, triangle_samples);
+
+    PointCloud pcd(mesh.GetDevice());
+    for (size_t i = 0; i < vertex_names.size(); ++i) {
+        pcd.SetPointAttr(vertex_names[i], vertex_samples[i]);
+    }
+    if (use_triangle_normal) {
+        pcd.SetPointNormals(triangle_samples[0]);
+    }
+    return pcd;
+}
+
+}  // namespace
+
+PointCloud TriangleMesh::SamplePointsUniformly(
+        int64_t number_of_points,
+        bool use_triangle_normal /* = false */) const {
+    if (number_of_points <= 0) {
+        utility::LogError("number_of_points <= 0");
+    }
+    if (!HasTriangleIndices() || GetTriangleIndices().GetLength() == 0) {
+        utility::LogError("Input mesh has no triangles.");
+    }
+
+    const TriangleMesh mesh = To(core::Device("CPU:0"));
+    return SamplePointsUniformlyHost(mesh, ComputeTriangleAreasHost(mesh),
+                                     number_of_points, use_triangle_normal)
+            .To(GetDevice());
+}
+
+PointCloud TriangleMesh::SamplePointsPoissonDisk(
+        int64_t number_of_points,
+        double init_factor /* = 5 */,
+        const PointCloud *pcl_init /* = nullptr */,
+        bool use_triangle_normal /* = false */) const {
+    if (number_of_points <= 0) {
+        utility::LogError("number_of_points <= 0");
+    }
+    if (!HasTriangleIndices() || GetTriangleIndices().GetLength() == 0) {
+        utility::LogError("Input mesh has no triangles.");
+    }
+    if (pcl_init == nullptr && init_factor < 1) {
+        utility::LogError(
+                "Either pass pcl_init with #points > number_of_points or "
+                "init_factor > 1");
+    }
+    if (pcl_init != nullptr &&
+        pcl_init->GetPointPositions().GetLength() < number_of_points) {
+        utility::LogError(
+                "Either pass pcl_init with #points > number_of_points, or "
+                "init_factor > 1");
+    }
+
+    static const core::Device host("CPU:0");
+    const TriangleMesh mesh = To(host);
+    const core::Tensor triangle_areas = ComputeTriangleAreasHost(mesh);
+    const double surface_area = triangle_areas.Sum({0}).Item<double>();
+
+    // Initial samples, then weighted sample elimination (Yuksel, 2015) with
+    // the constants of the paper.
+    const PointCloud pcd =
+            pcl_init == nullptr
+                    ? SamplePointsUniformlyHost(
+                              mesh, triangle_areas,
+                              int64_t(init_factor * number_of_points),
+                              use_triangle_normal)
+                    : pcl_init->To(host);
+    const double beta = 0.65;
+    const double gamma = 1.5;
+    const double ratio = double(number_of_points) /
+                         double(pcd.GetPointPositions().GetLength());
+    const double r_max = 2 * std::sqrt((surface_area / number_of_points) /
+                                        (2 * std::sqrt(3.)));
+    const double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
+
+    const core::Tensor points =
+            pcd.GetPointPositions().To(core::Float64).Contiguous();
+    core::nns::NearestNeighborSearch nns(points, core::Int64);
+    if (!nns.FixedRadiusIndex(r_max)) {
+        utility::LogError("Fixed radius search index is not set.");
+    }
+    core::Tensor indices, distances2, row_splits;
+    std::tie(indices, distances2, row_splits) =
+            nns.FixedRadiusSearch(points, r_max, false);
+
+    core::Tensor mask;
+    kernel::trianglemesh::SampleEliminationCPU(indices, distances2, row_splits,
+                                               number_of_points, r_min, r_max,
+                                               mask);
+    return pcd.SelectByMask(mask).To(GetDevice());
+}
+
+TriangleMesh TriangleMesh::SubdivideLoop(int number_of_iterations) const {
+    if (!HasVertexPositions() || !HasTriangleIndices() ||
+        GetTriangleIndices().GetLength() == 0) {
+        utility::LogWarning("TriangleMesh has no vertices or triangles.");
+        return Clone();
+    }
+
+    static const core::Device host("CPU:0");
+    const core::Device device = GetDevice();
+    std::vector<std::string> attrs;
+    for (const auto &kv : GetVertexAttr()) {
+        if ((kv.first == "positions" || kv.first == "normals" ||
+             kv.first == "colors") &&
+            kv.second.NumDims() == 2 && kv.second.GetShape(1) == 3 &&
+            (kv.second.GetDtype() == core::Float32 ||
+             kv.second.GetDtype() == core::Float64)) {
+            attrs.push_back(kv.first);
+        } else {
+            utility::LogWarning(
+                    "SubdivideLoop: vertex attribute {} is not subdivided and "
+                    "dropped.",
+                    kv.first);
+        }
+    }
+
+    TriangleMesh mesh(device);
+    for (const std::string &attr : attrs) {
+        mesh.SetVertexAttr(attr, GetVertexAttr(attr).Contiguous());
+    }
+    for (const auto &kv : GetTriangleAttr()) {
+        if (kv.first != "indices") {
+            mesh.SetTriangleAttr(kv.first, kv.second);
+        }
+    }
+    core::Tensor triangles =
+            GetTriangleIndices().To(host, core::Int64).Contiguous();
+
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        const int64_t num_vertices = mesh.GetVertexPositions().GetLength();
+        core::Tensor new_triangles, row_splits, col_idx, weights, diag_scale,
+                neighbour_scale;
+        kernel::trianglemesh::SubdivideLoopCPU(
+                triangles, ComputeEdgeBufIndices(triangles), num_vertices,
+                new_triangles, row_splits, col_idx, weights, diag_scale,
+                neighbour_scale);
+        const int64_t num_edges = row_splits.GetLength() - 1 - num_vertices;
+        row_splits = row_splits.To(device);
+        col_idx = col_idx.To(device);
+        weights = weights.To(device);
+        diag_scale = diag_scale.To(device);
+        neighbour_scale = neighbour_scale.To(device);
+
+        // The new edge vertices are appended to the input with zero
+        // attributes, the rows of the edge vertices have no diagonal term.
+        for (const std::string &attr : attrs) {
+            const core::Tensor &old_attr = mesh.GetVertexAttr(attr);
+            const core::Tensor input = core::Concatenate(
+                    {old_attr, core::Tensor::Zeros({num_edges, 3},
+                                                   old_attr.GetDtype(),
+                                                   device)});
+            core::Tensor output = core::Tensor::Empty(
+                    input.GetShape(), input.GetDtype(), device);
+            if (device.IsCPU()) {
+                kernel::trianglemesh::FilterVertexAttrCPU(
+                        row_splits, col_idx, weights, diag_scale,
+                        neighbour_scale, input, output);
+            } else if (device.IsCUDA()) {
+                CUDA_CALL(kernel::trianglemesh::FilterVertexAttrCUDA,
+                          row_splits, col_idx, weights, diag_scale,
+                          neighbour_scale, input, output);
+            } else {
+                utility::LogError("Unimplemented device");
+            }
+            mesh.SetVertexAttr(attr, output);
+        }
+
+        // Every triangle is split into four that inherit its attributes.
+        const core::Tensor parents =
+                core::Tensor::Arange(0, new_triangles.GetLength(), 1,
+                                     core::Int64, device) /
+                4;
+        for (const auto &kv : mesh.GetTriangleAttr()) {
+            mesh.SetTriangleAttr(kv.first, kv.second.IndexGet({parents}));
+        }
+        triangles = new_triangles;
+    }
+
+    mesh.SetTriangleIndices(
+            triangles.To(device, GetTriangleIndices().GetDtype()));
+    if (mesh.HasTriangleNormals()) {
+        mesh.ComputeTriangleNormals();
+    }
+    return mesh;
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+TriangleMesh::ClusterConnectedTriangles() const {
+    if (!HasTriangleIndices() || GetTriangleIndices().GetLength() == 0) {
+        utility::LogWarning("TriangleMesh has no triangles.");
+        return std::make_tuple(
+                core::Tensor::Empty({0}, core::Int64, GetDevice()),
+                core::Tensor::Empty({0}, core::Int64, GetDevice()),
+                core::Tensor::Empty({0}, core::Float64, GetDevice()));
+    }
+
+    static const core::Device host("CPU:0");
+    const TriangleMesh mesh = To(host);
+    const core::Tensor triangles =
+            mesh.GetTriangleIndices().To(core::Int64).Contiguous();
+    core::Tensor triangle_clusters, cluster_n_triangles, cluster_area;
+    kernel::trianglemesh::ClusterConnectedTrianglesCPU(
+            ComputeEdgeBufIndices(triangles), ComputeTriangleAreasHost(mesh),
+            triangle_clusters, cluster_n_triangles, cluster_area);
+    return std::make_tuple(triangle_clusters.To(GetDevice()),
+                           cluster_n_triangles.To(GetDevice()),
+                           cluster_area.To(GetDevice()));
+}
+
 geometry::TriangleMesh TriangleMesh::FromLegacy(
         const open3d::geometry::TriangleMesh &mesh_legacy,
         core::Dtype float_dtype,
@@ -561,93 +1116,176 @@ TriangleMesh TriangleMesh::ComputeConvexHull(bool joggle_inputs) const {
 
 TriangleMesh TriangleMesh::ClipPlane(const core::Tensor &point,
                                      const core::Tensor &normal) const {
-    using namespace vtkutils;
-    core::AssertTensorShape(point, {3});
-    core::AssertTensorShape(normal, {3});
-    // allow int types for convenience
-    core::AssertTensorDtypes(
-            point, {core::Float32, core::Float64, core::Int32, core::Int64});
-    core::AssertTensorDtypes(
-            normal, {core::Float32, core::Float64, core::Int32, core::Int64});
-
-    auto point_ = point.To(core::Device(), core::Float64).Contiguous();
-    auto normal_ = normal.To(core::Device(), core::Float64).Contiguous();
-
-    auto polydata = CreateVtkPolyDataFromGeometry(
-            *this, GetVertexAttr().GetKeySet(), GetTriangleAttr().GetKeySet(),
-            {}, {}, false);
-
-    vtkNew<vtkPlane> clipPlane;
-    clipPlane->SetNormal(normal_.GetDataPtr<double>());
-    clipPlane->SetOrigin(point_.GetDataPtr<double>());
-    vtkNew<vtkClipPolyData> clipper;
-    clipper->SetInputData(polydata);
-    clipper->SetClipFunction(clipPlane);
-    vtkNew<vtkCleanPolyData> cleaner;
-    cleaner->SetInputConnection(clipper->GetOutputPort());
-    cleaner->Update();
-    auto clipped_polydata = cleaner->GetOutput();
-    return CreateTriangleMeshFromVtkPolyData(clipped_polydata);
+    const core::Tensor distances =
+            ComputePlaneDistancesHost(*this, point, normal);
+    if (!HasTriangleIndices() || GetTriangleIndices().GetLength() == 0) {
+        return TriangleMesh(GetDevice());
+    }
+
+    static const core::Device host("CPU:0");
+    const core::Device device = GetDevice();
+    const core::Tensor triangles =
+            GetTriangleIndices().To(host, core::Int64).Contiguous();
+    // Only the edges of triangles crossing the plane are hashed.
+    const core::Tensor num_positive =
+            distances.Ge(0)
+                    .IndexGet({triangles.Reshape({-1})})
+                    .Reshape({-1, 3})
+                    .To(core::Int64)
+                    .Sum({1});
+    const core::Tensor crossing_triangles =
+            num_positive.Gt(0).LogicalAnd(num_positive.Lt(3)).NonZero()[0];
+    const core::Tensor edge_buf_indices = ComputeEdgeBufIndices(
+            triangles.IndexGet({crossing_triangles}));
+
+    core::Tensor clipped_triangles, triangle_parents, vertex_sources,
+            vertex_weights;
+    kernel::trianglemesh::ClipPlaneCPU(
+            triangles, distances, crossing_triangles, edge_buf_indices,
+            clipped_triangles, triangle_parents, vertex_sources,
+            vertex_weights);
+
+    TriangleMesh clipped(device);
+    vertex_sources = vertex_sources.To(device);
+    vertex_weights = vertex_weights.To(device);
+    for (const auto &kv : GetVertexAttr()) {
+        clipped.SetVertexAttr(kv.first, InterpolateAttr(kv.second,
+                                                        vertex_sources,
+                                                        vertex_weights));
+    }
+    triangle_parents = triangle_parents.To(device);
+    for (const auto &kv : GetTriangleAttr()) {
+        if (kv.first != "indices") {
+            clipped.SetTriangleAttr(kv.first,
+                                    kv.second.IndexGet({triangle_parents}));
+        }
+    }
+    clipped.SetTriangleIndices(
+            clipped_triangles.To(device, GetTriangleIndices().GetDtype()));
+    return clipped;
 }
 
 LineSet TriangleMesh::SlicePlane(
         const core::Tensor &point,
         const core::Tensor &normal,
         const std::vector<double> contour_values) const {
-    using namespace vtkutils;
-    core::AssertTensorShape(point, {3});
-    core::AssertTensorShape(normal, {3});
-    // allow int types for convenience
-    core::AssertTensorDtypes(
-            point, {core::Float32, core::Float64, core::Int32, core::Int64});
-    core::AssertTensorDtypes(
-            normal, {core::Float32, core::Float64, core::Int32, core::Int64});
-
-    auto point_ = point.To(core::Device(), core::Float64).Contiguous();
-    auto normal_ = normal.To(core::Device(), core::Float64).Contiguous();
-
-    auto polydata = CreateVtkPolyDataFromGeometry(
-            *this, GetVertexAttr().GetKeySet(), {}, {}, {}, false);
-
-    vtkNew<vtkPlane> clipPlane;
-    clipPlane->SetNormal(normal_.GetDataPtr<double>());
-    clipPlane->SetOrigin(point_.GetDataPtr<double>());
-
-    vtkNew<vtkCutter> cutter;
-    cutter->SetInputData(polydata);
-    cutter->SetCutFunction(clipPlane);
-    cutter->GenerateTrianglesOff();
-    cutter->SetNumberOfContours(contour_values.size());
-    int i = 0;
-    for (double value : contour_values) {
-        cutter->SetValue(i++, value);
-    }
-    cutter->Update();
-    auto slices_polydata = cutter->GetOutput();
-
-    return CreateLineSetFromVtkPolyData(slices_polydata);
+    const core::Tensor distances =
+            ComputePlaneDistancesHost(*this, point, normal);
+    LineSet slices(GetDevice());
+    if (!HasTriangleIndices() || GetTriangleIndices().GetLength() == 0) {
+        return slices;
+    }
+
+    static const core::Device host("CPU:0");
+    const core::Device device = GetDevice();
+    const core::Tensor triangles =
+            GetTriangleIndices().To(host, core::Int64).Contiguous();
+    core::Tensor cut_keys, cut_sources, cut_weights;
+    kernel::trianglemesh::SlicePlaneCPU(triangles, distances, contour_values,
+                                        cut_keys, cut_sources, cut_weights);
+
+    // Drop segments that touch a contour in a single vertex.
+    const core::Tensor segment_keys = cut_keys.Reshape({-1, 2, 3});
+    const core::Tensor keep = segment_keys.Slice(1, 0, 1)
+                                      .Ne(segment_keys.Slice(1, 1, 2))
+                                      .Any(core::SizeVector{1, 2});
+    const core::Tensor keep_cuts =
+            core::Concatenate({keep.Reshape({-1, 1}), keep.Reshape({-1, 1})},
+                              1)
+                    .Reshape({-1});
+    cut_keys = cut_keys.IndexGet({keep_cuts});
+    if (cut_keys.GetLength() == 0) {
+        return slices;
+    }
+
+    core::Tensor point_ids, first_cuts;
+    kernel::trianglemesh::UniqueBufIndicesCPU(ComputeKeyBufIndices(cut_keys),
+                                              point_ids, first_cuts);
+    const core::Tensor point_sources =
+            cut_sources.IndexGet({keep_cuts}).IndexGet({first_cuts}).To(device);
+    const core::Tensor point_weights =
+            cut_weights.IndexGet({keep_cuts}).IndexGet({first_cuts}).To(device);
+    for (const auto &kv : GetVertexAttr()) {
+        slices.SetPointAttr(kv.first, InterpolateAttr(kv.second, point_sources,
+                                                      point_weights));
+    }
+    slices.SetLineIndices(point_ids.Reshape({-1, 2}).To(
+            device, GetTriangleIndices().GetDtype()));
+    return slices;
 }
 
 TriangleMesh TriangleMesh::SimplifyQuadricDecimation(
         double target_reduction, bool preserve_volume) const {
-    using namespace vtkutils;
     if (target_reduction >= 1.0 || target_reduction < 0) {
         utility::LogError(
                 "target_reduction must be in the range [0,1) but is {}",
                 target_reduction);
     }
-
-    // exclude attributes because they will not be preserved
-    auto polydata = CreateVtkPolyDataFromGeometry(*this, {}, {}, {}, {}, false);
-
-    vtkNew<vtkQuadricDecimation> decimate;
-    decimate->SetInputData(polydata);
-    decimate->SetTargetReduction(target_reduction);
-    decimate->SetVolumePreservation(preserve_volume);
-    decimate->Update();
-    auto decimated_polydata = decimate->GetOutput();
-
-    return CreateTriangleMeshFromVtkPolyData(decimated_polydata);
+    if (!HasVertexPositions() || !HasTriangleIndices() ||
+        GetTriangleIndices().GetLength() == 0) {
+        utility::LogWarning("TriangleMesh has no vertices or triangles.");
+        return Clone();
+    }
+
+    static const core::Device host("CPU:0");
+    const core::Device device = GetDevice();
+    const core::Tensor triangles =
+            GetTriangleIndices().To(host, core::Int64).Contiguous();
+    const int64_t target_number_of_triangles = static_cast<int64_t>(
+            std::round((1 - target_reduction) * triangles.GetLength()));
+
+    core::Tensor new_vertices, new_triangles, vertex_indices, vertex_map,
+            triangle_parents;
+    kernel::trianglemesh::SimplifyQuadricDecimationCPU(
+            GetVertexPositions().To(host), triangles,
+            ComputeEdgeBufIndices(triangles), target_number_of_triangles,
+            preserve_volume, new_vertices, new_triangles, vertex_indices,
+            vertex_map, triangle_parents);
+
+    // Floating point attributes are averaged over the merged vertices, other
+    // attributes are taken from the remaining vertex.
+    TriangleMesh simplified(device);
+    const int64_t num_vertices = new_vertices.GetLength();
+    vertex_indices = vertex_indices.To(device);
+    vertex_map = vertex_map.To(device);
+    for (const auto &kv : GetVertexAttr()) {
+        const core::Dtype dtype = kv.second.GetDtype();
+        if (kv.first == "positions") {
+            simplified.SetVertexPositions(new_vertices.To(device, dtype));
+        } else if (dtype == core::Float32 || dtype == core::Float64) {
+            core::SizeVector shape = kv.second.GetShape();
+            shape[0] = num_vertices;
+            core::Tensor sum = core::Tensor::Zeros(shape, dtype, device);
+            sum.IndexAdd_(0, vertex_map, kv.second);
+            core::Tensor counts =
+                    core::Tensor::Zeros({num_vertices}, dtype, device);
+            counts.IndexAdd_(0, vertex_map,
+                             core::Tensor::Ones({vertex_map.GetLength()},
+                                                dtype, device));
+            shape = core::SizeVector(kv.second.NumDims(), 1);
+            shape[0] = num_vertices;
+            simplified.SetVertexAttr(kv.first, sum / counts.Reshape(shape));
+        } else {
+            simplified.SetVertexAttr(kv.first,
+                                     kv.second.IndexGet({vertex_indices}));
+        }
+    }
+    triangle_parents = triangle_parents.To(device);
+    for (const auto &kv : GetTriangleAttr()) {
+        if (kv.first != "indices") {
+            simplified.SetTriangleAttr(kv.first,
+                                       kv.second.IndexGet({triangle_parents}));
+        }
+    }
+    simplified.SetTriangleIndices(
+            new_triangles.To(device, GetTriangleIndices().GetDtype()));
+    if (simplified.HasVertexNormals()) {
+        simplified.NormalizeNormals();
+    }
+    if (simplified.HasTriangleNormals()) {
+        simplified.ComputeTriangleNormals();
+    }
+    return simplified;
 }
 
 namespace {
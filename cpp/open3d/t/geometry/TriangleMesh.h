@@ -24,6 +24,7 @@ namespace t {
 namespace geometry {
 
 class LineSet;
+class PointCloud;
 
 /// \class TriangleMesh
 /// \brief A triangle mesh contains vertices and triangles.
@@ -671,10 +672,114 @@ public:
     /// of the individual triangle surfaces.
     double GetSurfaceArea() const;
 
+    /// \brief Sharpens the mesh:
+    /// \f$v_o = v_i + strength (v_i * |N| - \sum_{n \in N} v_n)\f$.
+    /// Vertex positions, normals and colors are filtered if present.
+    ///
+    /// \param number_of_iterations Number of repetitions of this operation.
+    /// \param strength The strength of the filter.
+    /// \return The filtered triangle mesh.
+    TriangleMesh FilterSharpen(int number_of_iterations,
+                               double strength) const;
+
+    /// \brief Smooths the mesh with the simple neighbour average
+    /// \f$v_o = \frac{v_i + \sum_{n \in N} v_n}{|N| + 1}\f$.
+    /// Vertex positions, normals and colors are filtered if present.
+    ///
+    /// \param number_of_iterations Number of repetitions of this operation.
+    /// \return The filtered triangle mesh.
+    TriangleMesh FilterSmoothSimple(int number_of_iterations) const;
+
+    /// \brief Smooths the mesh with a Laplacian filter
+    /// \f$v_o = v_i + \lambda (\sum_{n \in N} w_n v_n - v_i)\f$, where the
+    /// normalized weights \f$w_n\f$ are the inverse distances to the
+    /// neighbours. Vertex positions, normals and colors are filtered if
+    /// present.
+    ///
+    /// \param number_of_iterations Number of repetitions of this operation.
+    /// \param lambda_filter The smoothing parameter.
+    /// \return The filtered triangle mesh.
+    TriangleMesh FilterSmoothLaplacian(int number_of_iterations,
+                                       double lambda_filter = 0.5) const;
+
+    /// \brief Smooths the mesh with the method of Taubin, "Curve and Surface
+    /// Smoothing Without Shrinkage", 1995. Every iteration applies
+    /// FilterSmoothLaplacian twice, first with \p lambda_filter and then with
+    /// \p mu.
+    ///
+    /// \param number_of_iterations Number of repetitions of this operation.
+    /// \param lambda_filter The filter parameter of the first step.
+    /// \param mu The filter parameter of the second step.
+    /// \return The filtered triangle mesh.
+    TriangleMesh FilterSmoothTaubin(int number_of_iterations,
+                                    double lambda_filter = 0.5,
+                                    double mu = -0.53) const;
+
+    /// \brief Samples points uniformly on the triangles, with probability
+    /// proportional to their areas. Floating point vertex attributes such as
+    /// positions, normals and colors are interpolated at the samples.
+    ///
+    /// This runs on the CPU.
+    ///
+    /// \param number_of_points Number of points to sample.
+    /// \param use_triangle_normal If true, the normals of the points are the
+    /// triangle normals instead of the interpolated vertex normals. Triangle
+    /// normals are computed if the mesh has none.
+    /// \return Point cloud with the sampled points.
+    PointCloud SamplePointsUniformly(int64_t number_of_points,
+                                     bool use_triangle_normal = false) const;
+
+    /// \brief Samples points on the mesh with Poisson disk sampling, by
+    /// weighted sample elimination of uniformly sampled points (Yuksel, "Sample
+    /// Elimination for Generating Poisson Disk Sample Sets", 2015).
+    ///
+    /// This runs on the CPU.
+    ///
+    /// \param number_of_points Number of points to keep.
+    /// \param init_factor The number of points of the uniform sampling is
+    /// init_factor * number_of_points.
+    /// \param pcl_init If not null, the initial samples instead of the
+    /// uniform sampling.
+    /// \param use_triangle_normal If true, the normals of the points are the
+    /// triangle normals instead of the interpolated vertex normals.
+    /// \return Point cloud with the sampled points.
+    PointCloud SamplePointsPoissonDisk(int64_t number_of_points,
+                                       double init_factor = 5,
+                                       const PointCloud *pcl_init = nullptr,
+                                       bool use_triangle_normal = false) const;
+
+    /// \brief Subdivides the mesh with the method of Loop, "Smooth Subdivision
+    /// Surfaces Based on Triangles", 1987. Every iteration splits each
+    /// triangle into four. Vertex positions, normals and colors are
+    /// interpolated, other vertex attributes are dropped. The new triangles
+    /// inherit the attributes of their parent and triangle normals are
+    /// recomputed.
+    ///
+    /// The edges are hashed on the CPU and the vertex attributes are
+    /// computed on the device of the mesh.
+    ///
+    /// \param number_of_iterations Number of subdivision steps.
+    /// \return The subdivided triangle mesh.
+    TriangleMesh SubdivideLoop(int number_of_iterations) const;
+
+    /// \brief Clusters the triangles into connected components. Triangles are
+    /// connected if they share an edge.
+    ///
+    /// This runs on the CPU.
+    ///
+    /// \return A tuple of the cluster index of every triangle (Int64), the
+    /// number of triangles of every cluster (Int64) and the surface area of
+    /// every cluster (Float64). Clusters are numbered in order of their
+    /// smallest triangle index.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    ClusterConnectedTriangles() const;
+
     /// \brief Clip mesh with a plane.
     /// This method clips the triangle mesh with the specified plane.
     /// Parts of the mesh on the positive side of the plane will be kept and
-    /// triangles intersected by the plane will be cut.
+    /// triangles intersected by the plane will be cut. Vertex attributes are
+    /// interpolated at the cuts and triangle attributes are kept. The
+    /// triangles are cut on the CPU.
     /// \param point A point on the plane as [Tensor of dim {3}].
     /// \param normal The normal of the plane as [Tensor of dim {3}]. The normal
     /// points to the positive side of the plane for which the geometry will be
@@ -685,7 +790,9 @@ public:
 
     /// \brief Extract contour slices given a plane.
     /// This method extracts slices as LineSet from the mesh at specific
-    /// contour values defined by the specified plane.
+    /// contour values defined by the specified plane. Vertex attributes are
+    /// interpolated at the points of the LineSet. The triangles are cut on
+    /// the CPU and only triangles that span a contour value are visited.
     /// \param point A point on the plane as [Tensor of dim {3}].
     /// \param normal The normal of the plane as [Tensor of dim {3}].
     /// \param contour_values Contour values at which slices will be generated.
@@ -755,7 +862,9 @@ public:
     /// Function to simplify mesh using Quadric Error Metric Decimation by
     /// Garland and Heckbert.
     ///
-    /// This function always uses the CPU device.
+    /// The edge collapses run on the CPU, the result is on the device of the
+    /// mesh. Floating point vertex attributes are averaged over the merged
+    /// vertices and triangle attributes are kept.
     ///
     /// \param target_reduction The factor of triangles to delete, i.e.,
     /// setting this to 0.9 will return a mesh with about 10% of the original
@@ -55,6 +55,12 @@ public:
     /// A sugar for hashmap.GetValueTensor(i)
     core::Tensor GetAttribute(const std::string &attr_name) const;
 
+    /// Get the edge length of a voxel in meters.
+    float GetVoxelSize() const { return voxel_size_; }
+
+    /// Get the number of voxels along each edge of a block.
+    int64_t GetBlockResolution() const { return block_resolution_; }
+
     /// Get a (4, N), Int64 index tensor for active voxels, used for advanced
     /// indexing.
     /// Returned index tensor can access selected value buffers in order of
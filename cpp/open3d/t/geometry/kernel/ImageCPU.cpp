@@ -5,5 +5,623 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
 #include "open3d/core/ParallelFor.h"
+#include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/geometry/kernel/ImageImpl.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace image {
+
+namespace {
+
+/// Output rows processed by one task. Intermediate rows of a band stay in
+/// cache between the horizontal and the vertical pass.
+constexpr int64_t kRowsPerBand = 32;
+
+/// Converts an accumulated value to the output type, rounding to nearest
+/// (ties to even) and saturating for integer types like IPP does.
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, T>::type
+SaturateCast(float v) {
+    return static_cast<T>(v);
+}
+
+template <typename T>
+inline typename std::enable_if<!std::is_floating_point<T>::value, T>::type
+SaturateCast(float v) {
+    v = std::nearbyint(v);
+    v = std::min(v, static_cast<float>(std::numeric_limits<T>::max()));
+    v = std::max(v, static_cast<float>(std::numeric_limits<T>::lowest()));
+    return static_cast<T>(v);
+}
+
+inline int64_t Clamp(int64_t v, int64_t lo, int64_t hi) {
+    return std::min(std::max(v, lo), hi);
+}
+
+/// Loads row \p r of an interleaved (rows, cols, channels) image into \p buf
+/// as float. \p pad pixels are replicated on each side, and out of range rows
+/// are replicated from the nearest border row.
+template <typename T>
+void LoadPaddedRow(const T *src,
+                   int64_t rows,
+                   int64_t cols,
+                   int64_t channels,
+                   int64_t r,
+                   int64_t pad,
+                   float *buf) {
+    const T *row = src + Clamp(r, 0, rows - 1) * cols * channels;
+    const int64_t width = cols * channels;
+    float *interior = buf + pad * channels;
+    for (int64_t i = 0; i < width; ++i) {
+        interior[i] = static_cast<float>(row[i]);
+    }
+    for (int64_t p = 0; p < pad; ++p) {
+        for (int64_t c = 0; c < channels; ++c) {
+            buf[p * channels + c] = interior[c];
+            interior[width + p * channels + c] =
+                    interior[width - channels + c];
+        }
+    }
+}
+
+/// Splits the rows into bands and runs \p func(row_begin, row_end) on them
+/// in parallel.
+template <typename Func>
+void ParallelForBands(int64_t rows, Func func) {
+    const int64_t num_bands = (rows + kRowsPerBand - 1) / kRowsPerBand;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t b = 0; b < num_bands; ++b) {
+        const int64_t r0 = b * kRowsPerBand;
+        func(r0, std::min(r0 + kRowsPerBand, rows));
+    }
+}
+
+/// Correlates the image with kernel_y^T * kernel_x, where both kernels have
+/// odd length and are anchored at their center. Borders are replicated.
+template <typename T, typename TOut>
+void SeparableFilter(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const std::vector<float> &kernel_x,
+                     const std::vector<float> &kernel_y) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t width = cols * channels;
+    const int64_t rx = static_cast<int64_t>(kernel_x.size()) / 2;
+    const int64_t ry = static_cast<int64_t>(kernel_y.size()) / 2;
+    const T *src_ptr = src.GetDataPtr<T>();
+    TOut *dst_ptr = dst.GetDataPtr<TOut>();
+
+    ParallelForBands(rows, [&](int64_t r0, int64_t r1) {
+        const int64_t num_in_rows = r1 - r0 + 2 * ry;
+        std::vector<float> padded((cols + 2 * rx) * channels);
+        std::vector<float> horizontal(num_in_rows * width);
+        std::vector<float> acc(width);
+
+        // Horizontal pass over the band and its vertical apron.
+        for (int64_t i = 0; i < num_in_rows; ++i) {
+            LoadPaddedRow(src_ptr, rows, cols, channels, r0 - ry + i, rx,
+                          padded.data());
+            float *out = horizontal.data() + i * width;
+            std::fill(out, out + width, 0.0f);
+            for (int64_t k = 0; k < 2 * rx + 1; ++k) {
+                const float w = kernel_x[k];
+                const float *in = padded.data() + k * channels;
+                for (int64_t e = 0; e < width; ++e) {
+                    out[e] += w * in[e];
+                }
+            }
+        }
+
+        // Vertical pass.
+        for (int64_t r = r0; r < r1; ++r) {
+            std::fill(acc.begin(), acc.end(), 0.0f);
+            for (int64_t k = 0; k < 2 * ry + 1; ++k) {
+                const float w = kernel_y[k];
+                const float *in = horizontal.data() + (r - r0 + k) * width;
+                for (int64_t e = 0; e < width; ++e) {
+                    acc[e] += w * in[e];
+                }
+            }
+            TOut *out = dst_ptr + r * width;
+            for (int64_t e = 0; e < width; ++e) {
+                out[e] = SaturateCast<TOut>(acc[e]);
+            }
+        }
+    });
+}
+
+/// Per-axis resampling table: each destination coordinate reads
+/// \p num_taps clamped source coordinates with the given weights.
+struct ResampleTable {
+    int64_t num_taps;
+    std::vector<int64_t> indices;
+    std::vector<float> weights;
+};
+
+float CubicWeight(float x) {
+    // Catmull-Rom spline (a = -0.5).
+    const float a = -0.5f;
+    x = std::abs(x);
+    if (x <= 1.0f) {
+        return ((a + 2.0f) * x - (a + 3.0f)) * x * x + 1.0f;
+    } else if (x < 2.0f) {
+        return ((a * x - 5.0f * a) * x + 8.0f * a) * x - 4.0f * a;
+    }
+    return 0.0f;
+}
+
+float LanczosWeight(float x) {
+    // 3-lobed Lanczos window.
+    const float a = 3.0f;
+    x = std::abs(x);
+    if (x < 1e-6f) {
+        return 1.0f;
+    } else if (x >= a) {
+        return 0.0f;
+    }
+    const float pi_x = static_cast<float>(M_PI) * x;
+    return a * std::sin(pi_x) * std::sin(pi_x / a) / (pi_x * pi_x);
+}
+
+ResampleTable BuildResampleTable(int64_t src_size,
+                                 int64_t dst_size,
+                                 Image::InterpType interp_type) {
+    const float scale =
+            static_cast<float>(src_size) / static_cast<float>(dst_size);
+    if (interp_type == Image::InterpType::Super && scale <= 1.0f) {
+        // Super sampling only makes sense for downsampling.
+        interp_type = Image::InterpType::Linear;
+    }
+
+    ResampleTable table;
+    switch (interp_type) {
+        case Image::InterpType::Nearest:
+            table.num_taps = 1;
+            break;
+        case Image::InterpType::Linear:
+            table.num_taps = 2;
+            break;
+        case Image::InterpType::Cubic:
+            table.num_taps = 4;
+            break;
+        case Image::InterpType::Lanczos:
+            table.num_taps = 6;
+            break;
+        case Image::InterpType::Super:
+            table.num_taps = static_cast<int64_t>(std::ceil(scale)) + 1;
+            break;
+        default:
+            utility::LogError("Unsupported interpolation type {}.",
+                              static_cast<int>(interp_type));
+    }
+    table.indices.resize(dst_size * table.num_taps);
+    table.weights.resize(dst_size * table.num_taps, 0.0f);
+
+    for (int64_t d = 0; d < dst_size; ++d) {
+        int64_t *indices = table.indices.data() + d * table.num_taps;
+        float *weights = table.weights.data() + d * table.num_taps;
+        // Source coordinate of the destination pixel center.
+        const float center = (d + 0.5f) * scale - 0.5f;
+        const int64_t base = static_cast<int64_t>(std::floor(center));
+        const float t = center - base;
+        switch (interp_type) {
+            case Image::InterpType::Nearest:
+                indices[0] = static_cast<int64_t>(d * scale);
+                weights[0] = 1.0f;
+                break;
+            case Image::InterpType::Linear:
+                indices[0] = base;
+                indices[1] = base + 1;
+                weights[0] = 1.0f - t;
+                weights[1] = t;
+                break;
+            case Image::InterpType::Cubic:
+            case Image::InterpType::Lanczos: {
+                const int64_t first = base - table.num_taps / 2 + 1;
+                float sum = 0.0f;
+                for (int64_t k = 0; k < table.num_taps; ++k) {
+                    const float x = center - (first + k);
+                    indices[k] = first + k;
+                    weights[k] = interp_type == Image::InterpType::Cubic
+                                         ? CubicWeight(x)
+                                         : LanczosWeight(x);
+                    sum += weights[k];
+                }
+                for (int64_t k = 0; k < table.num_taps; ++k) {
+                    weights[k] /= sum;
+                }
+                break;
+            }
+            case Image::InterpType::Super: {
+                // Average of the source pixels covered by [begin, end).
+                const float begin = d * scale;
+                const float end = std::min((d + 1) * scale,
+                                           static_cast<float>(src_size));
+                const int64_t first = static_cast<int64_t>(begin);
+                for (int64_t k = 0; k < table.num_taps; ++k) {
+                    const float lo = std::max(begin, float(first + k));
+                    const float hi = std::min(end, float(first + k + 1));
+                    indices[k] = first + k;
+                    weights[k] = std::max(hi - lo, 0.0f) / (end - begin);
+                }
+                break;
+            }
+        }
+        for (int64_t k = 0; k < table.num_taps; ++k) {
+            indices[k] = Clamp(indices[k], 0, src_size - 1);
+        }
+    }
+    return table;
+}
+
+template <typename T>
+void ResizeNearest(const core::Tensor &src, core::Tensor &dst) {
+    const int64_t src_rows = src.GetShape(0);
+    const int64_t src_cols = src.GetShape(1);
+    const int64_t dst_rows = dst.GetShape(0);
+    const int64_t dst_cols = dst.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const ResampleTable table_x = BuildResampleTable(
+            src_cols, dst_cols, Image::InterpType::Nearest);
+    const ResampleTable table_y = BuildResampleTable(
+            src_rows, dst_rows, Image::InterpType::Nearest);
+    const T *src_ptr = src.GetDataPtr<T>();
+    T *dst_ptr = dst.GetDataPtr<T>();
+
+    ParallelForBands(dst_rows, [&](int64_t r0, int64_t r1) {
+        for (int64_t r = r0; r < r1; ++r) {
+            const T *in = src_ptr + table_y.indices[r] * src_cols * channels;
+            T *out = dst_ptr + r * dst_cols * channels;
+            for (int64_t x = 0; x < dst_cols; ++x) {
+                const T *pixel = in + table_x.indices[x] * channels;
+                for (int64_t c = 0; c < channels; ++c) {
+                    out[x * channels + c] = pixel[c];
+                }
+            }
+        }
+    });
+}
+
+template <typename T>
+void ResizeSeparable(const core::Tensor &src,
+                     core::Tensor &dst,
+                     Image::InterpType interp_type) {
+    const int64_t src_rows = src.GetShape(0);
+    const int64_t src_cols = src.GetShape(1);
+    const int64_t dst_rows = dst.GetShape(0);
+    const int64_t dst_cols = dst.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t src_width = src_cols * channels;
+    const ResampleTable table_x =
+            BuildResampleTable(src_cols, dst_cols, interp_type);
+    const ResampleTable table_y =
+            BuildResampleTable(src_rows, dst_rows, interp_type);
+    const T *src_ptr = src.GetDataPtr<T>();
+    T *dst_ptr = dst.GetDataPtr<T>();
+
+    ParallelForBands(dst_rows, [&](int64_t r0, int64_t r1) {
+        std::vector<float> vertical(src_width);
+        for (int64_t r = r0; r < r1; ++r) {
+            // Vertical pass on full source rows first, so the inner loop is
+            // contiguous; the horizontal pass then runs on a single row.
+            std::fill(vertical.begin(), vertical.end(), 0.0f);
+            for (int64_t k = 0; k < table_y.num_taps; ++k) {
+                const float w = table_y.weights[r * table_y.num_taps + k];
+                if (w == 0.0f) continue;
+                const T *in = src_ptr +
+                              table_y.indices[r * table_y.num_taps + k] *
+                                      src_width;
+                for (int64_t e = 0; e < src_width; ++e) {
+                    vertical[e] += w * static_cast<float>(in[e]);
+                }
+            }
+
+            T *out = dst_ptr + r * dst_cols * channels;
+            for (int64_t x = 0; x < dst_cols; ++x) {
+                const int64_t *indices =
+                        table_x.indices.data() + x * table_x.num_taps;
+                const float *weights =
+                        table_x.weights.data() + x * table_x.num_taps;
+                for (int64_t c = 0; c < channels; ++c) {
+                    float acc = 0.0f;
+                    for (int64_t k = 0; k < table_x.num_taps; ++k) {
+                        acc += weights[k] * vertical[indices[k] * channels + c];
+                    }
+                    out[x * channels + c] = SaturateCast<T>(acc);
+                }
+            }
+        }
+    });
+}
+
+}  // namespace
+
+void RGBToGrayCPU(const core::Tensor &src, core::Tensor &dst) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t *dst_ptr = dst.GetDataPtr<scalar_t>();
+        ParallelForBands(src.GetShape(0), [&](int64_t r0, int64_t r1) {
+            const int64_t cols = src.GetShape(1);
+            for (int64_t i = r0 * cols; i < r1 * cols; ++i) {
+                const scalar_t *rgb = src_ptr + 3 * i;
+                dst_ptr[i] = SaturateCast<scalar_t>(
+                        0.299f * static_cast<float>(rgb[0]) +
+                        0.587f * static_cast<float>(rgb[1]) +
+                        0.114f * static_cast<float>(rgb[2]));
+            }
+        });
+    });
+}
+
+void ResizeCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               Image::InterpType interp_type) {
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        if (interp_type == Image::InterpType::Nearest) {
+            ResizeNearest<scalar_t>(src, dst);
+        } else {
+            ResizeSeparable<scalar_t>(src, dst, interp_type);
+        }
+    });
+}
+
+void DilateCPU(const core::Tensor &src, core::Tensor &dst, int kernel_size) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t width = cols * channels;
+    const int64_t radius = kernel_size / 2;
+
+    // Dilation with a square mask is a separable max filter.
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t *dst_ptr = dst.GetDataPtr<scalar_t>();
+        ParallelForBands(rows, [&](int64_t r0, int64_t r1) {
+            const int64_t num_in_rows = r1 - r0 + 2 * radius;
+            std::vector<float> padded((cols + 2 * radius) * channels);
+            std::vector<float> horizontal(num_in_rows * width);
+            std::vector<float> acc(width);
+
+            for (int64_t i = 0; i < num_in_rows; ++i) {
+                LoadPaddedRow(src_ptr, rows, cols, channels, r0 - radius + i,
+                              radius, padded.data());
+                float *out = horizontal.data() + i * width;
+                std::copy(padded.begin(), padded.begin() + width, out);
+                for (int64_t k = 1; k < 2 * radius + 1; ++k) {
+                    const float *in = padded.data() + k * channels;
+                    for (int64_t e = 0; e < width; ++e) {
+                        out[e] = std::max(out[e], in[e]);
+                    }
+                }
+            }
+
+            for (int64_t r = r0; r < r1; ++r) {
+                const float *first = horizontal.data() + (r - r0) * width;
+                std::copy(first, first + width, acc.begin());
+                for (int64_t k = 1; k < 2 * radius + 1; ++k) {
+                    const float *in = horizontal.data() + (r - r0 + k) * width;
+                    for (int64_t e = 0; e < width; ++e) {
+                        acc[e] = std::max(acc[e], in[e]);
+                    }
+                }
+                scalar_t *out = dst_ptr + r * width;
+                for (int64_t e = 0; e < width; ++e) {
+                    out[e] = static_cast<scalar_t>(acc[e]);
+                }
+            }
+        });
+    });
+}
+
+void FilterCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               const core::Tensor &kernel) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t width = cols * channels;
+    const int64_t kernel_rows = kernel.GetShape(0);
+    const int64_t kernel_cols = kernel.GetShape(1);
+    // Anchor at the kernel center, matching IPP for odd and even sizes.
+    const int64_t ay = (kernel_rows - 1) / 2;
+    const int64_t ax = (kernel_cols - 1) / 2;
+    const int64_t pad = std::max(ax, kernel_cols - 1 - ax);
+    const std::vector<float> weights =
+            kernel.To(core::Device("CPU:0"), core::Float32)
+                    .Contiguous()
+                    .ToFlatVector<float>();
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t *src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t *dst_ptr = dst.GetDataPtr<scalar_t>();
+        ParallelForBands(rows, [&](int64_t r0, int64_t r1) {
+            const int64_t num_in_rows = r1 - r0 + kernel_rows - 1;
+            const int64_t padded_width = (cols + 2 * pad) * channels;
+            std::vector<float> padded(num_in_rows * padded_width);
+            std::vector<float> acc(width);
+            for (int64_t i = 0; i < num_in_rows; ++i) {
+                LoadPaddedRow(src_ptr, rows, cols, channels, r0 - ay + i, pad,
+                              padded.data() + i * padded_width);
+            }
+
+            for (int64_t r = r0; r < r1; ++r) {
+                std::fill(acc.begin(), acc.end(), 0.0f);
+                for (int64_t i = 0; i < kernel_rows; ++i) {
+                    const float *in_row =
+                            padded.data() + (r - r0 + i) * padded_width;
+                    for (int64_t j = 0; j < kernel_cols; ++j) {
+                        const float w = weights[i * kernel_cols + j];
+                        const float *in = in_row + (pad - ax + j) * channels;
+                        for (int64_t e = 0; e < width; ++e) {
+                            acc[e] += w * in[e];
+                        }
+                    }
+                }
+                scalar_t *out = dst_ptr + r * width;
+                for (int64_t e = 0; e < width; ++e) {
+                    out[e] = SaturateCast<scalar_t>(acc[e]);
+                }
+            }
+        });
+    });
+}
+
+void FilterBilateralCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        int kernel_size,
+                        float value_sigma,
+                        float distance_sigma) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t width = cols * channels;
+    const int64_t radius = kernel_size / 2;
+    const int64_t padded_width = (cols + 2 * radius) * channels;
+    const float value_factor = -0.5f / (value_sigma * value_sigma);
+    const float distance_factor = -0.5f / (distance_sigma * distance_sigma);
+
+    // Circular window, as in IPP.
+    struct Tap {
+        int64_t dy;
+        int64_t offset;
+        float weight;
+    };
+    std::vector<Tap> taps;
+    for (int64_t dy = -radius; dy <= radius; ++dy) {
+        for (int64_t dx = -radius; dx <= radius; ++dx) {
+            const int64_t d2 = dy * dy + dx * dx;
+            if (d2 <= radius * radius) {
+                taps.push_back({dy + radius, (dx + radius) * channels,
+                                std::exp(d2 * distance_factor)});
+            }
+        }
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        // Integer value differences are bounded, so the range weights of
+        // 8-bit images are looked up instead of evaluated per tap.
+        std::vector<float> value_lut;
+        if (std::is_same<scalar_t, uint8_t>::value) {
+            value_lut.resize(channels * 255 * 255 + 1);
+            for (size_t i = 0; i < value_lut.size(); ++i) {
+                value_lut[i] = std::exp(i * value_factor);
+            }
+        }
+
+        const scalar_t *src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t *dst_ptr = dst.GetDataPtr<scalar_t>();
+        ParallelForBands(rows, [&](int64_t r0, int64_t r1) {
+            const int64_t num_in_rows = r1 - r0 + 2 * radius;
+            std::vector<float> padded(num_in_rows * padded_width);
+            std::vector<float> sum(channels);
+            for (int64_t i = 0; i < num_in_rows; ++i) {
+                LoadPaddedRow(src_ptr, rows, cols, channels, r0 - radius + i,
+                              radius, padded.data() + i * padded_width);
+            }
+
+            for (int64_t r = r0; r < r1; ++r) {
+                scalar_t *out = dst_ptr + r * width;
+                for (int64_t x = 0; x < cols; ++x) {
+                    const float *center = padded.data() +
+                                          (r - r0 + radius) * padded_width +
+                                          (x + radius) * channels;
+                    float weight_sum = 0.0f;
+                    std::fill(sum.begin(), sum.end(), 0.0f);
+                    for (const Tap &tap : taps) {
+                        const float *v = padded.data() +
+                                         (r - r0 + tap.dy) * padded_width +
+                                         x * channels + tap.offset;
+                        float d2 = 0.0f;
+                        for (int64_t c = 0; c < channels; ++c) {
+                            d2 += (v[c] - center[c]) * (v[c] - center[c]);
+                        }
+                        const float w =
+                                tap.weight *
+                                (value_lut.empty()
+                                         ? std::exp(d2 * value_factor)
+                                         : value_lut[static_cast<int64_t>(d2)]);
+                        weight_sum += w;
+                        for (int64_t c = 0; c < channels; ++c) {
+                            sum[c] += w * v[c];
+                        }
+                    }
+                    for (int64_t c = 0; c < channels; ++c) {
+                        out[x * channels + c] =
+                                SaturateCast<scalar_t>(sum[c] / weight_sum);
+                    }
+                }
+            }
+        });
+    });
+}
+
+void FilterGaussianCPU(const core::Tensor &src,
+                       core::Tensor &dst,
+                       int kernel_size,
+                       float sigma) {
+    const int radius = kernel_size / 2;
+    std::vector<float> kernel(kernel_size);
+    float sum = 0.0f;
+    for (int i = 0; i < kernel_size; ++i) {
+        const float x = static_cast<float>(i - radius);
+        kernel[i] = std::exp(-x * x / (2.0f * sigma * sigma));
+        sum += kernel[i];
+    }
+    for (float &w : kernel) {
+        w /= sum;
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        SeparableFilter<scalar_t, scalar_t>(src, dst, kernel, kernel);
+    });
+}
+
+void FilterSobelCPU(const core::Tensor &src,
+                    core::Tensor &dst_dx,
+                    core::Tensor &dst_dy,
+                    int kernel_size) {
+    std::vector<float> derivative, smooth;
+    if (kernel_size == 3) {
+        derivative = {-1, 0, 1};
+        smooth = {1, 2, 1};
+    } else if (kernel_size == 5) {
+        derivative = {-1, -2, 0, 2, 1};
+        smooth = {1, 4, 6, 4, 1};
+    } else {
+        utility::LogError("Kernel size must be 3 or 5, but got {}.",
+                          kernel_size);
+    }
+
+    core::Dtype dtype = src.GetDtype();
+    if (dtype == core::Float32) {
+        SeparableFilter<float, float>(src, dst_dx, derivative, smooth);
+        SeparableFilter<float, float>(src, dst_dy, smooth, derivative);
+    } else if (dtype == core::UInt8) {
+        SeparableFilter<uint8_t, int16_t>(src, dst_dx, derivative, smooth);
+        SeparableFilter<uint8_t, int16_t>(src, dst_dy, smooth, derivative);
+    } else {
+        utility::LogError("Unsupported dtype {} for FilterSobel.",
+                          dtype.ToString());
+    }
+}
+
+}  // namespace image
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
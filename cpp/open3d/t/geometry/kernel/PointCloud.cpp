@@ -12,6 +12,7 @@
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -147,6 +148,129 @@ void GetPointMaskWithinOBB(const core::Tensor& points,
     }
 }
 
+std::vector<core::Tensor> VoxelDownSample(
+        const core::Tensor& points,
+        double voxel_size,
+        const std::vector<core::Tensor>& attrs,
+        const std::vector<VoxelReduction>& reductions) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    if (attrs.size() != reductions.size()) {
+        utility::LogError("Expected {} reductions, but got {}.", attrs.size(),
+                          reductions.size());
+    }
+
+    // There is no GPU kernel yet, group and reduce on the host.
+    static const core::Device host("CPU:0");
+    std::vector<core::Tensor> attrs_d;
+    for (const core::Tensor& attr : attrs) {
+        if (attr.NumDims() == 0 || attr.GetLength() != points.GetLength()) {
+            utility::LogError(
+                    "Attributes must have the same length as the {} points.",
+                    points.GetLength());
+        }
+        attrs_d.push_back(attr.To(host).Contiguous());
+    }
+    std::vector<core::Tensor> voxel_attrs;
+    VoxelDownSampleCPU(points.To(host).Contiguous(), voxel_size, attrs_d,
+                       reductions, voxel_attrs);
+    for (core::Tensor& voxel_attr : voxel_attrs) {
+        voxel_attr = voxel_attr.To(points.GetDevice());
+    }
+    return voxel_attrs;
+}
+
+core::Tensor FarthestPointDownSample(const core::Tensor& points,
+                                     const core::Tensor& row_splits,
+                                     int64_t num_samples) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorDtype(row_splits, core::Int64);
+    if (num_samples < 0) {
+        utility::LogError("num_samples must be non-negative, but got {}.",
+                          num_samples);
+    }
+
+    // There is no GPU kernel yet: sampling is sequential in the number of
+    // samples, so run it on the host and move the indices back.
+    static const core::Device host("CPU:0");
+    const core::Tensor points_d = points.To(host).Contiguous();
+    const core::Tensor row_splits_d = row_splits.To(host).Contiguous();
+    const int64_t num_batches = row_splits_d.GetLength() - 1;
+    const int64_t* row_splits_ptr = row_splits_d.GetDataPtr<int64_t>();
+    if (num_batches < 0 || row_splits_ptr[0] != 0 ||
+        row_splits_ptr[num_batches] != points.GetLength()) {
+        utility::LogError(
+                "row_splits must start at 0 and end at the number of points "
+                "{}.",
+                points.GetLength());
+    }
+    for (int64_t b = 0; b < num_batches; ++b) {
+        const int64_t batch_size = row_splits_ptr[b + 1] - row_splits_ptr[b];
+        if (num_samples > batch_size) {
+            utility::LogError(
+                    "Illegal number of samples: {}, must <= point size: {} of "
+                    "batch {}.",
+                    num_samples, batch_size, b);
+        }
+    }
+    core::Tensor indices =
+            core::Tensor::Empty({num_batches * num_samples}, core::Int64, host);
+    FarthestPointDownSampleCPU(points_d, row_splits_d, num_samples, indices);
+    return indices.To(points.GetDevice());
+}
+
+core::Tensor ClusterDBSCAN(const core::Tensor& neighbors_index,
+                           const core::Tensor& neighbors_row_splits,
+                           size_t min_points,
+                           bool print_progress) {
+    core::AssertTensorDtypes(neighbors_index, {core::Int32, core::Int64});
+    core::AssertTensorDtype(neighbors_row_splits, core::Int64);
+
+    // Cluster on the host, the union-find is not ported to the GPU.
+    static const core::Device host("CPU:0");
+    const core::Tensor index_d = neighbors_index.To(host).Contiguous();
+    const core::Tensor row_splits_d =
+            neighbors_row_splits.To(host).Contiguous();
+    core::Tensor labels = core::Tensor::Empty(
+            {row_splits_d.GetLength() - 1}, core::Int32, host);
+    ClusterDBSCANCPU(index_d, row_splits_d, min_points, labels,
+                     print_progress);
+    return labels.To(neighbors_index.GetDevice());
+}
+
+void OrientNormalsConsistentTangentPlane(const core::Tensor& points,
+                                         core::Tensor& normals,
+                                         const core::Tensor& tetras,
+                                         const core::Tensor& knn_indices,
+                                         double lambda,
+                                         double cos_alpha_tol) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorShape(normals, points.GetShape());
+    core::AssertTensorDtype(normals, points.GetDtype());
+    core::AssertTensorShape(tetras, {utility::nullopt, 4});
+    core::AssertTensorDtype(tetras, core::Int64);
+    core::AssertTensorDtype(knn_indices, core::Int64);
+    if (knn_indices.NumDims() != 2 ||
+        knn_indices.GetLength() != points.GetLength()) {
+        utility::LogError("knn_indices must have shape {{{}, k}}.",
+                          points.GetLength());
+    }
+
+    // The spanning tree traversal is sequential, run on the host.
+    static const core::Device host("CPU:0");
+    core::Tensor normals_d = normals.To(host, /*copy=*/true).Contiguous();
+    OrientNormalsConsistentTangentPlaneCPU(
+            points.To(host).Contiguous(), normals_d,
+            tetras.To(host).Contiguous(), knn_indices.To(host).Contiguous(),
+            lambda, cos_alpha_tol);
+    normals.CopyFrom(normals_d);
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
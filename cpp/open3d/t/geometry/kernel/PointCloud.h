@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 
@@ -49,6 +51,73 @@ void GetPointMaskWithinOBB(const core::Tensor& points,
                            const core::Tensor& extent,
                            core::Tensor& mask);
 
+/// Reduction of the attribute values of the points in a voxel.
+enum class VoxelReduction {
+    Mean = 0,    ///< Average of the values.
+    First = 1,   ///< Value of the point with the smallest index.
+    Center = 2,  ///< Value of the point closest to the voxel center.
+    Mode = 3,    ///< Most frequent value of each channel, the smallest on ties.
+};
+
+/// \brief Voxel downsampling of point attributes.
+///
+/// Points are grouped by sorting their packed voxel coordinates and every
+/// voxel reduces all attributes in a single pass. The voxels are ordered by
+/// their coordinates.
+///
+/// \param points Float32 or Float64 points of shape {N, 3}.
+/// \param voxel_size Voxel size.
+/// \param attrs Attributes of shape {N, ...} on the device of \p points.
+/// \param reductions Reduction of each attribute.
+/// \return The reduced attributes of shape {V, ...}, in the order of \p
+/// attrs.
+std::vector<core::Tensor> VoxelDownSample(
+        const core::Tensor& points,
+        double voxel_size,
+        const std::vector<core::Tensor>& attrs,
+        const std::vector<VoxelReduction>& reductions);
+
+/// \brief Farthest point sampling of each batch of \p points.
+///
+/// \param points Float32 or Float64 points of shape {N, 3}.
+/// \param row_splits Int64 tensor of shape {B + 1} delimiting the batches.
+/// \param num_samples Number of points sampled from every batch, starting
+/// from the first point of the batch.
+/// \return Int64 indices into \p points of shape {B * num_samples}, batch
+/// after batch in sampling order, on the device of \p points.
+core::Tensor FarthestPointDownSample(const core::Tensor& points,
+                                     const core::Tensor& row_splits,
+                                     int64_t num_samples);
+
+/// \brief DBSCAN clustering of points from their radius neighbors.
+///
+/// \param neighbors_index Int32 or Int64 neighbor indices of all points,
+/// including the points themselves.
+/// \param neighbors_row_splits Int64 tensor of shape {N + 1} delimiting the
+/// neighbors of each point.
+/// \param min_points Minimum number of neighbors of a core point.
+/// \param print_progress If true the progress is visualized in the console.
+/// \return Int32 labels of shape {N} on the device of \p neighbors_index.
+/// Noise points are labeled -1.
+core::Tensor ClusterDBSCAN(const core::Tensor& neighbors_index,
+                           const core::Tensor& neighbors_row_splits,
+                           size_t min_points,
+                           bool print_progress);
+
+/// \brief Orients \p normals consistently along the minimum spanning tree of
+/// the Riemannian graph of \p points.
+///
+/// \param tetras Int64 tetrahedra of shape {T, 4} of the Delaunay
+/// triangulation of \p points.
+/// \param knn_indices Int64 indices of shape {N, k} of the nearest neighbors
+/// of each point.
+void OrientNormalsConsistentTangentPlane(const core::Tensor& points,
+                                         core::Tensor& normals,
+                                         const core::Tensor& tetras,
+                                         const core::Tensor& knn_indices,
+                                         double lambda,
+                                         double cos_alpha_tol);
+
 void UnprojectCPU(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -98,6 +167,30 @@ void ComputeBoundaryPointsCPU(const core::Tensor& points,
                               core::Tensor& mask,
                               double angle_threshold);
 
+void FarthestPointDownSampleCPU(const core::Tensor& points,
+                                const core::Tensor& row_splits,
+                                int64_t num_samples,
+                                core::Tensor& indices);
+
+void VoxelDownSampleCPU(const core::Tensor& points,
+                        double voxel_size,
+                        const std::vector<core::Tensor>& attrs,
+                        const std::vector<VoxelReduction>& reductions,
+                        std::vector<core::Tensor>& voxel_attrs);
+
+void ClusterDBSCANCPU(const core::Tensor& neighbors_index,
+                      const core::Tensor& neighbors_row_splits,
+                      size_t min_points,
+                      core::Tensor& labels,
+                      bool print_progress);
+
+void OrientNormalsConsistentTangentPlaneCPU(const core::Tensor& points,
+                                            core::Tensor& normals,
+                                            const core::Tensor& tetras,
+                                            const core::Tensor& knn_indices,
+                                            double lambda,
+                                            double cos_alpha_tol);
+
 #ifdef BUILD_CUDA_MODULE
 void UnprojectCUDA(
         const core::Tensor& depth,
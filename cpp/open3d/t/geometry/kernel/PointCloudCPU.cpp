@@ -5,7 +5,21 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
+#include "open3d/t/geometry/kernel/UnionFind.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressBar.h"
 
 namespace open3d {
 namespace t {
@@ -80,6 +94,930 @@ void ProjectCPU(
     });
 }
 
+namespace {
+
+/// Target number of points per block of the farthest point sampling grid.
+constexpr int64_t kFPSPointsPerBlock = 256;
+
+/// A voxel of the farthest point sampling grid. Its points are stored
+/// contiguously in [begin, end).
+template <typename scalar_t>
+struct FPSBlock {
+    int64_t begin;
+    int64_t end;
+    scalar_t min_bound[3];
+    scalar_t max_bound[3];
+    /// Largest distance of a block point to the sampled set, and the index of
+    /// that point (the smallest one on ties).
+    scalar_t max_dist;
+    int64_t argmax;
+};
+
+/// Returns true if the sample (\p max_dist, \p index) should replace
+/// (\p best_dist, \p best_index). Ties go to the smaller index, as in the
+/// legacy implementation.
+template <typename scalar_t>
+inline bool FPSIsFarther(scalar_t max_dist,
+                         int64_t index,
+                         scalar_t best_dist,
+                         int64_t best_index) {
+    return max_dist > best_dist ||
+           (max_dist == best_dist && index < best_index);
+}
+
+/// Farthest point sampling of a single batch of \p num_points points.
+///
+/// Points are bucketed into a voxel grid. After a new sample is picked, a
+/// block is only updated if its bounding box is closer to the sample than the
+/// farthest point of the block, since otherwise no distance can decrease.
+template <typename scalar_t>
+void FarthestPointDownSampleBatch(const scalar_t* points,
+                                  int64_t num_points,
+                                  int64_t num_samples,
+                                  int64_t offset,
+                                  int64_t* indices,
+                                  int num_threads) {
+    if (num_samples == 0) {
+        return;
+    }
+
+    scalar_t min_bound[3], max_bound[3];
+    for (int d = 0; d < 3; ++d) {
+        min_bound[d] = max_bound[d] = points[d];
+    }
+    for (int64_t i = 1; i < num_points; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            min_bound[d] = std::min(min_bound[d], points[3 * i + d]);
+            max_bound[d] = std::max(max_bound[d], points[3 * i + d]);
+        }
+    }
+
+    // Pick the voxel size by bisection, so that the grid has about
+    // num_points / kFPSPointsPerBlock cells also for flat point clouds.
+    const double target_cells =
+            std::max<double>(1.0, double(num_points) / kFPSPointsPerBlock);
+    double extent[3];
+    double max_extent = 0;
+    for (int d = 0; d < 3; ++d) {
+        extent[d] = double(max_bound[d]) - double(min_bound[d]);
+        max_extent = std::max(max_extent, extent[d]);
+    }
+    auto count_cells = [&](double voxel_size, int64_t* dims) {
+        double cells = 1;
+        for (int d = 0; d < 3; ++d) {
+            dims[d] = std::max<int64_t>(
+                    1, static_cast<int64_t>(std::ceil(extent[d] / voxel_size)));
+            cells *= dims[d];
+        }
+        return cells;
+    };
+    int64_t dims[3] = {1, 1, 1};
+    double voxel_size = std::max(max_extent, 1e-12);
+    if (max_extent > 0) {
+        double lo = max_extent / target_cells, hi = max_extent;
+        for (int iter = 0; iter < 32; ++iter) {
+            const double mid = 0.5 * (lo + hi);
+            (count_cells(mid, dims) > target_cells ? lo : hi) = mid;
+        }
+        voxel_size = hi;
+    }
+    const int64_t num_cells =
+            static_cast<int64_t>(count_cells(voxel_size, dims));
+
+    // Counting sort by cell. The sort is stable, so indices increase within
+    // a block.
+    std::vector<int64_t> cell_of(num_points);
+    std::vector<int64_t> cell_begin(num_cells + 1, 0);
+    for (int64_t i = 0; i < num_points; ++i) {
+        int64_t key = 0;
+        for (int d = 0; d < 3; ++d) {
+            const int64_t c = std::min(
+                    dims[d] - 1,
+                    static_cast<int64_t>((points[3 * i + d] - min_bound[d]) /
+                                         voxel_size));
+            key = key * dims[d] + c;
+        }
+        cell_of[i] = key;
+        ++cell_begin[key + 1];
+    }
+    for (int64_t c = 0; c < num_cells; ++c) {
+        cell_begin[c + 1] += cell_begin[c];
+    }
+
+    // Structure of arrays in block order, so distance updates vectorize.
+    std::vector<scalar_t> xs(num_points), ys(num_points), zs(num_points);
+    std::vector<scalar_t> dists(num_points,
+                                std::numeric_limits<scalar_t>::infinity());
+    std::vector<int64_t> order(num_points);
+    {
+        std::vector<int64_t> cursor(cell_begin.begin(), cell_begin.end() - 1);
+        for (int64_t i = 0; i < num_points; ++i) {
+            const int64_t j = cursor[cell_of[i]]++;
+            xs[j] = points[3 * i + 0];
+            ys[j] = points[3 * i + 1];
+            zs[j] = points[3 * i + 2];
+            order[j] = i;
+        }
+    }
+
+    std::vector<FPSBlock<scalar_t>> blocks;
+    for (int64_t c = 0; c < num_cells; ++c) {
+        if (cell_begin[c] == cell_begin[c + 1]) continue;
+        FPSBlock<scalar_t> block;
+        block.begin = cell_begin[c];
+        block.end = cell_begin[c + 1];
+        block.max_dist = std::numeric_limits<scalar_t>::infinity();
+        block.argmax = order[block.begin];
+        for (int d = 0; d < 3; ++d) {
+            block.min_bound[d] = std::numeric_limits<scalar_t>::max();
+            block.max_bound[d] = std::numeric_limits<scalar_t>::lowest();
+        }
+        for (int64_t j = block.begin; j < block.end; ++j) {
+            const scalar_t p[3] = {xs[j], ys[j], zs[j]};
+            for (int d = 0; d < 3; ++d) {
+                block.min_bound[d] = std::min(block.min_bound[d], p[d]);
+                block.max_bound[d] = std::max(block.max_bound[d], p[d]);
+            }
+        }
+        blocks.push_back(block);
+    }
+    const int64_t num_blocks = static_cast<int64_t>(blocks.size());
+
+    // Every sample costs two barriers, so small batches use fewer threads.
+    num_threads = static_cast<int>(std::max<int64_t>(
+            1, std::min<int64_t>(num_threads, num_blocks / 64)));
+
+    // As in the legacy implementation, sampling starts from the first point.
+    int64_t selected = 0;
+    indices[0] = offset;
+#pragma omp parallel num_threads(num_threads)
+    for (int64_t k = 1; k < num_samples; ++k) {
+        const scalar_t px = points[3 * selected + 0];
+        const scalar_t py = points[3 * selected + 1];
+        const scalar_t pz = points[3 * selected + 2];
+
+#pragma omp for schedule(dynamic, 16)
+        for (int64_t b = 0; b < num_blocks; ++b) {
+            FPSBlock<scalar_t>& block = blocks[b];
+            const scalar_t p[3] = {px, py, pz};
+            scalar_t lower_bound = 0;
+            for (int d = 0; d < 3; ++d) {
+                const scalar_t gap =
+                        std::max(std::max(block.min_bound[d] - p[d],
+                                          p[d] - block.max_bound[d]),
+                                 scalar_t(0));
+                lower_bound += gap * gap;
+            }
+            if (lower_bound >= block.max_dist) {
+                continue;
+            }
+
+            scalar_t max_dist = 0;
+            for (int64_t j = block.begin; j < block.end; ++j) {
+                const scalar_t dx = xs[j] - px;
+                const scalar_t dy = ys[j] - py;
+                const scalar_t dz = zs[j] - pz;
+                const scalar_t dist =
+                        std::min(dists[j], dx * dx + dy * dy + dz * dz);
+                dists[j] = dist;
+                max_dist = std::max(max_dist, dist);
+            }
+            int64_t j = block.begin;
+            while (j + 1 < block.end && dists[j] != max_dist) ++j;
+            block.max_dist = max_dist;
+            block.argmax = order[j];
+        }
+
+#pragma omp single
+        {
+            scalar_t best_dist = -1;
+            int64_t best_index = 0;
+            for (const FPSBlock<scalar_t>& block : blocks) {
+                if (FPSIsFarther(block.max_dist, block.argmax, best_dist,
+                                 best_index)) {
+                    best_dist = block.max_dist;
+                    best_index = block.argmax;
+                }
+            }
+            selected = best_index;
+            indices[k] = offset + selected;
+        }
+    }
+}
+
+/// Samples each batch of points delimited by \p row_splits. Many batches are
+/// sampled concurrently; a few large ones are each sampled by all threads.
+template <typename scalar_t>
+void FarthestPointDownSampleBatches(const scalar_t* points,
+                                    const int64_t* row_splits,
+                                    int64_t num_batches,
+                                    int64_t num_samples,
+                                    int64_t* indices) {
+    const int max_threads = utility::EstimateMaxThreads();
+    if (num_batches >= max_threads) {
+#pragma omp parallel for schedule(dynamic) num_threads(max_threads)
+        for (int64_t b = 0; b < num_batches; ++b) {
+            const int64_t begin = row_splits[b];
+            FarthestPointDownSampleBatch(points + 3 * begin,
+                                         row_splits[b + 1] - begin,
+                                         num_samples, begin,
+                                         indices + b * num_samples, 1);
+        }
+    } else {
+        for (int64_t b = 0; b < num_batches; ++b) {
+            const int64_t begin = row_splits[b];
+            FarthestPointDownSampleBatch(points + 3 * begin,
+                                         row_splits[b + 1] - begin,
+                                         num_samples, begin,
+                                         indices + b * num_samples,
+                                         max_threads);
+        }
+    }
+}
+
+/// DBSCAN from the precomputed radius neighbors of all points.
+///
+/// The connected components of the core points are found with a concurrent
+/// union-find over core-core neighbor pairs. Clusters are numbered by their
+/// smallest core point and border points join the lowest numbered cluster
+/// among their core neighbors, which are the labels of the sequential legacy
+/// implementation.
+template <typename index_t>
+void ClusterDBSCANImpl(const index_t* neighbors_index,
+                       const int64_t* neighbors_row_splits,
+                       int64_t num_points,
+                       int64_t min_points,
+                       int32_t* labels,
+                       bool print_progress) {
+    std::vector<uint8_t> is_core(num_points);
+    std::vector<std::atomic<int64_t>> parent(num_points);
+    std::atomic<int64_t>* parent_ptr = parent.data();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < num_points; ++idx) {
+        is_core[idx] = neighbors_row_splits[idx + 1] -
+                               neighbors_row_splits[idx] >=
+                       min_points;
+        parent_ptr[idx].store(idx, std::memory_order_relaxed);
+    }
+
+    utility::OMPProgressBar progress_bar(num_points, "Clustering",
+                                         print_progress);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) {
+            for (int64_t k = neighbors_row_splits[idx];
+                 k < neighbors_row_splits[idx + 1]; ++k) {
+                const int64_t nb = neighbors_index[k];
+                // Neighborhoods are symmetric, every pair is visited twice.
+                if (nb > idx && is_core[nb]) {
+                    UnionFindMerge(parent_ptr, idx, nb);
+                }
+            }
+        }
+        ++progress_bar;
+    }
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) {
+            parent_ptr[idx].store(UnionFindRoot(parent_ptr, idx),
+                                  std::memory_order_relaxed);
+        }
+    }
+
+    // The root of a cluster is its smallest core point.
+    std::vector<int32_t> cluster_labels(num_points, -1);
+    int32_t num_clusters = 0;
+    for (int64_t idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx] && parent_ptr[idx].load() == idx) {
+            cluster_labels[idx] = num_clusters++;
+        }
+    }
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) {
+            labels[idx] = cluster_labels[parent_ptr[idx].load(
+                    std::memory_order_relaxed)];
+            continue;
+        }
+        int32_t label = -1;
+        for (int64_t k = neighbors_row_splits[idx];
+             k < neighbors_row_splits[idx + 1]; ++k) {
+            const int64_t nb = neighbors_index[k];
+            if (is_core[nb]) {
+                const int32_t nb_label = cluster_labels[parent_ptr[nb].load(
+                        std::memory_order_relaxed)];
+                if (label < 0 || nb_label < label) {
+                    label = nb_label;
+                }
+            }
+        }
+        labels[idx] = label;
+    }
+    utility::LogDebug("Done Compute Clusters: {:d}", num_clusters);
+}
+
+/// Weighted edge of the Riemannian graph used to orient normals.
+struct WeightedEdge {
+    int64_t v0;
+    int64_t v1;
+    double weight;
+};
+
+/// Minimum spanning forest of \p edges (Kruskal's algorithm).
+std::vector<WeightedEdge> Kruskal(std::vector<WeightedEdge>& edges,
+                                  int64_t num_vertices) {
+    std::sort(edges.begin(), edges.end(),
+              [](const WeightedEdge& e0, const WeightedEdge& e1) {
+                  return e0.weight < e1.weight;
+              });
+    std::vector<int64_t> parent(num_vertices);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](int64_t idx) {
+        while (parent[idx] != idx) {
+            parent[idx] = parent[parent[idx]];
+            idx = parent[idx];
+        }
+        return idx;
+    };
+    std::vector<WeightedEdge> mst;
+    for (const WeightedEdge& edge : edges) {
+        const int64_t set0 = find(edge.v0);
+        const int64_t set1 = find(edge.v1);
+        if (set0 != set1) {
+            mst.push_back(edge);
+            parent[std::max(set0, set1)] = std::min(set0, set1);
+        }
+    }
+    return mst;
+}
+
+/// Orients \p normals consistently by propagation along the minimum spanning
+/// tree of the Riemannian graph, made of the Delaunay edges of the points and
+/// their \p knn_indices neighbors. Follows the legacy implementation step by
+/// step, with the per point work done in parallel.
+template <typename scalar_t>
+void OrientNormalsConsistentTangentPlaneImpl(const scalar_t* points,
+                                             scalar_t* normals,
+                                             int64_t num_points,
+                                             const int64_t* tetras,
+                                             int64_t num_tetras,
+                                             const int64_t* knn_indices,
+                                             int64_t knn,
+                                             double lambda,
+                                             double cos_alpha_tol) {
+    auto edge_key = [num_points](int64_t v0, int64_t v1) {
+        return std::min(v0, v1) * num_points + std::max(v0, v1);
+    };
+    // Distance of v1 to the tangent plane of v0 and squared distance of v0
+    // and v1.
+    auto plane_distance = [&](int64_t v0, int64_t v1, double& dist2) {
+        double dot = 0;
+        dist2 = 0;
+        for (int i = 0; i < 3; ++i) {
+            const double diff = double(points[3 * v0 + i]) - points[3 * v1 + i];
+            dot += diff * normals[3 * v0 + i];
+            dist2 += diff * diff;
+        }
+        return std::abs(dot);
+    };
+    auto normal_weight = [&](int64_t v0, int64_t v1) {
+        double dot = 0;
+        for (int i = 0; i < 3; ++i) {
+            dot += double(normals[3 * v0 + i]) * normals[3 * v1 + i];
+        }
+        return 1.0 - std::abs(dot);
+    };
+
+    // Euclidean MST, which is a subgraph of the Delaunay triangulation.
+    static constexpr int kTetraEdges[6][2] = {{0, 1}, {0, 2}, {0, 3},
+                                              {1, 2}, {1, 3}, {2, 3}};
+    std::unordered_set<int64_t> graph_edges;
+    graph_edges.reserve(6 * num_tetras);
+    std::vector<WeightedEdge> delaunay_graph;
+    delaunay_graph.reserve(6 * num_tetras);
+    for (int64_t t = 0; t < num_tetras; ++t) {
+        for (const auto& e : kTetraEdges) {
+            const int64_t v0 = tetras[4 * t + e[0]];
+            const int64_t v1 = tetras[4 * t + e[1]];
+            if (graph_edges.insert(edge_key(v0, v1)).second) {
+                delaunay_graph.push_back({v0, v1, 0});
+            }
+        }
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t eidx = 0; eidx < int64_t(delaunay_graph.size()); ++eidx) {
+        WeightedEdge& edge = delaunay_graph[eidx];
+        double dist2;
+        const double normal_dist = plane_distance(edge.v0, edge.v1, dist2);
+        // If cos_alpha_tol < 1, edges forming an angle below the threshold
+        // with the tangent plane are excluded.
+        const double cos_alpha = normal_dist / std::sqrt(dist2);
+        edge.weight = cos_alpha > cos_alpha_tol
+                              ? std::numeric_limits<double>::infinity()
+                              : dist2;
+        edge.weight += lambda * normal_dist;
+    }
+    std::vector<WeightedEdge> graph = Kruskal(delaunay_graph, num_points);
+    for (WeightedEdge& edge : graph) {
+        edge.weight = normal_weight(edge.v0, edge.v1);
+    }
+
+    // Add the k nearest neighbors to the Riemannian graph.
+    std::vector<uint8_t> accepted(num_points * knn, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v0 = 0; v0 < num_points; ++v0) {
+        const int64_t* neighbors = knn_indices + v0 * knn;
+        double q3 = 0, iqr = 0;
+        if (lambda != 0) {
+            // Quartiles of the neighbor distances to the tangent plane, to
+            // reject outliers.
+            std::vector<double> dist_plane(knn);
+            double dist2;
+            for (int64_t k = 0; k < knn; ++k) {
+                dist_plane[k] = plane_distance(v0, neighbors[k], dist2);
+            }
+            std::sort(dist_plane.begin(), dist_plane.end());
+            const double q1 = dist_plane[int64_t(knn * 0.25)];
+            q3 = dist_plane[int64_t(knn * 0.75)];
+            iqr = q3 - q1;
+        }
+        for (int64_t k = 0; k < knn; ++k) {
+            const int64_t v1 = neighbors[k];
+            if (v1 == v0) {
+                continue;
+            }
+            double dist2;
+            const double normal_dist = plane_distance(v0, v1, dist2);
+            if (normal_dist / std::sqrt(dist2) > cos_alpha_tol) {
+                continue;
+            }
+            if (lambda != 0 && normal_dist > q3 + 1.5 * iqr) {
+                continue;
+            }
+            accepted[v0 * knn + k] = 1;
+        }
+    }
+    for (int64_t v0 = 0; v0 < num_points; ++v0) {
+        for (int64_t k = 0; k < knn; ++k) {
+            const int64_t v1 = knn_indices[v0 * knn + k];
+            if (accepted[v0 * knn + k] &&
+                graph_edges.insert(edge_key(v0, v1)).second) {
+                graph.push_back({v0, v1, normal_weight(v0, v1)});
+            }
+        }
+    }
+    const std::vector<WeightedEdge> mst = Kruskal(graph, num_points);
+
+    // Adjacency of the MST in compressed sparse row format.
+    std::vector<int64_t> row_splits(num_points + 1, 0);
+    for (const WeightedEdge& edge : mst) {
+        ++row_splits[edge.v0 + 1];
+        ++row_splits[edge.v1 + 1];
+    }
+    std::partial_sum(row_splits.begin(), row_splits.end(), row_splits.begin());
+    std::vector<int64_t> adjacency(row_splits.back());
+    std::vector<int64_t> fill(row_splits.begin(), row_splits.end() - 1);
+    for (const WeightedEdge& edge : mst) {
+        adjacency[fill[edge.v0]++] = edge.v1;
+        adjacency[fill[edge.v1]++] = edge.v0;
+    }
+
+    // Traverse the MST from the lowest point, whose normal points down.
+    int64_t root = 0;
+    for (int64_t idx = 1; idx < num_points; ++idx) {
+        if (points[3 * idx + 2] < points[3 * root + 2]) {
+            root = idx;
+        }
+    }
+    auto orient = [normals](const double* reference, int64_t idx) {
+        scalar_t* normal = normals + 3 * idx;
+        if (reference[0] * normal[0] + reference[1] * normal[1] +
+                    reference[2] * normal[2] <
+            0) {
+            normal[0] = -normal[0];
+            normal[1] = -normal[1];
+            normal[2] = -normal[2];
+        }
+    };
+    const double down[3] = {0, 0, -1};
+    orient(down, root);
+    std::vector<uint8_t> visited(num_points, 0);
+    std::vector<int64_t> queue{root};
+    visited[root] = 1;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const int64_t v0 = queue[head];
+        const double reference[3] = {double(normals[3 * v0 + 0]),
+                                     double(normals[3 * v0 + 1]),
+                                     double(normals[3 * v0 + 2])};
+        for (int64_t k = row_splits[v0]; k < row_splits[v0 + 1]; ++k) {
+            const int64_t v1 = adjacency[k];
+            if (!visited[v1]) {
+                visited[v1] = 1;
+                orient(reference, v1);
+                queue.push_back(v1);
+            }
+        }
+    }
+}
+
+/// Returns \p key shifted left by \p bits, 0 if all bits are shifted out.
+inline uint64_t ShiftLeft(uint64_t key, int bits) {
+    return bits >= 64 ? 0 : key << bits;
+}
+
+/// Number of bits needed to represent \p value.
+inline int NumBits(uint64_t value) {
+    int bits = 0;
+    while (bits < 64 && (value >> bits) != 0) {
+        ++bits;
+    }
+    return bits;
+}
+
+/// Stable parallel least significant digit radix sort of \p values by the
+/// lowest \p key_bits bits of \p keys.
+void RadixSortPairs(std::vector<uint64_t>& keys,
+                    std::vector<int64_t>& values,
+                    int key_bits) {
+    constexpr int kRadixBits = 8;
+    constexpr int64_t kRadix = int64_t(1) << kRadixBits;
+    const int64_t num_keys = int64_t(keys.size());
+    const int num_chunks = utility::EstimateMaxThreads();
+    const int64_t chunk_size =
+            std::max<int64_t>(1, (num_keys + num_chunks - 1) / num_chunks);
+    std::vector<uint64_t> keys_tmp(num_keys);
+    std::vector<int64_t> values_tmp(num_keys);
+    std::vector<int64_t> offsets(num_chunks * kRadix);
+    for (int shift = 0; shift < key_bits; shift += kRadixBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t begin = std::min(num_keys, chunk * chunk_size);
+            const int64_t end = std::min(num_keys, begin + chunk_size);
+            int64_t* histogram = offsets.data() + chunk * kRadix;
+            for (int64_t idx = begin; idx < end; ++idx) {
+                ++histogram[(keys[idx] >> shift) & (kRadix - 1)];
+            }
+        }
+
+        // Exclusive prefix sum in digit major order, so that every chunk
+        // writes its keys of a digit after the ones of the previous chunks.
+        int64_t total = 0;
+        bool single_digit = false;
+        for (int64_t digit = 0; digit < kRadix; ++digit) {
+            const int64_t digit_begin = total;
+            for (int chunk = 0; chunk < num_chunks; ++chunk) {
+                const int64_t count = offsets[chunk * kRadix + digit];
+                offsets[chunk * kRadix + digit] = total;
+                total += count;
+            }
+            single_digit |= total - digit_begin == num_keys;
+        }
+        // All keys share this digit, the pass would not reorder them.
+        if (single_digit) {
+            continue;
+        }
+
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t begin = std::min(num_keys, chunk * chunk_size);
+            const int64_t end = std::min(num_keys, begin + chunk_size);
+            int64_t* offset = offsets.data() + chunk * kRadix;
+            for (int64_t idx = begin; idx < end; ++idx) {
+                const int64_t digit = (keys[idx] >> shift) & (kRadix - 1);
+                const int64_t pos = offset[digit]++;
+                keys_tmp[pos] = keys[idx];
+                values_tmp[pos] = values[idx];
+            }
+        }
+        keys.swap(keys_tmp);
+        values.swap(values_tmp);
+    }
+}
+
+/// Groups the points into voxels of size \p voxel_size.
+///
+/// \p voxels receives the integer voxel coordinates of every point, \p order
+/// the point indices sorted by voxel and \p voxel_splits the offsets of the
+/// voxels in \p order. Voxel coordinates are packed into 64-bit keys and
+/// radix sorted when they fit, otherwise they are compared directly. Points
+/// of a voxel stay in increasing index order.
+template <typename scalar_t>
+void GroupPointsByVoxel(const scalar_t* points,
+                        int64_t num_points,
+                        double voxel_size,
+                        std::vector<int64_t>& voxels,
+                        std::vector<int64_t>& order,
+                        std::vector<int64_t>& voxel_splits) {
+    // Divide in the point precision, as the tensor implementation does.
+    const scalar_t voxel_size_t = static_cast<scalar_t>(voxel_size);
+    voxels.resize(3 * num_points);
+    const int num_chunks = utility::EstimateMaxThreads();
+    const int64_t chunk_size =
+            std::max<int64_t>(1, (num_points + num_chunks - 1) / num_chunks);
+    std::vector<int64_t> chunk_min(3 * num_chunks,
+                                   std::numeric_limits<int64_t>::max());
+    std::vector<int64_t> chunk_max(3 * num_chunks,
+                                   std::numeric_limits<int64_t>::min());
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        const int64_t begin = std::min(num_points, chunk * chunk_size);
+        const int64_t end = std::min(num_points, begin + chunk_size);
+        for (int64_t idx = begin; idx < end; ++idx) {
+            for (int i = 0; i < 3; ++i) {
+                const int64_t voxel = static_cast<int64_t>(
+                        std::floor(points[3 * idx + i] / voxel_size_t));
+                voxels[3 * idx + i] = voxel;
+                chunk_min[3 * chunk + i] =
+                        std::min(chunk_min[3 * chunk + i], voxel);
+                chunk_max[3 * chunk + i] =
+                        std::max(chunk_max[3 * chunk + i], voxel);
+            }
+        }
+    }
+    int64_t min_voxel[3], bits[3];
+    for (int i = 0; i < 3; ++i) {
+        min_voxel[i] = chunk_min[i];
+        int64_t max_voxel = chunk_max[i];
+        for (int chunk = 1; chunk < num_chunks; ++chunk) {
+            min_voxel[i] = std::min(min_voxel[i], chunk_min[3 * chunk + i]);
+            max_voxel = std::max(max_voxel, chunk_max[3 * chunk + i]);
+        }
+        bits[i] = NumBits(uint64_t(max_voxel) - uint64_t(min_voxel[i]));
+    }
+
+    order.resize(num_points);
+    std::iota(order.begin(), order.end(), 0);
+    voxel_splits.clear();
+    if (num_points == 0) {
+        voxel_splits.push_back(0);
+        return;
+    }
+    if (bits[0] + bits[1] + bits[2] <= 64) {
+        std::vector<uint64_t> keys(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t idx = 0; idx < num_points; ++idx) {
+            uint64_t key =
+                    uint64_t(voxels[3 * idx + 0]) - uint64_t(min_voxel[0]);
+            for (int i = 1; i < 3; ++i) {
+                key = ShiftLeft(key, int(bits[i])) |
+                      (uint64_t(voxels[3 * idx + i]) - uint64_t(min_voxel[i]));
+            }
+            keys[idx] = key;
+        }
+        RadixSortPairs(keys, order, int(bits[0] + bits[1] + bits[2]));
+        for (int64_t idx = 0; idx < num_points; ++idx) {
+            if (idx == 0 || keys[idx] != keys[idx - 1]) {
+                voxel_splits.push_back(idx);
+            }
+        }
+    } else {
+        auto voxel_less = [&voxels](int64_t a, int64_t b) {
+            return std::lexicographical_compare(
+                    voxels.begin() + 3 * a, voxels.begin() + 3 * a + 3,
+                    voxels.begin() + 3 * b, voxels.begin() + 3 * b + 3);
+        };
+        std::stable_sort(order.begin(), order.end(), voxel_less);
+        for (int64_t idx = 0; idx < num_points; ++idx) {
+            if (idx == 0 || voxel_less(order[idx - 1], order[idx])) {
+                voxel_splits.push_back(idx);
+            }
+        }
+    }
+    voxel_splits.push_back(num_points);
+}
+
+/// Reduces one attribute over the points of a voxel.
+class VoxelAttrReducer {
+public:
+    virtual ~VoxelAttrReducer() = default;
+
+    /// Writes the reduction over the \p count points \p indices of a voxel to
+    /// row \p voxel of the output. \p center is the point closest to the
+    /// voxel center and \p scratch a buffer owned by the calling thread.
+    virtual void Reduce(int64_t voxel,
+                        const int64_t* indices,
+                        int64_t count,
+                        int64_t center,
+                        std::vector<int64_t>& scratch) const = 0;
+};
+
+template <typename scalar_t>
+class VoxelAttrReducerImpl final : public VoxelAttrReducer {
+public:
+    VoxelAttrReducerImpl(const core::Tensor& attr,
+                         core::Tensor& voxel_attr,
+                         VoxelReduction reduction)
+        : src_(attr.GetDataPtr<scalar_t>()),
+          dst_(voxel_attr.GetDataPtr<scalar_t>()),
+          channels_(attr.GetLength() == 0
+                            ? 0
+                            : attr.NumElements() / attr.GetLength()),
+          reduction_(reduction) {}
+
+    void Reduce(int64_t voxel,
+                const int64_t* indices,
+                int64_t count,
+                int64_t center,
+                std::vector<int64_t>& scratch) const override {
+        scalar_t* dst = dst_ + voxel * channels_;
+        switch (reduction_) {
+            case VoxelReduction::Mean:
+                for (int64_t c = 0; c < channels_; ++c) {
+                    double sum = 0;
+                    for (int64_t k = 0; k < count; ++k) {
+                        sum += double(src_[indices[k] * channels_ + c]);
+                    }
+                    dst[c] = static_cast<scalar_t>(sum / double(count));
+                }
+                break;
+            case VoxelReduction::First:
+                std::copy(src_ + indices[0] * channels_,
+                          src_ + (indices[0] + 1) * channels_, dst);
+                break;
+            case VoxelReduction::Center:
+                std::copy(src_ + center * channels_,
+                          src_ + (center + 1) * channels_, dst);
+                break;
+            case VoxelReduction::Mode:
+                for (int64_t c = 0; c < channels_; ++c) {
+                    auto value = [this, c](int64_t idx) {
+                        return src_[idx * channels_ + c];
+                    };
+                    scratch.assign(indices, indices + count);
+                    std::sort(scratch.begin(), scratch.end(),
+                              [&value](int64_t a, int64_t b) {
+                                  return value(a) < value(b);
+                              });
+                    // The first of the longest runs has the smallest value.
+                    int64_t best_begin = 0, best_count = 0;
+                    for (int64_t begin = 0, end = 0; begin < count;
+                         begin = end) {
+                        while (end < count &&
+                               value(scratch[end]) == value(scratch[begin])) {
+                            ++end;
+                        }
+                        if (end - begin > best_count) {
+                            best_begin = begin;
+                            best_count = end - begin;
+                        }
+                    }
+                    dst[c] = value(scratch[best_begin]);
+                }
+                break;
+        }
+    }
+
+private:
+    const scalar_t* src_;
+    scalar_t* dst_;
+    int64_t channels_;
+    VoxelReduction reduction_;
+};
+
+/// Reduces all attributes voxel by voxel in a single parallel pass.
+template <typename scalar_t>
+void ReduceVoxels(
+        const scalar_t* points,
+        const std::vector<int64_t>& voxels,
+        double voxel_size,
+        const std::vector<int64_t>& order,
+        const std::vector<int64_t>& voxel_splits,
+        const std::vector<std::unique_ptr<VoxelAttrReducer>>& reducers,
+        bool find_center) {
+    const int64_t num_voxels = int64_t(voxel_splits.size()) - 1;
+    const int num_chunks = utility::EstimateMaxThreads();
+    const int64_t chunk_size =
+            std::max<int64_t>(1, (num_voxels + num_chunks - 1) / num_chunks);
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        const int64_t begin = std::min(num_voxels, chunk * chunk_size);
+        const int64_t end = std::min(num_voxels, begin + chunk_size);
+        std::vector<int64_t> scratch;
+        for (int64_t voxel = begin; voxel < end; ++voxel) {
+            const int64_t* indices = order.data() + voxel_splits[voxel];
+            const int64_t count = voxel_splits[voxel + 1] - voxel_splits[voxel];
+            int64_t center = indices[0];
+            if (find_center) {
+                double voxel_center[3];
+                for (int i = 0; i < 3; ++i) {
+                    voxel_center[i] =
+                            (double(voxels[3 * indices[0] + i]) + 0.5) *
+                            voxel_size;
+                }
+                double min_dist2 = std::numeric_limits<double>::infinity();
+                for (int64_t k = 0; k < count; ++k) {
+                    double dist2 = 0;
+                    for (int i = 0; i < 3; ++i) {
+                        const double diff =
+                                double(points[3 * indices[k] + i]) -
+                                voxel_center[i];
+                        dist2 += diff * diff;
+                    }
+                    if (dist2 < min_dist2) {
+                        min_dist2 = dist2;
+                        center = indices[k];
+                    }
+                }
+            }
+            for (const auto& reducer : reducers) {
+                reducer->Reduce(voxel, indices, count, center, scratch);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+void FarthestPointDownSampleCPU(const core::Tensor& points,
+                                const core::Tensor& row_splits,
+                                int64_t num_samples,
+                                core::Tensor& indices) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        FarthestPointDownSampleBatches(points.GetDataPtr<scalar_t>(),
+                                       row_splits.GetDataPtr<int64_t>(),
+                                       row_splits.GetLength() - 1, num_samples,
+                                       indices.GetDataPtr<int64_t>());
+    });
+}
+
+void ClusterDBSCANCPU(const core::Tensor& neighbors_index,
+                      const core::Tensor& neighbors_row_splits,
+                      size_t min_points,
+                      core::Tensor& labels,
+                      bool print_progress) {
+    const int64_t num_points = neighbors_row_splits.GetLength() - 1;
+    if (neighbors_index.GetDtype() == core::Int32) {
+        ClusterDBSCANImpl(neighbors_index.GetDataPtr<int32_t>(),
+                          neighbors_row_splits.GetDataPtr<int64_t>(),
+                          num_points, int64_t(min_points),
+                          labels.GetDataPtr<int32_t>(), print_progress);
+    } else {
+        ClusterDBSCANImpl(neighbors_index.GetDataPtr<int64_t>(),
+                          neighbors_row_splits.GetDataPtr<int64_t>(),
+                          num_points, int64_t(min_points),
+                          labels.GetDataPtr<int32_t>(), print_progress);
+    }
+}
+
+void OrientNormalsConsistentTangentPlaneCPU(const core::Tensor& points,
+                                            core::Tensor& normals,
+                                            const core::Tensor& tetras,
+                                            const core::Tensor& knn_indices,
+                                            double lambda,
+                                            double cos_alpha_tol) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        OrientNormalsConsistentTangentPlaneImpl(
+                points.GetDataPtr<scalar_t>(), normals.GetDataPtr<scalar_t>(),
+                points.GetLength(), tetras.GetDataPtr<int64_t>(),
+                tetras.GetLength(), knn_indices.GetDataPtr<int64_t>(),
+                knn_indices.GetShape(1), lambda, cos_alpha_tol);
+    });
+}
+
+void VoxelDownSampleCPU(const core::Tensor& points,
+                        double voxel_size,
+                        const std::vector<core::Tensor>& attrs,
+                        const std::vector<VoxelReduction>& reductions,
+                        std::vector<core::Tensor>& voxel_attrs) {
+    const int64_t num_points = points.GetLength();
+    std::vector<int64_t> voxels, order, voxel_splits;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        GroupPointsByVoxel(points.GetDataPtr<scalar_t>(), num_points,
+                           voxel_size, voxels, order, voxel_splits);
+    });
+    const int64_t num_voxels = int64_t(voxel_splits.size()) - 1;
+
+    voxel_attrs.clear();
+    std::vector<std::unique_ptr<VoxelAttrReducer>> reducers;
+    for (size_t a = 0; a < attrs.size(); ++a) {
+        core::SizeVector shape = attrs[a].GetShape();
+        shape[0] = num_voxels;
+        voxel_attrs.push_back(core::Tensor::Empty(shape, attrs[a].GetDtype(),
+                                                  attrs[a].GetDevice()));
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(attrs[a].GetDtype(), [&]() {
+            reducers.emplace_back(new VoxelAttrReducerImpl<scalar_t>(
+                    attrs[a], voxel_attrs[a], reductions[a]));
+        });
+    }
+    const bool find_center =
+            std::find(reductions.begin(), reductions.end(),
+                      VoxelReduction::Center) != reductions.end();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        ReduceVoxels(points.GetDataPtr<scalar_t>(), voxels, voxel_size, order,
+                     voxel_splits, reducers, find_center);
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
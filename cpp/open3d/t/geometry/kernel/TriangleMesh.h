@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 
 namespace open3d {
@@ -29,6 +31,120 @@ void ComputeTriangleAreasCPU(const core::Tensor& vertices,
                              const core::Tensor& triangles,
                              core::Tensor& triangle_areas);
 
+void ComputeLaplacianFilterCPU(const core::Tensor& row_splits,
+                               const core::Tensor& col_idx,
+                               const core::Tensor& positions,
+                               double lambda_filter,
+                               core::Tensor& weights,
+                               core::Tensor& diag_scale,
+                               core::Tensor& neighbour_scale);
+
+void FilterVertexAttrCPU(const core::Tensor& row_splits,
+                         const core::Tensor& col_idx,
+                         const core::Tensor& weights,
+                         const core::Tensor& diag_scale,
+                         const core::Tensor& neighbour_scale,
+                         const core::Tensor& input,
+                         core::Tensor& output);
+
+/// Samples \p number_of_points points on the triangles with probability
+/// proportional to \p triangle_areas. Every tensor in \p vertex_attrs is
+/// interpolated with the barycentric coordinates of the samples, every
+/// tensor in \p triangle_attrs is copied from the sampled triangle.
+void SamplePointsUniformlyCPU(const core::Tensor& triangles,
+                              const core::Tensor& triangle_areas,
+                              int64_t number_of_points,
+                              const std::vector<core::Tensor>& vertex_attrs,
+                              const std::vector<core::Tensor>& triangle_attrs,
+                              std::vector<core::Tensor>& vertex_samples,
+                              std::vector<core::Tensor>& triangle_samples);
+
+/// Weighted sample elimination (Yuksel, 2015) on the neighbours of the samples
+/// within \p r_max, given as radius search result with squared distances.
+/// Sets \p mask to the \p number_of_points samples that are kept.
+void SampleEliminationCPU(const core::Tensor& neighbors_index,
+                          const core::Tensor& neighbors_distance2,
+                          const core::Tensor& neighbors_row_splits,
+                          int64_t number_of_points,
+                          double r_min,
+                          double r_max,
+                          core::Tensor& mask);
+
+/// One step of Loop subdivision. \p edge_buf_indices holds a unique id of
+/// every triangle edge (v0, v1), (v1, v2), (v2, v0), such as the buffer index
+/// of the ordered edge in a hash set. Sets \p new_triangles and the sparse
+/// matrix in CSR format that maps the old vertex attributes to the new ones,
+/// in the form expected by FilterVertexAttrCPU with the edge vertices
+/// appended to the input.
+void SubdivideLoopCPU(const core::Tensor& triangles,
+                      const core::Tensor& edge_buf_indices,
+                      int64_t num_vertices,
+                      core::Tensor& new_triangles,
+                      core::Tensor& row_splits,
+                      core::Tensor& col_idx,
+                      core::Tensor& weights,
+                      core::Tensor& diag_scale,
+                      core::Tensor& neighbour_scale);
+
+/// Clusters triangles that share an edge, with \p edge_buf_indices as in
+/// SubdivideLoopCPU. Clusters are numbered by their smallest triangle index.
+void ClusterConnectedTrianglesCPU(const core::Tensor& edge_buf_indices,
+                                  const core::Tensor& triangle_areas,
+                                  core::Tensor& triangle_clusters,
+                                  core::Tensor& cluster_n_triangles,
+                                  core::Tensor& cluster_area);
+
+/// Numbers the distinct values of \p buf_indices, such as hash set buffer
+/// indices, in order of their first appearance. Sets \p ids to the number of
+/// every entry and \p first to the position of the first entry of every
+/// number.
+void UniqueBufIndicesCPU(const core::Tensor& buf_indices,
+                         core::Tensor& ids,
+                         core::Tensor& first);
+
+/// Clips the triangles to the side of a plane with non-negative signed
+/// \p distances of the vertices. \p crossing_triangles are the triangles with
+/// vertices on both sides and \p edge_buf_indices the ids of their edges as in
+/// SubdivideLoopCPU. Every output vertex interpolates the input vertices
+/// \p vertex_sources with weight 1 - w and w, where the first source lies on
+/// the kept side. \p triangle_parents are the input triangles of the output
+/// triangles.
+void ClipPlaneCPU(const core::Tensor& triangles,
+                  const core::Tensor& distances,
+                  const core::Tensor& crossing_triangles,
+                  const core::Tensor& edge_buf_indices,
+                  core::Tensor& clipped_triangles,
+                  core::Tensor& triangle_parents,
+                  core::Tensor& vertex_sources,
+                  core::Tensor& vertex_weights);
+
+/// Intersects the triangles with the level sets of the vertex \p distances at
+/// \p contour_values. Every segment gives two consecutive cut points. A cut
+/// point interpolates \p cut_sources like ClipPlaneCPU and its key of an edge
+/// or a vertex and the contour index is shared by neighbouring triangles.
+void SlicePlaneCPU(const core::Tensor& triangles,
+                   const core::Tensor& distances,
+                   const std::vector<double>& contour_values,
+                   core::Tensor& cut_keys,
+                   core::Tensor& cut_sources,
+                   core::Tensor& cut_weights);
+
+/// Quadric error edge collapse down to \p target_number_of_triangles, with
+/// \p edge_buf_indices as in SubdivideLoopCPU. \p vertex_indices are the
+/// input vertices kept as output vertices, \p vertex_map is the output vertex
+/// every input vertex was merged into and \p triangle_parents are the input
+/// triangles of the output triangles.
+void SimplifyQuadricDecimationCPU(const core::Tensor& vertices,
+                                  const core::Tensor& triangles,
+                                  const core::Tensor& edge_buf_indices,
+                                  int64_t target_number_of_triangles,
+                                  bool preserve_volume,
+                                  core::Tensor& new_vertices,
+                                  core::Tensor& new_triangles,
+                                  core::Tensor& vertex_indices,
+                                  core::Tensor& vertex_map,
+                                  core::Tensor& triangle_parents);
+
 #ifdef BUILD_CUDA_MODULE
 void NormalizeNormalsCUDA(core::Tensor& normals);
 
@@ -43,6 +159,22 @@ void ComputeVertexNormalsCUDA(const core::Tensor& triangles,
 void ComputeTriangleAreasCUDA(const core::Tensor& vertices,
                               const core::Tensor& triangles,
                               core::Tensor& triangle_areas);
+
+void ComputeLaplacianFilterCUDA(const core::Tensor& row_splits,
+                                const core::Tensor& col_idx,
+                                const core::Tensor& positions,
+                                double lambda_filter,
+                                core::Tensor& weights,
+                                core::Tensor& diag_scale,
+                                core::Tensor& neighbour_scale);
+
+void FilterVertexAttrCUDA(const core::Tensor& row_splits,
+                          const core::Tensor& col_idx,
+                          const core::Tensor& weights,
+                          const core::Tensor& diag_scale,
+                          const core::Tensor& neighbour_scale,
+                          const core::Tensor& input,
+                          core::Tensor& output);
 #endif
 
 }  // namespace trianglemesh
@@ -5,7 +5,24 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "open3d/t/geometry/kernel/TriangleMeshImpl.h"
+#include "open3d/t/geometry/kernel/UnionFind.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
+#include "open3d/utility/Random.h"
 
 namespace open3d {
 namespace t {
@@ -13,6 +30,588 @@ namespace geometry {
 namespace kernel {
 namespace trianglemesh {
 
+namespace {
+
+/// Number of points sampled with one random engine. The samples only depend
+/// on the global seed and not on the number of threads.
+constexpr int64_t kSampleChunkSize = 4096;
+
+/// Barycentric interpolation of a vertex attribute at the sampled points.
+template <typename scalar_t>
+void InterpolateVertexAttr(const scalar_t* attr,
+                           int64_t channels,
+                           const int64_t* triangles,
+                           const int64_t* triangle_ids,
+                           const double* barycentric,
+                           int64_t num_points,
+                           scalar_t* out) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        const int64_t* triangle = triangles + 3 * triangle_ids[i];
+        const double* w = barycentric + 3 * i;
+        for (int64_t c = 0; c < channels; ++c) {
+            out[i * channels + c] = static_cast<scalar_t>(
+                    w[0] * attr[triangle[0] * channels + c] +
+                    w[1] * attr[triangle[1] * channels + c] +
+                    w[2] * attr[triangle[2] * channels + c]);
+        }
+    }
+}
+
+/// Counting sort of \p keys in [0, num_keys). Returns the CSR row splits and
+/// fills \p order with the positions of the keys, stable within each row.
+std::vector<int64_t> CountingSort(const std::vector<int64_t>& keys,
+                                  int64_t num_keys,
+                                  std::vector<int64_t>& order) {
+    std::vector<int64_t> splits(num_keys + 1, 0);
+    for (int64_t key : keys) {
+        ++splits[key + 1];
+    }
+    std::partial_sum(splits.begin(), splits.end(), splits.begin());
+    std::vector<int64_t> fill(splits.begin(), splits.end() - 1);
+    order.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        order[fill[keys[i]]++] = int64_t(i);
+    }
+    return splits;
+}
+
+/// Weighted sample elimination on the precomputed neighbours within r_max.
+/// The weight of a sample sums \f$(1 - d / r_{max})^8\f$ over its remaining
+/// neighbours, with \f$d\f$ clamped to \f$r_{min}\f$, and the sample with the
+/// largest weight is removed until \p number_of_points samples remain. The
+/// weights of the neighbours of a removed sample are updated in place.
+template <typename index_t>
+void SampleEliminationImpl(const index_t* neighbors_index,
+                           const double* neighbors_distance2,
+                           const int64_t* neighbors_row_splits,
+                           int64_t num_samples,
+                           int64_t number_of_points,
+                           double r_min,
+                           double r_max,
+                           bool* mask) {
+    auto weight_fn = [r_min, r_max](double d2) {
+        const double d = std::max(std::sqrt(d2), r_min);
+        return std::pow(1 - d / r_max, 8);
+    };
+
+    std::vector<double> weights(num_samples, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_samples; ++i) {
+        for (int64_t k = neighbors_row_splits[i];
+             k < neighbors_row_splits[i + 1]; ++k) {
+            if (int64_t(neighbors_index[k]) != i) {
+                weights[i] += weight_fn(neighbors_distance2[k]);
+            }
+        }
+        mask[i] = true;
+    }
+
+    typedef std::pair<double, int64_t> QueueEntry;
+    std::vector<QueueEntry> entries(num_samples);
+    for (int64_t i = 0; i < num_samples; ++i) {
+        entries[i] = QueueEntry(weights[i], i);
+    }
+    std::priority_queue<QueueEntry> queue(std::less<QueueEntry>(),
+                                          std::move(entries));
+    int64_t num_remaining = num_samples;
+    while (num_remaining > number_of_points && !queue.empty()) {
+        const QueueEntry entry = queue.top();
+        queue.pop();
+        const int64_t idx = entry.second;
+        // Skip entries that were reinserted with a smaller weight.
+        if (!mask[idx] || entry.first != weights[idx]) {
+            continue;
+        }
+        mask[idx] = false;
+        --num_remaining;
+        for (int64_t k = neighbors_row_splits[idx];
+             k < neighbors_row_splits[idx + 1]; ++k) {
+            const int64_t nb = int64_t(neighbors_index[k]);
+            if (nb != idx && mask[nb]) {
+                weights[nb] -= weight_fn(neighbors_distance2[k]);
+                queue.push(QueueEntry(weights[nb], nb));
+            }
+        }
+    }
+}
+
+/// Numbers the distinct \p keys in [0, num_keys) in order of their first
+/// appearance, skipping entries with \p valid false if \p valid is not null.
+/// Sets \p ids to the number of every entry (-1 if skipped) and \p first to
+/// the position of the first entry of every number.
+void UniqueKeys(const int64_t* keys,
+                const uint8_t* valid,
+                int64_t n,
+                int64_t num_keys,
+                std::vector<int64_t>& ids,
+                std::vector<int64_t>& first) {
+    std::vector<std::atomic<int64_t>> key_first(num_keys);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t key = 0; key < num_keys; ++key) {
+        key_first[key].store(n, std::memory_order_relaxed);
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        if (valid != nullptr && !valid[i]) {
+            continue;
+        }
+        std::atomic<int64_t>& slot = key_first[keys[i]];
+        int64_t current = slot.load(std::memory_order_relaxed);
+        while (i < current && !slot.compare_exchange_weak(current, i)) {
+        }
+    }
+
+    std::vector<int64_t> is_first(n), ranks(n);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        is_first[i] = (valid == nullptr || valid[i]) &&
+                      key_first[keys[i]].load(std::memory_order_relaxed) == i;
+    }
+    utility::InclusivePrefixSum(is_first.data(), is_first.data() + n,
+                                ranks.data());
+    first.resize(n > 0 ? ranks.back() : 0);
+    ids.resize(n);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        if (valid != nullptr && !valid[i]) {
+            ids[i] = -1;
+            continue;
+        }
+        ids[i] = ranks[key_first[keys[i]].load(std::memory_order_relaxed)] - 1;
+        if (is_first[i]) {
+            first[ids[i]] = i;
+        }
+    }
+}
+
+/// Exclusive prefix sum of \p counts. Returns the total.
+int64_t ExclusivePrefixSum(const std::vector<int64_t>& counts,
+                           std::vector<int64_t>& offsets) {
+    offsets.resize(counts.size() + 1);
+    offsets[0] = 0;
+    utility::InclusivePrefixSum(counts.data(), counts.data() + counts.size(),
+                                offsets.data() + 1);
+    return offsets.back();
+}
+
+/// Error quadric of the squared distance to a set of planes, see Garland and
+/// Heckbert, "Surface Simplification Using Quadric Error Metrics", 1997.
+struct Quadric {
+    Eigen::Matrix3d A = Eigen::Matrix3d::Zero();
+    Eigen::Vector3d b = Eigen::Vector3d::Zero();
+    double c = 0;
+
+    Quadric() = default;
+
+    Quadric(const Eigen::Vector3d& normal, double offset, double weight)
+        : A(weight * normal * normal.transpose()),
+          b(weight * offset * normal),
+          c(weight * offset * offset) {}
+
+    Quadric& operator+=(const Quadric& other) {
+        A += other.A;
+        b += other.b;
+        c += other.c;
+        return *this;
+    }
+
+    double Eval(const Eigen::Vector3d& v) const {
+        return v.dot(A * v) + 2 * b.dot(v) + c;
+    }
+};
+
+/// Serial edge collapse state of SimplifyQuadricDecimationCPU. The quadrics,
+/// adjacency and initial edge costs are set up in parallel.
+class QuadricDecimation {
+public:
+    QuadricDecimation(const double* vertices,
+                      const int64_t* triangles,
+                      const int64_t* edge_buf_indices,
+                      int64_t num_vertices,
+                      int64_t num_triangles,
+                      bool preserve_volume)
+        : positions_(num_vertices),
+          triangles_(triangles, triangles + 3 * num_triangles),
+          vertex_triangles_(num_vertices),
+          quadrics_(num_vertices),
+          vertex_deleted_(num_vertices, false),
+          triangle_deleted_(num_triangles, false),
+          merged_into_(num_vertices),
+          preserve_volume_(preserve_volume),
+          num_triangles_(num_triangles) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < num_vertices; ++v) {
+            positions_[v] = Eigen::Map<const Eigen::Vector3d>(vertices + 3 * v);
+            merged_into_[v] = v;
+        }
+
+        // Triangles of every vertex.
+        std::vector<int64_t> corner_triangles;
+        const std::vector<int64_t> vertex_splits =
+                CountingSort(triangles_, num_vertices, corner_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < num_vertices; ++v) {
+            for (int64_t k = vertex_splits[v]; k < vertex_splits[v + 1]; ++k) {
+                vertex_triangles_[v].push_back(corner_triangles[k] / 3);
+            }
+        }
+
+        // Edges with a single triangle are boundary edges.
+        const int64_t num_slots =
+                num_triangles > 0
+                        ? *std::max_element(edge_buf_indices,
+                                            edge_buf_indices +
+                                                    3 * num_triangles) +
+                                  1
+                        : 0;
+        std::vector<std::atomic<int64_t>> slot_triangles(num_slots);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t slot = 0; slot < num_slots; ++slot) {
+            slot_triangles[slot].store(0, std::memory_order_relaxed);
+        }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < 3 * num_triangles; ++i) {
+            slot_triangles[edge_buf_indices[i]].fetch_add(
+                    1, std::memory_order_relaxed);
+        }
+
+        // Every vertex gathers the area weighted planes of its triangles and
+        // the planes perpendicular to its boundary edges.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < num_vertices; ++v) {
+            for (int64_t t : vertex_triangles_[v]) {
+                const Eigen::Vector3d& p0 = positions_[triangles_[3 * t]];
+                const Eigen::Vector3d& p1 = positions_[triangles_[3 * t + 1]];
+                const Eigen::Vector3d& p2 = positions_[triangles_[3 * t + 2]];
+                Eigen::Vector3d normal = (p1 - p0).cross(p2 - p0);
+                const double area = 0.5 * normal.norm();
+                if (area == 0) {
+                    continue;
+                }
+                normal.normalize();
+                quadrics_[v] += Quadric(normal, -normal.dot(p0), area);
+
+                for (int j = 0; j < 3; ++j) {
+                    const int64_t a = triangles_[3 * t + j];
+                    const int64_t b = triangles_[3 * t + (j + 1) % 3];
+                    if ((a != v && b != v) ||
+                        slot_triangles[edge_buf_indices[3 * t + j]].load(
+                                std::memory_order_relaxed) != 1) {
+                        continue;
+                    }
+                    Eigen::Vector3d perp =
+                            (positions_[b] - positions_[a]).cross(normal);
+                    if (perp.norm() == 0) {
+                        continue;
+                    }
+                    perp.normalize();
+                    quadrics_[v] +=
+                            Quadric(perp, -perp.dot(positions_[a]), area);
+                }
+            }
+        }
+
+        // Initial costs of the unique edges.
+        std::vector<int64_t> edge_ids, edge_first;
+        UniqueKeys(edge_buf_indices, nullptr, 3 * num_triangles, num_slots,
+                   edge_ids, edge_first);
+        std::vector<Entry> entries(edge_first.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t e = 0; e < int64_t(edge_first.size()); ++e) {
+            const int64_t corner = edge_first[e];
+            const int64_t a = triangles_[corner];
+            const int64_t b =
+                    triangles_[corner - corner % 3 + (corner + 1) % 3];
+            entries[e] = Entry(Cost(std::min(a, b), std::max(a, b)).first,
+                               std::min(a, b), std::max(a, b));
+        }
+        queue_ = std::priority_queue<Entry, std::vector<Entry>, EntryGreater>(
+                EntryGreater(), std::move(entries));
+    }
+
+    /// Collapses edges in order of their cost until at most
+    /// \p target_number_of_triangles remain or no edge can be collapsed.
+    void Run(int64_t target_number_of_triangles) {
+        while (num_triangles_ > target_number_of_triangles && !queue_.empty()) {
+            double cost;
+            int64_t v0, v1;
+            std::tie(cost, v0, v1) = queue_.top();
+            queue_.pop();
+            if (vertex_deleted_[v0] || vertex_deleted_[v1]) {
+                continue;
+            }
+            const std::pair<double, Eigen::Vector3d> cost_vbar = Cost(v0, v1);
+            if (cost_vbar.first != cost) {
+                // The neighbourhood changed since the edge was queued.
+                queue_.push(Entry(cost_vbar.first, v0, v1));
+                continue;
+            }
+            if (CreatesInvalidTriangle(v0, v1, cost_vbar.second)) {
+                continue;
+            }
+            Collapse(v0, v1, cost_vbar.second);
+        }
+    }
+
+    /// Sets the remaining vertices and triangles. \p vertex_map maps every
+    /// input vertex to the output vertex it was merged into and
+    /// \p vertex_indices holds the input index of every output vertex.
+    void GetResult(core::Tensor& vertices,
+                   core::Tensor& triangles,
+                   core::Tensor& vertex_indices,
+                   core::Tensor& vertex_map,
+                   core::Tensor& triangle_parents) const {
+        const int64_t num_vertices = int64_t(positions_.size());
+        const int64_t num_triangles = int64_t(triangle_deleted_.size());
+        std::vector<int64_t> vertex_alive(num_vertices), vertex_offsets;
+        std::vector<int64_t> triangle_alive(num_triangles), triangle_offsets;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < num_vertices; ++v) {
+            vertex_alive[v] = !vertex_deleted_[v];
+        }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t t = 0; t < num_triangles; ++t) {
+            triangle_alive[t] = !triangle_deleted_[t];
+        }
+        const int64_t num_out_vertices =
+                ExclusivePrefixSum(vertex_alive, vertex_offsets);
+        const int64_t num_out_triangles =
+                ExclusivePrefixSum(triangle_alive, triangle_offsets);
+
+        // Collapses were recorded in order, so the target of a later collapse
+        // is resolved before the vertex merged into it.
+        std::vector<int64_t> root(merged_into_);
+        for (auto it = collapses_.rbegin(); it != collapses_.rend(); ++it) {
+            root[*it] = root[merged_into_[*it]];
+        }
+
+        vertices = core::Tensor::Empty({num_out_vertices, 3}, core::Float64);
+        vertex_indices = core::Tensor::Empty({num_out_vertices}, core::Int64);
+        vertex_map = core::Tensor::Empty({num_vertices}, core::Int64);
+        double* vertex_ptr = vertices.GetDataPtr<double>();
+        int64_t* vertex_index_ptr = vertex_indices.GetDataPtr<int64_t>();
+        int64_t* vertex_map_ptr = vertex_map.GetDataPtr<int64_t>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < num_vertices; ++v) {
+            vertex_map_ptr[v] = vertex_offsets[root[v]];
+            if (vertex_alive[v]) {
+                Eigen::Map<Eigen::Vector3d>(vertex_ptr +
+                                            3 * vertex_offsets[v]) =
+                        positions_[v];
+                vertex_index_ptr[vertex_offsets[v]] = v;
+            }
+        }
+
+        triangles = core::Tensor::Empty({num_out_triangles, 3}, core::Int64);
+        triangle_parents =
+                core::Tensor::Empty({num_out_triangles}, core::Int64);
+        int64_t* triangle_ptr = triangles.GetDataPtr<int64_t>();
+        int64_t* parent_ptr = triangle_parents.GetDataPtr<int64_t>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t t = 0; t < num_triangles; ++t) {
+            if (triangle_alive[t]) {
+                const int64_t out = triangle_offsets[t];
+                for (int j = 0; j < 3; ++j) {
+                    triangle_ptr[3 * out + j] =
+                            vertex_offsets[triangles_[3 * t + j]];
+                }
+                parent_ptr[out] = t;
+            }
+        }
+    }
+
+private:
+    typedef std::tuple<double, int64_t, int64_t> Entry;
+    struct EntryGreater {
+        bool operator()(const Entry& a, const Entry& b) const {
+            return std::get<0>(a) > std::get<0>(b);
+        }
+    };
+
+    bool HasVertex(int64_t t, int64_t v) const {
+        return triangles_[3 * t] == v || triangles_[3 * t + 1] == v ||
+               triangles_[3 * t + 2] == v;
+    }
+
+    /// Cost and position of the vertex that replaces the edge (v0, v1). With
+    /// volume preservation the position is constrained to keep the signed
+    /// volume enclosed by the triangles around the edge.
+    std::pair<double, Eigen::Vector3d> Cost(int64_t v0, int64_t v1) const {
+        Quadric quadric = quadrics_[v0];
+        quadric += quadrics_[v1];
+
+        if (preserve_volume_) {
+            // Moving vertex m of triangle (m, p, q) to x changes its volume
+            // term to x . (p x q). Triangles with both vertices vanish.
+            Eigen::Vector3d gradient = Eigen::Vector3d::Zero();
+            double volume = 0;
+            for (int64_t v : {v0, v1}) {
+                for (int64_t t : vertex_triangles_[v]) {
+                    if (triangle_deleted_[t] || (v == v1 && HasVertex(t, v0))) {
+                        continue;
+                    }
+                    const bool collapsed = HasVertex(t, v0) && HasVertex(t, v1);
+                    for (int j = 0; j < 3; ++j) {
+                        if (triangles_[3 * t + j] != v) {
+                            continue;
+                        }
+                        const Eigen::Vector3d pq =
+                                positions_[triangles_[3 * t + (j + 1) % 3]]
+                                        .cross(positions_[triangles_
+                                                                  [3 * t +
+                                                                   (j + 2) %
+                                                                           3]]);
+                        volume += positions_[v].dot(pq);
+                        if (!collapsed) {
+                            gradient += pq;
+                        }
+                    }
+                }
+            }
+            if (gradient.squaredNorm() > 0) {
+                Eigen::Matrix4d kkt;
+                kkt << quadric.A, gradient, gradient.transpose(), 0;
+                Eigen::Vector4d rhs;
+                rhs << -quadric.b, volume;
+                const Eigen::FullPivLU<Eigen::Matrix4d> lu(kkt);
+                if (lu.isInvertible()) {
+                    const Eigen::Vector3d vbar = lu.solve(rhs).head<3>();
+                    return std::make_pair(quadric.Eval(vbar), vbar);
+                }
+            }
+        }
+
+        if (std::fabs(quadric.A.determinant()) > 1e-4) {
+            const Eigen::Vector3d vbar = -quadric.A.ldlt().solve(quadric.b);
+            return std::make_pair(quadric.Eval(vbar), vbar);
+        }
+        const Eigen::Vector3d& p0 = positions_[v0];
+        const Eigen::Vector3d& p1 = positions_[v1];
+        const Eigen::Vector3d mid = (p0 + p1) / 2;
+        const double cost0 = quadric.Eval(p0);
+        const double cost1 = quadric.Eval(p1);
+        const double cost_mid = quadric.Eval(mid);
+        const double cost = std::min(cost0, std::min(cost1, cost_mid));
+        return std::make_pair(cost, cost == cost_mid ? mid
+                                    : cost == cost0  ? p0
+                                                     : p1);
+    }
+
+    /// True if moving v0 and v1 to \p vbar flips a triangle, makes one
+    /// degenerate or joins two triangles along a third edge.
+    bool CreatesInvalidTriangle(int64_t v0,
+                                int64_t v1,
+                                const Eigen::Vector3d& vbar) const {
+        const double degenerate_ratio_threshold = 0.001;
+        std::unordered_map<int64_t, int> vertex_count;
+        for (int64_t v : {v1, v0}) {
+            for (int64_t t : vertex_triangles_[v]) {
+                if (triangle_deleted_[t] ||
+                    (HasVertex(t, v0) && HasVertex(t, v1))) {
+                    continue;
+                }
+                Eigen::Vector3d p[3];
+                for (int j = 0; j < 3; ++j) {
+                    p[j] = positions_[triangles_[3 * t + j]];
+                }
+                const Eigen::Vector3d normal_before =
+                        (p[1] - p[0]).cross(p[2] - p[0]);
+                for (int j = 0; j < 3; ++j) {
+                    const int64_t u = triangles_[3 * t + j];
+                    if (u == v) {
+                        p[j] = vbar;
+                    } else if (vertex_count[u]++ >= 2) {
+                        return true;
+                    }
+                }
+                const Eigen::Vector3d normal_after =
+                        (p[1] - p[0]).cross(p[2] - p[0]);
+                if (normal_before.dot(normal_after) < 0 ||
+                    normal_after.norm() <
+                            degenerate_ratio_threshold * normal_before.norm()) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /// Merges v1 into v0 at \p vbar and requeues the edges around v0.
+    void Collapse(int64_t v0, int64_t v1, const Eigen::Vector3d& vbar) {
+        for (int64_t t : vertex_triangles_[v1]) {
+            if (triangle_deleted_[t]) {
+                continue;
+            }
+            if (HasVertex(t, v0)) {
+                triangle_deleted_[t] = true;
+                --num_triangles_;
+                continue;
+            }
+            for (int j = 0; j < 3; ++j) {
+                if (triangles_[3 * t + j] == v1) {
+                    triangles_[3 * t + j] = v0;
+                }
+            }
+            vertex_triangles_[v0].push_back(t);
+        }
+        vertex_triangles_[v1].clear();
+        positions_[v0] = vbar;
+        quadrics_[v0] += quadrics_[v1];
+        vertex_deleted_[v1] = true;
+        merged_into_[v1] = v0;
+        collapses_.push_back(v1);
+
+        for (int64_t t : vertex_triangles_[v0]) {
+            if (triangle_deleted_[t]) {
+                continue;
+            }
+            for (int j = 0; j < 3; ++j) {
+                if (triangles_[3 * t + j] == v0) {
+                    PushEdge(v0, triangles_[3 * t + (j + 1) % 3]);
+                    PushEdge(v0, triangles_[3 * t + (j + 2) % 3]);
+                }
+            }
+        }
+    }
+
+    void PushEdge(int64_t a, int64_t b) {
+        const int64_t v0 = std::min(a, b);
+        const int64_t v1 = std::max(a, b);
+        queue_.push(Entry(Cost(v0, v1).first, v0, v1));
+    }
+
+    std::vector<Eigen::Vector3d> positions_;
+    std::vector<int64_t> triangles_;
+    std::vector<std::vector<int64_t>> vertex_triangles_;
+    std::vector<Quadric> quadrics_;
+    std::vector<bool> vertex_deleted_;
+    std::vector<bool> triangle_deleted_;
+    std::vector<int64_t> merged_into_;
+    std::vector<int64_t> collapses_;
+    std::priority_queue<Entry, std::vector<Entry>, EntryGreater> queue_;
+    bool preserve_volume_;
+    int64_t num_triangles_;
+};
+
+}  // namespace
+
 void ComputeVertexNormalsCPU(const core::Tensor& triangles,
                              const core::Tensor& triangle_normals,
                              core::Tensor& vertex_normals) {
@@ -49,6 +648,628 @@ void ComputeVertexNormalsCPU(const core::Tensor& triangles,
     });
 }
 
+void SamplePointsUniformlyCPU(const core::Tensor& triangles,
+                              const core::Tensor& triangle_areas,
+                              int64_t number_of_points,
+                              const std::vector<core::Tensor>& vertex_attrs,
+                              const std::vector<core::Tensor>& triangle_attrs,
+                              std::vector<core::Tensor>& vertex_samples,
+                              std::vector<core::Tensor>& triangle_samples) {
+    const core::Tensor triangles_d = triangles.To(core::Int64).Contiguous();
+    const core::Tensor areas_d = triangle_areas.To(core::Float64).Contiguous();
+    const int64_t num_triangles = triangles_d.GetLength();
+    const int64_t* triangle_ptr = triangles_d.GetDataPtr<int64_t>();
+    const double* area_ptr = areas_d.GetDataPtr<double>();
+
+    // Triangles are drawn by bisecting the prefix sum of their areas.
+    std::vector<double> cdf(num_triangles);
+    utility::InclusivePrefixSum(area_ptr, area_ptr + num_triangles,
+                                cdf.data());
+    const double total_area = num_triangles > 0 ? cdf.back() : 0;
+    if (!(total_area > 0)) {
+        utility::LogError("Mesh has no surface area to sample.");
+    }
+
+    core::Tensor triangle_ids({number_of_points}, core::Int64);
+    int64_t* triangle_id_ptr = triangle_ids.GetDataPtr<int64_t>();
+    std::vector<double> barycentric(3 * number_of_points);
+    const uint32_t seed = utility::random::RandUint32();
+    const int64_t num_chunks =
+            (number_of_points + kSampleChunkSize - 1) / kSampleChunkSize;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        std::seed_seq seed_seq{seed, static_cast<uint32_t>(chunk)};
+        std::mt19937 engine(seed_seq);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        const int64_t end =
+                std::min(number_of_points, (chunk + 1) * kSampleChunkSize);
+        for (int64_t i = chunk * kSampleChunkSize; i < end; ++i) {
+            const double r1 = std::sqrt(uniform(engine));
+            const double r2 = uniform(engine);
+            double* w = barycentric.data() + 3 * i;
+            w[0] = 1 - r1;
+            w[1] = r1 * (1 - r2);
+            w[2] = r1 * r2;
+            const int64_t tidx =
+                    std::upper_bound(cdf.begin(), cdf.end(),
+                                     uniform(engine) * total_area) -
+                    cdf.begin();
+            triangle_id_ptr[i] = std::min(tidx, num_triangles - 1);
+        }
+    }
+
+    vertex_samples.clear();
+    for (const core::Tensor& attr : vertex_attrs) {
+        const core::Tensor attr_d = attr.Contiguous();
+        core::SizeVector shape = attr_d.GetShape();
+        const int64_t channels =
+                attr_d.GetLength() > 0 ? attr_d.NumElements() / shape[0] : 0;
+        shape[0] = number_of_points;
+        core::Tensor samples(shape, attr_d.GetDtype());
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(attr_d.GetDtype(), [&]() {
+            InterpolateVertexAttr(attr_d.GetDataPtr<scalar_t>(), channels,
+                                  triangle_ptr, triangle_id_ptr,
+                                  barycentric.data(), number_of_points,
+                                  samples.GetDataPtr<scalar_t>());
+        });
+        vertex_samples.push_back(samples);
+    }
+
+    triangle_samples.clear();
+    for (const core::Tensor& attr : triangle_attrs) {
+        triangle_samples.push_back(attr.IndexGet({triangle_ids}));
+    }
+}
+
+void SampleEliminationCPU(const core::Tensor& neighbors_index,
+                          const core::Tensor& neighbors_distance2,
+                          const core::Tensor& neighbors_row_splits,
+                          int64_t number_of_points,
+                          double r_min,
+                          double r_max,
+                          core::Tensor& mask) {
+    const int64_t num_samples = neighbors_row_splits.GetLength() - 1;
+    const core::Tensor distance2 =
+            neighbors_distance2.To(core::Float64).Contiguous();
+    mask = core::Tensor::Empty({num_samples}, core::Bool);
+    if (neighbors_index.GetDtype() == core::Int32) {
+        SampleEliminationImpl(neighbors_index.GetDataPtr<int32_t>(),
+                              distance2.GetDataPtr<double>(),
+                              neighbors_row_splits.GetDataPtr<int64_t>(),
+                              num_samples, number_of_points, r_min, r_max,
+                              mask.GetDataPtr<bool>());
+    } else {
+        SampleEliminationImpl(neighbors_index.GetDataPtr<int64_t>(),
+                              distance2.GetDataPtr<double>(),
+                              neighbors_row_splits.GetDataPtr<int64_t>(),
+                              num_samples, number_of_points, r_min, r_max,
+                              mask.GetDataPtr<bool>());
+    }
+}
+
+void SubdivideLoopCPU(const core::Tensor& triangles,
+                      const core::Tensor& edge_buf_indices,
+                      int64_t num_vertices,
+                      core::Tensor& new_triangles,
+                      core::Tensor& row_splits,
+                      core::Tensor& col_idx,
+                      core::Tensor& weights,
+                      core::Tensor& diag_scale,
+                      core::Tensor& neighbour_scale) {
+    const core::Tensor triangles_d = triangles.To(core::Int64).Contiguous();
+    const core::Tensor buf_d = edge_buf_indices.To(core::Int64).Contiguous();
+    const int64_t num_triangles = triangles_d.GetLength();
+    const int64_t* triangle_ptr = triangles_d.GetDataPtr<int64_t>();
+    const int64_t* buf_ptr = buf_d.GetDataPtr<int64_t>();
+
+    // Number the edges in order of their first appearance. Edge k of triangle
+    // t connects its corners k and (k + 1) % 3.
+    const int64_t num_slots =
+            num_triangles > 0
+                    ? *std::max_element(buf_ptr, buf_ptr + 3 * num_triangles) +
+                              1
+                    : 0;
+    std::vector<int64_t> slot_to_edge(num_slots, -1);
+    std::vector<int64_t> edge_ids(3 * num_triangles);
+    std::vector<int64_t> edge_vertices;
+    for (int64_t i = 0; i < 3 * num_triangles; ++i) {
+        int64_t& edge = slot_to_edge[buf_ptr[i]];
+        if (edge < 0) {
+            edge = int64_t(edge_vertices.size() / 2);
+            edge_vertices.push_back(triangle_ptr[i]);
+            edge_vertices.push_back(triangle_ptr[i - i % 3 + (i + 1) % 3]);
+        }
+        edge_ids[i] = edge;
+    }
+    const int64_t num_edges = int64_t(edge_vertices.size() / 2);
+
+    // Triangle corners of every edge and edge endpoints of every vertex.
+    std::vector<int64_t> edge_corners;
+    const std::vector<int64_t> edge_splits =
+            CountingSort(edge_ids, num_edges, edge_corners);
+    std::vector<int64_t> vertex_edges;
+    const std::vector<int64_t> vertex_splits =
+            CountingSort(edge_vertices, num_vertices, vertex_edges);
+
+    // Rows [0, num_vertices) move the old vertices, the following rows place
+    // one new vertex on every edge.
+    auto num_edge_triangles = [&](int64_t edge) {
+        return edge_splits[edge + 1] - edge_splits[edge];
+    };
+    auto num_boundary_edges = [&](int64_t vidx) {
+        int64_t count = 0;
+        for (int64_t k = vertex_splits[vidx]; k < vertex_splits[vidx + 1];
+             ++k) {
+            count += num_edge_triangles(vertex_edges[k] / 2) == 1;
+        }
+        return count;
+    };
+    const int64_t num_rows = num_vertices + num_edges;
+    std::vector<int64_t> splits(num_rows + 1, 0);
+    std::atomic<int64_t> num_non_manifold_vertices(0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t row = 0; row < num_rows; ++row) {
+        if (row < num_vertices) {
+            const int64_t num_boundary = num_boundary_edges(row);
+            if (num_boundary > 2) {
+                ++num_non_manifold_vertices;
+            }
+            splits[row + 1] = num_boundary >= 2 ? num_boundary
+                                                : vertex_splits[row + 1] -
+                                                          vertex_splits[row];
+        } else {
+            const int64_t n = num_edge_triangles(row - num_vertices);
+            splits[row + 1] = n < 2 ? 2 : 2 + n;
+        }
+    }
+    std::partial_sum(splits.begin(), splits.end(), splits.begin());
+    int64_t num_non_manifold_edges = 0;
+    for (int64_t edge = 0; edge < num_edges; ++edge) {
+        num_non_manifold_edges += num_edge_triangles(edge) > 2;
+    }
+    if (num_non_manifold_edges > 0) {
+        utility::LogWarning("SubdivideLoop: {} non-manifold edges.",
+                            num_non_manifold_edges);
+    }
+    if (num_non_manifold_vertices > 0) {
+        utility::LogWarning(
+                "SubdivideLoop: {} vertices with more than two boundary "
+                "edges, maybe the mesh is not manifold.",
+                num_non_manifold_vertices.load());
+    }
+
+    row_splits = core::Tensor(splits, {num_rows + 1}, core::Int64);
+    col_idx = core::Tensor::Empty({splits.back()}, core::Int64);
+    weights = core::Tensor::Empty({splits.back()}, core::Float64);
+    diag_scale = core::Tensor::Empty({num_rows}, core::Float64);
+    neighbour_scale = core::Tensor::Ones({num_rows}, core::Float64);
+    int64_t* col_ptr = col_idx.GetDataPtr<int64_t>();
+    double* weight_ptr = weights.GetDataPtr<double>();
+    double* diag_ptr = diag_scale.GetDataPtr<double>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t row = 0; row < num_rows; ++row) {
+        int64_t k = splits[row];
+        if (row < num_vertices) {
+            const int64_t num_neighbours =
+                    vertex_splits[row + 1] - vertex_splits[row];
+            const int64_t num_boundary = num_boundary_edges(row);
+            const bool boundary = num_boundary >= 2;
+            double beta = 0;
+            if (boundary) {
+                beta = 1. / 8.;
+            } else if (num_neighbours == 3) {
+                beta = 3. / 16.;
+            } else if (num_neighbours > 0) {
+                beta = 3. / (8. * num_neighbours);
+            }
+            diag_ptr[row] =
+                    1. - (boundary ? num_boundary : num_neighbours) * beta;
+            for (int64_t j = vertex_splits[row]; j < vertex_splits[row + 1];
+                 ++j) {
+                const int64_t edge = vertex_edges[j] / 2;
+                if (boundary && num_edge_triangles(edge) != 1) {
+                    continue;
+                }
+                // The neighbour is the other endpoint of the edge.
+                col_ptr[k] = edge_vertices[vertex_edges[j] ^ 1];
+                weight_ptr[k++] = beta;
+            }
+        } else {
+            const int64_t edge = row - num_vertices;
+            const int64_t n = num_edge_triangles(edge);
+            diag_ptr[row] = 0;
+            for (int i = 0; i < 2; ++i) {
+                col_ptr[k] = edge_vertices[2 * edge + i];
+                weight_ptr[k++] = n < 2 ? 0.5 : 3. / 8.;
+            }
+            if (n >= 2) {
+                for (int64_t j = edge_splits[edge]; j < edge_splits[edge + 1];
+                     ++j) {
+                    // The vertex opposite to the edge.
+                    const int64_t corner = edge_corners[j];
+                    col_ptr[k] = triangle_ptr[corner - corner % 3 +
+                                              (corner + 2) % 3];
+                    weight_ptr[k++] = 1. / (4. * n);
+                }
+            }
+        }
+    }
+
+    new_triangles = core::Tensor::Empty({4 * num_triangles, 3}, core::Int64);
+    int64_t* new_triangle_ptr = new_triangles.GetDataPtr<int64_t>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        const int64_t* v = triangle_ptr + 3 * t;
+        const int64_t v01 = num_vertices + edge_ids[3 * t];
+        const int64_t v12 = num_vertices + edge_ids[3 * t + 1];
+        const int64_t v20 = num_vertices + edge_ids[3 * t + 2];
+        const int64_t children[4][3] = {{v[0], v01, v20},
+                                        {v01, v[1], v12},
+                                        {v12, v[2], v20},
+                                        {v01, v12, v20}};
+        std::copy(&children[0][0], &children[0][0] + 12,
+                  new_triangle_ptr + 12 * t);
+    }
+}
+
+void ClusterConnectedTrianglesCPU(const core::Tensor& edge_buf_indices,
+                                  const core::Tensor& triangle_areas,
+                                  core::Tensor& triangle_clusters,
+                                  core::Tensor& cluster_n_triangles,
+                                  core::Tensor& cluster_area) {
+    const core::Tensor buf_d = edge_buf_indices.To(core::Int64).Contiguous();
+    const core::Tensor areas_d = triangle_areas.To(core::Float64).Contiguous();
+    const int64_t num_triangles = areas_d.GetLength();
+    const int64_t* buf_ptr = buf_d.GetDataPtr<int64_t>();
+    const double* area_ptr = areas_d.GetDataPtr<double>();
+
+    const int64_t num_slots =
+            num_triangles > 0
+                    ? *std::max_element(buf_ptr, buf_ptr + 3 * num_triangles) +
+                              1
+                    : 0;
+    std::vector<std::atomic<int64_t>> parent(num_triangles);
+    std::vector<std::atomic<int64_t>> edge_triangle(num_slots);
+    std::atomic<int64_t>* parent_ptr = parent.data();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        parent_ptr[t].store(t, std::memory_order_relaxed);
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t slot = 0; slot < num_slots; ++slot) {
+        edge_triangle[slot].store(-1, std::memory_order_relaxed);
+    }
+
+    // The first triangle to claim an edge is joined by all others sharing it.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < 3 * num_triangles; ++i) {
+        int64_t other = -1;
+        if (!edge_triangle[buf_ptr[i]].compare_exchange_strong(other, i / 3)) {
+            UnionFindMerge(parent_ptr, i / 3, other);
+        }
+    }
+
+    // Clusters are numbered by their smallest triangle, which is the order of
+    // the breadth first search of the legacy implementation.
+    triangle_clusters = core::Tensor::Empty({num_triangles}, core::Int64);
+    int64_t* cluster_ptr = triangle_clusters.GetDataPtr<int64_t>();
+    std::vector<int64_t> n_triangles;
+    std::vector<double> areas;
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        const int64_t root = UnionFindRoot(parent_ptr, t);
+        if (root == t) {
+            cluster_ptr[t] = int64_t(n_triangles.size());
+            n_triangles.push_back(0);
+            areas.push_back(0);
+        } else {
+            cluster_ptr[t] = cluster_ptr[root];
+        }
+        ++n_triangles[cluster_ptr[t]];
+        areas[cluster_ptr[t]] += area_ptr[t];
+    }
+    const int64_t num_clusters = int64_t(n_triangles.size());
+    cluster_n_triangles =
+            core::Tensor(n_triangles, {num_clusters}, core::Int64);
+    cluster_area = core::Tensor(areas, {num_clusters}, core::Float64);
+}
+
+void UniqueBufIndicesCPU(const core::Tensor& buf_indices,
+                         core::Tensor& ids,
+                         core::Tensor& first) {
+    const core::Tensor buf_d = buf_indices.To(core::Int64).Contiguous();
+    const int64_t n = buf_d.NumElements();
+    const int64_t* buf_ptr = buf_d.GetDataPtr<int64_t>();
+    const int64_t num_slots =
+            n > 0 ? *std::max_element(buf_ptr, buf_ptr + n) + 1 : 0;
+    std::vector<int64_t> ids_vec, first_vec;
+    UniqueKeys(buf_ptr, nullptr, n, num_slots, ids_vec, first_vec);
+    ids = core::Tensor(ids_vec, {n}, core::Int64);
+    first = core::Tensor(first_vec, {int64_t(first_vec.size())}, core::Int64);
+}
+
+void ClipPlaneCPU(const core::Tensor& triangles,
+                  const core::Tensor& distances,
+                  const core::Tensor& crossing_triangles,
+                  const core::Tensor& edge_buf_indices,
+                  core::Tensor& clipped_triangles,
+                  core::Tensor& triangle_parents,
+                  core::Tensor& vertex_sources,
+                  core::Tensor& vertex_weights) {
+    const core::Tensor triangles_d = triangles.To(core::Int64).Contiguous();
+    const core::Tensor distances_d = distances.To(core::Float64).Contiguous();
+    const core::Tensor crossing_d =
+            crossing_triangles.To(core::Int64).Contiguous();
+    const core::Tensor buf_d = edge_buf_indices.To(core::Int64).Contiguous();
+    const int64_t num_triangles = triangles_d.GetLength();
+    const int64_t num_vertices = distances_d.GetLength();
+    const int64_t num_crossing = crossing_d.GetLength();
+    const int64_t* triangle_ptr = triangles_d.GetDataPtr<int64_t>();
+    const double* d = distances_d.GetDataPtr<double>();
+    const int64_t* crossing_ptr = crossing_d.GetDataPtr<int64_t>();
+    const int64_t* buf_ptr = buf_d.GetDataPtr<int64_t>();
+
+    std::vector<int64_t> crossing_pos(num_triangles, -1);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < num_crossing; ++k) {
+        crossing_pos[crossing_ptr[k]] = k;
+    }
+
+    // Edge k of a crossing triangle connects its corners k and (k + 1) % 3.
+    // An edge gets a new vertex unless the endpoint on the positive side lies
+    // on the plane.
+    auto corner_edge = [&](int64_t corner) {
+        const int64_t* v = triangle_ptr + 3 * crossing_ptr[corner / 3];
+        return std::make_pair(v[corner % 3], v[(corner + 1) % 3]);
+    };
+    std::vector<uint8_t> cut_flags(3 * num_crossing);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t corner = 0; corner < 3 * num_crossing; ++corner) {
+        int64_t a, b;
+        std::tie(a, b) = corner_edge(corner);
+        cut_flags[corner] =
+                (d[a] >= 0) != (d[b] >= 0) && d[a] != 0 && d[b] != 0;
+    }
+    const int64_t num_slots =
+            num_crossing > 0
+                    ? *std::max_element(buf_ptr, buf_ptr + 3 * num_crossing) +
+                              1
+                    : 0;
+    std::vector<int64_t> cut_ids, cut_first;
+    UniqueKeys(buf_ptr, cut_flags.data(), 3 * num_crossing, num_slots, cut_ids,
+               cut_first);
+    const int64_t num_cuts = int64_t(cut_first.size());
+
+    // The part of a triangle on the positive side is a polygon with up to
+    // four corners. Old vertices keep their index, cut vertices follow.
+    auto clip_polygon = [&](int64_t t, int64_t* polygon) {
+        const int64_t* v = triangle_ptr + 3 * t;
+        int n = 0;
+        auto append = [&](int64_t idx) {
+            if (n == 0 || polygon[n - 1] != idx) {
+                polygon[n++] = idx;
+            }
+        };
+        for (int j = 0; j < 3; ++j) {
+            const int64_t a = v[j];
+            const int64_t b = v[(j + 1) % 3];
+            if (d[a] >= 0) {
+                append(a);
+            }
+            if ((d[a] >= 0) != (d[b] >= 0)) {
+                const int64_t corner = 3 * crossing_pos[t] + j;
+                append(cut_flags[corner] ? num_vertices + cut_ids[corner]
+                                         : (d[a] >= 0 ? a : b));
+            }
+        }
+        while (n > 1 && polygon[n - 1] == polygon[0]) {
+            --n;
+        }
+        return n;
+    };
+
+    std::vector<int64_t> counts(num_triangles), offsets;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        int64_t polygon[6];
+        counts[t] = std::max(0, clip_polygon(t, polygon) - 2);
+    }
+    const int64_t num_out_triangles = ExclusivePrefixSum(counts, offsets);
+
+    // Fan triangulation with provisional vertex indices, then only the
+    // referenced vertices are kept.
+    std::vector<int64_t> out_triangles(3 * num_out_triangles);
+    std::vector<int64_t> parents(num_out_triangles);
+    std::vector<std::atomic<uint8_t>> used(num_vertices + num_cuts);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_vertices + num_cuts; ++i) {
+        used[i].store(0, std::memory_order_relaxed);
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        int64_t polygon[6];
+        const int n = clip_polygon(t, polygon);
+        for (int i = 0; i + 2 < n; ++i) {
+            int64_t* out = out_triangles.data() + 3 * (offsets[t] + i);
+            out[0] = polygon[0];
+            out[1] = polygon[i + 1];
+            out[2] = polygon[i + 2];
+            parents[offsets[t] + i] = t;
+        }
+        // Degenerate polygons that touch the plane in a vertex or an edge
+        // produce no triangles, so their vertices are dropped.
+        for (int i = 0; n >= 3 && i < n; ++i) {
+            used[polygon[i]].store(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::vector<int64_t> used_counts(num_vertices + num_cuts), new_ids;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_vertices + num_cuts; ++i) {
+        used_counts[i] = used[i].load(std::memory_order_relaxed);
+    }
+    const int64_t num_out_vertices = ExclusivePrefixSum(used_counts, new_ids);
+
+    vertex_sources = core::Tensor::Empty({num_out_vertices, 2}, core::Int64);
+    vertex_weights = core::Tensor::Empty({num_out_vertices}, core::Float64);
+    int64_t* source_ptr = vertex_sources.GetDataPtr<int64_t>();
+    double* weight_ptr = vertex_weights.GetDataPtr<double>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_vertices + num_cuts; ++i) {
+        if (!used_counts[i]) {
+            continue;
+        }
+        int64_t* source = source_ptr + 2 * new_ids[i];
+        if (i < num_vertices) {
+            source[0] = source[1] = i;
+            weight_ptr[new_ids[i]] = 0;
+        } else {
+            // The first source is the endpoint on the positive side.
+            int64_t a, b;
+            std::tie(a, b) = corner_edge(cut_first[i - num_vertices]);
+            if (d[a] < 0) {
+                std::swap(a, b);
+            }
+            source[0] = a;
+            source[1] = b;
+            weight_ptr[new_ids[i]] = d[a] / (d[a] - d[b]);
+        }
+    }
+
+    clipped_triangles =
+            core::Tensor::Empty({num_out_triangles, 3}, core::Int64);
+    int64_t* clipped_ptr = clipped_triangles.GetDataPtr<int64_t>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < 3 * num_out_triangles; ++i) {
+        clipped_ptr[i] = new_ids[out_triangles[i]];
+    }
+    triangle_parents = core::Tensor(parents, {num_out_triangles}, core::Int64);
+}
+
+void SlicePlaneCPU(const core::Tensor& triangles,
+                   const core::Tensor& distances,
+                   const std::vector<double>& contour_values,
+                   core::Tensor& cut_keys,
+                   core::Tensor& cut_sources,
+                   core::Tensor& cut_weights) {
+    const core::Tensor triangles_d = triangles.To(core::Int64).Contiguous();
+    const core::Tensor distances_d = distances.To(core::Float64).Contiguous();
+    const int64_t num_triangles = triangles_d.GetLength();
+    const int64_t* triangle_ptr = triangles_d.GetDataPtr<int64_t>();
+    const double* d = distances_d.GetDataPtr<double>();
+
+    // A triangle crosses the contours in (min distance, max distance], found
+    // by bisection of the sorted contour values.
+    std::vector<int64_t> order(contour_values.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        return contour_values[a] < contour_values[b];
+    });
+    std::vector<double> sorted_values(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        sorted_values[i] = contour_values[order[i]];
+    }
+    auto contour_range = [&](int64_t t) {
+        const int64_t* v = triangle_ptr + 3 * t;
+        const double d_min = std::min({d[v[0]], d[v[1]], d[v[2]]});
+        const double d_max = std::max({d[v[0]], d[v[1]], d[v[2]]});
+        return std::make_pair(
+                std::upper_bound(sorted_values.begin(), sorted_values.end(),
+                                 d_min) -
+                        sorted_values.begin(),
+                std::upper_bound(sorted_values.begin(), sorted_values.end(),
+                                 d_max) -
+                        sorted_values.begin());
+    };
+
+    std::vector<int64_t> counts(num_triangles), offsets;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        const auto range = contour_range(t);
+        counts[t] = range.second - range.first;
+    }
+    const int64_t num_segments = ExclusivePrefixSum(counts, offsets);
+
+    // Every segment has two cut points on the edges that change sides. The
+    // key of a cut point is its edge and contour, or its vertex twice if the
+    // vertex lies on the contour, so that neighbouring triangles share it.
+    cut_keys = core::Tensor::Empty({2 * num_segments, 3}, core::Int64);
+    cut_sources = core::Tensor::Empty({2 * num_segments, 2}, core::Int64);
+    cut_weights = core::Tensor::Empty({2 * num_segments}, core::Float64);
+    int64_t* key_ptr = cut_keys.GetDataPtr<int64_t>();
+    int64_t* source_ptr = cut_sources.GetDataPtr<int64_t>();
+    double* weight_ptr = cut_weights.GetDataPtr<double>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        const int64_t* v = triangle_ptr + 3 * t;
+        const auto range = contour_range(t);
+        int64_t cut = 2 * offsets[t];
+        for (int64_t l = range.first; l < range.second; ++l) {
+            const double value = sorted_values[l];
+            for (int j = 0; j < 3; ++j) {
+                int64_t a = v[j];
+                int64_t b = v[(j + 1) % 3];
+                if ((d[a] >= value) == (d[b] >= value)) {
+                    continue;
+                }
+                // a is the endpoint on the positive side.
+                if (d[a] < value) {
+                    std::swap(a, b);
+                }
+                if (d[a] == value) {
+                    b = a;
+                }
+                key_ptr[3 * cut] = std::min(a, b);
+                key_ptr[3 * cut + 1] = std::max(a, b);
+                key_ptr[3 * cut + 2] = order[l];
+                source_ptr[2 * cut] = a;
+                source_ptr[2 * cut + 1] = b;
+                weight_ptr[cut] = a == b ? 0 : (d[a] - value) / (d[a] - d[b]);
+                ++cut;
+            }
+        }
+    }
+}
+
+void SimplifyQuadricDecimationCPU(const core::Tensor& vertices,
+                                  const core::Tensor& triangles,
+                                  const core::Tensor& edge_buf_indices,
+                                  int64_t target_number_of_triangles,
+                                  bool preserve_volume,
+                                  core::Tensor& new_vertices,
+                                  core::Tensor& new_triangles,
+                                  core::Tensor& vertex_indices,
+                                  core::Tensor& vertex_map,
+                                  core::Tensor& triangle_parents) {
+    const core::Tensor vertices_d = vertices.To(core::Float64).Contiguous();
+    const core::Tensor triangles_d = triangles.To(core::Int64).Contiguous();
+    const core::Tensor buf_d = edge_buf_indices.To(core::Int64).Contiguous();
+
+    QuadricDecimation decimation(
+            vertices_d.GetDataPtr<double>(), triangles_d.GetDataPtr<int64_t>(),
+            buf_d.GetDataPtr<int64_t>(), vertices_d.GetLength(),
+            triangles_d.GetLength(), preserve_volume);
+    decimation.Run(target_number_of_triangles);
+    decimation.GetResult(new_vertices, new_triangles, vertex_indices,
+                         vertex_map, triangle_parents);
+}
+
 }  // namespace trianglemesh
 }  // namespace kernel
 }  // namespace geometry
@@ -153,6 +153,104 @@ void ComputeTriangleAreasCPU
     });
 }
 
+#if defined(__CUDACC__)
+void ComputeLaplacianFilterCUDA
+#else
+void ComputeLaplacianFilterCPU
+#endif
+        (const core::Tensor& row_splits,
+         const core::Tensor& col_idx,
+         const core::Tensor& positions,
+         double lambda_filter,
+         core::Tensor& weights,
+         core::Tensor& diag_scale,
+         core::Tensor& neighbour_scale) {
+    const int64_t n = positions.GetLength();
+    const core::Dtype dtype = positions.GetDtype();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+        const int64_t* col_idx_ptr = col_idx.GetDataPtr<int64_t>();
+        const scalar_t* position_ptr = positions.GetDataPtr<scalar_t>();
+        double* weight_ptr = weights.GetDataPtr<double>();
+        double* diag_ptr = diag_scale.GetDataPtr<double>();
+        double* neighbour_ptr = neighbour_scale.GetDataPtr<double>();
+
+        core::ParallelFor(
+                positions.GetDevice(), n,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t* p = position_ptr + 3 * workload_idx;
+                    double total_weight = 0;
+                    for (int64_t k = row_splits_ptr[workload_idx];
+                         k < row_splits_ptr[workload_idx + 1]; ++k) {
+                        const scalar_t* q = position_ptr + 3 * col_idx_ptr[k];
+                        double dx = p[0] - q[0];
+                        double dy = p[1] - q[1];
+                        double dz = p[2] - q[2];
+                        weight_ptr[k] =
+                                1. / (sqrt(dx * dx + dy * dy + dz * dz) +
+                                      1e-12);
+                        total_weight += weight_ptr[k];
+                    }
+                    if (total_weight > 0) {
+                        diag_ptr[workload_idx] = 1 - lambda_filter;
+                        neighbour_ptr[workload_idx] =
+                                lambda_filter / total_weight;
+                    } else {
+                        diag_ptr[workload_idx] = 1;
+                        neighbour_ptr[workload_idx] = 0;
+                    }
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void FilterVertexAttrCUDA
+#else
+void FilterVertexAttrCPU
+#endif
+        (const core::Tensor& row_splits,
+         const core::Tensor& col_idx,
+         const core::Tensor& weights,
+         const core::Tensor& diag_scale,
+         const core::Tensor& neighbour_scale,
+         const core::Tensor& input,
+         core::Tensor& output) {
+    const int64_t n = input.GetLength();
+    const core::Dtype dtype = input.GetDtype();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+        const int64_t* col_idx_ptr = col_idx.GetDataPtr<int64_t>();
+        const double* weight_ptr =
+                weights.NumElements() > 0 ? weights.GetDataPtr<double>()
+                                          : nullptr;
+        const double* diag_ptr = diag_scale.GetDataPtr<double>();
+        const double* neighbour_ptr = neighbour_scale.GetDataPtr<double>();
+        const scalar_t* input_ptr = input.GetDataPtr<scalar_t>();
+        scalar_t* output_ptr = output.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(
+                input.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    double sum[3] = {0, 0, 0};
+                    for (int64_t k = row_splits_ptr[workload_idx];
+                         k < row_splits_ptr[workload_idx + 1]; ++k) {
+                        const scalar_t* q = input_ptr + 3 * col_idx_ptr[k];
+                        const double w = weight_ptr ? weight_ptr[k] : 1.0;
+                        sum[0] += w * q[0];
+                        sum[1] += w * q[1];
+                        sum[2] += w * q[2];
+                    }
+                    const int64_t idx = 3 * workload_idx;
+                    for (int i = 0; i < 3; ++i) {
+                        output_ptr[idx + i] = static_cast<scalar_t>(
+                                diag_ptr[workload_idx] * input_ptr[idx + i] +
+                                neighbour_ptr[workload_idx] * sum[i]);
+                    }
+                });
+    });
+}
+
 }  // namespace trianglemesh
 }  // namespace kernel
 }  // namespace geometry
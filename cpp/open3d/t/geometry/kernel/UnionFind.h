@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+
+/// Lock-free disjoint set forest over [0, n), stored as an array of parent
+/// indices initialized to parent[i] = i. Roots are always linked below smaller
+/// roots, so every parent index is at most the index of its child and the root
+/// of a tree is its smallest member. UnionFindRoot and UnionFindMerge may run
+/// concurrently.
+
+/// Returns the root of \p idx in the forest \p parent and halves the path on
+/// the way.
+inline int64_t UnionFindRoot(std::atomic<int64_t>* parent, int64_t idx) {
+    while (true) {
+        const int64_t p = parent[idx].load(std::memory_order_relaxed);
+        if (p == idx) {
+            return idx;
+        }
+        const int64_t gp = parent[p].load(std::memory_order_relaxed);
+        if (gp != p) {
+            parent[idx].store(gp, std::memory_order_relaxed);
+        }
+        idx = gp;
+    }
+}
+
+/// Merges the sets of \p a and \p b, linking the larger root below the smaller
+/// one.
+inline void UnionFindMerge(std::atomic<int64_t>* parent, int64_t a, int64_t b) {
+    while (true) {
+        a = UnionFindRoot(parent, a);
+        b = UnionFindRoot(parent, b);
+        if (a == b) {
+            return;
+        }
+        if (a < b) {
+            std::swap(a, b);
+        }
+        int64_t expected = a;
+        if (parent[a].compare_exchange_weak(expected, b)) {
+            return;
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
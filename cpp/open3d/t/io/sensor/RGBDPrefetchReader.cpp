@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDPrefetchReader.h"
+
+#include <algorithm>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+RGBDPrefetchReader::RGBDPrefetchReader(const FrameLoader &loader,
+                                       int num_threads,
+                                       size_t buffer_size,
+                                       const core::Device &device)
+    : loader_(loader),
+      device_(device),
+      frame_buffer_(buffer_size),
+      is_ready_(buffer_size, false) {
+    Start(num_threads);
+}
+
+RGBDPrefetchReader::RGBDPrefetchReader(std::unique_ptr<RGBDVideoReader> reader,
+                                       size_t buffer_size,
+                                       const core::Device &device)
+    : device_(device),
+      frame_buffer_(buffer_size),
+      is_ready_(buffer_size, false) {
+    if (!reader || !reader->IsOpened()) {
+        utility::LogError("RGBD video reader is not opened.");
+    }
+    std::shared_ptr<RGBDVideoReader> video_reader(std::move(reader));
+    loader_ = [video_reader](int64_t, t::geometry::RGBDImage &frame) {
+        if (video_reader->IsEOF()) return false;
+        frame = video_reader->NextFrame();
+        return !frame.IsEmpty();
+    };
+    Start(1);
+}
+
+RGBDPrefetchReader::RGBDPrefetchReader(
+        const std::vector<std::string> &color_files,
+        const std::vector<std::string> &depth_files,
+        int num_threads,
+        size_t buffer_size,
+        const core::Device &device)
+    : device_(device),
+      frame_buffer_(buffer_size),
+      is_ready_(buffer_size, false) {
+    if (color_files.size() != depth_files.size()) {
+        utility::LogError(
+                "Number of color images ({}) and depth images ({}) differ.",
+                color_files.size(), depth_files.size());
+    }
+    loader_ = [color_files, depth_files](int64_t index,
+                                         t::geometry::RGBDImage &frame) {
+        if (index >= int64_t(color_files.size())) return false;
+        t::geometry::Image color, depth;
+        if (!ReadImage(color_files[index], color)) {
+            utility::LogError("Failed to read {}.", color_files[index]);
+        }
+        if (!ReadImage(depth_files[index], depth)) {
+            utility::LogError("Failed to read {}.", depth_files[index]);
+        }
+        frame = t::geometry::RGBDImage(color, depth);
+        return true;
+    };
+    if (num_threads <= 0) {
+        num_threads = utility::EstimateMaxThreads();
+    }
+    Start(std::min(num_threads, std::max(int(color_files.size()), 1)));
+}
+
+RGBDPrefetchReader::~RGBDPrefetchReader() { Close(); }
+
+void RGBDPrefetchReader::Start(int num_threads) {
+    if (frame_buffer_.empty()) {
+        utility::LogError("buffer_size must be positive.");
+    }
+    if (num_threads <= 0) {
+        utility::LogError("num_threads must be positive, but got {}.",
+                          num_threads);
+    }
+    for (int i = 0; i < num_threads; ++i) {
+        decode_threads_.emplace_back(&RGBDPrefetchReader::DecodeLoop, this);
+    }
+}
+
+void RGBDPrefetchReader::DecodeLoop() {
+    const int64_t buffer_size = frame_buffer_.size();
+    while (true) {
+        int64_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            slot_free_.wait(lock, [&] {
+                return stop_ || next_decode_ >= num_frames_ ||
+                       next_decode_ < next_read_ + buffer_size;
+            });
+            if (stop_ || next_decode_ >= num_frames_) return;
+            index = next_decode_++;
+        }
+
+        t::geometry::RGBDImage frame;
+        bool is_success = false;
+        std::exception_ptr error;
+        try {
+            is_success = loader_(index, frame);
+            if (is_success && frame.GetDevice() != device_) {
+                frame = frame.To(device_);
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (is_success) {
+                frame_buffer_[index % buffer_size] = std::move(frame);
+                is_ready_[index % buffer_size] = true;
+            } else if (index < num_frames_) {
+                num_frames_ = index;
+                error_ = error;
+            }
+        }
+        frame_ready_.notify_all();
+        if (!is_success) {
+            // Wake up the threads waiting for a slot past the last frame.
+            slot_free_.notify_all();
+        }
+    }
+}
+
+bool RGBDPrefetchReader::IsEOF() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    frame_ready_.wait(lock, [&] {
+        return next_read_ >= num_frames_ ||
+               is_ready_[next_read_ % frame_buffer_.size()];
+    });
+    return next_read_ >= num_frames_ && !error_;
+}
+
+t::geometry::RGBDImage RGBDPrefetchReader::NextFrame() {
+    t::geometry::RGBDImage frame;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const size_t slot = next_read_ % frame_buffer_.size();
+        frame_ready_.wait(lock, [&] {
+            return next_read_ >= num_frames_ || is_ready_[slot];
+        });
+        if (next_read_ >= num_frames_) {
+            if (error_) {
+                std::exception_ptr error = error_;
+                error_ = nullptr;
+                std::rethrow_exception(error);
+            }
+            return frame;
+        }
+        frame = std::move(frame_buffer_[slot]);
+        frame_buffer_[slot] = t::geometry::RGBDImage();
+        is_ready_[slot] = false;
+        ++next_read_;
+    }
+    slot_free_.notify_all();
+    return frame;
+}
+
+void RGBDPrefetchReader::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        num_frames_ = std::min(num_frames_, next_read_);
+    }
+    slot_free_.notify_all();
+    frame_ready_.notify_all();
+    for (auto &thread : decode_threads_) {
+        thread.join();
+    }
+    decode_threads_.clear();
+}
+
+int64_t RGBDPrefetchReader::GetFrameIndex() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_read_;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
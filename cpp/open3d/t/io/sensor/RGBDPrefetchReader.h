@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class RGBDPrefetchReader
+///
+/// Reads a sequence of RGBD frames ahead of the consumer.
+///
+/// Decode threads load the frames following the last returned frame into a
+/// look-ahead buffer, so that decoding (e.g. of 16 bit PNG depth images)
+/// overlaps with the processing of earlier frames. Frames are returned in
+/// sequence order, regardless of the order in which they finish decoding.
+///
+/// Sources with random access, such as folders of color and depth images, are
+/// decoded by several threads. Sequential sources, such as RGBD video files,
+/// are read by a single thread.
+class RGBDPrefetchReader {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 8;
+
+    /// \brief Loads frame \p index into \p frame and returns true, or returns
+    /// false if \p index is past the last frame.
+    ///
+    /// A loader passed with more than one thread is called concurrently with
+    /// different indices and must be thread safe. Exceptions are rethrown by
+    /// NextFrame() when the failed frame is reached.
+    typedef std::function<bool(int64_t index, t::geometry::RGBDImage &frame)>
+            FrameLoader;
+
+    /// \brief Reads frames from a generic \p loader, e.g. wrapping a legacy
+    /// Azure Kinect MKVReader.
+    ///
+    /// \param loader Frame loader.
+    /// \param num_threads Number of decode threads. Use 1 for loaders that
+    /// must be called with increasing indices.
+    /// \param buffer_size Max number of frames decoded ahead of the consumer.
+    /// \param device Frames are moved to this device by the decode threads.
+    RGBDPrefetchReader(const FrameLoader &loader,
+                       int num_threads = 1,
+                       size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                       const core::Device &device = core::Device("CPU:0"));
+
+    /// \brief Reads frames from an opened RGBD video \p reader, e.g. an
+    /// RSBagReader, on a single thread.
+    ///
+    /// \param reader Opened RGBD video reader.
+    /// \param buffer_size Max number of frames decoded ahead of the consumer.
+    /// \param device Frames are moved to this device by the decode thread.
+    RGBDPrefetchReader(std::unique_ptr<RGBDVideoReader> reader,
+                       size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                       const core::Device &device = core::Device("CPU:0"));
+
+    /// \brief Reads pairs of color and depth image files.
+    ///
+    /// \param color_files Color image files, in sequence order.
+    /// \param depth_files Depth image files, one per color image.
+    /// \param num_threads Number of decode threads. Defaults to the number of
+    /// available cores if <= 0.
+    /// \param buffer_size Max number of frames decoded ahead of the consumer.
+    /// \param device Frames are moved to this device by the decode threads.
+    RGBDPrefetchReader(const std::vector<std::string> &color_files,
+                       const std::vector<std::string> &depth_files,
+                       int num_threads = 0,
+                       size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                       const core::Device &device = core::Device("CPU:0"));
+
+    RGBDPrefetchReader(const RGBDPrefetchReader &) = delete;
+    RGBDPrefetchReader &operator=(const RGBDPrefetchReader &) = delete;
+    ~RGBDPrefetchReader();
+
+    /// \brief Check if all frames are read.
+    ///
+    /// Blocks until the next frame is decoded or the end of the sequence is
+    /// known.
+    bool IsEOF();
+
+    /// \brief Returns the next frame in sequence order.
+    ///
+    /// Blocks until the frame is decoded. Returns an empty RGBDImage past the
+    /// last frame.
+    t::geometry::RGBDImage NextFrame();
+
+    /// Stops the decode threads. Frames that are not read yet are discarded.
+    void Close();
+
+    /// Number of frames returned by NextFrame() so far.
+    int64_t GetFrameIndex() const;
+
+private:
+    void Start(int num_threads);
+    void DecodeLoop();
+
+    FrameLoader loader_;
+    core::Device device_;
+    /// Circular look-ahead buffer. Frame i is stored in slot i % size.
+    std::vector<t::geometry::RGBDImage> frame_buffer_;
+    std::vector<bool> is_ready_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable frame_ready_;
+    std::condition_variable slot_free_;
+    int64_t next_decode_ = 0;  ///< Next frame claimed by a decode thread.
+    int64_t next_read_ = 0;    ///< Next frame returned by NextFrame().
+    /// Number of frames, known once a loader returns false or throws.
+    int64_t num_frames_ = INT64_MAX;
+    std::exception_ptr error_;
+    bool stop_ = false;
+    std::vector<std::thread> decode_threads_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,725 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/color_map/ColorMapOptimizer.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/RaycastingScene.h"
+#include "open3d/utility/Eigen.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+namespace {
+
+/// Image warping field of one camera: a grid of anchor points, each holding
+/// the warped pixel position of its initial position. See
+/// open3d::pipelines::color_map::ImageWarpingField.
+class WarpingField {
+public:
+    void Init(int64_t rows, int64_t cols, int number_of_vertical_anchors) {
+        anchor_h_ = number_of_vertical_anchors;
+        anchor_step_ = double(rows) / (anchor_h_ - 1);
+        anchor_w_ = int(std::ceil(double(cols) / anchor_step_) + 1);
+        flow_.resize(anchor_w_ * anchor_h_ * 2);
+        for (int j = 0; j < anchor_h_; j++) {
+            for (int i = 0; i < anchor_w_; i++) {
+                flow_((i + j * anchor_w_) * 2) = i * anchor_step_;
+                flow_((i + j * anchor_w_) * 2 + 1) = j * anchor_step_;
+            }
+        }
+        initial_flow_ = flow_;
+    }
+
+    /// Finds the anchor cell (i, j) containing the pixel (u, v) and the
+    /// bilinear coordinates (p, q) of the pixel in the cell.
+    bool Locate(double u, double v, int& i, int& j, double& p, double& q)
+            const {
+        if (!(u >= 0 && v >= 0)) return false;
+        i = int(u / anchor_step_);
+        j = int(v / anchor_step_);
+        if (i >= anchor_w_ - 1 || j >= anchor_h_ - 1) return false;
+        p = (u - i * anchor_step_) / anchor_step_;
+        q = (v - j * anchor_step_) / anchor_step_;
+        return true;
+    }
+
+    Eigen::Vector2d Anchor(int i, int j) const {
+        return flow_.segment<2>((i + j * anchor_w_) * 2);
+    }
+
+    bool Warp(double u, double v, double& uu, double& vv) const {
+        int i, j;
+        double p, q;
+        if (!Locate(u, v, i, j, p, q)) return false;
+        const Eigen::Vector2d uv = (1 - p) * (1 - q) * Anchor(i, j) +
+                                   (1 - p) * q * Anchor(i, j + 1) +
+                                   p * (1 - q) * Anchor(i + 1, j) +
+                                   p * q * Anchor(i + 1, j + 1);
+        uu = uv(0);
+        vv = uv(1);
+        return true;
+    }
+
+    int anchor_w_ = 0;
+    int anchor_h_ = 0;
+    double anchor_step_ = 0;
+    Eigen::VectorXd flow_;
+    Eigen::VectorXd initial_flow_;
+};
+
+/// Images and state of one camera. All tensors are contiguous on the CPU.
+struct Camera {
+    /// (rows, cols, 1) Float32 gray images and their gradients on each
+    /// pyramid level, from fine to coarse.
+    std::vector<core::Tensor> gray_;
+    std::vector<core::Tensor> dx_;
+    std::vector<core::Tensor> dy_;
+    /// (rows, cols, 3) Float32 color image.
+    core::Tensor color_;
+    int64_t rows_ = 0;
+    int64_t cols_ = 0;
+    Eigen::Matrix3d intrinsic_;
+    Eigen::Matrix4d_u extrinsic_;
+    WarpingField warping_field_;
+    /// Vertices visible from the camera.
+    std::vector<int64_t> visible_vertices_;
+};
+
+/// Bilinear interpolation of a 1 channel Float32 image.
+inline bool Interpolate(const core::Tensor& image,
+                        double u,
+                        double v,
+                        double& value) {
+    const int64_t rows = image.GetShape(0);
+    const int64_t cols = image.GetShape(1);
+    if (!(u >= 0 && v >= 0 && u < cols - 1 && v < rows - 1)) return false;
+    const int64_t u0 = int64_t(u);
+    const int64_t v0 = int64_t(v);
+    const double pu = u - u0;
+    const double pv = v - v0;
+    const float* data = image.GetDataPtr<float>() + v0 * cols + u0;
+    value = (1 - pu) * (1 - pv) * data[0] + pu * (1 - pv) * data[1] +
+            (1 - pu) * pv * data[cols] + pu * pv * data[cols + 1];
+    return true;
+}
+
+/// Transforms a world point into the camera frame \p G and projects it to the
+/// full resolution pixel (u, v).
+inline bool Project(const Camera& camera,
+                    const double* X,
+                    Eigen::Vector3d& G,
+                    double& u,
+                    double& v) {
+    G = camera.extrinsic_.block<3, 3>(0, 0) *
+                Eigen::Vector3d(X[0], X[1], X[2]) +
+        camera.extrinsic_.block<3, 1>(0, 3);
+    if (G(2) <= 0) return false;
+    const Eigen::Matrix3d& K = camera.intrinsic_;
+    u = K(0, 0) * G(0) / G(2) + K(0, 2);
+    v = K(1, 1) * G(1) / G(2) + K(1, 2);
+    return true;
+}
+
+inline bool InImage(const Camera& camera, double u, double v, int margin) {
+    return u >= margin && u < camera.cols_ - margin && v >= margin &&
+           v < camera.rows_ - margin;
+}
+
+/// Returns the full resolution pixel of a world point in the warped image.
+inline bool GetPixel(const Camera& camera,
+                     bool non_rigid,
+                     const double* X,
+                     int margin,
+                     double& u,
+                     double& v) {
+    Eigen::Vector3d G;
+    if (!Project(camera, X, G, u, v) || !InImage(camera, u, v, margin)) {
+        return false;
+    }
+    if (non_rigid) {
+        return camera.warping_field_.Warp(u, v, u, v) &&
+               InImage(camera, u, v, margin);
+    }
+    return true;
+}
+
+Camera CreateCamera(const t::geometry::RGBDImage& rgbd,
+                    const core::Tensor& intrinsic,
+                    const core::Tensor& extrinsic,
+                    const ColorMapOptimizationOption& option) {
+    const core::Device host("CPU:0");
+    Camera camera;
+    camera.intrinsic_ = core::eigen_converter::TensorToEigenMatrixXd(
+            intrinsic.To(host, core::Float64));
+    camera.extrinsic_ = core::eigen_converter::TensorToEigenMatrixXd(
+            extrinsic.To(host, core::Float64));
+
+    if (rgbd.color_.GetChannels() != 3) {
+        utility::LogError("Color images must have 3 channels, but got {}.",
+                          rgbd.color_.GetChannels());
+    }
+    // UInt8 and UInt16 colors are scaled to [0, 1].
+    const t::geometry::Image color =
+            rgbd.color_.To(host).To(core::Float32, /*copy=*/false);
+    camera.rows_ = color.GetRows();
+    camera.cols_ = color.GetCols();
+    camera.color_ = color.AsTensor().Contiguous();
+
+    t::geometry::Image gray = color.RGBToGray().FilterGaussian(3);
+    const int n_levels = int(option.iterations_.size());
+    for (int level = 0; level < n_levels; ++level) {
+        const auto gradient = gray.FilterSobel(3);
+        camera.gray_.push_back(gray.AsTensor().Contiguous());
+        camera.dx_.push_back(gradient.first.AsTensor().Contiguous());
+        camera.dy_.push_back(gradient.second.AsTensor().Contiguous());
+        if (level + 1 < n_levels) {
+            gray = gray.PyrDown();
+        }
+    }
+
+    if (option.non_rigid_camera_coordinate_) {
+        camera.warping_field_.Init(camera.rows_, camera.cols_,
+                                   option.number_of_vertical_anchors_);
+    }
+    return camera;
+}
+
+/// Finds the vertices visible from \p camera: they must project onto valid
+/// depth close to their own depth away from depth discontinuities, and must
+/// not be occluded by the mesh.
+void ComputeVisibility(Camera& camera,
+                       const t::geometry::Image& depth_raw,
+                       const core::Tensor& vertices,
+                       t::geometry::RaycastingScene* scene,
+                       const ColorMapOptimizationOption& option) {
+    const t::geometry::Image depth =
+            depth_raw.To(core::Device("CPU:0"))
+                    .ClipTransform(option.depth_scale_, 0.0f,
+                                   std::numeric_limits<float>::infinity());
+    if (depth.GetRows() != camera.rows_ || depth.GetCols() != camera.cols_) {
+        utility::LogError(
+                "Color image of size {}x{} and depth image of size {}x{} "
+                "differ.",
+                camera.cols_, camera.rows_, depth.GetCols(), depth.GetRows());
+    }
+
+    // Depth discontinuity mask.
+    const auto gradient = depth.FilterSobel(3);
+    const core::Tensor& dx = gradient.first.AsTensor();
+    const core::Tensor& dy = gradient.second.AsTensor();
+    const double threshold = option.depth_threshold_for_discontinuity_check_;
+    t::geometry::Image mask(
+            (dx * dx + dy * dy).Sqrt().Gt(threshold).To(core::UInt8));
+    if (option.half_dilation_kernel_size_for_discontinuity_map_ > 0) {
+        mask = mask.Dilate(
+                2 * option.half_dilation_kernel_size_for_discontinuity_map_ +
+                1);
+    }
+    const core::Tensor depth_t = depth.AsTensor().Contiguous();
+    const core::Tensor mask_t = mask.AsTensor().Contiguous();
+    const float* depth_ptr = depth_t.GetDataPtr<float>();
+    const uint8_t* mask_ptr = mask_t.GetDataPtr<uint8_t>();
+
+    const int64_t n_vertex = vertices.GetLength();
+    const double* vertices_ptr = vertices.GetDataPtr<double>();
+    std::vector<uint8_t> candidate(n_vertex, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n_vertex; ++i) {
+        Eigen::Vector3d G;
+        double u, v;
+        if (!Project(camera, vertices_ptr + 3 * i, G, u, v)) continue;
+        const int64_t u_d = int64_t(std::round(u));
+        const int64_t v_d = int64_t(std::round(v));
+        if (u_d < 0 || u_d >= camera.cols_ || v_d < 0 ||
+            v_d >= camera.rows_) {
+            continue;
+        }
+        const int64_t pixel = v_d * camera.cols_ + u_d;
+        const float d_sensor = depth_ptr[pixel];
+        if (d_sensor > option.maximum_allowable_depth_ || mask_ptr[pixel] ||
+            std::abs(G(2) - d_sensor) >=
+                    option.depth_threshold_for_visibility_check_) {
+            continue;
+        }
+        candidate[i] = 1;
+    }
+    std::vector<int64_t> candidates;
+    for (int64_t i = 0; i < n_vertex; ++i) {
+        if (candidate[i]) candidates.push_back(i);
+    }
+    if (scene == nullptr || candidates.empty()) {
+        camera.visible_vertices_ = std::move(candidates);
+        return;
+    }
+
+    // Rays from the camera center to the vertices, which are hit at t = 1.
+    const Eigen::Matrix3d R = camera.extrinsic_.block<3, 3>(0, 0);
+    const Eigen::Vector3d center =
+            -R.transpose() * camera.extrinsic_.block<3, 1>(0, 3);
+    const int64_t n_candidate = int64_t(candidates.size());
+    core::Tensor rays({n_candidate, 6}, core::Float32);
+    std::vector<float> distances(n_candidate);
+    float* rays_ptr = rays.GetDataPtr<float>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < n_candidate; ++k) {
+        const double* X = vertices_ptr + 3 * candidates[k];
+        const Eigen::Vector3d direction =
+                Eigen::Vector3d(X[0], X[1], X[2]) - center;
+        for (int d = 0; d < 3; ++d) {
+            rays_ptr[6 * k + d] = float(center(d));
+            rays_ptr[6 * k + 3 + d] = float(direction(d));
+        }
+        distances[k] = float(direction.norm());
+    }
+    const core::Tensor t_hit = scene->CastRays(rays)["t_hit"].Contiguous();
+    const float* t_hit_ptr = t_hit.GetDataPtr<float>();
+    for (int64_t k = 0; k < n_candidate; ++k) {
+        if (t_hit_ptr[k] * distances[k] >=
+            distances[k] - option.depth_threshold_for_visibility_check_) {
+            camera.visible_vertices_.push_back(candidates[k]);
+        }
+    }
+}
+
+/// Sets the proxy intensity of each vertex to its average intensity in the
+/// images of \p level it is visible in.
+void SetProxyIntensity(const std::vector<Camera>& cameras,
+                       const core::Tensor& vertices,
+                       const std::vector<int64_t>& vertex_camera_offsets,
+                       const std::vector<int>& vertex_cameras,
+                       int level,
+                       const ColorMapOptimizationOption& option,
+                       std::vector<double>& proxy_intensity) {
+    const int64_t n_vertex = vertices.GetLength();
+    const double* vertices_ptr = vertices.GetDataPtr<double>();
+    const double scale = std::ldexp(1.0, -level);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n_vertex; ++i) {
+        double sum = 0.0;
+        int count = 0;
+        for (int64_t k = vertex_camera_offsets[i];
+             k < vertex_camera_offsets[i + 1]; ++k) {
+            const Camera& camera = cameras[vertex_cameras[k]];
+            double u, v, gray;
+            if (GetPixel(camera, option.non_rigid_camera_coordinate_,
+                         vertices_ptr + 3 * i, option.image_boundary_margin_,
+                         u, v) &&
+                Interpolate(camera.gray_[level], u * scale, v * scale, gray)) {
+                sum += gray;
+                count++;
+            }
+        }
+        proxy_intensity[i] = count > 0 ? sum / count : 0.0;
+    }
+}
+
+/// Computes the intensity and its gradient with respect to the full
+/// resolution pixel (u, v) on \p level.
+inline bool GetIntensityAndGradient(const Camera& camera,
+                                    int level,
+                                    double u,
+                                    double v,
+                                    double& gray,
+                                    double& dIdu,
+                                    double& dIdv) {
+    const double scale = std::ldexp(1.0, -level);
+    if (!Interpolate(camera.gray_[level], u * scale, v * scale, gray) ||
+        !Interpolate(camera.dx_[level], u * scale, v * scale, dIdu) ||
+        !Interpolate(camera.dy_[level], u * scale, v * scale, dIdv)) {
+        return false;
+    }
+    dIdu *= scale;
+    dIdv *= scale;
+    return true;
+}
+
+/// Jacobian of the intensity with respect to the camera pose, given the
+/// intensity gradient (dIdu, dIdv) at the projection of the camera point G.
+inline Eigen::Vector6d ComputePoseJacobian(const Eigen::Matrix3d& K,
+                                           const Eigen::Vector3d& G,
+                                           double dIdu,
+                                           double dIdv) {
+    const double invz = 1. / G(2);
+    const double v0 = dIdu * K(0, 0) * invz;
+    const double v1 = dIdv * K(1, 1) * invz;
+    const double v2 = -(v0 * G(0) + v1 * G(1)) * invz;
+    Eigen::Vector6d J;
+    J << -G(2) * v1 + G(1) * v2, G(2) * v0 - G(0) * v2, -G(1) * v0 + G(0) * v1,
+            v0, v1, v2;
+    return J;
+}
+
+/// One Gauss-Newton step on the pose of \p camera. Returns the sum of squared
+/// residuals and adds the number of residuals to \p count.
+double OptimizeCameraRigid(Camera& camera,
+                           const double* vertices_ptr,
+                           const std::vector<double>& proxy_intensity,
+                           int level,
+                           const ColorMapOptimizationOption& option,
+                           int64_t& count) {
+    Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+    double r2 = 0.0;
+    for (const int64_t vid : camera.visible_vertices_) {
+        Eigen::Vector3d G;
+        double u, v, gray, dIdu, dIdv;
+        if (!Project(camera, vertices_ptr + 3 * vid, G, u, v) ||
+            !InImage(camera, u, v, option.image_boundary_margin_) ||
+            !GetIntensityAndGradient(camera, level, u, v, gray, dIdu, dIdv)) {
+            continue;
+        }
+        const Eigen::Vector6d J =
+                ComputePoseJacobian(camera.intrinsic_, G, dIdu, dIdv);
+        const double r = gray - proxy_intensity[vid];
+        JTJ.noalias() += J * J.transpose();
+        JTr.noalias() += J * r;
+        r2 += r * r;
+        count++;
+    }
+
+    bool success;
+    Eigen::Matrix4d delta;
+    std::tie(success, delta) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+    if (success) {
+        camera.extrinsic_ = delta * camera.extrinsic_;
+    }
+    return r2;
+}
+
+/// One Gauss-Newton step on the pose and the warping field of \p camera.
+double OptimizeCameraNonRigid(Camera& camera,
+                              const double* vertices_ptr,
+                              int64_t n_vertex,
+                              const std::vector<double>& proxy_intensity,
+                              int level,
+                              const ColorMapOptimizationOption& option,
+                              int64_t& count) {
+    WarpingField& field = camera.warping_field_;
+    const int n_flow = int(field.flow_.size());
+    Eigen::MatrixXd JTJ = Eigen::MatrixXd::Zero(6 + n_flow, 6 + n_flow);
+    Eigen::VectorXd JTr = Eigen::VectorXd::Zero(6 + n_flow);
+    Eigen::Matrix<double, 14, 1> J;
+    Eigen::Matrix<int, 14, 1> pattern;
+    double r2 = 0.0;
+    for (const int64_t vid : camera.visible_vertices_) {
+        Eigen::Vector3d G;
+        double u, v, p, q;
+        int i, j;
+        if (!Project(camera, vertices_ptr + 3 * vid, G, u, v) ||
+            !InImage(camera, u, v, option.image_boundary_margin_) ||
+            !field.Locate(u, v, i, j, p, q)) {
+            continue;
+        }
+        const Eigen::Vector2d anchors[4] = {
+                field.Anchor(i, j), field.Anchor(i, j + 1),
+                field.Anchor(i + 1, j), field.Anchor(i + 1, j + 1)};
+        const Eigen::Vector2d uv =
+                (1 - p) * (1 - q) * anchors[0] + (1 - p) * q * anchors[1] +
+                p * (1 - q) * anchors[2] + p * q * anchors[3];
+        double gray;
+        Eigen::Vector2d dIdf;
+        if (!InImage(camera, uv(0), uv(1), option.image_boundary_margin_) ||
+            !GetIntensityAndGradient(camera, level, uv(0), uv(1), gray,
+                                     dIdf(0), dIdf(1))) {
+            continue;
+        }
+        const Eigen::Vector2d dfdu = ((anchors[2] - anchors[0]) * (1 - q) +
+                                      (anchors[3] - anchors[1]) * q) /
+                                     field.anchor_step_;
+        const Eigen::Vector2d dfdv = ((anchors[1] - anchors[0]) * (1 - p) +
+                                      (anchors[3] - anchors[2]) * p) /
+                                     field.anchor_step_;
+        J.head<6>() = ComputePoseJacobian(camera.intrinsic_, G, dIdf.dot(dfdu),
+                                          dIdf.dot(dfdv));
+        const double weights[4] = {(1 - p) * (1 - q), (1 - p) * q,
+                                   p * (1 - q), p * q};
+        const int cells[4] = {i + j * field.anchor_w_,
+                              i + (j + 1) * field.anchor_w_,
+                              (i + 1) + j * field.anchor_w_,
+                              (i + 1) + (j + 1) * field.anchor_w_};
+        for (int k = 0; k < 6; ++k) {
+            pattern(k) = k;
+        }
+        for (int a = 0; a < 4; ++a) {
+            for (int d = 0; d < 2; ++d) {
+                J(6 + 2 * a + d) = dIdf(d) * weights[a];
+                pattern(6 + 2 * a + d) = 6 + cells[a] * 2 + d;
+            }
+        }
+        const double r = gray - proxy_intensity[vid];
+        for (int x = 0; x < 14; ++x) {
+            for (int y = 0; y < 14; ++y) {
+                JTJ(pattern(x), pattern(y)) += J(x) * J(y);
+            }
+            JTr(pattern(x)) += J(x) * r;
+        }
+        r2 += r * r;
+        count++;
+    }
+
+    // Keep the anchor points close to their initial positions.
+    const double weight = option.non_rigid_anchor_point_weight_ *
+                          camera.visible_vertices_.size() / n_vertex;
+    for (int k = 0; k < n_flow; ++k) {
+        const double r = weight * (field.flow_(k) - field.initial_flow_(k));
+        JTJ(6 + k, 6 + k) += weight * weight;
+        JTr(6 + k) += weight * r;
+    }
+
+    bool success;
+    Eigen::VectorXd delta;
+    std::tie(success, delta) = utility::SolveLinearSystemPSD(JTJ, -JTr);
+    if (success) {
+        const Eigen::Vector6d delta_pose = delta.head<6>();
+        camera.extrinsic_ = utility::TransformVector6dToMatrix4d(delta_pose) *
+                            camera.extrinsic_;
+        field.flow_ += delta.tail(n_flow);
+    }
+    return r2;
+}
+
+/// Averages the vertex colors over the images they are visible in, and fills
+/// invisible vertices from their nearest visible neighbors.
+core::Tensor ComputeVertexColors(
+        const std::vector<Camera>& cameras,
+        const core::Tensor& vertices,
+        const std::vector<int64_t>& vertex_camera_offsets,
+        const std::vector<int>& vertex_cameras,
+        const ColorMapOptimizationOption& option) {
+    const int64_t n_vertex = vertices.GetLength();
+    const double* vertices_ptr = vertices.GetDataPtr<double>();
+    core::Tensor colors = core::Tensor::Zeros({n_vertex, 3}, core::Float32);
+    float* colors_ptr = colors.GetDataPtr<float>();
+    std::vector<uint8_t> valid(n_vertex, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n_vertex; ++i) {
+        Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+        int count = 0;
+        for (int64_t k = vertex_camera_offsets[i];
+             k < vertex_camera_offsets[i + 1]; ++k) {
+            const Camera& camera = cameras[vertex_cameras[k]];
+            double u, v;
+            if (!GetPixel(camera, option.non_rigid_camera_coordinate_,
+                          vertices_ptr + 3 * i, option.image_boundary_margin_,
+                          u, v)) {
+                continue;
+            }
+            const int64_t pixel = int64_t(std::round(v)) * camera.cols_ +
+                                  int64_t(std::round(u));
+            const float* color = camera.color_.GetDataPtr<float>() + 3 * pixel;
+            sum += Eigen::Vector3d(color[0], color[1], color[2]);
+            count++;
+        }
+        if (count > 0) {
+            for (int d = 0; d < 3; ++d) {
+                colors_ptr[3 * i + d] = float(sum(d) / count);
+            }
+            valid[i] = 1;
+        }
+    }
+
+    if (option.invisible_vertex_color_knn_ <= 0) {
+        return colors;
+    }
+    std::vector<int64_t> valid_ids, invalid_ids;
+    for (int64_t i = 0; i < n_vertex; ++i) {
+        (valid[i] ? valid_ids : invalid_ids).push_back(i);
+    }
+    if (valid_ids.empty() || invalid_ids.empty()) {
+        return colors;
+    }
+    const core::Tensor valid_indices(valid_ids, {int64_t(valid_ids.size())},
+                                     core::Int64);
+    const core::Tensor invalid_indices(
+            invalid_ids, {int64_t(invalid_ids.size())}, core::Int64);
+    const int knn = std::min(option.invisible_vertex_color_knn_,
+                             int(valid_ids.size()));
+    core::nns::NearestNeighborSearch nns(vertices.IndexGet({valid_indices}));
+    nns.KnnIndex();
+    const core::Tensor neighbors =
+            nns.KnnSearch(vertices.IndexGet({invalid_indices}), knn).first;
+    const core::Tensor neighbor_colors =
+            colors.IndexGet({valid_indices})
+                    .IndexGet({neighbors.Reshape({-1})})
+                    .Reshape({int64_t(invalid_ids.size()), knn, 3});
+    colors.IndexSet({invalid_indices}, neighbor_colors.Mean({1}));
+    return colors;
+}
+
+}  // namespace
+
+ColorMapOptimizationResult RunColorMapOptimization(
+        const t::geometry::TriangleMesh& mesh,
+        const std::vector<t::geometry::RGBDImage>& images_rgbd,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        const ColorMapOptimizationOption& option) {
+    const int64_t n_camera = int64_t(images_rgbd.size());
+    if (n_camera == 0) {
+        utility::LogError("No RGB-D images are given.");
+    }
+    if (!mesh.HasVertexPositions() ||
+        mesh.GetVertexPositions().GetLength() == 0) {
+        utility::LogError("The mesh has no vertices.");
+    }
+    if (intrinsics.NumDims() == 2) {
+        core::AssertTensorShape(intrinsics, {3, 3});
+    } else {
+        core::AssertTensorShape(intrinsics, {n_camera, 3, 3});
+    }
+    core::AssertTensorShape(extrinsics, {n_camera, 4, 4});
+    if (option.iterations_.empty()) {
+        utility::LogError("At least one pyramid level is required.");
+    }
+    if (option.non_rigid_camera_coordinate_ &&
+        option.number_of_vertical_anchors_ < 2) {
+        utility::LogError("At least 2 vertical anchors are required, got {}.",
+                          option.number_of_vertical_anchors_);
+    }
+
+    const core::Device host("CPU:0");
+    const core::Tensor vertices =
+            mesh.GetVertexPositions().To(host, core::Float64).Contiguous();
+    const int64_t n_vertex = vertices.GetLength();
+    const double* vertices_ptr = vertices.GetDataPtr<double>();
+
+    std::unique_ptr<t::geometry::RaycastingScene> scene;
+    if (mesh.HasTriangleIndices() &&
+        mesh.GetTriangleIndices().GetLength() > 0) {
+        scene = std::make_unique<t::geometry::RaycastingScene>();
+        scene->AddTriangles(vertices.To(core::Float32),
+                            mesh.GetTriangleIndices().To(host, core::UInt32));
+    }
+
+    utility::LogDebug("[ColorMapOptimization] Preprocessing images");
+    std::vector<Camera> cameras;
+    cameras.reserve(n_camera);
+    for (int64_t c = 0; c < n_camera; ++c) {
+        cameras.push_back(CreateCamera(
+                images_rgbd[c],
+                intrinsics.NumDims() == 2 ? intrinsics : intrinsics[c],
+                extrinsics[c], option));
+        ComputeVisibility(cameras.back(), images_rgbd[c].depth_, vertices,
+                          scene.get(), option);
+        utility::LogDebug("[cam {:d}]: {:d}/{:d} vertices are visible", c,
+                          cameras.back().visible_vertices_.size(), n_vertex);
+        if (option.non_rigid_camera_coordinate_ &&
+            (cameras.back().rows_ != cameras[0].rows_ ||
+             cameras.back().cols_ != cameras[0].cols_)) {
+            utility::LogError(
+                    "Non-rigid optimization requires images of the same "
+                    "size.");
+        }
+    }
+    scene.reset();
+
+    // Cameras each vertex is visible in, as a compressed list.
+    std::vector<int64_t> vertex_camera_offsets(n_vertex + 1, 0);
+    for (const Camera& camera : cameras) {
+        for (const int64_t vid : camera.visible_vertices_) {
+            vertex_camera_offsets[vid + 1]++;
+        }
+    }
+    for (int64_t i = 0; i < n_vertex; ++i) {
+        vertex_camera_offsets[i + 1] += vertex_camera_offsets[i];
+    }
+    std::vector<int> vertex_cameras(vertex_camera_offsets[n_vertex]);
+    std::vector<int64_t> cursor(vertex_camera_offsets.begin(),
+                                vertex_camera_offsets.end() - 1);
+    for (int64_t c = 0; c < n_camera; ++c) {
+        for (const int64_t vid : cameras[c].visible_vertices_) {
+            vertex_cameras[cursor[vid]++] = int(c);
+        }
+    }
+
+    utility::LogDebug("[ColorMapOptimization] {} optimization",
+                      option.non_rigid_camera_coordinate_ ? "Non-rigid"
+                                                          : "Rigid");
+    ColorMapOptimizationResult result;
+    std::vector<double> proxy_intensity(n_vertex, 0.0);
+    const int n_levels = int(option.iterations_.size());
+    for (int k = 0; k < n_levels; ++k) {
+        const int level = n_levels - 1 - k;
+        SetProxyIntensity(cameras, vertices, vertex_camera_offsets,
+                          vertex_cameras, level, option, proxy_intensity);
+        for (int itr = 0; itr < option.iterations_[k]; ++itr) {
+            double r2 = 0.0;
+            int64_t count = 0;
+            // Cameras are independent given the proxy intensities, so each
+            // thread solves whole cameras and only the residuals are reduced.
+#pragma omp parallel for schedule(dynamic) reduction(+ : r2, count) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int64_t c = 0; c < n_camera; ++c) {
+                if (option.non_rigid_camera_coordinate_) {
+                    r2 += OptimizeCameraNonRigid(cameras[c], vertices_ptr,
+                                                 n_vertex, proxy_intensity,
+                                                 level, option, count);
+                } else {
+                    r2 += OptimizeCameraRigid(cameras[c], vertices_ptr,
+                                              proxy_intensity, level, option,
+                                              count);
+                }
+            }
+            result.residual_ = count > 0 ? r2 / count : 0.0;
+            utility::LogDebug(
+                    "[Level {:d}, iteration {:04d}] Residual error : {:.6f}",
+                    level, itr + 1, result.residual_);
+            SetProxyIntensity(cameras, vertices, vertex_camera_offsets,
+                              vertex_cameras, level, option, proxy_intensity);
+        }
+    }
+
+    utility::LogDebug("[ColorMapOptimization] Set Mesh Color");
+    result.mesh_ = mesh.Clone();
+    result.mesh_.SetVertexColors(
+            ComputeVertexColors(cameras, vertices, vertex_camera_offsets,
+                                vertex_cameras, option)
+                    .To(mesh.GetDevice()));
+
+    result.extrinsics_ = core::Tensor::Empty({n_camera, 4, 4}, core::Float64);
+    for (int64_t c = 0; c < n_camera; ++c) {
+        result.extrinsics_[c] = core::eigen_converter::EigenMatrixToTensor(
+                Eigen::Matrix4d(cameras[c].extrinsic_));
+    }
+    result.extrinsics_ = result.extrinsics_.To(extrinsics.GetDevice());
+
+    if (option.non_rigid_camera_coordinate_) {
+        const WarpingField& field = cameras[0].warping_field_;
+        result.warping_fields_ = core::Tensor::Empty(
+                {n_camera, field.anchor_h_, field.anchor_w_, 2},
+                core::Float64);
+        for (int64_t c = 0; c < n_camera; ++c) {
+            const Eigen::VectorXd& flow = cameras[c].warping_field_.flow_;
+            std::memcpy(result.warping_fields_[c].GetDataPtr<double>(),
+                        flow.data(), sizeof(double) * flow.size());
+        }
+    }
+    return result;
+}
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+class ColorMapOptimizationOption {
+public:
+    /// If true, each image is additionally deformed by a warping field of
+    /// anchor points (non-rigid optimization), otherwise only the camera poses
+    /// are optimized (rigid optimization).
+    bool non_rigid_camera_coordinate_ = false;
+
+    /// Number of vertical anchor points of the image warping field. The number
+    /// of horizontal anchor points is computed from the aspect ratio. Only
+    /// used for non-rigid optimization.
+    int number_of_vertical_anchors_ = 16;
+
+    /// Weight of the regularizer keeping anchor points at their initial
+    /// position. Only used for non-rigid optimization.
+    double non_rigid_anchor_point_weight_ = 0.316;
+
+    /// Number of iterations on each level of the image pyramid, from coarse to
+    /// fine. The number of pyramid levels is the size of this vector.
+    std::vector<int> iterations_ = {100, 100, 100};
+
+    /// Scale factor to convert raw depth values into meters.
+    float depth_scale_ = 1000.0f;
+
+    /// Points with a depth larger than maximum_allowable_depth in an RGB-D
+    /// image are invisible for the camera of that image.
+    double maximum_allowable_depth_ = 2.5;
+
+    /// Points whose depth differs from the depth image by more than this value,
+    /// or which are occluded by the mesh by more than this value, are
+    /// invisible for the camera of that image.
+    double depth_threshold_for_visibility_check_ = 0.03;
+
+    /// Points are invisible if the depth gradient magnitude at their projection
+    /// is larger than this value.
+    double depth_threshold_for_discontinuity_check_ = 0.1;
+
+    /// Half size of the dilation kernel applied to the depth discontinuity
+    /// mask.
+    int half_dilation_kernel_size_for_discontinuity_map_ = 3;
+
+    /// Points projected into the image border of this width in pixels are
+    /// ignored.
+    int image_boundary_margin_ = 10;
+
+    /// Vertices invisible from all images get the average color of their k
+    /// nearest visible vertices. Set to 0 to leave them black.
+    int invisible_vertex_color_knn_ = 3;
+};
+
+/// \class ColorMapOptimizationResult
+/// \brief Result of RunColorMapOptimization().
+class ColorMapOptimizationResult {
+public:
+    /// Copy of the input mesh with optimized vertex colors.
+    t::geometry::TriangleMesh mesh_;
+    /// (N, 4, 4) Float64 optimized extrinsic matrices.
+    core::Tensor extrinsics_;
+    /// (N, anchor_h, anchor_w, 2) Float64 pixel positions of the anchor points
+    /// of the image warping fields. Empty for rigid optimization.
+    core::Tensor warping_fields_;
+    /// Mean squared intensity residual of the last iteration.
+    double residual_ = 0.0;
+};
+
+/// \brief Optimizes the camera poses, and optionally image warping fields, to
+/// maximize the photometric consistency of a mesh colored from RGB-D images.
+///
+/// Implements "Color Map Optimization for 3D Reconstruction with Consumer
+/// Depth Cameras", Zhou and Koltun, 2014. Vertex visibility is computed once
+/// from the depth images and by ray casting the mesh. Each iteration updates
+/// all cameras in parallel and then the vertex intensities. Computation runs
+/// on the CPU.
+///
+/// \param mesh The mesh to color.
+/// \param images_rgbd N RGB-D images with UInt8 or Float32 color and UInt16 or
+/// Float32 depth.
+/// \param intrinsics (3, 3) intrinsic matrix shared by all images, or
+/// (N, 3, 3) intrinsic matrices.
+/// \param extrinsics (N, 4, 4) initial world to camera transformations.
+/// \param option Optimization options.
+ColorMapOptimizationResult RunColorMapOptimization(
+        const t::geometry::TriangleMesh& mesh,
+        const std::vector<t::geometry::RGBDImage>& images_rgbd,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        const ColorMapOptimizationOption& option =
+                ColorMapOptimizationOption());
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
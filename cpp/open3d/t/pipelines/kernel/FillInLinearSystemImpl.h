@@ -5,9 +5,9 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
-#include "open3d/core/linalg/kernel/SVD3x3.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
+#include "open3d/t/pipelines/kernel/FillInLinearSystemJacobianImpl.h"
 
 namespace open3d {
 namespace t {
@@ -199,51 +199,16 @@ void FillInSLACAlignmentTermCPU
                 const float *cgrid_ratio_q =
                         cgrid_ratio_qs_ptr + 8 * workload_idx;
 
-                float r = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
-                          (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
-                          (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
-                if (abs(r) > threshold) return;
-
                 // Now we fill in a 60 x 60 sub-matrix: 2 x (6 + 8 x 3)
                 float J[60];
                 int idx[60];
-
-                // Jacobian w.r.t. Ti: 0-6
-                J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
-                J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
-                J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
-                J[3] = Ri_Cnormal_p[0];
-                J[4] = Ri_Cnormal_p[1];
-                J[5] = Ri_Cnormal_p[2];
-
-                // Jacobian w.r.t. Tj: 6-12
-                for (int k = 0; k < 6; ++k) {
-                    J[k + 6] = -J[k];
-
-                    idx[k + 0] = 6 * i + k;
-                    idx[k + 6] = 6 * j + k;
-                }
-
-                // Jacobian w.r.t. C over p: 12-36
-                for (int k = 0; k < 8; ++k) {
-                    J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
-                    J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
-                    J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
-
-                    idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
-                    idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
-                    idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
-                }
-
-                // Jacobian w.r.t. C over q: 36-60
-                for (int k = 0; k < 8; ++k) {
-                    J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
-                    J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
-                    J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
-
-                    idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
-                    idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
-                    idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
+                float r;
+                if (!GetSLACAlignmentJacobian(
+                            Ti_Cp, Tj_Cq, Cnormal_p, Ri_Cnormal_p,
+                            RjTRi_Cnormal_p, cgrid_idx_p, cgrid_idx_q,
+                            cgrid_ratio_p, cgrid_ratio_q, i, j, n_frags,
+                            threshold, J, idx, r)) {
+                    return;
                 }
 
         // Not optimized; Switch to reduction if necessary.
@@ -317,98 +282,23 @@ void FillInSLACRegularizerTermCPU
                 const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
                 const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
 
-                // Build a 3x3 linear system to compute the local R
-                float cov[3][3] = {{0}};
-                float U[3][3], V[3][3], S[3];
-
-                int cnt = 0;
-                for (int k = 0; k < 6; ++k) {
-                    bool mask_k = mask_nbs[k];
-                    if (!mask_k) continue;
-
-                    int idx_k = idx_nbs[k];
-
-                    // Now build linear systems
-                    float diff_ik_init[3] = {
-                            positions_init_ptr[idx_i * 3 + 0] -
-                                    positions_init_ptr[idx_k * 3 + 0],
-                            positions_init_ptr[idx_i * 3 + 1] -
-                                    positions_init_ptr[idx_k * 3 + 1],
-                            positions_init_ptr[idx_i * 3 + 2] -
-                                    positions_init_ptr[idx_k * 3 + 2]};
-                    float diff_ik_curr[3] = {
-                            positions_curr_ptr[idx_i * 3 + 0] -
-                                    positions_curr_ptr[idx_k * 3 + 0],
-                            positions_curr_ptr[idx_i * 3 + 1] -
-                                    positions_curr_ptr[idx_k * 3 + 1],
-                            positions_curr_ptr[idx_i * 3 + 2] -
-                                    positions_curr_ptr[idx_k * 3 + 2]};
-
-                    // Build linear system by computing XY^T when formulating Y
-                    // = RX Y: curr X: init
-                    for (int i = 0; i < 3; ++i) {
-                        for (int j = 0; j < 3; ++j) {
-                            cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
-                        }
-                    }
-                    ++cnt;
-                }
-
-                if (cnt < 3) {
-                    return;
-                }
-
-                core::linalg::kernel::svd3x3(*cov, *U, S, *V);
-
                 float R[3][3];
-                core::linalg::kernel::transpose3x3_(*U);
-                core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
-
-                float d = core::linalg::kernel::det3x3(*R);
-
-                if (d < 0) {
-                    U[2][0] = -U[2][0];
-                    U[2][1] = -U[2][1];
-                    U[2][2] = -U[2][2];
-                    core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+                if (!GetSLACRegularizerRotation(
+                            idx_i, idx_nbs, mask_nbs, positions_init_ptr,
+                            positions_curr_ptr, anchor_idx, R)) {
+                    return;
                 }
 
-                // Now we have R, we build Hessian and residuals
-                // But first, we need to anchor a point
-                if (idx_i == anchor_idx) {
-                    R[0][0] = R[1][1] = R[2][2] = 1;
-                    R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] =
-                            0;
-                }
                 for (int k = 0; k < 6; ++k) {
                     bool mask_k = mask_nbs[k];
 
                     if (mask_k) {
                         int idx_k = idx_nbs[k];
 
-                        float diff_ik_init[3] = {
-                                positions_init_ptr[idx_i * 3 + 0] -
-                                        positions_init_ptr[idx_k * 3 + 0],
-                                positions_init_ptr[idx_i * 3 + 1] -
-                                        positions_init_ptr[idx_k * 3 + 1],
-                                positions_init_ptr[idx_i * 3 + 2] -
-                                        positions_init_ptr[idx_k * 3 + 2]};
-                        float diff_ik_curr[3] = {
-                                positions_curr_ptr[idx_i * 3 + 0] -
-                                        positions_curr_ptr[idx_k * 3 + 0],
-                                positions_curr_ptr[idx_i * 3 + 1] -
-                                        positions_curr_ptr[idx_k * 3 + 1],
-                                positions_curr_ptr[idx_i * 3 + 2] -
-                                        positions_curr_ptr[idx_k * 3 + 2]};
-                        float R_diff_ik_curr[3];
-
-                        core::linalg::kernel::matmul3x3_3x1(*R, diff_ik_init,
-                                                            R_diff_ik_curr);
-
                         float local_r[3];
-                        local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
-                        local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
-                        local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+                        GetSLACRegularizerResidual(idx_i, idx_k, R,
+                                                   positions_init_ptr,
+                                                   positions_curr_ptr, local_r);
 
                         int offset_idx_i = 3 * idx_i + 6 * n_frags;
                         int offset_idx_k = 3 * idx_k + 6 * n_frags;
@@ -0,0 +1,192 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/linalg/kernel/SVD3x3.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+#ifndef __CUDACC__
+using std::abs;
+#endif
+
+/// Computes the point-to-plane residual \p r of a SLAC correspondence and its
+/// Jacobian \p J w.r.t. the 60 parameters \p idx it depends on: 2 x (6 pose
+/// parameters + 8 control grid points x 3). Returns false if |r| is larger
+/// than \p threshold.
+OPEN3D_HOST_DEVICE inline bool GetSLACAlignmentJacobian(
+        const float *Ti_Cp,
+        const float *Tj_Cq,
+        const float *Cnormal_p,
+        const float *Ri_Cnormal_p,
+        const float *RjTRi_Cnormal_p,
+        const int *cgrid_idx_p,
+        const int *cgrid_idx_q,
+        const float *cgrid_ratio_p,
+        const float *cgrid_ratio_q,
+        int i,
+        int j,
+        int n_frags,
+        float threshold,
+        float *J,
+        int *idx,
+        float &r) {
+    r = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
+        (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
+        (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
+    if (abs(r) > threshold) return false;
+
+    // Jacobian w.r.t. Ti: 0-6
+    J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
+    J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
+    J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
+    J[3] = Ri_Cnormal_p[0];
+    J[4] = Ri_Cnormal_p[1];
+    J[5] = Ri_Cnormal_p[2];
+
+    // Jacobian w.r.t. Tj: 6-12
+    for (int k = 0; k < 6; ++k) {
+        J[k + 6] = -J[k];
+
+        idx[k + 0] = 6 * i + k;
+        idx[k + 6] = 6 * j + k;
+    }
+
+    // Jacobian w.r.t. C over p: 12-36
+    for (int k = 0; k < 8; ++k) {
+        J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
+        J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
+        J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
+
+        idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
+        idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
+        idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
+    }
+
+    // Jacobian w.r.t. C over q: 36-60
+    for (int k = 0; k < 8; ++k) {
+        J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
+        J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
+        J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
+
+        idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
+        idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
+        idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
+    }
+    return true;
+}
+
+/// Difference between the positions of control grid points \p idx_i and
+/// \p idx_k.
+OPEN3D_HOST_DEVICE inline void GetSLACGridDifference(const float *positions,
+                                                     int idx_i,
+                                                     int idx_k,
+                                                     float *diff_ik) {
+    diff_ik[0] = positions[idx_i * 3 + 0] - positions[idx_k * 3 + 0];
+    diff_ik[1] = positions[idx_i * 3 + 1] - positions[idx_k * 3 + 1];
+    diff_ik[2] = positions[idx_i * 3 + 2] - positions[idx_k * 3 + 2];
+}
+
+/// Estimates the local rotation \p R of control grid point \p idx_i from its
+/// up to 6 neighbors. Returns false if less than 3 neighbors are valid. The
+/// rotation of the anchor point is fixed to identity.
+OPEN3D_HOST_DEVICE inline bool GetSLACRegularizerRotation(
+        int idx_i,
+        const int *idx_nbs,
+        const bool *mask_nbs,
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        int anchor_idx,
+        float R[3][3]) {
+    // Build a 3x3 linear system to compute the local R
+    float cov[3][3] = {{0}};
+    float U[3][3], V[3][3], S[3];
+
+    int cnt = 0;
+    for (int k = 0; k < 6; ++k) {
+        bool mask_k = mask_nbs[k];
+        if (!mask_k) continue;
+
+        int idx_k = idx_nbs[k];
+
+        // Now build linear systems
+        float diff_ik_init[3], diff_ik_curr[3];
+        GetSLACGridDifference(positions_init_ptr, idx_i, idx_k, diff_ik_init);
+        GetSLACGridDifference(positions_curr_ptr, idx_i, idx_k, diff_ik_curr);
+
+        // Build linear system by computing XY^T when formulating Y = RX
+        // Y: curr X: init
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
+            }
+        }
+        ++cnt;
+    }
+
+    if (cnt < 3) {
+        return false;
+    }
+
+    core::linalg::kernel::svd3x3(*cov, *U, S, *V);
+
+    core::linalg::kernel::transpose3x3_(*U);
+    core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+
+    float d = core::linalg::kernel::det3x3(*R);
+
+    if (d < 0) {
+        U[2][0] = -U[2][0];
+        U[2][1] = -U[2][1];
+        U[2][2] = -U[2][2];
+        core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+    }
+
+    // Now we have R, we build Hessian and residuals
+    // But first, we need to anchor a point
+    if (idx_i == anchor_idx) {
+        R[0][0] = R[1][1] = R[2][2] = 1;
+        R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] = 0;
+    }
+    return true;
+}
+
+/// Computes the residual \p local_r of the as-rigid-as-possible regularizer
+/// between control grid point \p idx_i with local rotation \p R and its
+/// neighbor \p idx_k.
+OPEN3D_HOST_DEVICE inline void GetSLACRegularizerResidual(
+        int idx_i,
+        int idx_k,
+        float R[3][3],
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        float *local_r) {
+    float diff_ik_init[3], diff_ik_curr[3];
+    GetSLACGridDifference(positions_init_ptr, idx_i, idx_k, diff_ik_init);
+    GetSLACGridDifference(positions_curr_ptr, idx_i, idx_k, diff_ik_curr);
+
+    float R_diff_ik_curr[3];
+    core::linalg::kernel::matmul3x3_3x1(*R, diff_ik_init, R_diff_ik_curr);
+
+    local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
+    local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
+    local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
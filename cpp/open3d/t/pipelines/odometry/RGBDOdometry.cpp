@@ -23,349 +23,240 @@ using core::Tensor;
 using t::geometry::Image;
 using t::geometry::RGBDImage;
 
-OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsic,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScaleHybrid(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScale(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& init_source_to_target,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const Method method,
-        const OdometryLossParams& params) {
-    // TODO (wei): more device check
-    const core::Device device = source.depth_.GetDevice();
-    core::AssertTensorDevice(target.depth_.AsTensor(), device);
-
+namespace {
+
+// Fills the pyramid of frame with the images the method needs when the frame
+// is used as source and/or as target.
+void CreatePyramid(OdometryFrame& frame,
+                   const RGBDImage& rgbd,
+                   const Tensor& intrinsics,
+                   const float depth_scale,
+                   const float depth_max,
+                   const int64_t n_levels,
+                   const Method method,
+                   const float depth_outlier_trunc,
+                   const bool as_source,
+                   const bool as_target) {
     core::AssertTensorShape(intrinsics, {3, 3});
-    core::AssertTensorShape(init_source_to_target, {4, 4});
-
-    // 4x4 transformations are always float64 and stay on CPU.
-    const core::Device host("CPU:0");
-    const Tensor intrinsics_d = intrinsics.To(host, core::Float64).Clone();
-    const Tensor trans_d =
-            init_source_to_target.To(host, core::Float64).Clone();
-
-    Image source_depth = source.depth_;
-    Image target_depth = target.depth_;
-
-    Image source_depth_processed =
-            source_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-    Image target_depth_processed =
-            target_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-
-    RGBDImage source_processed(source.color_, source_depth_processed);
-    RGBDImage target_processed(target.color_, target_depth_processed);
-
-    if (method == Method::PointToPlane) {
-        return RGBDOdometryMultiScalePointToPlane(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Intensity) {
-        return RGBDOdometryMultiScaleIntensity(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Hybrid) {
-        return RGBDOdometryMultiScaleHybrid(source_processed, target_processed,
-                                            intrinsics_d, trans_d, depth_scale,
-                                            depth_max, criteria, params);
-    } else {
+    if (n_levels < 1) {
+        utility::LogError("Number of pyramid levels must be positive, got {}.",
+                          n_levels);
+    }
+    if (method != Method::PointToPlane && method != Method::Intensity &&
+        method != Method::Hybrid) {
         utility::LogError("Odometry method not implemented.");
     }
 
-    return OdometryResult(trans_d);
-}
-
-OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_vertex_maps(n_levels);
-    std::vector<Tensor> target_vertex_maps(n_levels);
-    std::vector<Tensor> target_normal_maps(n_levels);
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Tensor intrinsics_pyr = intrinsics;
-
-    // Create image pyramid.
-    for (int64_t i = 0; i < n_levels; ++i) {
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_vertex_map =
-                target_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-
-        Image target_depth_curr_smooth =
-                target_depth_curr.FilterBilateral(5, 5, 10);
-        Image target_vertex_map_smooth =
-                target_depth_curr_smooth.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_normal_map = target_vertex_map_smooth.CreateNormalMap(NAN);
-
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-        target_vertex_maps[n_levels - 1 - i] = target_vertex_map.AsTensor();
-        target_normal_maps[n_levels - 1 - i] = target_normal_map.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
+    const bool point_to_plane = method == Method::PointToPlane;
+    const bool need_intensity = !point_to_plane;
+    const bool need_vertex_map = as_source || (as_target && point_to_plane);
+    const bool need_normal_map = as_target && point_to_plane;
+    const bool need_intensity_grad = as_target && need_intensity;
+    const bool need_depth_grad = as_target && method == Method::Hybrid;
+
+    frame = OdometryFrame();
+    frame.method_ = method;
+    frame.depth_outlier_trunc_ = depth_outlier_trunc;
+    frame.intrinsics_.resize(n_levels);
+    if (need_intensity) {
+        frame.depth_.resize(n_levels);
+        frame.intensity_.resize(n_levels);
     }
-
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultPointToPlane(
-                    source_vertex_maps[i], target_vertex_maps[i],
-                    target_normal_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
-            utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
-                              iter, delta_result.inlier_rmse_,
-                              delta_result.fitness_);
-
-            if (std::abs(result.fitness_ - delta_result.fitness_) /
-                                result.fitness_ <
-                        criteria[i].relative_fitness_ &&
-                std::abs(result.inlier_rmse_ - delta_result.inlier_rmse_) /
-                                result.inlier_rmse_ <
-                        criteria[i].relative_rmse_) {
-                utility::LogDebug("Early exit at level {}, iter {}", i, iter);
-                break;
-            }
-            result.inlier_rmse_ = delta_result.inlier_rmse_;
-            result.fitness_ = delta_result.fitness_;
-        }
+    if (need_vertex_map) frame.vertex_maps_.resize(n_levels);
+    if (need_normal_map) frame.normal_maps_.resize(n_levels);
+    if (need_intensity_grad) {
+        frame.intensity_dx_.resize(n_levels);
+        frame.intensity_dy_.resize(n_levels);
+    }
+    if (need_depth_grad) {
+        frame.depth_dx_.resize(n_levels);
+        frame.depth_dy_.resize(n_levels);
     }
 
-    return result;
-}
-
-OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
+    // 4x4 transformations are always float64 and stay on CPU.
+    Tensor intrinsics_pyr =
+            intrinsics.To(core::Device("CPU:0"), core::Float64).Clone();
+
+    Image depth_curr =
+            rgbd.depth_.ClipTransform(depth_scale, 0, depth_max, NAN);
+    Image intensity_curr;
+    if (need_intensity) {
+        intensity_curr = rgbd.color_.RGBToGray().To(core::Float32);
+    }
 
     // Create image pyramid
     for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
+        const int64_t level = n_levels - 1 - i;
+        frame.intrinsics_[level] = intrinsics_pyr.Clone();
 
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
+        if (need_vertex_map) {
+            frame.vertex_maps_[level] =
+                    depth_curr.CreateVertexMap(intrinsics_pyr, NAN).AsTensor();
+        }
+        if (need_normal_map) {
+            Image depth_curr_smooth = depth_curr.FilterBilateral(5, 5, 10);
+            Image vertex_map_smooth =
+                    depth_curr_smooth.CreateVertexMap(intrinsics_pyr, NAN);
+            frame.normal_maps_[level] =
+                    vertex_map_smooth.CreateNormalMap(NAN).AsTensor();
+        }
+        if (need_intensity) {
+            frame.depth_[level] = depth_curr.AsTensor();
+            frame.intensity_[level] = intensity_curr.AsTensor();
+        }
+        if (need_intensity_grad) {
+            auto intensity_grad = intensity_curr.FilterSobel();
+            frame.intensity_dx_[level] = intensity_grad.first.AsTensor();
+            frame.intensity_dy_[level] = intensity_grad.second.AsTensor();
+        }
+        if (need_depth_grad) {
+            auto depth_grad = depth_curr.FilterSobel();
+            frame.depth_dx_[level] = depth_grad.first.AsTensor();
+            frame.depth_dy_[level] = depth_grad.second.AsTensor();
+        }
 
         if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
+            depth_curr = depth_curr.PyrDownDepth(depth_outlier_trunc * 2, NAN);
+            if (need_intensity) {
+                intensity_curr = intensity_curr.PyrDown();
+            }
 
             intrinsics_pyr /= 2;
             intrinsics_pyr[-1][-1] = 1;
         }
     }
+}
 
-    // Odometry
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultIntensity(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_intensity_dx[i],
-                    target_intensity_dy[i], source_vertex_maps[i],
-                    intrinsic_matrices[i], result.transformation_,
-                    params.depth_outlier_trunc_, params.intensity_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
-            utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
-                              iter, delta_result.inlier_rmse_,
-                              delta_result.fitness_);
-
-            if (std::abs(result.fitness_ - delta_result.fitness_) /
-                                result.fitness_ <
-                        criteria[i].relative_fitness_ &&
-                std::abs(result.inlier_rmse_ - delta_result.inlier_rmse_) /
-                                result.inlier_rmse_ <
-                        criteria[i].relative_rmse_) {
-                utility::LogDebug("Early exit at level {}, iter {}", i, iter);
-                break;
-            }
-            result.inlier_rmse_ = delta_result.inlier_rmse_;
-            result.fitness_ = delta_result.fitness_;
+// Checks that the frame holds all images needed in its role.
+void CheckPyramid(const OdometryFrame& frame,
+                  const std::string& role,
+                  const Method method,
+                  const int64_t n_levels) {
+    if (frame.method_ != method) {
+        utility::LogError(
+                "The source and target frames were created for different "
+                "odometry methods.");
+    }
+    if (frame.GetNumLevels() != n_levels) {
+        utility::LogError(
+                "The {} frame has {} pyramid levels but the criteria list has "
+                "{} entries.",
+                role, frame.GetNumLevels(), n_levels);
+    }
+    auto CheckLevels = [&](const std::vector<Tensor>& images,
+                           const std::string& name) {
+        if (int64_t(images.size()) != n_levels) {
+            utility::LogError("The {} frame has no {} pyramid.", role, name);
+        }
+    };
+    const bool as_source = role == "source";
+    if (method == Method::PointToPlane) {
+        CheckLevels(frame.vertex_maps_, "vertex map");
+        if (!as_source) CheckLevels(frame.normal_maps_, "normal map");
+        return;
+    }
+    CheckLevels(frame.depth_, "depth");
+    CheckLevels(frame.intensity_, "intensity");
+    if (as_source) {
+        CheckLevels(frame.vertex_maps_, "vertex map");
+    } else {
+        CheckLevels(frame.intensity_dx_, "intensity gradient");
+        if (method == Method::Hybrid) {
+            CheckLevels(frame.depth_dx_, "depth gradient");
         }
     }
+}
 
-    return result;
+}  // namespace
+
+OdometryFrame::OdometryFrame(const RGBDImage& rgbd,
+                             const Tensor& intrinsics,
+                             const float depth_scale,
+                             const float depth_max,
+                             const int64_t num_levels,
+                             const Method method,
+                             const OdometryLossParams& params) {
+    CreatePyramid(*this, rgbd, intrinsics, depth_scale, depth_max, num_levels,
+                  method, params.depth_outlier_trunc_, /*as_source=*/true,
+                  /*as_target=*/true);
 }
 
-OdometryResult RGBDOdometryMultiScaleHybrid(
+OdometryResult RGBDOdometryMultiScale(
         const RGBDImage& source,
         const RGBDImage& target,
         const Tensor& intrinsics,
-        const Tensor& trans,
+        const Tensor& init_source_to_target,
         const float depth_scale,
         const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
+        const Method method,
         const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> target_depth_dx(n_levels);
-    std::vector<Tensor> target_depth_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr(source.depth_);
-    Image target_depth_curr(target.depth_);
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
+    // TODO (wei): more device check
+    const core::Device device = source.depth_.GetDevice();
+    core::AssertTensorDevice(target.depth_.AsTensor(), device);
 
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
+    // One-off calls only compute the images each frame needs in its role.
+    const int64_t n_levels = int64_t(criteria.size());
+    OdometryFrame source_frame, target_frame;
+    CreatePyramid(source_frame, source, intrinsics, depth_scale, depth_max,
+                  n_levels, method, params.depth_outlier_trunc_,
+                  /*as_source=*/true, /*as_target=*/false);
+    CreatePyramid(target_frame, target, intrinsics, depth_scale, depth_max,
+                  n_levels, method, params.depth_outlier_trunc_,
+                  /*as_source=*/false, /*as_target=*/true);
+
+    return RGBDOdometryMultiScale(source_frame, target_frame,
+                                  init_source_to_target, criteria, params);
+}
 
-        auto target_depth_grad = target_depth_curr.FilterSobel();
-        target_depth_dx[n_levels - 1 - i] = target_depth_grad.first.AsTensor();
-        target_depth_dy[n_levels - 1 - i] = target_depth_grad.second.AsTensor();
+OdometryResult RGBDOdometryMultiScale(
+        const OdometryFrame& source,
+        const OdometryFrame& target,
+        const Tensor& init_source_to_target,
+        const std::vector<OdometryConvergenceCriteria>& criteria,
+        const OdometryLossParams& params) {
+    core::AssertTensorShape(init_source_to_target, {4, 4});
 
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
+    const Method method = source.method_;
+    const int64_t n_levels = int64_t(criteria.size());
+    CheckPyramid(source, "source", method, n_levels);
+    CheckPyramid(target, "target", method, n_levels);
 
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
-    }
+    // 4x4 transformations are always float64 and stay on CPU.
+    const core::Device host("CPU:0");
+    const Tensor trans_d =
+            init_source_to_target.To(host, core::Float64).Clone();
 
     // Odometry
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
+    OdometryResult result(trans_d, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
     for (int64_t i = 0; i < n_levels; ++i) {
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultHybrid(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_depth_dx[i], target_depth_dy[i],
-                    target_intensity_dx[i], target_intensity_dy[i],
-                    source_vertex_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_, params.intensity_huber_delta_);
+            OdometryResult delta_result;
+            if (method == Method::PointToPlane) {
+                delta_result = ComputeOdometryResultPointToPlane(
+                        source.vertex_maps_[i], target.vertex_maps_[i],
+                        target.normal_maps_[i], source.intrinsics_[i],
+                        result.transformation_, params.depth_outlier_trunc_,
+                        params.depth_huber_delta_);
+            } else if (method == Method::Intensity) {
+                delta_result = ComputeOdometryResultIntensity(
+                        source.depth_[i], target.depth_[i],
+                        source.intensity_[i], target.intensity_[i],
+                        target.intensity_dx_[i], target.intensity_dy_[i],
+                        source.vertex_maps_[i], source.intrinsics_[i],
+                        result.transformation_, params.depth_outlier_trunc_,
+                        params.intensity_huber_delta_);
+            } else {
+                delta_result = ComputeOdometryResultHybrid(
+                        source.depth_[i], target.depth_[i],
+                        source.intensity_[i], target.intensity_[i],
+                        target.depth_dx_[i], target.depth_dy_[i],
+                        target.intensity_dx_[i], target.intensity_dy_[i],
+                        source.vertex_maps_[i], source.intrinsics_[i],
+                        result.transformation_, params.depth_outlier_trunc_,
+                        params.depth_huber_delta_,
+                        params.intensity_huber_delta_);
+            }
             result.transformation_ =
                     delta_result.transformation_.Matmul(result.transformation_);
             utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
@@ -118,11 +118,74 @@ public:
     float intensity_huber_delta_;
 };
 
+/// \class OdometryFrame
+/// \brief Image pyramid of an RGBD image used by RGBDOdometryMultiScale.
+///
+/// In a video stream the source of one odometry call becomes the target of the
+/// next call. Creating an OdometryFrame once per input image and passing it to
+/// RGBDOdometryMultiScale computes the pyramid of each image only once.
+/// All pyramid levels are ordered from coarse to fine.
+class OdometryFrame {
+public:
+    OdometryFrame() = default;
+
+    /// \brief Creates the image pyramid of \p rgbd so that the frame can be
+    /// used both as source and as target.
+    ///
+    /// \param rgbd RGBD image with a depth image (UInt16 or Float32) and a
+    /// color image (UInt8 x 3).
+    /// \param intrinsics (3, 3) intrinsic matrix for projection.
+    /// \param depth_scale Converts depth pixel values to meters by dividing the
+    /// scale factor.
+    /// \param depth_max Max depth to truncate depth image with noisy
+    /// measurements.
+    /// \param num_levels Number of pyramid levels. Must match the size of the
+    /// criteria list used for the odometry.
+    /// \param method Odometry method, which determines the images computed for
+    /// each level.
+    /// \param params Loss parameters. The depth outlier threshold is used to
+    /// downsample the depth images.
+    OdometryFrame(const t::geometry::RGBDImage& rgbd,
+                  const core::Tensor& intrinsics,
+                  const float depth_scale = 1000.0f,
+                  const float depth_max = 3.0f,
+                  const int64_t num_levels = 3,
+                  const Method method = Method::Hybrid,
+                  const OdometryLossParams& params = OdometryLossParams());
+
+    /// Returns the number of pyramid levels.
+    int64_t GetNumLevels() const { return int64_t(intrinsics_.size()); }
+
+public:
+    /// Odometry method the pyramid was created for.
+    Method method_ = Method::Hybrid;
+    /// Depth outlier threshold used to downsample the depth images.
+    float depth_outlier_trunc_ = 0.07f;
+    /// (3, 3) Float64 intrinsic matrices on CPU.
+    std::vector<core::Tensor> intrinsics_;
+    /// Float32 depth images in meters.
+    std::vector<core::Tensor> depth_;
+    /// Float32 vertex maps.
+    std::vector<core::Tensor> vertex_maps_;
+    /// Float32 normal maps of the bilateral filtered depth (PointToPlane).
+    std::vector<core::Tensor> normal_maps_;
+    /// Float32 intensity images (Intensity and Hybrid).
+    std::vector<core::Tensor> intensity_;
+    /// Float32 intensity gradients (Intensity and Hybrid).
+    std::vector<core::Tensor> intensity_dx_;
+    std::vector<core::Tensor> intensity_dy_;
+    /// Float32 depth gradients (Hybrid).
+    std::vector<core::Tensor> depth_dx_;
+    std::vector<core::Tensor> depth_dy_;
+};
+
 /// \brief Create an RGBD image pyramid given the original source and target
 /// RGBD images, and perform hierarchical odometry using specified \p
 /// method.
 /// Can be used for offline odometry where we do not expect to push performance
 /// to the extreme and not reuse vertex/normal map computed before.
+/// For sequential tracking create an OdometryFrame per image and use the
+/// OdometryFrame overload instead.
 /// Input RGBD images hold a depth image (UInt16 or Float32) with a scale
 /// factor and a color image (UInt8 x 3).
 /// \param source Source RGBD image.
@@ -155,6 +218,30 @@ OdometryResult RGBDOdometryMultiScale(
         const Method method = Method::Hybrid,
         const OdometryLossParams& params = OdometryLossParams());
 
+/// \brief Performs hierarchical odometry on precomputed image pyramids.
+///
+/// The method and the number of levels are taken from the frames, which must
+/// have been created with the same settings. This overload avoids recomputing
+/// the pyramid of a frame which is used in more than one odometry call.
+/// \param source Source frame.
+/// \param target Target frame.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target of core::Float64 on CPU.
+/// \param criteria_list Criteria used to define and terminate iterations from
+/// coarse to fine. The size must match the number of pyramid levels.
+/// \param params Parameters used in loss function, including outlier rejection
+/// threshold and Huber norm parameters.
+/// \return odometry result, with (4, 4) optimized transformation matrix from
+/// source to target, inlier ratio, and fitness.
+OdometryResult RGBDOdometryMultiScale(
+        const OdometryFrame& source,
+        const OdometryFrame& target,
+        const core::Tensor& init_source_to_target =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+        const std::vector<OdometryConvergenceCriteria>& criteria_list = {10, 5,
+                                                                         3},
+        const OdometryLossParams& params = OdometryLossParams());
+
 /// \brief Estimates the 4x4 rigid transformation T from source to target, with
 /// inlier rmse and fitness.
 /// Performs one iteration of RGBD odometry using loss function
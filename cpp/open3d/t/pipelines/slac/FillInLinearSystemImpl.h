@@ -12,6 +12,7 @@
 #include "open3d/core/EigenConverter.h"
 #include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
+#include "open3d/t/pipelines/slac/SparseLinearSystem.h"
 #include "open3d/utility/FileSystem.h"
 
 namespace open3d {
@@ -99,7 +100,32 @@ void FillInRigidAlignmentTerm(Tensor& AtA,
     }
 }
 
+// Dense counterpart of the sparse FillInSLACAlignmentTerm() in
+// SparseLinearSystem.h, so that the assembly below works for both.
 static void FillInSLACAlignmentTerm(Tensor& AtA,
+                                    Tensor& Atb,
+                                    Tensor& residual,
+                                    const Tensor& Ti_Cps,
+                                    const Tensor& Tj_Cqs,
+                                    const Tensor& Cnormal_ps,
+                                    const Tensor& Ri_Cnormal_ps,
+                                    const Tensor& RjT_Ri_Cnormal_ps,
+                                    const Tensor& cgrid_idx_ps,
+                                    const Tensor& cgrid_idx_qs,
+                                    const Tensor& cgrid_ratio_ps,
+                                    const Tensor& cgrid_ratio_qs,
+                                    int i,
+                                    int j,
+                                    int n_frags,
+                                    float threshold) {
+    kernel::FillInSLACAlignmentTerm(
+            AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
+            RjT_Ri_Cnormal_ps, cgrid_idx_ps, cgrid_idx_qs, cgrid_ratio_ps,
+            cgrid_ratio_qs, i, j, n_frags, threshold);
+}
+
+template <typename Matrix>
+static void FillInSLACAlignmentTerm(Matrix& AtA,
                                     Tensor& Atb,
                                     Tensor& residual,
                                     ControlGrid& ctr_grid,
@@ -143,13 +169,14 @@ static void FillInSLACAlignmentTerm(Tensor& AtA,
     Tensor RjT_Ri_Cnormal_ps =
             (Rj.T().Matmul(Ri_Cnormal_ps.T())).T().Contiguous();
 
-    kernel::FillInSLACAlignmentTerm(
-            AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
-            RjT_Ri_Cnormal_ps, cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps,
-            cgrid_ratio_qs, i, j, n_fragments, threshold);
+    FillInSLACAlignmentTerm(AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps,
+                            Ri_Cnormal_ps, RjT_Ri_Cnormal_ps, cgrid_index_ps,
+                            cgrid_index_qs, cgrid_ratio_ps, cgrid_ratio_qs, i,
+                            j, n_fragments, threshold);
 }
 
-void FillInSLACAlignmentTerm(Tensor& AtA,
+template <typename Matrix>
+void FillInSLACAlignmentTerm(Matrix& AtA,
                              Tensor& Atb,
                              Tensor& residual,
                              ControlGrid& ctr_grid,
@@ -212,7 +239,27 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
     }
 }
 
-void FillInSLACRegularizerTerm(Tensor& AtA,
+// Dense counterpart of the sparse FillInSLACRegularizerTerm() in
+// SparseLinearSystem.h, so that the assembly below works for both.
+static void FillInSLACRegularizerTerm(Tensor& AtA,
+                                      Tensor& Atb,
+                                      Tensor& residual,
+                                      const Tensor& grid_idx,
+                                      const Tensor& grid_nbs_idx,
+                                      const Tensor& grid_nbs_mask,
+                                      const Tensor& positions_init,
+                                      const Tensor& positions_curr,
+                                      float weight,
+                                      int n_frags,
+                                      int anchor_idx) {
+    kernel::FillInSLACRegularizerTerm(AtA, Atb, residual, grid_idx,
+                                      grid_nbs_idx, grid_nbs_mask,
+                                      positions_init, positions_curr, weight,
+                                      n_frags, anchor_idx);
+}
+
+template <typename Matrix>
+void FillInSLACRegularizerTerm(Matrix& AtA,
                                Tensor& Atb,
                                Tensor& residual,
                                ControlGrid& ctr_grid,
@@ -225,11 +272,11 @@ void FillInSLACRegularizerTerm(Tensor& AtA,
 
     Tensor positions_init = ctr_grid.GetInitPositions();
     Tensor positions_curr = ctr_grid.GetCurrPositions();
-    kernel::FillInSLACRegularizerTerm(AtA, Atb, residual, active_buf_indices,
-                                      nb_buf_indices, nb_masks, positions_init,
-                                      positions_curr,
-                                      n_frags * params.regularizer_weight_,
-                                      n_frags, ctr_grid.GetAnchorIdx());
+    FillInSLACRegularizerTerm(AtA, Atb, residual, active_buf_indices,
+                              nb_buf_indices, nb_masks, positions_init,
+                              positions_curr,
+                              n_frags * params.regularizer_weight_, n_frags,
+                              ctr_grid.GetAnchorIdx());
     if (debug_option.debug_) {
         VisualizeGridDeformation(ctr_grid);
     }
@@ -12,6 +12,7 @@
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/t/pipelines/slac/FillInLinearSystemImpl.h"
+#include "open3d/t/pipelines/slac/SparseLinearSystem.h"
 #include "open3d/utility/FileSystem.h"
 
 namespace open3d {
@@ -323,38 +324,62 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
     // Fill-in
     // fragments x 6 (se3) + control_grids x 3 (R^3)
     int64_t num_params = fnames_down.size() * 6 + ctr_grid.Size() * 3;
-    utility::LogInfo("Initializing the {}^2 Hessian matrix", num_params);
+    // The sparse linear system is assembled and solved on the CPU.
+    core::Device linear_system_device =
+            params.use_sparse_solver_ ? core::Device("CPU:0") : device;
+    utility::LogInfo("Initializing the {}^2 {} Hessian matrix", num_params,
+                     params.use_sparse_solver_ ? "sparse" : "dense");
 
     PoseGraph pose_graph_update(pose_graph);
     for (int itr = 0; itr < params.max_iterations_; ++itr) {
         utility::LogInfo("Iteration {}", itr);
-        core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
-                                               core::Float32, device);
-        core::Tensor Atb =
-                core::Tensor::Zeros({num_params, 1}, core::Float32, device);
-
-        core::Tensor indices_eye0 =
-                core::Tensor::Arange(0, 6, 1, core::Int64, device);
-        AtA.IndexSet({indices_eye0, indices_eye0},
-                     core::Tensor::Ones({}, core::Float32, device));
-
+        core::Tensor Atb = core::Tensor::Zeros({num_params, 1}, core::Float32,
+                                               linear_system_device);
         core::Tensor residual_data =
-                core::Tensor::Zeros({1}, core::Float32, device);
-        FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid, fnames_down,
-                                pose_graph_update, params, debug_option);
+                core::Tensor::Zeros({1}, core::Float32, linear_system_device);
+        core::Tensor residual_reg =
+                core::Tensor::Zeros({1}, core::Float32, linear_system_device);
+
+        core::Tensor delta;
+        if (params.use_sparse_solver_) {
+            BlockSparseMatrix AtA(num_params);
+            AtA.AddBlock(0, 0, Eigen::Matrix3f::Identity());
+            AtA.AddBlock(1, 1, Eigen::Matrix3f::Identity());
+
+            FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid,
+                                    fnames_down, pose_graph_update, params,
+                                    debug_option);
+            FillInSLACRegularizerTerm(AtA, Atb, residual_reg, ctr_grid,
+                                      pose_graph_update.nodes_.size(), params,
+                                      debug_option);
+            utility::LogDebug("Sparse Hessian has {} non-zero 3x3 blocks.",
+                              AtA.GetNumNonZeroBlocks());
 
-        utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
+            delta = AtA.Solve(Atb.Neg(), params.sparse_solver_max_iterations_,
+                              params.sparse_solver_tolerance_)
+                            .To(device);
+        } else {
+            core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
+                                                   core::Float32, device);
+
+            core::Tensor indices_eye0 =
+                    core::Tensor::Arange(0, 6, 1, core::Int64, device);
+            AtA.IndexSet({indices_eye0, indices_eye0},
+                         core::Tensor::Ones({}, core::Float32, device));
+
+            FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid,
+                                    fnames_down, pose_graph_update, params,
+                                    debug_option);
+            FillInSLACRegularizerTerm(AtA, Atb, residual_reg, ctr_grid,
+                                      pose_graph_update.nodes_.size(), params,
+                                      debug_option);
 
-        core::Tensor residual_reg =
-                core::Tensor::Zeros({1}, core::Float32, device);
-        FillInSLACRegularizerTerm(AtA, Atb, residual_reg, ctr_grid,
-                                  pose_graph_update.nodes_.size(), params,
-                                  debug_option);
+            delta = AtA.Solve(Atb.Neg());
+        }
+        utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
         utility::LogInfo("Regularizer loss = {}",
                          residual_reg[0].Item<float>());
 
-        core::Tensor delta = AtA.Solve(Atb.Neg());
-
         core::Tensor delta_poses =
                 delta.Slice(0, 0, 6 * pose_graph_update.nodes_.size());
         core::Tensor delta_cgrids = delta.Slice(
@@ -41,6 +41,19 @@ struct SLACOptimizerParams {
     /// Device to use.
     core::Device device_;
 
+    /// If true, SLAC assembles its normal equations in a block sparse matrix
+    /// and solves them by preconditioned conjugate gradient on the CPU, instead
+    /// of a dense matrix with (6 x fragments + 3 x control grid points)^2
+    /// entries. Memory then grows linearly with the number of active control
+    /// grid points.
+    bool use_sparse_solver_ = false;
+
+    /// Maximum number of conjugate gradient iterations of the sparse solver.
+    int sparse_solver_max_iterations_ = 1000;
+
+    /// Relative residual at which the sparse solver stops.
+    float sparse_solver_tolerance_ = 1e-6;
+
     /// Relative directory to store SLAC results in the dataset folder.
     std::string slac_folder_ = "";
     std::string GetSubfolderName() const {
@@ -0,0 +1,357 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slac/SparseLinearSystem.h"
+
+#include <Eigen/Dense>
+#include <vector>
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/pipelines/kernel/FillInLinearSystemJacobianImpl.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slac {
+
+BlockSparseMatrix::BlockSparseMatrix(int64_t num_params)
+    : num_blocks_(num_params / 3) {
+    if (num_params < 0 || num_params % 3 != 0) {
+        utility::LogError("num_params must be a non-negative multiple of 3.");
+    }
+}
+
+void BlockSparseMatrix::AddBlock(int64_t row,
+                                 int64_t col,
+                                 const Eigen::Matrix3f& block) {
+    auto it = blocks_.find(row * num_blocks_ + col);
+    if (it == blocks_.end()) {
+        blocks_.emplace(row * num_blocks_ + col, block);
+    } else {
+        it->second += block;
+    }
+}
+
+void BlockSparseMatrix::AddJtJ(const float* J, const int* idx, int n) {
+    for (int bi = 0; bi < n; bi += 3) {
+        const Eigen::Map<const Eigen::Vector3f> J_i(J + bi);
+        for (int bj = 0; bj < n; bj += 3) {
+            const Eigen::Map<const Eigen::Vector3f> J_j(J + bj);
+            AddBlock(idx[bi] / 3, idx[bj] / 3, J_i * J_j.transpose());
+        }
+    }
+}
+
+void BlockSparseMatrix::Add(const BlockSparseMatrix& other) {
+    if (other.num_blocks_ != num_blocks_) {
+        utility::LogError("Size mismatch: {} vs {}.", other.GetNumParams(),
+                          GetNumParams());
+    }
+    for (const auto& kv : other.blocks_) {
+        auto it = blocks_.find(kv.first);
+        if (it == blocks_.end()) {
+            blocks_.emplace(kv.first, kv.second);
+        } else {
+            it->second += kv.second;
+        }
+    }
+}
+
+core::Tensor BlockSparseMatrix::Solve(const core::Tensor& b,
+                                      int max_iterations,
+                                      float tolerance) const {
+    const int64_t n = GetNumParams();
+    core::AssertTensorShape(b, {n, 1});
+    core::AssertTensorDtype(b, core::Float32);
+
+    // Compress the blocks to block rows.
+    std::vector<int64_t> row_offsets(num_blocks_ + 1, 0);
+    for (const auto& kv : blocks_) {
+        ++row_offsets[kv.first / num_blocks_ + 1];
+    }
+    for (int64_t r = 0; r < num_blocks_; ++r) {
+        row_offsets[r + 1] += row_offsets[r];
+    }
+    std::vector<int64_t> cols(blocks_.size());
+    std::vector<const Eigen::Matrix3f*> values(blocks_.size());
+    std::vector<int64_t> fill(row_offsets.begin(), row_offsets.end() - 1);
+    for (const auto& kv : blocks_) {
+        const int64_t k = fill[kv.first / num_blocks_]++;
+        cols[k] = kv.first % num_blocks_;
+        values[k] = &kv.second;
+    }
+
+    // Rows without a valid diagonal block only have zero entries in b, so
+    // identity keeps them at zero.
+    std::vector<Eigen::Matrix3d> diag_inv(num_blocks_,
+                                          Eigen::Matrix3d::Identity());
+    for (int64_t r = 0; r < num_blocks_; ++r) {
+        auto it = blocks_.find(r * num_blocks_ + r);
+        if (it == blocks_.end()) continue;
+        Eigen::Matrix3d inverse;
+        bool invertible;
+        it->second.cast<double>().computeInverseWithCheck(inverse, invertible);
+        if (invertible) diag_inv[r] = inverse;
+    }
+
+    auto multiply = [&](const Eigen::VectorXd& x, Eigen::VectorXd& y) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t r = 0; r < num_blocks_; ++r) {
+            Eigen::Vector3d y_r = Eigen::Vector3d::Zero();
+            for (int64_t k = row_offsets[r]; k < row_offsets[r + 1]; ++k) {
+                y_r += values[k]->cast<double>() * x.segment<3>(3 * cols[k]);
+            }
+            y.segment<3>(3 * r) = y_r;
+        }
+    };
+    auto precondition = [&](const Eigen::VectorXd& x, Eigen::VectorXd& y) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t r = 0; r < num_blocks_; ++r) {
+            y.segment<3>(3 * r) = diag_inv[r] * x.segment<3>(3 * r);
+        }
+    };
+
+    const core::Tensor b_cpu = b.To(core::Device("CPU:0")).Contiguous();
+    const Eigen::VectorXd b_eigen =
+            Eigen::Map<const Eigen::VectorXf>(b_cpu.GetDataPtr<float>(), n)
+                    .cast<double>();
+    const double b_norm = b_eigen.norm();
+
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+    Eigen::VectorXd r = b_eigen;
+    Eigen::VectorXd z(n), p(n), Ap(n);
+    precondition(r, z);
+    p = z;
+    double rz = r.dot(z);
+    double r_norm = b_norm;
+    int itr = 0;
+    for (; itr < max_iterations && r_norm > tolerance * b_norm; ++itr) {
+        multiply(p, Ap);
+        const double pAp = p.dot(Ap);
+        if (pAp <= 0) break;
+        const double alpha = rz / pAp;
+        x += alpha * p;
+        r -= alpha * Ap;
+        r_norm = r.norm();
+
+        precondition(r, z);
+        const double rz_new = r.dot(z);
+        p = z + (rz_new / rz) * p;
+        rz = rz_new;
+    }
+    utility::LogDebug("PCG: {} iterations, relative residual = {}.", itr,
+                      b_norm > 0 ? r_norm / b_norm : 0.0);
+
+    const Eigen::VectorXf x_float = x.cast<float>();
+    return core::Tensor(std::vector<float>(x_float.data(), x_float.data() + n),
+                        {n, 1}, core::Float32)
+            .To(b.GetDevice());
+}
+
+core::Tensor BlockSparseMatrix::ToDense() const {
+    const int64_t n = GetNumParams();
+    core::Tensor dense = core::Tensor::Zeros({n, n}, core::Float32);
+    float* dense_ptr = dense.GetDataPtr<float>();
+    for (const auto& kv : blocks_) {
+        const int64_t row = kv.first / num_blocks_;
+        const int64_t col = kv.first % num_blocks_;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                dense_ptr[(3 * row + i) * n + 3 * col + j] += kv.second(i, j);
+            }
+        }
+    }
+    return dense;
+}
+
+static void AssertLinearSystemOnCPU(const BlockSparseMatrix& AtA,
+                                    const core::Tensor& Atb,
+                                    const core::Tensor& residual) {
+    const core::Device host("CPU:0");
+    core::AssertTensorShape(Atb, {AtA.GetNumParams(), 1});
+    core::AssertTensorDtype(Atb, core::Float32);
+    core::AssertTensorDevice(Atb, host);
+    core::AssertTensorDtype(residual, core::Float32);
+    core::AssertTensorDevice(residual, host);
+    if (!Atb.IsContiguous() || !residual.IsContiguous()) {
+        utility::LogError("Atb and residual must be contiguous.");
+    }
+}
+
+void FillInSLACAlignmentTerm(BlockSparseMatrix& AtA,
+                             core::Tensor& Atb,
+                             core::Tensor& residual,
+                             const core::Tensor& Ti_Cps,
+                             const core::Tensor& Tj_Cqs,
+                             const core::Tensor& Cnormal_ps,
+                             const core::Tensor& Ri_Cnormal_ps,
+                             const core::Tensor& RjT_Ri_Cnormal_ps,
+                             const core::Tensor& cgrid_idx_ps,
+                             const core::Tensor& cgrid_idx_qs,
+                             const core::Tensor& cgrid_ratio_ps,
+                             const core::Tensor& cgrid_ratio_qs,
+                             int i,
+                             int j,
+                             int n_frags,
+                             float threshold) {
+    AssertLinearSystemOnCPU(AtA, Atb, residual);
+    const int64_t n = Ti_Cps.GetLength();
+    if (Tj_Cqs.GetLength() != n || Cnormal_ps.GetLength() != n ||
+        Ri_Cnormal_ps.GetLength() != n || RjT_Ri_Cnormal_ps.GetLength() != n ||
+        cgrid_idx_ps.GetLength() != n || cgrid_ratio_ps.GetLength() != n ||
+        cgrid_idx_qs.GetLength() != n || cgrid_ratio_qs.GetLength() != n) {
+        utility::LogError(
+                "Unable to setup linear system: input length mismatch.");
+    }
+
+    const core::Device host("CPU:0");
+    const core::Tensor Ti_Cps_h = Ti_Cps.To(host).Contiguous();
+    const core::Tensor Tj_Cqs_h = Tj_Cqs.To(host).Contiguous();
+    const core::Tensor Cnormal_ps_h = Cnormal_ps.To(host).Contiguous();
+    const core::Tensor Ri_Cnormal_ps_h = Ri_Cnormal_ps.To(host).Contiguous();
+    const core::Tensor RjT_Ri_Cnormal_ps_h =
+            RjT_Ri_Cnormal_ps.To(host).Contiguous();
+    const core::Tensor cgrid_idx_ps_h = cgrid_idx_ps.To(host).Contiguous();
+    const core::Tensor cgrid_idx_qs_h = cgrid_idx_qs.To(host).Contiguous();
+    const core::Tensor cgrid_ratio_ps_h = cgrid_ratio_ps.To(host).Contiguous();
+    const core::Tensor cgrid_ratio_qs_h = cgrid_ratio_qs.To(host).Contiguous();
+
+    const float* Ti_Cps_ptr = Ti_Cps_h.GetDataPtr<float>();
+    const float* Tj_Cqs_ptr = Tj_Cqs_h.GetDataPtr<float>();
+    const float* Cnormal_ps_ptr = Cnormal_ps_h.GetDataPtr<float>();
+    const float* Ri_Cnormal_ps_ptr = Ri_Cnormal_ps_h.GetDataPtr<float>();
+    const float* RjT_Ri_Cnormal_ps_ptr =
+            RjT_Ri_Cnormal_ps_h.GetDataPtr<float>();
+    const int* cgrid_idx_ps_ptr = cgrid_idx_ps_h.GetDataPtr<int>();
+    const int* cgrid_idx_qs_ptr = cgrid_idx_qs_h.GetDataPtr<int>();
+    const float* cgrid_ratio_ps_ptr = cgrid_ratio_ps_h.GetDataPtr<float>();
+    const float* cgrid_ratio_qs_ptr = cgrid_ratio_qs_h.GetDataPtr<float>();
+
+    float* Atb_ptr = Atb.GetDataPtr<float>();
+    float residual_sum = 0;
+
+    // Each thread assembles its own blocks, which are merged at the end.
+#pragma omp parallel num_threads(utility::EstimateMaxThreads()) \
+        reduction(+ : residual_sum)
+    {
+        BlockSparseMatrix AtA_local(AtA.GetNumParams());
+#pragma omp for schedule(static)
+        for (int64_t w = 0; w < n; ++w) {
+            float J[60];
+            int idx[60];
+            float r;
+            if (!kernel::GetSLACAlignmentJacobian(
+                        Ti_Cps_ptr + 3 * w, Tj_Cqs_ptr + 3 * w,
+                        Cnormal_ps_ptr + 3 * w, Ri_Cnormal_ps_ptr + 3 * w,
+                        RjT_Ri_Cnormal_ps_ptr + 3 * w, cgrid_idx_ps_ptr + 8 * w,
+                        cgrid_idx_qs_ptr + 8 * w, cgrid_ratio_ps_ptr + 8 * w,
+                        cgrid_ratio_qs_ptr + 8 * w, i, j, n_frags, threshold,
+                        J, idx, r)) {
+                continue;
+            }
+
+            AtA_local.AddJtJ(J, idx, 60);
+            for (int k = 0; k < 60; ++k) {
+#pragma omp atomic
+                Atb_ptr[idx[k]] += J[k] * r;
+            }
+            residual_sum += r * r;
+        }
+#pragma omp critical(FillInSLACAlignmentTermSparse)
+        { AtA.Add(AtA_local); }
+    }
+    *residual.GetDataPtr<float>() += residual_sum;
+}
+
+void FillInSLACRegularizerTerm(BlockSparseMatrix& AtA,
+                               core::Tensor& Atb,
+                               core::Tensor& residual,
+                               const core::Tensor& grid_idx,
+                               const core::Tensor& grid_nbs_idx,
+                               const core::Tensor& grid_nbs_mask,
+                               const core::Tensor& positions_init,
+                               const core::Tensor& positions_curr,
+                               float weight,
+                               int n_frags,
+                               int anchor_idx) {
+    AssertLinearSystemOnCPU(AtA, Atb, residual);
+
+    const core::Device host("CPU:0");
+    const core::Tensor grid_idx_h = grid_idx.To(host).Contiguous();
+    const core::Tensor grid_nbs_idx_h = grid_nbs_idx.To(host).Contiguous();
+    const core::Tensor grid_nbs_mask_h = grid_nbs_mask.To(host).Contiguous();
+    const core::Tensor positions_init_h = positions_init.To(host).Contiguous();
+    const core::Tensor positions_curr_h = positions_curr.To(host).Contiguous();
+
+    const int64_t n = grid_idx_h.GetLength();
+    const int* grid_idx_ptr = grid_idx_h.GetDataPtr<int>();
+    const int* grid_nbs_idx_ptr = grid_nbs_idx_h.GetDataPtr<int>();
+    const bool* grid_nbs_mask_ptr = grid_nbs_mask_h.GetDataPtr<bool>();
+    const float* positions_init_ptr = positions_init_h.GetDataPtr<float>();
+    const float* positions_curr_ptr = positions_curr_h.GetDataPtr<float>();
+
+    float* Atb_ptr = Atb.GetDataPtr<float>();
+    float residual_sum = 0;
+
+    const Eigen::Matrix3f W = weight * Eigen::Matrix3f::Identity();
+#pragma omp parallel num_threads(utility::EstimateMaxThreads()) \
+        reduction(+ : residual_sum)
+    {
+        BlockSparseMatrix AtA_local(AtA.GetNumParams());
+#pragma omp for schedule(static)
+        for (int64_t w = 0; w < n; ++w) {
+            const int idx_i = grid_idx_ptr[w];
+            const int* idx_nbs = grid_nbs_idx_ptr + 6 * w;
+            const bool* mask_nbs = grid_nbs_mask_ptr + 6 * w;
+
+            float R[3][3];
+            if (!kernel::GetSLACRegularizerRotation(
+                        idx_i, idx_nbs, mask_nbs, positions_init_ptr,
+                        positions_curr_ptr, anchor_idx, R)) {
+                continue;
+            }
+
+            for (int k = 0; k < 6; ++k) {
+                if (!mask_nbs[k]) continue;
+                const int idx_k = idx_nbs[k];
+
+                float local_r[3];
+                kernel::GetSLACRegularizerResidual(idx_i, idx_k, R,
+                                                   positions_init_ptr,
+                                                   positions_curr_ptr, local_r);
+                residual_sum += weight * (local_r[0] * local_r[0] +
+                                          local_r[1] * local_r[1] +
+                                          local_r[2] * local_r[2]);
+
+                const int64_t block_i = idx_i + 2 * n_frags;
+                const int64_t block_k = idx_k + 2 * n_frags;
+                AtA_local.AddBlock(block_i, block_i, W);
+                AtA_local.AddBlock(block_k, block_k, W);
+                AtA_local.AddBlock(block_i, block_k, -W);
+                AtA_local.AddBlock(block_k, block_i, -W);
+                for (int axis = 0; axis < 3; ++axis) {
+#pragma omp atomic
+                    Atb_ptr[3 * block_i + axis] += weight * local_r[axis];
+#pragma omp atomic
+                    Atb_ptr[3 * block_k + axis] -= weight * local_r[axis];
+                }
+            }
+        }
+#pragma omp critical(FillInSLACRegularizerTermSparse)
+        { AtA.Add(AtA_local); }
+    }
+    *residual.GetDataPtr<float>() += residual_sum;
+}
+
+}  // namespace slac
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
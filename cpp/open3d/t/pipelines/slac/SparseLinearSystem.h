@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <unordered_map>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slac {
+
+/// \class BlockSparseMatrix
+/// \brief Symmetric matrix of 3x3 blocks, used to assemble and solve the SLAC
+/// normal equations on the CPU.
+///
+/// Each fragment pose spans 2 blocks and each control grid point 1 block. Only
+/// non-zero blocks are stored, so memory grows with the number of active
+/// control grid points instead of quadratically with the number of parameters.
+class BlockSparseMatrix {
+public:
+    /// \param num_params Number of rows and columns, a multiple of 3.
+    explicit BlockSparseMatrix(int64_t num_params = 0);
+
+    int64_t GetNumParams() const { return num_blocks_ * 3; }
+
+    /// Number of stored non-zero 3x3 blocks.
+    int64_t GetNumNonZeroBlocks() const { return blocks_.size(); }
+
+    /// Adds \p block to the block at block row \p row and block column \p col.
+    void AddBlock(int64_t row, int64_t col, const Eigen::Matrix3f& block);
+
+    /// \brief Adds J^T J of a row Jacobian \p J with \p n entries.
+    ///
+    /// \param idx Parameter index of each entry of \p J. Indices come in
+    /// triplets of consecutive indices starting at a multiple of 3.
+    void AddJtJ(const float* J, const int* idx, int n);
+
+    /// Adds all blocks of \p other, which must have the same size.
+    void Add(const BlockSparseMatrix& other);
+
+    /// \brief Solves A x = b with conjugate gradient preconditioned by the
+    /// inverse 3x3 diagonal blocks (block Jacobi).
+    ///
+    /// \param b (num_params, 1) Float32 tensor.
+    /// \param max_iterations Maximum number of iterations.
+    /// \param tolerance Stops once |b - A x| <= tolerance * |b|.
+    /// \return (num_params, 1) Float32 solution on the device of \p b.
+    core::Tensor Solve(const core::Tensor& b,
+                       int max_iterations,
+                       float tolerance) const;
+
+    /// Returns the dense (num_params, num_params) Float32 matrix on the CPU.
+    core::Tensor ToDense() const;
+
+private:
+    int64_t num_blocks_;
+    /// Blocks keyed by row * num_blocks_ + col.
+    std::unordered_map<int64_t, Eigen::Matrix3f> blocks_;
+};
+
+/// Sparse counterpart of kernel::FillInSLACAlignmentTerm() on the CPU. Inputs
+/// on other devices are copied to the CPU, \p Atb and \p residual must be on
+/// the CPU.
+void FillInSLACAlignmentTerm(BlockSparseMatrix& AtA,
+                             core::Tensor& Atb,
+                             core::Tensor& residual,
+                             const core::Tensor& Ti_Cps,
+                             const core::Tensor& Tj_Cqs,
+                             const core::Tensor& Cnormal_ps,
+                             const core::Tensor& Ri_Cnormal_ps,
+                             const core::Tensor& RjT_Ri_Cnormal_ps,
+                             const core::Tensor& cgrid_idx_ps,
+                             const core::Tensor& cgrid_idx_qs,
+                             const core::Tensor& cgrid_ratio_ps,
+                             const core::Tensor& cgrid_ratio_qs,
+                             int i,
+                             int j,
+                             int n_frags,
+                             float threshold);
+
+/// Sparse counterpart of kernel::FillInSLACRegularizerTerm() on the CPU.
+/// Inputs on other devices are copied to the CPU, \p Atb and \p residual must
+/// be on the CPU.
+void FillInSLACRegularizerTerm(BlockSparseMatrix& AtA,
+                               core::Tensor& Atb,
+                               core::Tensor& residual,
+                               const core::Tensor& grid_idx,
+                               const core::Tensor& grid_nbs_idx,
+                               const core::Tensor& grid_nbs_mask,
+                               const core::Tensor& positions_init,
+                               const core::Tensor& positions_curr,
+                               float weight,
+                               int n_frags,
+                               int anchor_idx);
+
+}  // namespace slac
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,516 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/Backend.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/t/pipelines/registration/TransformationEstimation.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+using open3d::pipelines::registration::PoseGraph;
+using open3d::pipelines::registration::PoseGraphEdge;
+using open3d::pipelines::registration::PoseGraphNode;
+
+struct Backend::Keyframe {
+    int64_t frame_id_ = -1;
+    t::geometry::RGBDImage rgbd_;
+    /// Front end pose without the corrections applied by Update().
+    Eigen::Matrix4d_u T_odometry_ = Eigen::Matrix4d::Identity();
+    /// Pose the keyframe is integrated at in the model. Only accessed on the
+    /// thread owning the model.
+    Eigen::Matrix4d_u T_integrated_ = Eigen::Matrix4d::Identity();
+    /// Set by the background thread.
+    Eigen::VectorXd descriptor_;
+    t::geometry::PointCloud pcd_;
+};
+
+namespace {
+
+core::Tensor ToTensor(const Eigen::Matrix4d& matrix) {
+    return core::eigen_converter::EigenMatrixToTensor(matrix);
+}
+
+Eigen::Matrix4d ToEigen(const core::Tensor& tensor) {
+    core::AssertTensorShape(tensor, {4, 4});
+    return core::eigen_converter::TensorToEigenMatrixXd(tensor);
+}
+
+/// Rotation angle in radians of the relative motion \p T.
+double RotationAngle(const Eigen::Matrix4d& T) {
+    const double cos_angle = (T.block<3, 3>(0, 0).trace() - 1.0) / 2.0;
+    return std::acos(std::min(1.0, std::max(-1.0, cos_angle)));
+}
+
+/// Upper bound of the distance a point at \p depth moves by the relative
+/// motion \p T.
+double Displacement(const Eigen::Matrix4d& T, double depth) {
+    return T.block<3, 1>(0, 3).norm() + RotationAngle(T) * depth;
+}
+
+/// Normalizes \p v to zero mean and unit norm. Constant vectors become zero.
+void Standardize(Eigen::Ref<Eigen::VectorXd> v) {
+    v.array() -= v.mean();
+    const double norm = v.norm();
+    if (norm > 1e-12) {
+        v /= norm;
+    } else {
+        v.setZero();
+    }
+}
+
+/// Global descriptor of an RGBD image: mean intensity and mean valid depth in
+/// a rows x cols grid, each standardized, so that the dot product of two
+/// descriptors is their normalized cross correlation.
+Eigen::VectorXd ComputeDescriptor(const t::geometry::RGBDImage& rgbd,
+                                  float depth_scale,
+                                  float depth_max,
+                                  int rows,
+                                  int cols) {
+    const core::Device host("CPU:0");
+    const core::Tensor depth = rgbd.depth_.AsTensor()
+                                       .To(host)
+                                       .To(core::Float32)
+                                       .Contiguous();
+    core::Tensor intensity;
+    if (rgbd.color_.AsTensor().NumElements() > 0) {
+        intensity = rgbd.color_.To(host)
+                            .RGBToGray()
+                            .AsTensor()
+                            .To(core::Float32)
+                            .Contiguous();
+    }
+
+    const int64_t height = depth.GetShape(0), width = depth.GetShape(1);
+    const float* depth_ptr = depth.GetDataPtr<float>();
+    const float* intensity_ptr =
+            intensity.NumElements() > 0 ? intensity.GetDataPtr<float>()
+                                        : nullptr;
+
+    const int cells = rows * cols;
+    Eigen::VectorXd descriptor = Eigen::VectorXd::Zero(2 * cells);
+    Eigen::VectorXd depth_count = Eigen::VectorXd::Zero(cells);
+    Eigen::VectorXd intensity_count = Eigen::VectorXd::Zero(cells);
+    for (int64_t v = 0; v < height; ++v) {
+        const int r = int(v * rows / height);
+        for (int64_t u = 0; u < width; ++u) {
+            const int c = r * cols + int(u * cols / width);
+            const int64_t idx = v * width + u;
+            if (intensity_ptr) {
+                descriptor(c) += intensity_ptr[idx];
+                intensity_count(c) += 1;
+            }
+            const float d = depth_ptr[idx] / depth_scale;
+            if (d > 0 && d < depth_max) {
+                descriptor(cells + c) += d;
+                depth_count(c) += 1;
+            }
+        }
+    }
+    for (int c = 0; c < cells; ++c) {
+        if (intensity_count(c) > 0) descriptor(c) /= intensity_count(c);
+        if (depth_count(c) > 0) descriptor(cells + c) /= depth_count(c);
+    }
+    Standardize(descriptor.head(cells));
+    Standardize(descriptor.tail(cells));
+    const double norm = descriptor.norm();
+    if (norm > 0) descriptor /= norm;
+    return descriptor;
+}
+
+/// Removes the observation of \p rgbd at \p extrinsic from \p grid by
+/// inverting the running averages of VoxelBlockGrid::Integrate(). The frame
+/// is integrated alone into a temporary grid with the same layout, whose
+/// weights mark the voxels it updated and whose values are the ones it added.
+void Deintegrate(t::geometry::VoxelBlockGrid& grid,
+                 const t::geometry::RGBDImage& rgbd,
+                 const core::Tensor& intrinsics,
+                 const core::Tensor& extrinsic,
+                 const BackendParams& params) {
+    const std::vector<std::string> attr_names = {"tsdf", "weight", "color"};
+    std::vector<core::Dtype> attr_dtypes;
+    for (const std::string& name : attr_names) {
+        attr_dtypes.push_back(grid.GetAttribute(name).GetDtype());
+    }
+    core::HashMap hashmap = grid.GetHashMap();
+    const core::Tensor block_coords = grid.GetUniqueBlockCoordinates(
+            rgbd.depth_, intrinsics, extrinsic, params.depth_scale_,
+            params.depth_max_, params.trunc_voxel_multiplier_);
+    if (block_coords.GetLength() == 0) return;
+    t::geometry::VoxelBlockGrid frame_grid(
+            attr_names, attr_dtypes, {{1}, {1}, {3}}, grid.GetVoxelSize(),
+            grid.GetBlockResolution(), block_coords.GetLength(),
+            hashmap.GetDevice());
+    frame_grid.Integrate(block_coords, rgbd.depth_, rgbd.color_, intrinsics,
+                         extrinsic, params.depth_scale_, params.depth_max_,
+                         params.trunc_voxel_multiplier_);
+
+    // Blocks of the frame that are still in the grid.
+    core::Tensor frame_indices =
+            frame_grid.GetHashMap().GetActiveIndices().To(core::Int64);
+    core::Tensor buf_indices, masks;
+    std::tie(buf_indices, masks) = hashmap.Find(
+            frame_grid.GetHashMap().GetKeyTensor().IndexGet({frame_indices}));
+    frame_indices = frame_indices.IndexGet({masks});
+    buf_indices = buf_indices.To(core::Int64).IndexGet({masks});
+    if (buf_indices.GetLength() == 0) return;
+
+    auto Get = [](const t::geometry::VoxelBlockGrid& source,
+                  const std::string& name, const core::Tensor& indices) {
+        return source.GetAttribute(name).IndexGet({indices}).To(core::Float32);
+    };
+    const core::Tensor weight = Get(grid, "weight", buf_indices);
+    const core::Tensor frame_weight = Get(frame_grid, "weight", frame_indices);
+    const float max_value = std::numeric_limits<float>::max();
+    const core::Tensor remaining = (weight - frame_weight).Clip(0, max_value);
+    // Voxels without remaining observations are reset to zero.
+    const core::Tensor keep = remaining.Gt(0).To(core::Float32);
+    for (const std::string name : {"tsdf", "color"}) {
+        const core::Tensor frame_value = Get(frame_grid, name, frame_indices);
+        core::Tensor frame_count = frame_weight;
+        if (name == "color") {
+            // Integrate() keeps the color of voxels that project outside of
+            // the color image, which stay black in frame_grid.
+            frame_count = frame_count *
+                          frame_value.Sum({4}, true).Gt(0).To(core::Float32);
+        }
+        core::Tensor value = (Get(grid, name, buf_indices) * weight -
+                              frame_value * frame_count) *
+                             keep / (weight - frame_count).Clip(1, max_value);
+        if (name == "color") {
+            value = value.Clip(0, max_value);
+        }
+        grid.GetAttribute(name).IndexSet(
+                {buf_indices}, value.To(grid.GetAttribute(name).GetDtype()));
+    }
+    grid.GetAttribute("weight").IndexSet(
+            {buf_indices}, remaining.To(attr_dtypes[1]));
+}
+
+}  // namespace
+
+Backend::Backend(const core::Tensor& intrinsics, const BackendParams& params)
+    : intrinsics_(intrinsics.To(core::Float64)), params_(params) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    if (params_.min_loop_interval_ < 1) {
+        utility::LogError("min_loop_interval must be positive, but got {}.",
+                          params_.min_loop_interval_);
+    }
+    if (params_.descriptor_rows_ < 1 || params_.descriptor_cols_ < 1) {
+        utility::LogError("Invalid descriptor grid size {}x{}.",
+                          params_.descriptor_rows_, params_.descriptor_cols_);
+    }
+    thread_ = std::thread([this] { Run(); });
+}
+
+Backend::~Backend() { Stop(); }
+
+bool Backend::AddFrame(int64_t frame_id,
+                       const t::geometry::RGBDImage& rgbd,
+                       const core::Tensor& T_frame_to_world) {
+    const Eigen::Matrix4d T_integrated = ToEigen(T_frame_to_world);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) return false;
+
+    const Eigen::Matrix4d T_odometry = correction_.inverse() * T_integrated;
+    if (!keyframes_.empty()) {
+        const Eigen::Matrix4d T_motion =
+                keyframes_.back()->T_odometry_.inverse() * T_odometry;
+        const double translation = T_motion.block<3, 1>(0, 3).norm();
+        const double rotation = RotationAngle(T_motion) * 180.0 / M_PI;
+        if (translation < params_.keyframe_translation_ &&
+            rotation < params_.keyframe_rotation_) {
+            return false;
+        }
+    }
+
+    auto keyframe = std::make_shared<Keyframe>();
+    keyframe->frame_id_ = frame_id;
+    keyframe->rgbd_ = rgbd.To(core::Device("CPU:0"));
+    keyframe->T_odometry_ = T_odometry;
+    keyframe->T_integrated_ = T_integrated;
+    keyframes_.push_back(keyframe);
+    queue_.push_back(keyframe);
+    queue_changed_.notify_one();
+    return true;
+}
+
+void Backend::Run() {
+    while (true) {
+        std::shared_ptr<Keyframe> keyframe;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queue_changed_.wait(lock,
+                                [&] { return stopped_ || !queue_.empty(); });
+            if (stopped_) break;
+            keyframe = queue_.front();
+            queue_.pop_front();
+            busy_ = true;
+        }
+
+        bool failed = false;
+        try {
+            ProcessKeyframe(keyframe);
+        } catch (const std::exception& e) {
+            // Pose graph nodes must match the keyframes, so stop here.
+            utility::LogWarning("Loop closure back end stopped: {}", e.what());
+            failed = true;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_ = false;
+            stopped_ = stopped_ || failed;
+        }
+        idle_.notify_all();
+    }
+    idle_.notify_all();
+}
+
+void Backend::ProcessKeyframe(const std::shared_ptr<Keyframe>& keyframe) {
+    namespace registration = t::pipelines::registration;
+
+    const BackendParams& p = params_;
+    keyframe->descriptor_ =
+            ComputeDescriptor(keyframe->rgbd_, p.depth_scale_, p.depth_max_,
+                              p.descriptor_rows_, p.descriptor_cols_);
+    keyframe->pcd_ =
+            t::geometry::PointCloud::CreateFromDepthImage(
+                    keyframe->rgbd_.depth_, intrinsics_,
+                    core::Tensor::Eye(4, core::Float32, core::Device("CPU:0")),
+                    p.depth_scale_, p.depth_max_)
+                    .VoxelDownSample(p.voxel_size_);
+    keyframe->pcd_.EstimateNormals(30, 2 * p.voxel_size_);
+
+    std::vector<std::shared_ptr<Keyframe>> keyframes;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        keyframes.assign(keyframes_.begin(),
+                         keyframes_.begin() + working_graph_.nodes_.size());
+    }
+    const int id = int(working_graph_.nodes_.size());
+    if (id == 0) {
+        working_graph_.nodes_.emplace_back(keyframe->T_odometry_);
+    } else {
+        // Odometry edge from the previous keyframe.
+        const Keyframe& prev = *keyframes.back();
+        const Eigen::Matrix4d T_motion =
+                prev.T_odometry_.inverse() * keyframe->T_odometry_;
+        const Eigen::Matrix4d T_prev_to_curr = T_motion.inverse();
+        const Eigen::Matrix6d information =
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        registration::GetInformationMatrix(
+                                prev.pcd_, keyframe->pcd_,
+                                p.max_correspondence_distance_,
+                                ToTensor(T_prev_to_curr)));
+        working_graph_.nodes_.emplace_back(
+                working_graph_.nodes_.back().pose_ * T_motion);
+        working_graph_.edges_.emplace_back(id - 1, id, T_prev_to_curr,
+                                           information, false);
+    }
+
+    // Loop candidates among older keyframes, most similar first.
+    std::vector<std::pair<double, int>> candidates;
+    for (int i = 0; i + p.min_loop_interval_ <= id; ++i) {
+        const double similarity =
+                keyframes[i]->descriptor_.dot(keyframe->descriptor_);
+        if (similarity >= p.min_similarity_) {
+            candidates.emplace_back(similarity, i);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              std::greater<std::pair<double, int>>());
+    if (int(candidates.size()) > p.max_loop_candidates_) {
+        candidates.resize(p.max_loop_candidates_);
+    }
+
+    int num_accepted = 0;
+    for (const auto& candidate : candidates) {
+        const int i = candidate.second;
+        const Keyframe& loop = *keyframes[i];
+        const Eigen::Matrix4d T_init =
+                working_graph_.nodes_[id].pose_.inverse() *
+                working_graph_.nodes_[i].pose_;
+        auto result = registration::ICP(
+                loop.pcd_, keyframe->pcd_, p.max_correspondence_distance_,
+                ToTensor(T_init),
+                registration::TransformationEstimationPointToPlane());
+        utility::LogDebug(
+                "Loop candidate {} -> {} (frames {} -> {}), similarity "
+                "{:.3f}, fitness {:.3f}, rmse {:.4f}.",
+                i, id, loop.frame_id_, keyframe->frame_id_, candidate.first,
+                result.fitness_, result.inlier_rmse_);
+        if (result.fitness_ < p.min_fitness_) continue;
+
+        const Eigen::Matrix6d information =
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        registration::GetInformationMatrix(
+                                loop.pcd_, keyframe->pcd_,
+                                p.max_correspondence_distance_,
+                                result.transformation_));
+        working_graph_.edges_.emplace_back(i, id,
+                                           ToEigen(result.transformation_),
+                                           information, true);
+        ++num_accepted;
+    }
+
+    if (num_accepted > 0) {
+        // Warm started from the current estimate, so only the new loop
+        // closures have to be absorbed.
+        open3d::pipelines::registration::GlobalOptimization(
+                working_graph_,
+                open3d::pipelines::registration::
+                        GlobalOptimizationLevenbergMarquardt(),
+                open3d::pipelines::registration::
+                        GlobalOptimizationConvergenceCriteria(),
+                open3d::pipelines::registration::GlobalOptimizationOption(
+                        p.max_correspondence_distance_,
+                        p.edge_prune_threshold_, p.preference_loop_closure_,
+                        0));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pose_graph_ = working_graph_;
+    if (num_accepted > 0) {
+        num_loop_closures_ = std::count_if(
+                working_graph_.edges_.begin(), working_graph_.edges_.end(),
+                [](const PoseGraphEdge& edge) { return edge.uncertain_; });
+        ++graph_version_;
+    }
+}
+
+bool Backend::Update(Model& model) {
+    PoseGraph pose_graph;
+    std::vector<std::shared_ptr<Keyframe>> keyframes;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (graph_version_ == applied_version_) return false;
+        applied_version_ = graph_version_;
+        pose_graph = pose_graph_;
+        keyframes = keyframes_;
+    }
+    const size_t num_nodes = pose_graph.nodes_.size();
+    if (num_nodes == 0) return false;
+
+    // Keyframes added after the optimization follow the last optimized one.
+    const Keyframe& last = *keyframes[num_nodes - 1];
+    const Eigen::Matrix4d T_last = pose_graph.nodes_.back().pose_;
+    std::vector<Eigen::Matrix4d> T_optimized(keyframes.size());
+    for (size_t i = 0; i < keyframes.size(); ++i) {
+        T_optimized[i] = i < num_nodes
+                                 ? Eigen::Matrix4d(pose_graph.nodes_[i].pose_)
+                                 : Eigen::Matrix4d(T_last *
+                                                   last.T_odometry_.inverse() *
+                                                   keyframes[i]->T_odometry_);
+    }
+    const Eigen::Matrix4d T_correction =
+            T_last * (correction_ * last.T_odometry_).inverse();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        correction_ = T_correction * correction_;
+    }
+    model.T_frame_to_world_ =
+            ToTensor(T_correction * ToEigen(model.GetCurrentFramePose()));
+
+    // Move the keyframes whose optimized pose differs from the one they are
+    // integrated at. Other frames keep their contribution where they were
+    // integrated.
+    const BackendParams& p = params_;
+    t::geometry::VoxelBlockGrid& grid = model.voxel_grid_;
+    const core::Device device = grid.GetHashMap().GetDevice();
+    int64_t num_reintegrated = 0;
+    for (size_t i = 0; i < keyframes.size(); ++i) {
+        Keyframe& keyframe = *keyframes[i];
+        const bool is_last = i + 1 == keyframes.size();
+        const bool moved =
+                Displacement(keyframe.T_integrated_.inverse() * T_optimized[i],
+                             p.depth_max_) > p.reintegration_threshold_;
+        if (!moved && !is_last) continue;
+
+        const t::geometry::RGBDImage rgbd = keyframe.rgbd_.To(device);
+        const core::Tensor extrinsic = ToTensor(T_optimized[i].inverse());
+        const core::Tensor block_coords = grid.GetUniqueBlockCoordinates(
+                rgbd.depth_, intrinsics_, extrinsic, p.depth_scale_,
+                p.depth_max_, p.trunc_voxel_multiplier_);
+        if (is_last) {
+            model.frustum_block_coords_ = block_coords;
+        }
+        if (!moved) continue;
+
+        Deintegrate(grid, rgbd, intrinsics_,
+                    ToTensor(keyframe.T_integrated_.inverse()), p);
+        grid.Integrate(block_coords, rgbd.depth_, rgbd.color_, intrinsics_,
+                       extrinsic, p.depth_scale_, p.depth_max_,
+                       p.trunc_voxel_multiplier_);
+        keyframe.T_integrated_ = T_optimized[i];
+        ++num_reintegrated;
+    }
+    utility::LogDebug(
+            "Applied pose graph with {} nodes, re-integrated {} of {} "
+            "keyframes.",
+            num_nodes, num_reintegrated, keyframes.size());
+    return true;
+}
+
+void Backend::WaitForIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [&] { return stopped_ || (queue_.empty() && !busy_); });
+}
+
+void Backend::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    queue_changed_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+PoseGraph Backend::GetPoseGraph() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pose_graph_;
+}
+
+std::vector<int64_t> Backend::GetKeyframeIds() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<int64_t> frame_ids;
+    for (const auto& keyframe : keyframes_) {
+        frame_ids.push_back(keyframe->frame_id_);
+    }
+    return frame_ids;
+}
+
+int64_t Backend::GetNumLoopClosures() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_loop_closures_;
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
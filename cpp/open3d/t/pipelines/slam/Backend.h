@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/pipelines/slam/Model.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+class BackendParams {
+public:
+    /// \brief Parameters of the loop closure back end.
+    ///
+    /// \param depth_scale Scale factor to convert raw data into meter metric.
+    /// \param depth_max Depth truncation to discard points far away from the
+    /// camera.
+    /// \param trunc_voxel_multiplier Truncation distance multiplier in voxel
+    /// size for signed distance, used for re-integration.
+    /// \param keyframe_translation A frame becomes a keyframe if it moved
+    /// farther than this distance in meters from the last keyframe.
+    /// \param keyframe_rotation A frame becomes a keyframe if it rotated more
+    /// than this angle in degrees from the last keyframe.
+    /// \param min_loop_interval Minimum number of keyframes between the two
+    /// keyframes of a loop closure.
+    /// \param min_similarity Minimum descriptor similarity in [-1, 1] of a
+    /// loop candidate.
+    /// \param max_loop_candidates Maximum number of candidates verified with
+    /// ICP per keyframe.
+    /// \param voxel_size Voxel size in meters of the keyframe point clouds
+    /// used for ICP.
+    /// \param max_correspondence_distance Maximum correspondence distance in
+    /// meters of ICP.
+    /// \param min_fitness Loop closures with a lower ICP fitness are rejected.
+    /// \param reintegration_threshold Keyframes are re-integrated if their
+    /// optimized pose moves points at depth_max farther than this distance in
+    /// meters from where they were integrated.
+    BackendParams(float depth_scale = 1000.0f,
+                  float depth_max = 3.0f,
+                  float trunc_voxel_multiplier = 8.0f,
+                  double keyframe_translation = 0.3,
+                  double keyframe_rotation = 15.0,
+                  int min_loop_interval = 10,
+                  double min_similarity = 0.8,
+                  int max_loop_candidates = 3,
+                  double voxel_size = 0.025,
+                  double max_correspondence_distance = 0.07,
+                  double min_fitness = 0.3,
+                  double reintegration_threshold = 0.01)
+        : depth_scale_(depth_scale),
+          depth_max_(depth_max),
+          trunc_voxel_multiplier_(trunc_voxel_multiplier),
+          keyframe_translation_(keyframe_translation),
+          keyframe_rotation_(keyframe_rotation),
+          min_loop_interval_(min_loop_interval),
+          min_similarity_(min_similarity),
+          max_loop_candidates_(max_loop_candidates),
+          voxel_size_(voxel_size),
+          max_correspondence_distance_(max_correspondence_distance),
+          min_fitness_(min_fitness),
+          reintegration_threshold_(reintegration_threshold) {}
+
+public:
+    float depth_scale_;
+    float depth_max_;
+    float trunc_voxel_multiplier_;
+    double keyframe_translation_;
+    double keyframe_rotation_;
+    int min_loop_interval_;
+    double min_similarity_;
+    int max_loop_candidates_;
+    double voxel_size_;
+    double max_correspondence_distance_;
+    double min_fitness_;
+    double reintegration_threshold_;
+    /// Loop closures with a lower confidence after pose graph optimization
+    /// are pruned.
+    double edge_prune_threshold_ = 0.25;
+    /// Weight of loop closure edges relative to odometry edges.
+    double preference_loop_closure_ = 0.1;
+    /// Rows and columns of the grid of the global keyframe descriptor.
+    int descriptor_rows_ = 12;
+    int descriptor_cols_ = 16;
+};
+
+/// \class Backend
+/// \brief Online loop closure and pose graph back end of a Model.
+///
+/// The front end passes every tracked frame to AddFrame(), which selects
+/// keyframes. A background thread describes each keyframe with a small grid
+/// of normalized intensity and depth averages, finds loop candidates among
+/// older keyframes by descriptor similarity, verifies them with point to
+/// plane ICP and optimizes the keyframe pose graph after each accepted loop
+/// closure. Update() applies the latest optimized poses on the thread owning
+/// the model: keyframes that moved are de-integrated at the pose they were
+/// integrated at and integrated again at their optimized pose, and the current
+/// frame pose of the model is corrected. Only keyframe images are kept, so
+/// the observations of the other frames stay where they were integrated.
+///
+/// A typical loop calls AddFrame() after Model::Integrate() and Update()
+/// before Model::SynthesizeModelFrame().
+class Backend {
+public:
+    /// \param intrinsics (3, 3) intrinsic matrix of the input frames.
+    /// \param params Back end parameters.
+    Backend(const core::Tensor& intrinsics,
+            const BackendParams& params = BackendParams());
+    ~Backend();
+
+    Backend(const Backend&) = delete;
+    Backend& operator=(const Backend&) = delete;
+
+    /// \brief Adds a tracked and integrated frame.
+    ///
+    /// \param frame_id Id of the frame.
+    /// \param rgbd The RGBD image of the frame. Keyframes keep a copy on the
+    /// host for re-integration.
+    /// \param T_frame_to_world (4, 4) pose of the frame in the model.
+    /// \return True if the frame was selected as a keyframe.
+    bool AddFrame(int64_t frame_id,
+                  const t::geometry::RGBDImage& rgbd,
+                  const core::Tensor& T_frame_to_world);
+
+    /// \brief Applies the latest optimized pose graph to \p model.
+    ///
+    /// Must be called on the thread owning the model, since keyframes are
+    /// de-integrated and re-integrated.
+    /// \return True if the model was corrected.
+    bool Update(Model& model);
+
+    /// Blocks until all added keyframes are processed.
+    void WaitForIdle();
+
+    /// Stops the background thread. Keyframes added afterwards are ignored.
+    void Stop();
+
+    /// Returns a copy of the keyframe pose graph.
+    open3d::pipelines::registration::PoseGraph GetPoseGraph() const;
+
+    /// Returns the frame ids of the keyframes, in the order of the pose graph
+    /// nodes.
+    std::vector<int64_t> GetKeyframeIds() const;
+
+    /// Returns the number of accepted loop closures.
+    int64_t GetNumLoopClosures() const;
+
+private:
+    struct Keyframe;
+
+    void Run();
+    void ProcessKeyframe(const std::shared_ptr<Keyframe>& keyframe);
+
+    core::Tensor intrinsics_;
+    BackendParams params_;
+
+    /// Keyframes in the order they were added. Guarded by mutex_.
+    std::vector<std::shared_ptr<Keyframe>> keyframes_;
+    /// Keyframes waiting for the background thread. Guarded by mutex_.
+    std::deque<std::shared_ptr<Keyframe>> queue_;
+    bool busy_ = false;
+    bool stopped_ = false;
+    int64_t num_loop_closures_ = 0;
+
+    /// Pose graph of the processed keyframes, owned by the background
+    /// thread. pose_graph_ is the optimized snapshot shared with Update(),
+    /// guarded by mutex_.
+    open3d::pipelines::registration::PoseGraph working_graph_;
+    open3d::pipelines::registration::PoseGraph pose_graph_;
+    int64_t graph_version_ = 0;
+    int64_t applied_version_ = 0;
+
+    /// Accumulated correction from the frame of the front end poses passed to
+    /// AddFrame() before the first Update() to the current model frame.
+    Eigen::Matrix4d_u correction_ = Eigen::Matrix4d::Identity();
+
+    mutable std::mutex mutex_;
+    std::condition_variable queue_changed_;
+    std::condition_variable idle_;
+    std::thread thread_;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
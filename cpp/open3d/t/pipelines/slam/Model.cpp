@@ -72,12 +72,9 @@ odometry::OdometryResult Model::TrackFrameToModel(
         float depth_max,
         float depth_diff,
         const odometry::Method method,
-        const std::vector<odometry::OdometryConvergenceCriteria>& criteria) {
-    // TODO: Expose init_source_to_target as param, and make the input sequence
-    // consistent with RGBDOdometryMultiScale.
-    const static core::Tensor init_source_to_target =
-            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
-
+        const std::vector<odometry::OdometryConvergenceCriteria>& criteria,
+        const core::Tensor& init_source_to_target) {
+    // TODO: Make the input sequence consistent with RGBDOdometryMultiScale.
     return odometry::RGBDOdometryMultiScale(
             t::geometry::RGBDImage(input_frame.GetDataAsImage("color"),
                                    input_frame.GetDataAsImage("depth")),
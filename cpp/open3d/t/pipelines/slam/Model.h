@@ -73,6 +73,9 @@ public:
     /// \param criteria Criteria used to define and terminate iterations.
     /// In multiscale odometry the order is from coarse to fine. Inputting a
     /// vector of iterations by default triggers the implicit conversion.
+    /// \param init_source_to_target (4, 4) initial transformation from the
+    /// input frame to the raycast frame, e.g., if the raycast frame was
+    /// synthesized at an older pose.
     odometry::OdometryResult TrackFrameToModel(
             const Frame& input_frame,
             const Frame& raycast_frame,
@@ -81,7 +84,9 @@ public:
             float depth_diff = 0.07,
             odometry::Method method = odometry::Method::PointToPlane,
             const std::vector<odometry::OdometryConvergenceCriteria>& criteria =
-                    {6, 3, 1});
+                    {6, 3, 1},
+            const core::Tensor& init_source_to_target =
+                    core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")));
 
     /// Integrate RGBD frame into the volumetric voxel grid.
     /// \param input_frame Input RGBD frame.
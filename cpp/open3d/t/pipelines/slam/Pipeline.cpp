@@ -0,0 +1,323 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/Pipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+namespace {
+
+/// Blocking FIFO queue with a maximum size connecting two pipeline stages.
+/// Close() wakes up all waiting threads. Push() fails after closing, while
+/// Pop() still returns the remaining items.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity)
+        : capacity_(std::max<size_t>(capacity, 1)) {}
+
+    bool Push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock,
+                       [&] { return closed_ || queue_.size() < capacity_; });
+        if (closed_) return false;
+        queue_.push(std::move(item));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    bool Pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [&] { return closed_ || !queue_.empty(); });
+        if (queue_.empty()) return false;
+        item = std::move(queue_.front());
+        queue_.pop();
+        not_full_.notify_one();
+        return true;
+    }
+
+    void Close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+private:
+    size_t capacity_;
+    bool closed_ = false;
+    std::queue<T> queue_;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+};
+
+struct PipelineFrame {
+    int64_t frame_id = -1;
+    t::geometry::RGBDImage rgbd;
+    core::Tensor T_frame_to_world;
+    bool tracking_success = true;
+    /// System time in ms when loading finished.
+    double loaded_time = 0;
+};
+
+/// The latest synthesized model frame and the pose it was synthesized at.
+struct ModelFrame {
+    int64_t frame_id = -1;
+    std::shared_ptr<Frame> raycast_frame;
+    core::Tensor T_frame_to_world;
+};
+
+}  // namespace
+
+Pipeline::Pipeline(Model& model,
+                   const core::Tensor& intrinsics,
+                   const PipelineParams& params)
+    : model_(model), intrinsics_(intrinsics), params_(params) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    if (params_.max_model_lag_ < 0) {
+        utility::LogError("max_model_lag must be non-negative, but got {}.",
+                          params_.max_model_lag_);
+    }
+}
+
+std::vector<core::Tensor> Pipeline::Run(const FrameLoader& loader,
+                                        const FrameCallback& callback) {
+    const core::Device device = model_.voxel_grid_.GetHashMap().GetDevice();
+    const core::Device host("CPU:0");
+    const int64_t first_frame_id = model_.frame_id_ + 1;
+    const core::Tensor T_init =
+            model_.GetCurrentFramePose().To(host, core::Float64);
+
+    BoundedQueue<PipelineFrame> loaded_queue(params_.queue_size_);
+    BoundedQueue<PipelineFrame> tracked_queue(params_.queue_size_);
+
+    std::mutex model_mutex;
+    std::condition_variable model_updated;
+    ModelFrame model_frame;
+    bool aborted = false;
+    std::exception_ptr error;
+
+    // Stops all stages after an error in one of them.
+    auto Abort = [&](std::exception_ptr e) {
+        {
+            std::lock_guard<std::mutex> lock(model_mutex);
+            if (!error) error = e;
+            aborted = true;
+        }
+        model_updated.notify_all();
+        loaded_queue.Close();
+        tracked_queue.Close();
+    };
+
+    double load_time = 0, track_time = 0;
+
+    std::thread load_thread([&] {
+        try {
+            for (int64_t i = 0;; ++i) {
+                utility::Timer timer;
+                timer.Start();
+                PipelineFrame frame;
+                frame.frame_id = first_frame_id + i;
+                frame.rgbd = loader(i);
+                if (frame.rgbd.IsEmpty()) break;
+                frame.rgbd = frame.rgbd.To(device);
+                timer.Stop();
+                load_time += timer.GetDurationInMillisecond();
+                frame.loaded_time =
+                        utility::Timer::GetSystemTimeInMilliseconds();
+                if (!loaded_queue.Push(std::move(frame))) break;
+            }
+            loaded_queue.Close();
+        } catch (...) {
+            Abort(std::current_exception());
+        }
+    });
+
+    std::thread track_thread([&] {
+        try {
+            core::Tensor T_prev = T_init;
+            PipelineFrame frame;
+            while (loaded_queue.Pop(frame)) {
+                if (frame.frame_id == first_frame_id) {
+                    frame.T_frame_to_world = T_init;
+                    if (!tracked_queue.Push(std::move(frame))) break;
+                    continue;
+                }
+
+                // Wait until a model frame is published and recent enough.
+                ModelFrame model_curr;
+                {
+                    std::unique_lock<std::mutex> lock(model_mutex);
+                    model_updated.wait(lock, [&] {
+                        return aborted ||
+                               (model_frame.frame_id >= first_frame_id &&
+                                model_frame.frame_id >=
+                                        frame.frame_id - 1 -
+                                                params_.max_model_lag_);
+                    });
+                    if (aborted) break;
+                    model_curr = model_frame;
+                }
+
+                utility::Timer timer;
+                timer.Start();
+                Frame input_frame(frame.rgbd.depth_.GetRows(),
+                                  frame.rgbd.depth_.GetCols(), intrinsics_,
+                                  device);
+                input_frame.SetDataFromImage("depth", frame.rgbd.depth_);
+                input_frame.SetDataFromImage("color", frame.rgbd.color_);
+
+                // The model frame may be older than the previous frame, so
+                // start from the motion since the model frame.
+                const core::Tensor T_init_source_to_target =
+                        model_curr.T_frame_to_world.Inverse().Matmul(T_prev);
+                auto result = model_.TrackFrameToModel(
+                        input_frame, *model_curr.raycast_frame,
+                        params_.depth_scale_, params_.depth_max_,
+                        params_.depth_diff_, params_.method_,
+                        params_.criteria_, T_init_source_to_target);
+
+                // Motion relative to the previous frame.
+                core::Tensor motion = T_init_source_to_target.Inverse().Matmul(
+                        result.transformation_);
+                core::Tensor translation = motion.Slice(0, 0, 3).Slice(1, 3, 4);
+                double translation_norm = std::sqrt(
+                        (translation * translation).Sum({0, 1}).Item<double>());
+                if (result.fitness_ >= params_.min_fitness_ &&
+                    translation_norm < params_.max_translation_) {
+                    T_prev = model_curr.T_frame_to_world.Matmul(
+                            result.transformation_);
+                } else {  // Don't update
+                    frame.tracking_success = false;
+                    utility::LogWarning(
+                            "Tracking failed for frame {}, fitness: {:.3f}, "
+                            "translation: {:.3f}. Using previous frame's "
+                            "pose.",
+                            frame.frame_id, result.fitness_, translation_norm);
+                }
+                frame.T_frame_to_world = T_prev;
+                timer.Stop();
+                track_time += timer.GetDurationInMillisecond();
+
+                if (!tracked_queue.Push(std::move(frame))) break;
+            }
+            tracked_queue.Close();
+        } catch (...) {
+            Abort(std::current_exception());
+        }
+    });
+
+    // Mapping runs on the calling thread, since it owns the model.
+    std::vector<core::Tensor> poses;
+    statistics_ = PipelineStatistics();
+    utility::Timer run_timer;
+    run_timer.Start();
+    try {
+        std::shared_ptr<Frame> raycast_frame;
+        PipelineFrame frame;
+        while (tracked_queue.Pop(frame)) {
+            utility::Timer timer;
+            timer.Start();
+            if (!raycast_frame) {
+                raycast_frame = std::make_shared<Frame>(
+                        frame.rgbd.depth_.GetRows(),
+                        frame.rgbd.depth_.GetCols(), intrinsics_, device);
+            }
+
+            Frame input_frame(frame.rgbd.depth_.GetRows(),
+                              frame.rgbd.depth_.GetCols(), intrinsics_, device);
+            input_frame.SetDataFromImage("depth", frame.rgbd.depth_);
+            input_frame.SetDataFromImage("color", frame.rgbd.color_);
+
+            model_.UpdateFramePose(frame.frame_id, frame.T_frame_to_world);
+            if (frame.tracking_success) {
+                model_.Integrate(input_frame, params_.depth_scale_,
+                                 params_.depth_max_,
+                                 params_.trunc_voxel_multiplier_);
+            } else {
+                ++statistics_.num_tracking_failures_;
+            }
+
+            // The tracking thread may still read the previous model frame, so
+            // ray cast into a copy.
+            raycast_frame = std::make_shared<Frame>(*raycast_frame);
+            model_.SynthesizeModelFrame(*raycast_frame, params_.depth_scale_,
+                                        0.1, params_.depth_max_,
+                                        params_.trunc_voxel_multiplier_,
+                                        false);
+            {
+                std::lock_guard<std::mutex> lock(model_mutex);
+                model_frame.frame_id = frame.frame_id;
+                model_frame.raycast_frame = raycast_frame;
+                model_frame.T_frame_to_world = frame.T_frame_to_world;
+            }
+            model_updated.notify_all();
+            timer.Stop();
+            statistics_.map_time_ += timer.GetDurationInMillisecond();
+
+            const double latency =
+                    utility::Timer::GetSystemTimeInMilliseconds() -
+                    frame.loaded_time;
+            statistics_.mean_latency_ += latency;
+            statistics_.max_latency_ =
+                    std::max(statistics_.max_latency_, latency);
+            ++statistics_.num_frames_;
+
+            poses.push_back(frame.T_frame_to_world);
+            if (callback) {
+                callback(frame.frame_id, frame.T_frame_to_world);
+            }
+        }
+    } catch (...) {
+        Abort(std::current_exception());
+    }
+    run_timer.Stop();
+
+    load_thread.join();
+    track_thread.join();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    const int64_t n = statistics_.num_frames_;
+    if (n > 0) {
+        statistics_.load_time_ = load_time / n;
+        statistics_.track_time_ = n > 1 ? track_time / (n - 1) : 0;
+        statistics_.map_time_ /= n;
+        statistics_.mean_latency_ /= n;
+        statistics_.fps_ = 1000.0 * n / run_timer.GetDurationInMillisecond();
+    }
+    utility::LogDebug(
+            "Pipeline processed {} frames at {:.2f} fps. Mean time load "
+            "{:.2f} ms, track {:.2f} ms, map {:.2f} ms, latency {:.2f} ms.",
+            n, statistics_.fps_, statistics_.load_time_,
+            statistics_.track_time_, statistics_.map_time_,
+            statistics_.mean_latency_);
+    return poses;
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+#include "open3d/t/pipelines/slam/Model.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+class PipelineParams {
+public:
+    /// \brief Parameters of the pipelined SLAM front end.
+    ///
+    /// \param depth_scale Scale factor to convert raw data into meter metric.
+    /// \param depth_max Depth truncation to discard points far away from the
+    /// camera.
+    /// \param depth_diff Depth difference threshold used to filter projective
+    /// associations in tracking.
+    /// \param trunc_voxel_multiplier Truncation distance multiplier in voxel
+    /// size for signed distance.
+    /// \param queue_size Maximum number of frames buffered between two stages.
+    /// \param max_model_lag Maximum number of frames the model used for
+    /// tracking may lag behind. With 0 frame i is tracked against the model
+    /// after integrating frame i - 1, like the sequential loop. With 1 tracking
+    /// of frame i overlaps the integration of frame i - 1. Tracking always
+    /// waits for the model frame of the first frame of a run.
+    /// \param min_fitness Tracking results with a lower fitness are rejected.
+    /// \param max_translation Tracking results moving the camera farther than
+    /// this distance in meters from the previous frame are rejected.
+    PipelineParams(float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float depth_diff = 0.07f,
+                   float trunc_voxel_multiplier = 8.0f,
+                   int queue_size = 2,
+                   int max_model_lag = 1,
+                   double min_fitness = 0.1,
+                   double max_translation = 0.15)
+        : depth_scale_(depth_scale),
+          depth_max_(depth_max),
+          depth_diff_(depth_diff),
+          trunc_voxel_multiplier_(trunc_voxel_multiplier),
+          queue_size_(queue_size),
+          max_model_lag_(max_model_lag),
+          min_fitness_(min_fitness),
+          max_translation_(max_translation) {}
+
+public:
+    float depth_scale_;
+    float depth_max_;
+    float depth_diff_;
+    float trunc_voxel_multiplier_;
+    int queue_size_;
+    int max_model_lag_;
+    double min_fitness_;
+    double max_translation_;
+    /// Method used for tracking.
+    odometry::Method method_ = odometry::Method::PointToPlane;
+    /// Criteria used for tracking from coarse to fine.
+    std::vector<odometry::OdometryConvergenceCriteria> criteria_ = {6, 3, 1};
+};
+
+/// Timing statistics of a pipeline run. Times are in milliseconds.
+class PipelineStatistics {
+public:
+    /// Number of processed frames.
+    int64_t num_frames_ = 0;
+    /// Number of frames where tracking was rejected.
+    int64_t num_tracking_failures_ = 0;
+    /// Mean time to load and upload a frame.
+    double load_time_ = 0;
+    /// Mean time to track a frame.
+    double track_time_ = 0;
+    /// Mean time to integrate a frame and synthesize the model frame.
+    double map_time_ = 0;
+    /// Mean and max time from loading a frame until it is integrated.
+    double mean_latency_ = 0;
+    double max_latency_ = 0;
+    /// Processed frames per second.
+    double fps_ = 0;
+};
+
+/// \class Pipeline
+/// \brief Runs the dense SLAM front end of a Model as a pipeline.
+///
+/// Loading, tracking and mapping (integration and ray casting) run on separate
+/// threads connected by bounded queues, so that loading frame i + 1, tracking
+/// frame i and integrating frame i - 1 overlap. Tracking uses the latest
+/// synthesized model frame, which may lag behind by
+/// PipelineParams::max_model_lag_ frames.
+class Pipeline {
+public:
+    /// Returns the RGBD image with the given index, counted from the start of
+    /// the run, or an empty image if there are no more frames. Called on the
+    /// loader thread.
+    using FrameLoader = std::function<t::geometry::RGBDImage(int64_t index)>;
+    /// Called on the thread calling Run() after a frame has been integrated.
+    using FrameCallback = std::function<void(
+            int64_t frame_id, const core::Tensor& T_frame_to_world)>;
+
+    /// \param model The model to track against and integrate into. It must
+    /// outlive the pipeline and must not be used by others during Run().
+    /// \param intrinsics (3, 3) intrinsic matrix of the input frames.
+    /// \param params Pipeline parameters.
+    Pipeline(Model& model,
+             const core::Tensor& intrinsics,
+             const PipelineParams& params = PipelineParams());
+
+    /// \brief Processes frames until \p loader returns an empty image.
+    ///
+    /// The first frame is integrated at the current pose of the model. Errors
+    /// on the worker threads stop the pipeline and are rethrown.
+    /// \param loader Function returning the next RGBD image.
+    /// \param callback Optional function called after each integration.
+    /// \return The (4, 4) Float64 frame to world poses of all frames.
+    std::vector<core::Tensor> Run(const FrameLoader& loader,
+                                  const FrameCallback& callback = nullptr);
+
+    /// Returns the statistics of the last run.
+    PipelineStatistics GetStatistics() const { return statistics_; }
+
+private:
+    Model& model_;
+    core::Tensor intrinsics_;
+    PipelineParams params_;
+    PipelineStatistics statistics_;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -201,6 +201,12 @@ Returns:
                  "algorithm.",
                  "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
                  "probability"_a = 0.99999999)
+            .def("segment_planes", &PointCloud::SegmentPlanes,
+                 "Segments several planes one after another using the RANSAC "
+                 "algorithm. Returns a list of (plane_model, inliers) tuples.",
+                 "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                 "num_iterations"_a = 100, "probability"_a = 0.99999999,
+                 "max_num_planes"_a = 10, "min_num_inliers"_a = 100)
             .def("detect_planar_patches", &PointCloud::DetectPlanarPatches,
                  R"doc(
 Detects planar patches in the point cloud using a robust statistics-based approach.
@@ -371,6 +377,20 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
              {"num_iterations", "Number of iterations."},
              {"probability",
               "Expected probability of finding the optimal plane."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Number of iterations per plane."},
+             {"probability",
+              "Expected probability of finding the optimal plane."},
+             {"max_num_planes", "Maximum number of planes to segment."},
+             {"min_num_inliers",
+              "Stop once the best plane has fewer inliers."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "detect_planar_patches",
             {
@@ -312,6 +312,14 @@ void pybind_trianglemesh(py::module &m) {
                         "creates cavities. See Edelsbrunner and Muecke, "
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
                         "pcd"_a, "alpha"_a, "tetra_mesh"_a, "pt_map"_a)
+            .def_static("create_from_point_cloud_alpha_shape_tiled",
+                        &TriangleMesh::CreateFromPointCloudAlphaShapeTiled,
+                        "Computes the same alpha shape as "
+                        "create_from_point_cloud_alpha_shape, but "
+                        "tetrahedralizes overlapping spatial tiles of the "
+                        "point cloud in parallel to bound the memory usage.",
+                        "pcd"_a, "alpha"_a, "tile_size"_a = 0,
+                        "n_threads"_a = -1)
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &TriangleMesh::CreateFromPointCloudBallPivoting,
@@ -324,8 +332,11 @@ void pybind_trianglemesh(py::module &m) {
                     "Ball Pivoting Algorithm\", 2014. The surface "
                     "reconstruction is done by rolling a ball with a given "
                     "radius over the point cloud, whenever the ball touches "
-                    "three points a triangle is created.",
-                    "pcd"_a, "radii"_a)
+                    "three points a triangle is created. With n_threads "
+                    "other than 1, large point clouds are split into spatial "
+                    "tiles that are reconstructed in parallel and stitched "
+                    "afterwards.",
+                    "pcd"_a, "radii"_a, "n_threads"_a = 1)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
                         "Function that computes a triangle mesh from a "
@@ -336,6 +347,16 @@ void pybind_trianglemesh(py::module &m) {
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
                         "linear_fit"_a = false, "n_threads"_a = -1)
+            .def_static("create_from_point_cloud_poisson_tiled",
+                        &TriangleMesh::CreateFromPointCloudPoissonTiled,
+                        "Computes a Screened Poisson Reconstruction like "
+                        "create_from_point_cloud_poisson, but splits the "
+                        "bounding cube into overlapping blocks that are solved "
+                        "independently and blended to bound the memory usage.",
+                        "pcd"_a, "depth"_a = 10, "max_block_depth"_a = 8,
+                        "max_block_memory_mb"_a = 0, "overlap"_a = 0.125,
+                        "scale"_a = 1.1, "linear_fit"_a = false,
+                        "n_threads"_a = -1)
             .def_static(
                     "create_from_oriented_bounding_box",
                     &TriangleMesh::CreateFromOrientedBoundingBox,
@@ -648,6 +669,20 @@ void pybind_trianglemesh(py::module &m) {
               "Otherwise, TetraMesh is computed from pcd."},
              {"pt_map",
               "Optional map from tetra_mesh vertex indices to pcd points."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_alpha_shape_tiled",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surface is "
+              "reconstructed."},
+             {"alpha",
+              "Parameter to control the shape. A very big value will give a "
+              "shape close to the convex hull."},
+             {"tile_size",
+              "Edge length of the cubic tiles. Set to 0 to choose it from the "
+              "number of points."},
+             {"n_threads",
+              "Number of threads used for the tiles. Set to -1 to "
+              "automatically determine it."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_ball_pivoting",
             {{"pcd",
@@ -655,7 +690,11 @@ void pybind_trianglemesh(py::module &m) {
               "reconstructed. Has to contain normals."},
              {"radii",
               "The radii of the ball that are used for the surface "
-              "reconstruction."}});
+              "reconstruction."},
+             {"n_threads",
+              "Number of threads used for reconstruction. The default 1 "
+              "grows a single front sequentially. Set to -1 to automatically "
+              "determine it and reconstruct spatial tiles in parallel."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_poisson",
             {{"pcd",
@@ -680,6 +719,35 @@ void pybind_trianglemesh(py::module &m) {
              {"n_threads",
               "Number of threads used for reconstruction. Set to -1 to "
               "automatically determine it."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_poisson_tiled",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surface is "
+              "reconstructed. Has to contain normals."},
+             {"depth",
+              "Maximum depth of the global tree. The finest cells have the "
+              "same size as with create_from_point_cloud_poisson at this "
+              "depth."},
+             {"max_block_depth",
+              "Maximum depth of the tree of a single block. The tree of a "
+              "block with overlap spans twice its width, so it is one level "
+              "deeper than the block itself."},
+             {"max_block_memory_mb",
+              "Estimated memory limit of a single block in MB. Blocks "
+              "exceeding it are split further. Set to 0 to only use "
+              "max_block_depth."},
+             {"overlap",
+              "Padding of each block relative to its width, in [0, 0.5]."},
+             {"scale",
+              "Specifies the ratio between the diameter of the cube used for "
+              "reconstruction and the diameter of the samples' bounding cube."},
+             {"linear_fit",
+              "If true, the reconstructor will use linear interpolation to "
+              "estimate the positions of iso-vertices."},
+             {"n_threads",
+              "Number of threads used to solve each block. The blocks are "
+              "solved one at a time. Set to -1 to automatically determine "
+              "it."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_oriented_bounding_box",
             {{"obox", "OrientedBoundingBox object to create mesh of."},
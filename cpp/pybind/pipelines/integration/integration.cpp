@@ -192,9 +192,19 @@ In SIGGRAPH, 2013)");
             .def("extract_voxel_point_cloud",
                  &ScalableTSDFVolume::ExtractVoxelPointCloud,
                  "Debug function to extract the voxel data into a point "
-                 "cloud.");
+                 "cloud.")
+            .def("integrate_many", &ScalableTSDFVolume::IntegrateMany,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Integrates several RGBD frames in parallel. The result "
+                 "equals integrating the frames one by one in order.",
+                 "images"_a, "intrinsic"_a, "extrinsics"_a);
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
                                     "extract_voxel_point_cloud");
+    docstring::ClassMethodDocInject(
+            m, "ScalableTSDFVolume", "integrate_many",
+            {{"images", "RGBD frames sharing the same intrinsic."},
+             {"intrinsic", "Pinhole camera intrinsic parameters."},
+             {"extrinsics", "Extrinsic parameters of each frame."}});
 }
 
 void pybind_integration_methods(py::module &m) {
@@ -39,6 +39,32 @@ public:
                                source, target, source_xyz, target_dx, target_dy,
                                extrinsic, corresps, intrinsic);
     }
+    std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override {
+        // Python overrides of the per-row Jacobian bypass the fused reduction.
+        bool has_override;
+        {
+            py::gil_scoped_acquire gil;
+            has_override = bool(py::get_override(
+                    static_cast<const RGBDOdometryJacobianBase *>(this),
+                    "compute_jacobian_and_residual"));
+        }
+        if (has_override) {
+            return RGBDOdometryJacobian::ComputeJTJandJTr(
+                    source, target, source_xyz, target_dx, target_dy,
+                    intrinsic, extrinsic, corresps);
+        }
+        return RGBDOdometryJacobianBase::ComputeJTJandJTr(
+                source, target, source_xyz, target_dx, target_dy, intrinsic,
+                extrinsic, corresps);
+    }
 };
 
 void pybind_odometry_classes(py::module &m) {
@@ -154,7 +154,8 @@ void pybind_image(py::module &m) {
                  "kernel_size"_a = 3, "sigma"_a = 1.0)
             .def("filter_bilateral", &Image::FilterBilateral,
                  "Return a new image after bilateral filtering."
-                 "Note: CPU (IPP) and CUDA (NPP) versions are inconsistent: "
+                 "Note: CPU (IPP or native) and CUDA (NPP) versions are "
+                 "inconsistent: "
                  "CPU uses a round kernel (radius = floor(kernel_size / 2)), "
                  "while CUDA uses a square kernel (width = kernel_size). "
                  "Make sure to tune parameters accordingly.",
@@ -212,18 +212,25 @@ The attributes of the point cloud have different levels::
     pointcloud.def(
             "voxel_down_sample",
             [](const PointCloud& pointcloud, const double voxel_size,
-               const std::string& reduction) {
-                return pointcloud.VoxelDownSample(voxel_size, reduction);
+               const std::string& reduction,
+               const std::unordered_map<std::string, std::string>&
+                       attr_reductions) {
+                return pointcloud.VoxelDownSample(voxel_size, reduction,
+                                                  attr_reductions);
             },
             "Downsamples a point cloud with a specified voxel size and a "
             "reduction type.",
             "voxel_size"_a, "reduction"_a = "mean",
+            "attr_reductions"_a =
+                    std::unordered_map<std::string, std::string>(),
             R"doc(Downsamples a point cloud with a specified voxel size.
 
 Args:
     voxel_size (float): The size of the voxel used to downsample the point cloud.
 
-    reduction (str): The approach to pool point properties in a voxel. Can only be "mean" at current.
+    reduction (str): The approach to pool point properties in a voxel. One of "mean" (average of the points in the voxel), "first" (attributes of the point with the smallest index) or "center" (attributes of the point closest to the voxel center).
+
+    attr_reductions (Dict[str, str]): Reduction of individual attributes by attribute name, overriding reduction. Integer and boolean attributes such as labels may also use "mode", the most frequent value in the voxel.
 
 Return:
     A downsampled point cloud with point properties reduced in each voxel.
@@ -445,8 +452,8 @@ Example:
 the remaining points. Based on Katz et al. 'Direct Visibility of Point Sets',
 2007. Additional information about the choice of radius for noisy point clouds
 can be found in Mehra et. al. 'Visibility of Noisy Point Cloud Data', 2010.
-This is a wrapper for a CPU implementation and a copy of the point cloud data
-and resulting visible triangle mesh and indiecs will be made.
+The spherical flip runs on the device of the point cloud, the convex hull is
+computed on the CPU with qhull.
 
 Args:
     camera_location: All points not visible from that location will be removed.
@@ -483,8 +490,8 @@ Example:
             "min_points"_a, "print_progress"_a = false,
             R"(Cluster PointCloud using the DBSCAN algorithm  Ester et al.,'A
 Density-Based Algorithm for Discovering Clusters in Large Spatial Databases
-with Noise', 1996. This is a wrapper for a CPU implementation and a copy of the
-point cloud data and resulting labels will be made.
+with Noise', 1996. Neighbors are found on the device of the point cloud and the
+clusters are formed in parallel on the CPU.
 
 Args:
     eps: Density parameter that is used to find neighbouring points.
@@ -519,8 +526,7 @@ Example:
             "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
             "num_iterations"_a = 100, "probability"_a = 0.999,
             R"(Segments a plane in the point cloud using the RANSAC algorithm.
-This is a wrapper for a CPU implementation and a copy of the point cloud data and
-resulting plane model and inlier indiecs will be made.
+Batches of plane hypotheses are scored in parallel on the CPU.
 
 Args:
     distance_threshold (default 0.01): Max distance a point can be from the plane model, and still be considered an inlier.
@@ -547,6 +553,45 @@ Example:
         inlier_cloud = inlier_cloud.paint_uniform_color([1.0, 0, 0])
         outlier_cloud = pcd.select_by_index(inliers, invert=True)
         o3d.visualization.draw([inlier_cloud, outlier_cloud]))");
+    pointcloud.def(
+            "segment_planes", &PointCloud::SegmentPlanes,
+            "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+            "num_iterations"_a = 100, "probability"_a = 0.99999999,
+            "max_num_planes"_a = 10, "min_num_inliers"_a = 100,
+            R"(Segments several planes one after another using the RANSAC algorithm.
+After each plane is found its inliers are removed and the next plane is
+segmented from the remaining points. Batches of plane hypotheses are scored in
+parallel on the CPU.
+
+Args:
+    distance_threshold (default 0.01): Max distance a point can be from the plane model, and still be considered an inlier.
+
+    ransac_n (default 3): Number of initial points to be considered inliers in each iteration.
+
+    num_iterations (default 100): Maximum number of iterations per plane.
+
+    probability (default 0.99999999): Expected probability of finding the optimal plane.
+
+    max_num_planes (default 10): Maximum number of planes to segment.
+
+    min_num_inliers (default 100): Stop once the best plane has fewer inliers.
+
+Return:
+    List of tuples of the plane model `ax + by + cz + d = 0` and the indices
+    of the plane inliers on the same device as the point cloud, in the order
+    the planes were segmented.
+
+Example:
+
+    We use Redwood dataset to segment its dominant planes::
+
+        sample_pcd_data = o3d.data.PCDPointCloud()
+        pcd = o3d.t.io.read_point_cloud(sample_pcd_data.path)
+        planes = pcd.segment_planes(distance_threshold=0.01,
+                                    num_iterations=1000,
+                                    max_num_planes=3)
+        for plane_model, inliers in planes:
+            print(plane_model, len(inliers)))");
     pointcloud.def(
             "compute_convex_hull", &PointCloud::ComputeConvexHull,
             "joggle_inputs"_a = false,
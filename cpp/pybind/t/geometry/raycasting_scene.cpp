@@ -91,11 +91,112 @@ Returns:
     The geometry ID of the added mesh.
 )doc");
 
-    raycasting_scene.def("cast_rays", &RaycastingScene::CastRays, "rays"_a,
-                         "nthreads"_a = 0,
-                         R"doc(
+    raycasting_scene.def(
+            "add_prototype",
+            py::overload_cast<const core::Tensor&, const core::Tensor&>(
+                    &RaycastingScene::AddPrototype),
+            "vertex_positions"_a, "triangle_indices"_a, R"doc(
+Add a triangle mesh as prototype for instances.
+
+Prototypes are not part of the scene. They can be placed multiple times in the
+scene with add_instance(). The acceleration structure of a prototype is built
+once and shared by all its instances.
+
+Args:
+    vertices (open3d.core.Tensor): Vertices as Tensor of dim {N,3} and dtype
+        Float32.
+    triangles (open3d.core.Tensor): Triangles as Tensor of dim {M,3} and dtype
+        UInt32.
+
+Returns:
+    The prototype ID of the added mesh.
+)doc");
+
+    raycasting_scene.def("add_prototype",
+                         py::overload_cast<const TriangleMesh&>(
+                                 &RaycastingScene::AddPrototype),
+                         "mesh"_a, R"doc(
+Add a triangle mesh as prototype for instances.
+
+Args:
+    mesh (open3d.t.geometry.TriangleMesh): A triangle mesh.
+
+Returns:
+    The prototype ID of the added mesh.
+)doc");
+
+    raycasting_scene.def("add_instance", &RaycastingScene::AddInstance,
+                         "prototype_id"_a, "transform"_a, R"doc(
+Add an instance of a prototype to the scene.
+
+Query results for hits with the instance report the geometry ID of the
+instance and the primitive IDs of the prototype mesh::
+
+    import open3d as o3d
+    import numpy as np
+
+    scene = o3d.t.geometry.RaycastingScene()
+    box = o3d.t.geometry.TriangleMesh.create_box()
+    box_id = scene.add_prototype(box)
+
+    # Place 100 boxes without copying the mesh.
+    for i in range(100):
+        transform = np.eye(4, dtype=np.float32)
+        transform[0, 3] = 2 * i
+        scene.add_instance(box_id, o3d.core.Tensor(transform))
+
+Args:
+    prototype_id (int): The ID returned by add_prototype().
+
+    transform (open3d.core.Tensor): The 4x4 transformation from the prototype
+        coordinate system to the scene.
+
+Returns:
+    The geometry ID of the instance.
+)doc");
+
+    raycasting_scene.def("set_instance_transform",
+                         &RaycastingScene::SetInstanceTransform,
+                         "geometry_id"_a, "transform"_a, R"doc(
+Changes the transformation of an instance.
+
+Moving instances switches the scene to a two-level acceleration structure such
+that only the top level is rebuilt on the next query.
+
+Args:
+    geometry_id (int): The geometry ID returned by add_instance().
+
+    transform (open3d.core.Tensor): The 4x4 transformation from the prototype
+        coordinate system to the scene.
+)doc");
+
+    raycasting_scene.def("set_geometry_mask", &RaycastingScene::SetGeometryMask,
+                         "geometry_id"_a, "mask"_a, R"doc(
+Sets the mask of a geometry or instance.
+
+Rays only intersect geometries for which the bitwise AND of the ray mask and
+the geometry mask is not 0. The default mask of a geometry is 0xFFFFFFFF.
+Closest point queries ignore masks.
+
+Args:
+    geometry_id (int): The geometry ID.
+
+    mask (int): The 32 bit mask.
+)doc");
+
+    raycasting_scene.def(
+            "cast_rays",
+            py::overload_cast<const core::Tensor&, const int, const uint32_t>(
+                    &RaycastingScene::CastRays),
+            "rays"_a, "nthreads"_a = 0, "ray_mask"_a = 0xFFFFFFFF,
+            R"doc(
 Computes the first intersection of the rays with the scene.
 
+Rays with 3 or more dims are treated as images with shape
+{.., height, width, 6} and are traced as SIMD packets of neighboring pixels,
+which is faster for coherent rays like the rays generated by
+create_rays_pinhole(). Rays with shape {N, 6} are traced individually.
+
 Args:
     rays (open3d.core.Tensor): A tensor with >=2 dims, shape {.., 6}, and Dtype
         Float32 describing the rays.
@@ -108,6 +209,10 @@ Args:
 
     nthreads (int): The number of threads to use. Set to 0 for automatic.
 
+    ray_mask (int): The mask of the rays. Only geometries with a mask that
+        shares a bit with the ray mask are intersected. See
+        set_geometry_mask().
+
 Returns:
     A dictionary which contains the following keys
 
@@ -132,11 +237,50 @@ Returns:
         A tensor with the normals of the hit triangles. The shape is {.., 3}.
 )doc");
 
-    raycasting_scene.def("test_occlusions", &RaycastingScene::TestOcclusions,
-                         "rays"_a, "tnear"_a = 0.f,
-                         "tfar"_a = std::numeric_limits<float>::infinity(),
-                         "nthreads"_a = 0,
-                         R"doc(
+    raycasting_scene.def(
+            "cast_rays",
+            [](RaycastingScene& self, const core::Tensor& rays,
+               std::unordered_map<std::string, core::Tensor> result,
+               const int nthreads, const uint32_t ray_mask) {
+                self.CastRays(rays, result, nthreads, ray_mask);
+                return result;
+            },
+            "rays"_a, "result"_a, "nthreads"_a = 0, "ray_mask"_a = 0xFFFFFFFF,
+            R"doc(
+Computes the first intersection of the rays with the scene and writes the
+results to the tensors in the result dictionary.
+
+Tensors in result with the expected shape and dtype are reused and all other
+tensors are allocated. This avoids allocations when casting rays repeatedly::
+
+    result = scene.cast_rays(rays)
+    for frame in range(100):
+        # Update rays and write to the existing tensors.
+        result = scene.cast_rays(rays, result)
+
+Args:
+    rays (open3d.core.Tensor): The rays. See the other overload.
+
+    result (dict): The dictionary with the output tensors. See the other
+        overload for the keys.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+    ray_mask (int): The mask of the rays. See set_geometry_mask().
+
+Returns:
+    The dictionary with the output tensors.
+)doc");
+
+    raycasting_scene.def(
+            "test_occlusions",
+            py::overload_cast<const core::Tensor&, const float, const float,
+                              const int, const uint32_t>(
+                    &RaycastingScene::TestOcclusions),
+            "rays"_a, "tnear"_a = 0.f,
+            "tfar"_a = std::numeric_limits<float>::infinity(),
+            "nthreads"_a = 0, "ray_mask"_a = 0xFFFFFFFF,
+            R"doc(
 Checks if the rays have any intersection with the scene.
 
 Args:
@@ -154,14 +298,53 @@ Args:
 
     nthreads (int): The number of threads to use. Set to 0 for automatic.
 
+    ray_mask (int): The mask of the rays. Only geometries with a mask that
+        shares a bit with the ray mask are intersected. See
+        set_geometry_mask().
+
 Returns:
     A boolean tensor which indicates if the ray is occluded by the scene (true)
     or not (false).
 )doc");
 
+    raycasting_scene.def(
+            "test_occlusions",
+            [](RaycastingScene& self, const core::Tensor& rays,
+               core::Tensor occluded, const float tnear, const float tfar,
+               const int nthreads, const uint32_t ray_mask) {
+                self.TestOcclusions(rays, occluded, tnear, tfar, nthreads,
+                                    ray_mask);
+                return occluded;
+            },
+            "rays"_a, "occluded"_a, "tnear"_a = 0.f,
+            "tfar"_a = std::numeric_limits<float>::infinity(),
+            "nthreads"_a = 0, "ray_mask"_a = 0xFFFFFFFF, R"doc(
+Checks if the rays have any intersection with the scene and writes the result
+to occluded.
+
+occluded is reused if it has the expected shape and dtype Bool and is allocated
+otherwise.
+
+Args:
+    rays (open3d.core.Tensor): The rays. See the other overload.
+
+    occluded (open3d.core.Tensor): The output tensor.
+
+    tnear (float): The tnear offset for the rays. The default is 0.
+
+    tfar (float): The tfar value for the ray. The default is infinity.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+    ray_mask (int): The mask of the rays. See set_geometry_mask().
+
+Returns:
+    The boolean output tensor.
+)doc");
+
     raycasting_scene.def("count_intersections",
                          &RaycastingScene::CountIntersections, "rays"_a,
-                         "nthreads"_a = 0, R"doc(
+                         "nthreads"_a = 0, "ray_mask"_a = 0xFFFFFFFF, R"doc(
 Computes the number of intersection of the rays with the scene.
 
 Args:
@@ -175,13 +358,17 @@ Args:
 
     nthreads (int): The number of threads to use. Set to 0 for automatic.
 
+    ray_mask (int): The mask of the rays. Only geometries with a mask that
+        shares a bit with the ray mask are intersected. See
+        set_geometry_mask().
+
 Returns:
     A tensor with the number of intersections. The shape is {..}.
 )doc");
 
     raycasting_scene.def("list_intersections",
                          &RaycastingScene::ListIntersections, "rays"_a,
-                         "nthreads"_a = 0, R"doc(
+                         "nthreads"_a = 0, "ray_mask"_a = 0xFFFFFFFF, R"doc(
 Lists the intersections of the rays with the scene::
 
     import open3d as o3d
@@ -239,6 +426,10 @@ Args:
 
     nthreads (int): The number of threads to use. Set to 0 for automatic.
 
+    ray_mask (int): The mask of the rays. Only geometries with a mask that
+        shares a bit with the ray mask are intersected. See
+        set_geometry_mask().
+
 Returns:
     The returned dictionary contains
     
@@ -273,6 +464,75 @@ An example of using ray_splits::
             print(f'ray {ray_id}, intersection {i} at {t}')
             
         
+)doc");
+
+    raycasting_scene.def("cast_rays_multi_hit",
+                         &RaycastingScene::CastRaysMultiHit, "rays"_a,
+                         "max_hits"_a, "nthreads"_a = 0,
+                         "ray_mask"_a = 0xFFFFFFFF, R"doc(
+Computes the first max_hits intersections along the rays.
+
+In contrast to cast_rays(), which only returns the closest hit, this function
+returns up to max_hits intersections per ray sorted by distance, e.g., to
+simulate multi-return lidar sensors::
+
+    import open3d as o3d
+
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+                                        o3d.geometry.TriangleMesh.create_box())
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(cube)
+
+    rays = o3d.t.geometry.RaycastingScene.create_rays_lidar(
+        elevations_deg=o3d.core.Tensor([-10, 0, 10], dtype=o3d.core.float32),
+        azimuth_resolution_deg=1,
+        extrinsic_matrix=o3d.core.Tensor([[1, 0, 0, 2], [0, 1, 0, -0.5],
+                                          [0, 0, 1, -0.5], [0, 0, 0, 1]]))
+    ans = scene.cast_rays_multi_hit(rays, max_hits=2)
+    print(ans['t_hit'][1, 0])  # [2, 3]
+
+Args:
+    rays (open3d.core.Tensor): A tensor with >=2 dims, shape {.., 6}, and Dtype
+        Float32 describing the rays; {..} can be any number of dimensions.
+        The last dimension must be 6 and has the format [ox, oy, oz, dx, dy, dz]
+        with [ox,oy,oz] as the origin and [dx,dy,dz] as the direction. It is not
+        necessary to normalize the direction although it should be normalised if
+        t_hit is to be calculated in coordinate units.
+
+    max_hits (int): The maximum number of intersections K to return per ray.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+    ray_mask (int): The mask of the rays. Only geometries with a mask that
+        shares a bit with the ray mask are intersected. See
+        set_geometry_mask().
+
+Returns:
+    A dictionary which contains the following keys
+
+    num_hits
+        A tensor with the number of returned hits. The shape is {..}.
+
+    t_hit
+        A tensor with the distance to the hits. Unused entries are inf. The
+        shape is {.., K}.
+
+    geometry_ids
+        A tensor with the geometry IDs. Unused entries are set to INVALID_ID.
+        The shape is {.., K}.
+
+    primitive_ids
+        A tensor with the primitive IDs, which corresponds to the triangle
+        index. Unused entries are set to INVALID_ID. The shape is {.., K}.
+
+    primitive_uvs
+        A tensor with the barycentric coordinates of the hit points within the
+        hit triangles. The shape is {.., K, 2}.
+
+    primitive_normals
+        A tensor with the normals of the hit triangles. The shape is
+        {.., K, 3}.
 )doc");
 
     raycasting_scene.def("compute_closest_points",
@@ -393,6 +653,85 @@ Returns:
     or 1. A point is occupied or inside if the value is 1.
 )doc");
 
+    raycasting_scene.def(
+            "compute_distance_grid", &RaycastingScene::ComputeDistanceGrid,
+            "origin"_a, "voxel_size"_a, "grid_size"_a,
+            "band_width"_a = std::numeric_limits<float>::infinity(),
+            "nthreads"_a = 0, R"doc(
+Computes the distance to the surface for all voxels of a dense grid.
+
+This is much faster than compute_distance() for the grid points. Exact closest
+points are computed for the voxels close to the surface and the grid boundary
+and are propagated to the remaining voxels with the jump flooding algorithm.
+The propagated distances are approximations which are exact in most cases.
+
+Args:
+    origin (open3d.core.Tensor): The position of the voxel (0,0,0) as tensor
+        with shape {3}.
+
+    voxel_size (float): The distance between neighboring voxels.
+
+    grid_size (open3d.core.SizeVector): The number of voxels [nx, ny, nz] in x,
+        y and z.
+
+    band_width (float): Only distances smaller than band_width are computed
+        and all other voxels are set to band_width. The distances in the band
+        are exact and no propagation is needed. The default computes the
+        distance for all voxels.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+Returns:
+    A Float32 tensor with shape {nx, ny, nz}. The element [i,j,k] is the
+    distance of the point origin + voxel_size * [i,j,k].
+)doc");
+
+    raycasting_scene.def(
+            "compute_signed_distance_grid",
+            &RaycastingScene::ComputeSignedDistanceGrid, "origin"_a,
+            "voxel_size"_a, "grid_size"_a,
+            "band_width"_a = std::numeric_limits<float>::infinity(),
+            "nthreads"_a = 0, "nsamples"_a = 1, R"doc(
+Computes the signed distance to the surface for all voxels of a dense grid.
+
+The distances are computed as in compute_distance_grid(). Like
+compute_signed_distance() this function assumes watertight meshes and
+determines the sign by counting intersections but uses a single ray for all
+voxels of a grid row::
+
+    import open3d as o3d
+
+    mesh = o3d.t.geometry.TriangleMesh.create_sphere()
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(mesh)
+
+    # 64^3 grid covering [-1.5, 1.5]^3
+    sdf = scene.compute_signed_distance_grid(origin=[-1.5, -1.5, -1.5],
+                                             voxel_size=3 / 63,
+                                             grid_size=[64, 64, 64])
+
+Args:
+    origin (open3d.core.Tensor): The position of the voxel (0,0,0) as tensor
+        with shape {3}.
+
+    voxel_size (float): The distance between neighboring voxels.
+
+    grid_size (open3d.core.SizeVector): The number of voxels [nx, ny, nz] in x,
+        y and z.
+
+    band_width (float): Only distances smaller than band_width are computed
+        and all other voxels are set to +-band_width.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+    nsamples (int): The number of rays per grid row used for determining the
+        inside. This must be an odd number.
+
+Returns:
+    A Float32 tensor with shape {nx, ny, nz}. Negative distances mean a point
+    is inside a closed surface.
+)doc");
+
     raycasting_scene.def_static(
             "create_rays_pinhole",
             py::overload_cast<const core::Tensor&, const core::Tensor&, int,
@@ -435,6 +774,34 @@ Returns:
     A tensor of shape {height_px, width_px, 6} with the rays.
 )doc");
 
+    raycasting_scene.def_static(
+            "create_rays_lidar", &RaycastingScene::CreateRaysLidar,
+            "elevations_deg"_a, "azimuth_resolution_deg"_a,
+            "extrinsic_matrix"_a, "extrinsic_matrix_end"_a = utility::nullopt,
+            R"doc(
+Creates rays for a rotating multi-beam lidar.
+
+The sensor rotates about its z axis and fires all beams at each azimuth step.
+The azimuth of column j is j * azimuth_resolution_deg measured from the x axis
+of the sensor.
+
+Args:
+    elevations_deg (open3d.core.Tensor): A tensor with shape {num_beams} with
+        the elevation angle of each beam in degree.
+    azimuth_resolution_deg (float): The angle between two azimuth steps in
+        degree. The number of columns is round(360 / azimuth_resolution_deg).
+    extrinsic_matrix (open3d.core.Tensor): The 4x4 world to sensor SE(3)
+        transformation matrix at the start of the sweep.
+    extrinsic_matrix_end (Optional[open3d.core.Tensor]): The 4x4 world to
+        sensor transformation at the end of the sweep. If given, the sensor
+        pose is interpolated over the sweep to simulate the rolling shutter
+        effect of a moving sensor.
+
+Returns:
+    A tensor of shape {num_beams, num_columns, 6} with the rays. The directions
+    have unit length such that t_hit is the range.
+)doc");
+
     raycasting_scene.def_property_readonly_static(
             "INVALID_ID",
             [](py::object /* self */) -> uint32_t {
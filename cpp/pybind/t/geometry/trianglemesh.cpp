@@ -12,6 +12,7 @@
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/t/geometry/LineSet.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "pybind/docstring.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -205,6 +206,147 @@ Returns:
     A scalar describing the surface area of the mesh.
 )");
 
+    triangle_mesh.def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                      "number_of_iterations"_a, "strength"_a,
+                      R"(Sharpens the mesh. Vertex positions, normals and colors are filtered if present.
+
+The output value is the input value plus strength times the input value minus
+the sum of the adjacent values.
+
+Args:
+    number_of_iterations (int): Number of repetitions of this operation.
+    strength (float): The strength of the filter.
+
+Returns:
+    The filtered triangle mesh.
+)");
+
+    triangle_mesh.def("filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+                      "number_of_iterations"_a,
+                      R"(Smooths the mesh by averaging every vertex with its neighbours. Vertex positions, normals and colors are filtered if present.
+
+Args:
+    number_of_iterations (int): Number of repetitions of this operation.
+
+Returns:
+    The filtered triangle mesh.
+)");
+
+    triangle_mesh.def(
+            "filter_smooth_laplacian", &TriangleMesh::FilterSmoothLaplacian,
+            "number_of_iterations"_a, "lambda_filter"_a = 0.5,
+            R"(Smooths the mesh with a Laplacian filter weighted by the inverse distance to the neighbours. Vertex positions, normals and colors are filtered if present.
+
+Args:
+    number_of_iterations (int): Number of repetitions of this operation.
+    lambda_filter (float): The smoothing parameter.
+
+Returns:
+    The filtered triangle mesh.
+
+Example:
+    This smooths the Stanford Bunny::
+
+        bunny = o3d.data.BunnyMesh()
+        mesh = o3d.t.io.read_triangle_mesh(bunny.path)
+        smooth = mesh.filter_smooth_laplacian(10)
+)");
+
+    triangle_mesh.def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                      "number_of_iterations"_a, "lambda_filter"_a = 0.5,
+                      "mu"_a = -0.53,
+                      R"(Smooths the mesh with the method of Taubin, "Curve and Surface Smoothing Without Shrinkage", 1995.
+
+Every iteration applies filter_smooth_laplacian twice, first with lambda_filter
+and then with mu. This avoids the shrinkage of the Laplacian filter.
+
+Args:
+    number_of_iterations (int): Number of repetitions of this operation.
+    lambda_filter (float): The filter parameter of the first step.
+    mu (float): The filter parameter of the second step.
+
+Returns:
+    The filtered triangle mesh.
+)");
+
+    triangle_mesh.def(
+            "sample_points_uniformly", &TriangleMesh::SamplePointsUniformly,
+            "number_of_points"_a, "use_triangle_normal"_a = false,
+            R"(Samples points uniformly on the triangles, with probability proportional to
+their areas. Floating point vertex attributes such as positions, normals and
+colors are interpolated at the samples. This runs on the CPU.
+
+Args:
+    number_of_points (int): Number of points to sample.
+    use_triangle_normal (bool): If True, the normals of the points are the
+        triangle normals instead of the interpolated vertex normals.
+
+Returns:
+    A point cloud with the sampled points.
+
+Example:
+    This samples the Stanford Bunny::
+
+        bunny = o3d.data.BunnyMesh()
+        mesh = o3d.t.io.read_triangle_mesh(bunny.path)
+        pcd = mesh.sample_points_uniformly(100000)
+)");
+
+    triangle_mesh.def(
+            "sample_points_poisson_disk", &TriangleMesh::SamplePointsPoissonDisk,
+            "number_of_points"_a, "init_factor"_a = 5, "pcl_init"_a = nullptr,
+            "use_triangle_normal"_a = false,
+            R"(Samples points on the mesh such that every point has approximately the same
+distance to its neighbours (blue noise). The method is weighted sample
+elimination of uniform samples, Yuksel, "Sample Elimination for Generating
+Poisson Disk Sample Sets", EUROGRAPHICS, 2015. This runs on the CPU.
+
+Args:
+    number_of_points (int): Number of points to keep.
+    init_factor (float): The uniform sampling draws
+        init_factor * number_of_points points.
+    pcl_init (open3d.t.geometry.PointCloud): Initial samples used instead of
+        the uniform sampling.
+    use_triangle_normal (bool): If True, the normals of the points are the
+        triangle normals instead of the interpolated vertex normals.
+
+Returns:
+    A point cloud with the sampled points.
+)");
+
+    triangle_mesh.def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                      "number_of_iterations"_a,
+                      R"(Subdivides the mesh with the method of Loop, "Smooth Subdivision Surfaces Based on Triangles", 1987.
+
+Every iteration splits each triangle into four. Vertex positions, normals and
+colors are interpolated, other vertex attributes are dropped. The new triangles
+inherit the attributes of their parent.
+
+Args:
+    number_of_iterations (int): Number of subdivision steps.
+
+Returns:
+    The subdivided triangle mesh.
+)");
+
+    triangle_mesh.def(
+            "cluster_connected_triangles",
+            &TriangleMesh::ClusterConnectedTriangles,
+            R"(Clusters the triangles into connected components. Triangles are connected if
+they share an edge. This runs on the CPU.
+
+Returns:
+    A tuple of the cluster index of every triangle, the number of triangles of
+    every cluster and the surface area of every cluster. Clusters are numbered
+    in order of their smallest triangle index.
+
+Example:
+    This removes all but the largest component::
+
+        clusters, n_triangles, areas = mesh.cluster_connected_triangles()
+        mesh = mesh.select_faces_by_mask(clusters == n_triangles.argmax())
+)");
+
     triangle_mesh.def(
             "compute_convex_hull", &TriangleMesh::ComputeConvexHull,
             "joggle_inputs"_a = false,
@@ -549,7 +691,9 @@ Example:
             "preserve_volume"_a = true,
             R"(Function to simplify mesh using Quadric Error Metric Decimation by Garland and Heckbert.
 
-This function always uses the CPU device.
+The edge collapses run on the CPU, the result is on the device of the mesh.
+Floating point vertex attributes are averaged over the merged vertices and
+triangle attributes are kept.
 
 Args:
     target_reduction (float): The factor of triangles to delete, i.e., setting
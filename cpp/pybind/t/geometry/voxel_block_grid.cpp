@@ -9,6 +9,7 @@
 #include <unordered_map>
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/t/geometry/MultiResolutionVoxelBlockGrid.h"
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 #include "pybind/core/tensor_converter.h"
 #include "pybind/t/geometry/geometry.h"
@@ -210,6 +211,79 @@ void pybind_voxel_block_grid(py::module& m) {
             "Save the voxel block grid to a npz file.", "file_name"_a);
     vbg.def_static("load", &VoxelBlockGrid::Load,
                    "Load a voxel block grid from a npz file.", "file_name"_a);
+
+    py::class_<MultiResolutionVoxelBlockGrid> mrvbg(
+            m, "MultiResolutionVoxelBlockGrid",
+            "A stack of voxel block grids whose voxel size doubles from one "
+            "level to the next. Each level integrates the depth observations "
+            "within its depth range, so that geometry near the sensor is "
+            "stored at the finest level and distant geometry at coarser "
+            "levels. Ray casting and extraction prefer the finest level.");
+
+    mrvbg.def(py::init<const std::vector<std::string>&,
+                       const std::vector<core::Dtype>&,
+                       const std::vector<core::SizeVector>&, float,
+                       const std::vector<float>&, int64_t, int64_t,
+                       const core::Device&>(),
+              "attr_names"_a, "attr_dtypes"_a, "attr_channels"_a,
+              "voxel_size"_a = 0.0058,
+              "level_depth_max"_a = std::vector<float>{3.0f},
+              "block_resolution"_a = 16, "block_count"_a = 10000,
+              "device"_a = core::Device("CPU:0"));
+
+    mrvbg.def_property_readonly("num_levels",
+                                &MultiResolutionVoxelBlockGrid::GetNumLevels,
+                                "Number of resolution levels.");
+    mrvbg.def("level", &MultiResolutionVoxelBlockGrid::GetLevel,
+              py::return_value_policy::reference_internal,
+              "Get the voxel block grid of a level, with level 0 the finest.",
+              "level"_a);
+    mrvbg.def("voxel_size", &MultiResolutionVoxelBlockGrid::GetVoxelSize,
+              "Get the voxel size of a level.", "level"_a);
+
+    mrvbg.def("integrate",
+              py::overload_cast<const Image&, const Image&,
+                                const core::Tensor&, const core::Tensor&,
+                                float, float>(
+                      &MultiResolutionVoxelBlockGrid::Integrate),
+              "Integrate an RGB-D frame into all levels.", "depth"_a,
+              "color"_a, "intrinsic"_a, "extrinsic"_a,
+              "depth_scale"_a.noconvert() = 1000.0f,
+              "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
+
+    mrvbg.def("integrate",
+              py::overload_cast<const Image&, const core::Tensor&,
+                                const core::Tensor&, float, float>(
+                      &MultiResolutionVoxelBlockGrid::Integrate),
+              "Integrate a depth image into all levels.", "depth"_a,
+              "intrinsic"_a, "extrinsic"_a,
+              "depth_scale"_a.noconvert() = 1000.0f,
+              "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
+
+    mrvbg.def("ray_cast", &MultiResolutionVoxelBlockGrid::RayCast,
+              "Ray cast all levels and keep, per pixel, the result of the "
+              "finest level with a surface. Supports the vertex, depth, color "
+              "and normal attributes.",
+              "intrinsic"_a, "extrinsic"_a, "width"_a, "height"_a,
+              "render_attributes"_a =
+                      std::vector<std::string>{"depth", "color"},
+              "depth_scale"_a = 1000.0f, "depth_min"_a = 0.1f,
+              "weight_threshold"_a = 3.0f, "trunc_voxel_multiplier"_a = 8.0f,
+              "range_map_down_factor"_a = 8);
+
+    mrvbg.def("extract_point_cloud",
+              &MultiResolutionVoxelBlockGrid::ExtractPointCloud,
+              "Extract the isosurface points of all levels, without the "
+              "points of a level that fall into blocks allocated at a finer "
+              "level.",
+              "weight_threshold"_a = 3.0f);
+
+    mrvbg.def("extract_triangle_mesh",
+              &MultiResolutionVoxelBlockGrid::ExtractTriangleMesh,
+              "Extract the triangle meshes of all levels, without the "
+              "triangles of a level that have a vertex in a block allocated "
+              "at a finer level.",
+              "weight_threshold"_a = 3.0f);
 }
 
 }  // namespace geometry
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "open3d/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDPrefetchReader.h"
 #include "open3d/t/io/sensor/RGBDSensor.h"
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 #ifdef BUILD_LIBREALSENSE
@@ -146,6 +147,51 @@ void pybind_sensor(py::module &m) {
     docstring::ClassMethodDocInject(m, "RGBDVideoReader", "save_frames",
                                     map_shared_argument_docstrings);
 
+    // Class RGBD prefetch reader
+    py::class_<RGBDPrefetchReader> rgbd_prefetch_reader(
+            m, "RGBDPrefetchReader",
+            "Reads a sequence of RGBD frames ahead of the consumer with "
+            "background decode threads. Frames are returned in sequence "
+            "order.");
+    rgbd_prefetch_reader
+            .def(py::init([](const fs::path &filename, size_t buffer_size,
+                             const core::Device &device) {
+                     auto reader = RGBDVideoReader::Create(filename.string());
+                     if (!reader || !reader->Open(filename.string())) {
+                         utility::LogError("Failed to open {}.",
+                                           filename.string());
+                     }
+                     return std::make_unique<RGBDPrefetchReader>(
+                             std::move(reader), buffer_size, device);
+                 }),
+                 "filename"_a,
+                 "buffer_size"_a = RGBDPrefetchReader::DEFAULT_BUFFER_SIZE,
+                 "device"_a = core::Device("CPU:0"),
+                 "Read the frames of an RGBD video file on a background "
+                 "thread.")
+            .def(py::init<const std::vector<std::string> &,
+                          const std::vector<std::string> &, int, size_t,
+                          const core::Device &>(),
+                 "color_files"_a, "depth_files"_a, "num_threads"_a = 0,
+                 "buffer_size"_a = RGBDPrefetchReader::DEFAULT_BUFFER_SIZE,
+                 "device"_a = core::Device("CPU:0"),
+                 "Decode pairs of color and depth image files with "
+                 "num_threads threads (all cores if <= 0).")
+            .def("is_eof", &RGBDPrefetchReader::IsEOF,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Check if all frames are read. Blocks until the next frame "
+                 "is decoded.")
+            .def("next_frame", &RGBDPrefetchReader::NextFrame,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Return the next frame in sequence order, or an empty "
+                 "RGBDImage past the last frame.")
+            .def("close", &RGBDPrefetchReader::Close,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Stop the decode threads.")
+            .def_property_readonly("frame_index",
+                                   &RGBDPrefetchReader::GetFrameIndex,
+                                   "Number of frames read so far.");
+
     // Class RGBD sensor
     py::class_<RGBDSensor> rgbd_sensor(
             m, "RGBDSensor", "Interface class for control of RGBD cameras.");
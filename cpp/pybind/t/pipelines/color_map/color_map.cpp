@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "pybind/t/pipelines/color_map/color_map.h"
+
+#include "open3d/t/pipelines/color_map/ColorMapOptimizer.h"
+#include "pybind/docstring.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+void pybind_color_map_classes(py::module &m) {
+    py::class_<ColorMapOptimizationOption> option(
+            m, "ColorMapOptimizationOption",
+            "Options of the color map optimization.");
+    py::detail::bind_copy_functions<ColorMapOptimizationOption>(option);
+    option.def(py::init<>())
+            .def_readwrite(
+                    "non_rigid_camera_coordinate",
+                    &ColorMapOptimizationOption::non_rigid_camera_coordinate_,
+                    "Set to True to also optimize image warping fields.")
+            .def_readwrite(
+                    "number_of_vertical_anchors",
+                    &ColorMapOptimizationOption::number_of_vertical_anchors_,
+                    "Number of vertical anchor points of the image warping "
+                    "field.")
+            .def_readwrite(
+                    "non_rigid_anchor_point_weight",
+                    &ColorMapOptimizationOption::non_rigid_anchor_point_weight_,
+                    "Weight of the regularizer of the anchor points.")
+            .def_readwrite("iterations",
+                           &ColorMapOptimizationOption::iterations_,
+                           "Number of iterations on each pyramid level, from "
+                           "coarse to fine.")
+            .def_readwrite("depth_scale",
+                           &ColorMapOptimizationOption::depth_scale_,
+                           "Scale factor to convert raw depth into meters.")
+            .def_readwrite(
+                    "maximum_allowable_depth",
+                    &ColorMapOptimizationOption::maximum_allowable_depth_,
+                    "Points farther than this depth are invisible.")
+            .def_readwrite("depth_threshold_for_visibility_check",
+                           &ColorMapOptimizationOption::
+                                   depth_threshold_for_visibility_check_,
+                           "Maximum depth difference and occlusion of "
+                           "visible points.")
+            .def_readwrite("depth_threshold_for_discontinuity_check",
+                           &ColorMapOptimizationOption::
+                                   depth_threshold_for_discontinuity_check_,
+                           "Points at larger depth gradients are invisible.")
+            .def_readwrite("half_dilation_kernel_size_for_discontinuity_map",
+                           &ColorMapOptimizationOption::
+                                   half_dilation_kernel_size_for_discontinuity_map_,
+                           "Half size of the dilation kernel of the depth "
+                           "discontinuity mask.")
+            .def_readwrite(
+                    "image_boundary_margin",
+                    &ColorMapOptimizationOption::image_boundary_margin_,
+                    "Points projected into this image border are ignored.")
+            .def_readwrite(
+                    "invisible_vertex_color_knn",
+                    &ColorMapOptimizationOption::invisible_vertex_color_knn_,
+                    "Number of neighbors used to color invisible vertices.");
+
+    py::class_<ColorMapOptimizationResult> result(
+            m, "ColorMapOptimizationResult",
+            "Result of the color map optimization.");
+    py::detail::bind_copy_functions<ColorMapOptimizationResult>(result);
+    result.def(py::init<>())
+            .def_readwrite("mesh", &ColorMapOptimizationResult::mesh_,
+                           "Mesh with optimized vertex colors.")
+            .def_readwrite("extrinsics",
+                           &ColorMapOptimizationResult::extrinsics_,
+                           "(N, 4, 4) optimized extrinsic matrices.")
+            .def_readwrite("warping_fields",
+                           &ColorMapOptimizationResult::warping_fields_,
+                           "(N, anchor_h, anchor_w, 2) anchor points of the "
+                           "image warping fields.")
+            .def_readwrite("residual", &ColorMapOptimizationResult::residual_,
+                           "Mean squared intensity residual.");
+}
+
+void pybind_color_map_methods(py::module &m) {
+    m.def("run_color_map_optimization", &RunColorMapOptimization,
+          py::call_guard<py::gil_scoped_release>(),
+          "Optimizes the camera poses, and optionally image warping fields, "
+          "for photometrically consistent vertex colors of a mesh.",
+          "mesh"_a, "images_rgbd"_a, "intrinsics"_a, "extrinsics"_a,
+          "option"_a = ColorMapOptimizationOption());
+    docstring::FunctionDocInject(
+            m, "run_color_map_optimization",
+            {{"mesh", "The mesh to color."},
+             {"images_rgbd", "List of N RGB-D images."},
+             {"intrinsics",
+              "(3, 3) intrinsic matrix shared by all images, or (N, 3, 3) "
+              "intrinsic matrices."},
+             {"extrinsics", "(N, 4, 4) initial world to camera transforms."},
+             {"option", "Optimization options."}});
+}
+
+void pybind_color_map(py::module &m) {
+    py::module m_submodule = m.def_submodule(
+            "color_map", "Tensor color map optimization pipeline.");
+    pybind_color_map_classes(m_submodule);
+    pybind_color_map_methods(m_submodule);
+}
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
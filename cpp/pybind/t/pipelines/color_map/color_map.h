@@ -0,0 +1,22 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "pybind/open3d_pybind.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+void pybind_color_map(py::module &m);
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -107,6 +107,32 @@ void pybind_odometry_classes(py::module &m) {
                         olp.depth_outlier_trunc_, olp.depth_huber_delta_,
                         olp.intensity_huber_delta_);
             });
+
+    // open3d.t.pipelines.odometry.OdometryFrame
+    py::class_<OdometryFrame> odometry_frame(
+            m, "OdometryFrame",
+            "Image pyramid of an RGBD image for multi scale RGBD odometry. "
+            "Create one frame per image of a sequence and pass it to "
+            "rgbd_odometry_multi_scale, so that the pyramid of each image is "
+            "computed once although it is used as source and as target.");
+    py::detail::bind_copy_functions<OdometryFrame>(odometry_frame);
+    odometry_frame
+            .def(py::init<const t::geometry::RGBDImage &, const core::Tensor &,
+                          float, float, int64_t, Method,
+                          const OdometryLossParams &>(),
+                 py::call_guard<py::gil_scoped_release>(), "rgbd"_a,
+                 "intrinsics"_a, "depth_scale"_a = 1000.0f,
+                 "depth_max"_a = 3.0f, "num_levels"_a = 3,
+                 "method"_a = Method::Hybrid,
+                 "params"_a = OdometryLossParams())
+            .def_property_readonly("num_levels", &OdometryFrame::GetNumLevels,
+                                   "int: Number of pyramid levels.")
+            .def_readonly("method", &OdometryFrame::method_,
+                          "Method: Odometry method of the pyramid.")
+            .def("__repr__", [](const OdometryFrame &frame) {
+                return fmt::format("OdometryFrame[num_levels={}].",
+                                   frame.GetNumLevels());
+            });
 }
 
 // Odometry functions have similar arguments, sharing arg docstrings.
@@ -172,7 +198,14 @@ static const std::unordered_map<std::string, std::string>
                  "by CreateVertexMap before calling this function."}};
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("rgbd_odometry_multi_scale", &RGBDOdometryMultiScale,
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const t::geometry::RGBDImage &,
+                            const t::geometry::RGBDImage &,
+                            const core::Tensor &, const core::Tensor &, float,
+                            float,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            Method, const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi Scale RGBD odometry.", "source"_a, "target"_a,
           "intrinsics"_a,
@@ -182,6 +215,21 @@ void pybind_odometry_methods(py::module &m) {
           "criteria_list"_a =
                   std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
           "method"_a = Method::Hybrid, "params"_a = OdometryLossParams());
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const OdometryFrame &, const OdometryFrame &,
+                            const core::Tensor &,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Multi Scale RGBD odometry on precomputed image "
+          "pyramids.",
+          "source"_a, "target"_a,
+          "init_source_to_target"_a =
+                  core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+          "criteria_list"_a =
+                  std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
+          "params"_a = OdometryLossParams());
     docstring::FunctionDocInject(m, "rgbd_odometry_multi_scale",
                                  map_shared_argument_docstrings);
 
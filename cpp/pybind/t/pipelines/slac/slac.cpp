@@ -47,6 +47,19 @@ void pybind_slac_classes(py::module &m) {
                            "Weight of the regularizer.")
             .def_readwrite("device", &SLACOptimizerParams::device_,
                            "Device to use.")
+            .def_readwrite("use_sparse_solver",
+                           &SLACOptimizerParams::use_sparse_solver_,
+                           "If true, solve the SLAC normal equations with a "
+                           "block sparse matrix and preconditioned conjugate "
+                           "gradient on the CPU instead of a dense matrix.")
+            .def_readwrite("sparse_solver_max_iterations",
+                           &SLACOptimizerParams::sparse_solver_max_iterations_,
+                           "Maximum number of conjugate gradient iterations "
+                           "of the sparse solver.")
+            .def_readwrite("sparse_solver_tolerance",
+                           &SLACOptimizerParams::sparse_solver_tolerance_,
+                           "Relative residual at which the sparse solver "
+                           "stops.")
             .def_readwrite("slac_folder", &SLACOptimizerParams::slac_folder_,
                            "Relative directory to store SLAC results in the "
                            "dataset folder.")
@@ -5,8 +5,10 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include "open3d/t/pipelines/slam/Backend.h"
 #include "open3d/t/pipelines/slam/Frame.h"
 #include "open3d/t/pipelines/slam/Model.h"
+#include "open3d/t/pipelines/slam/Pipeline.h"
 #include "pybind/docstring.h"
 
 namespace open3d {
@@ -48,6 +50,9 @@ static const std::unordered_map<std::string, std::string>
                 {"height", "Height of an image frame."},
                 {"width", "Width of an image frame."},
                 {"intrinsics", "Intrinsic matrix stored in a 3x3 Tensor."},
+                {"init_source_to_target",
+                 "Initial 4x4 transformation from the input frame to the model "
+                 "frame."},
                 {"trunc_voxel_multiplier",
                  "Truncation distance multiplier in voxel size for signed "
                  "distance. For instance, "
@@ -88,7 +93,9 @@ void pybind_slam_model(py::module &m) {
             "depth_max"_a = 3.0, "depth_diff"_a = 0.07,
             "method"_a = odometry::Method::PointToPlane,
             "criteria"_a = (std::vector<odometry::OdometryConvergenceCriteria>){
-                    6, 3, 1});
+                    6, 3, 1},
+            "init_source_to_target"_a =
+                    core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")));
     docstring::ClassMethodDocInject(m, "Model", "track_frame_to_model",
                                     map_shared_argument_docstrings);
 
@@ -153,11 +160,149 @@ void pybind_slam_frame(py::module &m) {
               "Get a 2D image from from the given key in the map.");
 }
 
+void pybind_slam_pipeline(py::module &m) {
+    py::class_<PipelineParams> params(m, "PipelineParams",
+                                      "Parameters of the SLAM pipeline.");
+    py::detail::bind_copy_functions<PipelineParams>(params);
+    params.def(py::init<float, float, float, float, int, int, double,
+                        double>(),
+               "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+               "depth_diff"_a = 0.07f, "trunc_voxel_multiplier"_a = 8.0f,
+               "queue_size"_a = 2, "max_model_lag"_a = 1,
+               "min_fitness"_a = 0.1, "max_translation"_a = 0.15)
+            .def_readwrite("depth_scale", &PipelineParams::depth_scale_)
+            .def_readwrite("depth_max", &PipelineParams::depth_max_)
+            .def_readwrite("depth_diff", &PipelineParams::depth_diff_)
+            .def_readwrite("trunc_voxel_multiplier",
+                           &PipelineParams::trunc_voxel_multiplier_)
+            .def_readwrite("queue_size", &PipelineParams::queue_size_,
+                           "Maximum number of frames buffered between two "
+                           "stages.")
+            .def_readwrite("max_model_lag", &PipelineParams::max_model_lag_,
+                           "Maximum number of frames the model used for "
+                           "tracking may lag behind. Use 0 to track against "
+                           "the model of the previous frame.")
+            .def_readwrite("min_fitness", &PipelineParams::min_fitness_)
+            .def_readwrite("max_translation", &PipelineParams::max_translation_)
+            .def_readwrite("method", &PipelineParams::method_)
+            .def_readwrite("criteria", &PipelineParams::criteria_);
+
+    py::class_<PipelineStatistics> statistics(
+            m, "PipelineStatistics",
+            "Timing statistics of a pipeline run in milliseconds.");
+    statistics.def_readonly("num_frames", &PipelineStatistics::num_frames_)
+            .def_readonly("num_tracking_failures",
+                          &PipelineStatistics::num_tracking_failures_)
+            .def_readonly("load_time", &PipelineStatistics::load_time_)
+            .def_readonly("track_time", &PipelineStatistics::track_time_)
+            .def_readonly("map_time", &PipelineStatistics::map_time_)
+            .def_readonly("mean_latency", &PipelineStatistics::mean_latency_)
+            .def_readonly("max_latency", &PipelineStatistics::max_latency_)
+            .def_readonly("fps", &PipelineStatistics::fps_);
+
+    py::class_<Pipeline> pipeline(
+            m, "Pipeline",
+            "Runs loading, tracking and mapping of a Model on separate "
+            "threads connected by bounded queues.");
+    pipeline.def(py::init<Model &, const core::Tensor &,
+                          const PipelineParams &>(),
+                 py::keep_alive<1, 2>(), "model"_a, "intrinsics"_a,
+                 "params"_a = PipelineParams());
+    pipeline.def("run", &Pipeline::Run,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Processes frames until loader returns an empty RGBD image "
+                 "and returns the frame to world poses. loader(index) is "
+                 "called on a worker thread, callback(frame_id, pose) after "
+                 "each integration.",
+                 "loader"_a, "callback"_a = nullptr);
+    pipeline.def("get_statistics", &Pipeline::GetStatistics,
+                 "Returns the statistics of the last run.");
+}
+
+void pybind_slam_backend(py::module &m) {
+    py::class_<BackendParams> params(
+            m, "BackendParams", "Parameters of the loop closure back end.");
+    py::detail::bind_copy_functions<BackendParams>(params);
+    params.def(py::init<float, float, float, double, double, int, double, int,
+                        double, double, double, double>(),
+               "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+               "trunc_voxel_multiplier"_a = 8.0f,
+               "keyframe_translation"_a = 0.3, "keyframe_rotation"_a = 15.0,
+               "min_loop_interval"_a = 10, "min_similarity"_a = 0.8,
+               "max_loop_candidates"_a = 3, "voxel_size"_a = 0.025,
+               "max_correspondence_distance"_a = 0.07, "min_fitness"_a = 0.3,
+               "reintegration_threshold"_a = 0.01)
+            .def_readwrite("depth_scale", &BackendParams::depth_scale_)
+            .def_readwrite("depth_max", &BackendParams::depth_max_)
+            .def_readwrite("trunc_voxel_multiplier",
+                           &BackendParams::trunc_voxel_multiplier_)
+            .def_readwrite("keyframe_translation",
+                           &BackendParams::keyframe_translation_,
+                           "Minimum translation in meters between keyframes.")
+            .def_readwrite("keyframe_rotation",
+                           &BackendParams::keyframe_rotation_,
+                           "Minimum rotation in degrees between keyframes.")
+            .def_readwrite("min_loop_interval",
+                           &BackendParams::min_loop_interval_,
+                           "Minimum number of keyframes between the two "
+                           "keyframes of a loop closure.")
+            .def_readwrite("min_similarity", &BackendParams::min_similarity_,
+                           "Minimum descriptor similarity of a loop "
+                           "candidate.")
+            .def_readwrite("max_loop_candidates",
+                           &BackendParams::max_loop_candidates_)
+            .def_readwrite("voxel_size", &BackendParams::voxel_size_)
+            .def_readwrite("max_correspondence_distance",
+                           &BackendParams::max_correspondence_distance_)
+            .def_readwrite("min_fitness", &BackendParams::min_fitness_)
+            .def_readwrite("reintegration_threshold",
+                           &BackendParams::reintegration_threshold_)
+            .def_readwrite("edge_prune_threshold",
+                           &BackendParams::edge_prune_threshold_)
+            .def_readwrite("preference_loop_closure",
+                           &BackendParams::preference_loop_closure_)
+            .def_readwrite("descriptor_rows", &BackendParams::descriptor_rows_)
+            .def_readwrite("descriptor_cols",
+                           &BackendParams::descriptor_cols_);
+
+    py::class_<Backend> backend(
+            m, "Backend",
+            "Online loop closure back end. Selects keyframes, verifies loop "
+            "candidates with ICP, optimizes the keyframe pose graph in a "
+            "background thread and re-integrates moved keyframes into the "
+            "model.");
+    backend.def(py::init<const core::Tensor &, const BackendParams &>(),
+                "intrinsics"_a, "params"_a = BackendParams());
+    backend.def("add_frame", &Backend::AddFrame,
+                "Adds a tracked and integrated frame. Returns True if it was "
+                "selected as a keyframe.",
+                "frame_id"_a, "rgbd"_a, "frame_to_world"_a);
+    backend.def("update", &Backend::Update,
+                py::call_guard<py::gil_scoped_release>(),
+                "Applies the latest optimized pose graph to the model. Returns "
+                "True if the model was corrected.",
+                "model"_a);
+    backend.def("wait_for_idle", &Backend::WaitForIdle,
+                py::call_guard<py::gil_scoped_release>(),
+                "Blocks until all added keyframes are processed.");
+    backend.def("stop", &Backend::Stop,
+                py::call_guard<py::gil_scoped_release>(),
+                "Stops the background thread.");
+    backend.def("get_pose_graph", &Backend::GetPoseGraph,
+                "Returns the keyframe pose graph.");
+    backend.def("get_keyframe_ids", &Backend::GetKeyframeIds,
+                "Returns the frame ids of the keyframes.");
+    backend.def("get_num_loop_closures", &Backend::GetNumLoopClosures,
+                "Returns the number of accepted loop closures.");
+}
+
 void pybind_slam(py::module &m) {
     py::module m_submodule =
             m.def_submodule("slam", "Tensor DenseSLAM pipeline.");
     pybind_slam_model(m_submodule);
     pybind_slam_frame(m_submodule);
+    pybind_slam_pipeline(m_submodule);
+    pybind_slam_backend(m_submodule);
 }
 
 }  // namespace slam
@@ -0,0 +1,59 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "apps/OfflineReconstruction/CacheUtil.h"
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+using apps::offline_reconstruction::ReconstructionCache;
+
+TEST(CacheUtil, PointCloudAndFeatureRoundTrip) {
+    const std::string folder = utility::filesystem::GetTempDirectoryPath() +
+                               "/offline_reconstruction_cache";
+    utility::filesystem::DeleteDirectory(folder);
+
+    // Colors that are not multiples of 1/255 would be quantized by a PLY file.
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 10; ++i) {
+        const double v = 0.1 * i + 1.0 / 3.0;
+        pcd.points_.push_back(Eigen::Vector3d(v, -v, 1e-9 * v));
+        pcd.normals_.push_back(
+                Eigen::Vector3d(v, 1.0, -1.0 / 7.0).normalized());
+        pcd.colors_.push_back(Eigen::Vector3d(v / 4.0, 1.0 / 3.0, 0.123456789));
+    }
+    pipelines::registration::Feature feature;
+    feature.Resize(33, 10);
+    for (int i = 0; i < int(feature.data_.size()); ++i) {
+        feature.data_.data()[i] = std::sqrt(double(i));
+    }
+
+    ReconstructionCache cache(folder, true);
+    cache.StorePointCloudAndFeature("fragment", 42, pcd, feature);
+
+    geometry::PointCloud loaded_pcd;
+    pipelines::registration::Feature loaded_feature;
+    EXPECT_TRUE(cache.LoadPointCloudAndFeature("fragment", 42, loaded_pcd,
+                                               loaded_feature));
+    EXPECT_EQ(loaded_pcd.points_, pcd.points_);
+    EXPECT_EQ(loaded_pcd.normals_, pcd.normals_);
+    EXPECT_EQ(loaded_pcd.colors_, pcd.colors_);
+    EXPECT_EQ(loaded_feature.data_.rows(), feature.data_.rows());
+    EXPECT_EQ(loaded_feature.data_.cols(), feature.data_.cols());
+    EXPECT_TRUE(loaded_feature.data_ == feature.data_);
+
+    // Other keys miss.
+    EXPECT_FALSE(cache.LoadPointCloudAndFeature("fragment", 43, loaded_pcd,
+                                                loaded_feature));
+
+    utility::filesystem::DeleteDirectory(folder);
+}
+
+}  // namespace tests
+}  // namespace open3d
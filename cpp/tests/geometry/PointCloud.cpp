@@ -1317,6 +1317,37 @@ TEST(PointCloud, ComputeConvexHull) {
                                                              {7, 4, 6}}));
 }
 
+TEST(PointCloud, ComputeConvexHullLarge) {
+    // Large inputs are culled to the points outside of the polytope spanned by
+    // the extreme points before Qhull runs.
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform_gen(-1.0, 1.0);
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 50000; ++i) {
+        pcd.points_.emplace_back(uniform_gen(), uniform_gen(), uniform_gen());
+    }
+
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::vector<size_t> pt_map;
+    std::tie(mesh, pt_map) = pcd.ComputeConvexHull();
+    ExpectEQ(mesh->vertices_, ApplyIndices(pcd.points_, pt_map));
+    EXPECT_TRUE(mesh->IsWatertight());
+
+    // No point is outside of the convex hull.
+    double max_dist = std::numeric_limits<double>::lowest();
+    for (const Eigen::Vector3i& triangle : mesh->triangles_) {
+        const Eigen::Vector3d& v0 = mesh->vertices_[triangle(0)];
+        const Eigen::Vector3d normal =
+                (mesh->vertices_[triangle(1)] - v0)
+                        .cross(mesh->vertices_[triangle(2)] - v0)
+                        .normalized();
+        for (const Eigen::Vector3d& point : pcd.points_) {
+            max_dist = std::max(max_dist, normal.dot(point - v0));
+        }
+    }
+    EXPECT_LE(max_dist, 1e-9);
+}
+
 TEST(PointCloud, HiddenPointRemoval) {
     geometry::PointCloud pcd;
     data::PLYPointCloud pointcloud_ply;
@@ -1429,6 +1460,49 @@ TEST(PointCloud, SegmentPlaneDeterministic) {
     }
 }
 
+TEST(PointCloud, SegmentPlanes) {
+    // Two orthogonal planes z = 0 and y = 1 with a few outliers.
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform_gen(0.0, 1.0);
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 3000; ++i) {
+        pcd.points_.emplace_back(4 * uniform_gen(), 4 * uniform_gen(), 0);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        pcd.points_.emplace_back(4 * uniform_gen(), 1, 3 * uniform_gen());
+    }
+    for (int i = 0; i < 200; ++i) {
+        pcd.points_.emplace_back(4 * uniform_gen(), 4 * uniform_gen(),
+                                 0.5 + 2 * uniform_gen());
+    }
+
+    auto planes = pcd.SegmentPlanes(0.01, 3, 1000, 0.99999999,
+                                    /*max_num_planes=*/5,
+                                    /*min_num_inliers=*/500);
+    ASSERT_EQ(planes.size(), 2u);
+
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = planes[0];
+    EXPECT_NEAR(std::abs(plane_model(2)), 1.0, 1e-6);
+    EXPECT_GE(inliers.size(), 3000u);
+    std::tie(plane_model, inliers) = planes[1];
+    EXPECT_NEAR(std::abs(plane_model(1)), 1.0, 1e-6);
+    EXPECT_GE(inliers.size(), 1950u);
+
+    // Every point is assigned to at most one plane.
+    std::vector<size_t> all_inliers;
+    for (const auto& plane : planes) {
+        const std::vector<size_t>& plane_inliers = std::get<1>(plane);
+        EXPECT_TRUE(std::is_sorted(plane_inliers.begin(), plane_inliers.end()));
+        all_inliers.insert(all_inliers.end(), plane_inliers.begin(),
+                           plane_inliers.end());
+    }
+    std::sort(all_inliers.begin(), all_inliers.end());
+    EXPECT_EQ(std::adjacent_find(all_inliers.begin(), all_inliers.end()),
+              all_inliers.end());
+}
+
 TEST(PointCloud, DetectPlanarPatches) {
     geometry::PointCloud pcd;
     data::PCDPointCloud pointcloud_pcd;
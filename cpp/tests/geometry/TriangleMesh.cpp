@@ -8,7 +8,9 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Random.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -825,6 +827,27 @@ TEST(TriangleMesh, FilterSmoothLaplacian) {
     ExpectEQ(mesh->vertices_, ref2, 1e-3);
 }
 
+TEST(TriangleMesh, FilterSmoothLaplacianScope) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0},
+                       {0, -1, 0}, {5, 5, 5}};
+    mesh->vertex_colors_ = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1},
+                            {1, 1, 0}, {0, 1, 1}, {1, 1, 1}};
+    mesh->triangles_ = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}};
+
+    // Only the colors are filtered, the isolated vertex is kept.
+    auto filtered = mesh->FilterSmoothLaplacian(
+            1, 0.5, geometry::MeshBase::FilterScope::Color);
+    ExpectEQ(filtered->vertices_, mesh->vertices_);
+    ExpectEQ(filtered->vertex_colors_[5], Eigen::Vector3d(1, 1, 1));
+    ExpectEQ(filtered->vertex_colors_[0], Eigen::Vector3d(0.625, 0.375, 0.25));
+
+    filtered = mesh->FilterSmoothLaplacian(
+            1, 0.5, geometry::MeshBase::FilterScope::Vertex);
+    ExpectEQ(filtered->vertex_colors_, mesh->vertex_colors_);
+    ExpectEQ(filtered->vertices_[5], Eigen::Vector3d(5, 5, 5));
+}
+
 TEST(TriangleMesh, FilterSmoothTaubin) {
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
@@ -2005,6 +2028,94 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     ExpectEQ(densities_es, densities_gt, 1e-4);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudPoissonTiled) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 60);
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertices_;
+
+    // depth 6 with blocks of depth 6, i.e., cores of depth 5 padded to twice
+    // their width, splits the cube into 8 blocks.
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::vector<double> densities;
+    std::tie(mesh, densities) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(pcd, 6, 6);
+
+    EXPECT_GT(mesh->triangles_.size(), 0u);
+    EXPECT_EQ(densities.size(), mesh->vertices_.size());
+    EXPECT_EQ(mesh->vertex_normals_.size(), mesh->vertices_.size());
+    for (const Eigen::Vector3i& triangle : mesh->triangles_) {
+        EXPECT_TRUE((triangle.array() >= 0).all());
+        EXPECT_TRUE((triangle.array() < int(mesh->vertices_.size())).all());
+        EXPECT_NE(triangle(0), triangle(1));
+        EXPECT_NE(triangle(1), triangle(2));
+        EXPECT_NE(triangle(2), triangle(0));
+    }
+    size_t num_on_sphere = 0;
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        if (std::abs(vertex.norm() - 1.0) < 0.1) {
+            num_on_sphere++;
+        }
+    }
+    EXPECT_GT(num_on_sphere, mesh->vertices_.size() * 9 / 10);
+
+    // A single block reconstructs the same surface.
+    std::shared_ptr<geometry::TriangleMesh> mesh_single;
+    std::tie(mesh_single, densities) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(pcd, 6, 7);
+    EXPECT_GT(mesh_single->triangles_.size(), 0u);
+    EXPECT_NEAR(mesh->GetSurfaceArea(), mesh_single->GetSurfaceArea(),
+                0.1 * mesh_single->GetSurfaceArea());
+}
+
+TEST(TriangleMesh, CreateFromPointCloudPoissonTiledMatchesPoisson) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 60);
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertices_;
+
+    const size_t depth = 6;
+    std::shared_ptr<geometry::TriangleMesh> mesh_gt;
+    std::vector<double> densities;
+    std::tie(mesh_gt, densities) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, depth);
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::tie(mesh, densities) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(pcd, depth,
+                                                                     6);
+    ASSERT_GT(mesh_gt->triangles_.size(), 0u);
+    ASSERT_GT(mesh->triangles_.size(), 0u);
+    EXPECT_NEAR(mesh->GetSurfaceArea(), mesh_gt->GetSurfaceArea(),
+                0.05 * mesh_gt->GetSurfaceArea());
+
+    // Both solves use the same cells, so the surfaces agree within a cell,
+    // including at the seams on the planes through the center of the cube.
+    const double cell_width = 2.0 * 1.1 / (1 << depth);
+    geometry::PointCloud vertices_gt;
+    vertices_gt.points_ = mesh_gt->vertices_;
+    geometry::KDTreeFlann kdtree(vertices_gt);
+    std::vector<int> indices;
+    std::vector<double> dists2;
+    size_t num_close = 0, num_seam = 0, num_seam_close = 0;
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        kdtree.SearchKNN(vertex, 1, indices, dists2);
+        const bool is_close = std::sqrt(dists2[0]) < cell_width;
+        num_close += is_close;
+        if (vertex.cwiseAbs().minCoeff() < cell_width) {
+            num_seam++;
+            num_seam_close += is_close;
+        }
+    }
+    EXPECT_GT(num_close, mesh->vertices_.size() * 95 / 100);
+    EXPECT_GT(num_seam, 0u);
+    EXPECT_GT(num_seam_close, num_seam * 9 / 10);
+
+    // The seams are stitched: the sphere is closed up to a few edges.
+    const size_t num_edges = mesh->triangles_.size() * 3 / 2;
+    const size_t num_open_edges = mesh->GetNonManifoldEdges(false).size();
+    EXPECT_LT(num_open_edges, num_edges / 50);
+}
+
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     geometry::PointCloud pcd;
     pcd.points_ = {
@@ -2030,6 +2141,66 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt, 1e-6, false);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudAlphaShapeTiled) {
+    utility::random::Seed(0);
+    geometry::PointCloud pcd;
+    utility::random::UniformRealGenerator<double> uniform_gen(0.0, 1.0);
+    for (int i = 0; i < 2000; ++i) {
+        pcd.points_.emplace_back(uniform_gen(), uniform_gen(), uniform_gen());
+    }
+
+    auto mesh_gt =
+            geometry::TriangleMesh::CreateFromPointCloudAlphaShape(pcd, 0.1);
+    auto mesh_es = geometry::TriangleMesh::CreateFromPointCloudAlphaShapeTiled(
+            pcd, 0.1, /*tile_size=*/0.25);
+
+    // The tiles share no tetras, so the alpha shapes only differ in the order
+    // of their vertices and triangles.
+    auto sorted_vertices = [](const geometry::TriangleMesh& mesh) {
+        std::vector<Eigen::Vector3d> vertices = mesh.vertices_;
+        std::sort(vertices.begin(), vertices.end(),
+                  [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
+                      return std::lexicographical_compare(
+                              a.data(), a.data() + 3, b.data(), b.data() + 3);
+                  });
+        return vertices;
+    };
+    EXPECT_GT(mesh_gt->triangles_.size(), 0u);
+    EXPECT_EQ(mesh_es->triangles_.size(), mesh_gt->triangles_.size());
+    ExpectEQ(sorted_vertices(*mesh_es), sorted_vertices(*mesh_gt));
+    EXPECT_NEAR(mesh_es->GetSurfaceArea(), mesh_gt->GetSurfaceArea(), 1e-6);
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // A jittered height field that is large enough to be split into tiles.
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 60; ++i) {
+        for (int j = 0; j < 60; ++j) {
+            const double x = i * 0.1 + 0.013 * ((i * 7 + j * 3) % 5);
+            const double y = j * 0.1 + 0.011 * ((i * 3 + j * 5) % 7);
+            pcd.points_.push_back({x, y, 0.2 * std::sin(x) * std::cos(y)});
+            pcd.normals_.push_back({0, 0, 1});
+        }
+    }
+    const std::vector<double> radii = {0.09, 0.12};
+
+    auto mesh_serial = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, radii, /*n_threads=*/1);
+    auto mesh_tiled = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, radii, /*n_threads=*/4);
+
+    EXPECT_GT(mesh_serial->triangles_.size(), 6000u);
+    EXPECT_TRUE(mesh_serial->IsEdgeManifold(true));
+    EXPECT_TRUE(mesh_tiled->IsEdgeManifold(true));
+    EXPECT_EQ(mesh_tiled->vertices_.size(), pcd.points_.size());
+    EXPECT_EQ(mesh_tiled->triangle_normals_.size(),
+              mesh_tiled->triangles_.size());
+    // The tiles are stitched without leaving gaps along their boundaries.
+    EXPECT_NEAR(double(mesh_tiled->triangles_.size()),
+                double(mesh_serial->triangles_.size()),
+                0.01 * mesh_serial->triangles_.size());
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
@@ -5,6 +5,14 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/io/ImageIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -36,5 +44,50 @@ TEST(ScalableTSDFVolume, DISABLED_GetNormalAt) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_GetTSDFAt) { NotImplemented(); }
 
+TEST(ScalableTSDFVolume, IntegrateMany) {
+    data::SampleRedwoodRGBDImages redwood_data;
+    camera::PinholeCameraTrajectory trajectory;
+    ASSERT_TRUE(io::ReadPinholeCameraTrajectory(
+            redwood_data.GetOdometryLogPath(), trajectory));
+    const camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+
+    std::vector<geometry::RGBDImage> images;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> extrinsics;
+    for (size_t i = 0; i < trajectory.parameters_.size(); ++i) {
+        geometry::Image im_color, im_depth;
+        io::ReadImage(redwood_data.GetColorPaths()[i], im_color);
+        io::ReadImage(redwood_data.GetDepthPaths()[i], im_depth);
+        images.push_back(*geometry::RGBDImage::CreateFromColorAndDepth(
+                im_color, im_depth, 1000.0, 4.0, false));
+        extrinsics.push_back(trajectory.parameters_[i].extrinsic_);
+    }
+
+    pipelines::integration::ScalableTSDFVolume volume(
+            4.0 / 512, 0.04, pipelines::integration::TSDFVolumeColorType::RGB8);
+    for (size_t i = 0; i < images.size(); ++i) {
+        volume.Integrate(images[i], intrinsic, extrinsics[i]);
+    }
+    pipelines::integration::ScalableTSDFVolume volume_many(
+            4.0 / 512, 0.04, pipelines::integration::TSDFVolumeColorType::RGB8);
+    volume_many.IntegrateMany(images, intrinsic, extrinsics);
+    EXPECT_ANY_THROW(volume_many.IntegrateMany(images, intrinsic, {}));
+
+    // Each unit applies the frames in the same order as Integrate().
+    ASSERT_EQ(volume.volume_units_.size(), volume_many.volume_units_.size());
+    for (const auto &unit : volume.volume_units_) {
+        const auto it = volume_many.volume_units_.find(unit.first);
+        ASSERT_TRUE(it != volume_many.volume_units_.end());
+        const auto &voxels = unit.second.volume_->voxels_;
+        const auto &voxels_many = it->second.volume_->voxels_;
+        ASSERT_EQ(voxels.size(), voxels_many.size());
+        for (size_t k = 0; k < voxels.size(); ++k) {
+            EXPECT_EQ(voxels[k].tsdf_, voxels_many[k].tsdf_);
+            EXPECT_EQ(voxels[k].weight_, voxels_many[k].weight_);
+            ExpectEQ(voxels[k].color_, voxels_many[k].color_);
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
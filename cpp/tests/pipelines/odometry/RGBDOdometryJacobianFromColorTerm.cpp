@@ -87,6 +87,21 @@ TEST(RGBDOdometryJacobianFromColorTerm, ComputeJacobianAndResidual) {
         EXPECT_NEAR(ref_r[row], r[0], THRESHOLD_1E_6);
         ExpectEQ(ref_J_r[row], J_r[0], 1e-4);
     }
+
+    // The fused reduction matches the accumulation of the per-row Jacobians.
+    Eigen::Matrix6d JTJ, ref_JTJ;
+    Eigen::Vector6d JTr, ref_JTr;
+    double r2, ref_r2;
+    std::tie(JTJ, JTr, r2) = jacobian_method.ComputeJTJandJTr(
+            source, target, *source_xyz, target_dx, target_dy, intrinsic,
+            extrinsic, corresps);
+    std::tie(ref_JTJ, ref_JTr, ref_r2) =
+            jacobian_method.RGBDOdometryJacobian::ComputeJTJandJTr(
+                    source, target, *source_xyz, target_dx, target_dy,
+                    intrinsic, extrinsic, corresps);
+    EXPECT_TRUE(JTJ.isApprox(ref_JTJ, 1e-10));
+    EXPECT_TRUE(JTr.isApprox(ref_JTr, 1e-10));
+    EXPECT_NEAR(r2, ref_r2, 1e-10);
 }
 
 }  // namespace tests
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/MultiResolutionVoxelBlockGrid.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/io/ImageIO.h"
+
+namespace open3d {
+namespace tests {
+
+using namespace t::geometry;
+
+class MultiResolutionVoxelBlockGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(MultiResolutionVoxelBlockGrid,
+                         MultiResolutionVoxelBlockGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(MultiResolutionVoxelBlockGridPermuteDevices, Construct) {
+    core::Device device = GetParam();
+    MultiResolutionVoxelBlockGrid grid(
+            {"tsdf", "weight", "color"},
+            {core::Float32, core::Float32, core::Float32}, {{1}, {1}, {3}},
+            3.0 / 512, {1.0, 2.0, 4.0}, 8, 10, device);
+    EXPECT_EQ(grid.GetNumLevels(), 3);
+    EXPECT_FLOAT_EQ(grid.GetVoxelSize(1), 2 * grid.GetVoxelSize(0));
+    EXPECT_FLOAT_EQ(grid.GetVoxelSize(2), 4 * grid.GetVoxelSize(0));
+    EXPECT_EQ(grid.GetLevel(2).GetAttribute("tsdf").GetShape(),
+              core::SizeVector({10, 8, 8, 8, 1}));
+    EXPECT_ANY_THROW(grid.GetLevel(3));
+
+    EXPECT_ANY_THROW(MultiResolutionVoxelBlockGrid(
+            {"tsdf", "weight"}, {core::Float32, core::Float32}, {{1}, {1}},
+            3.0 / 512, {}));
+    EXPECT_ANY_THROW(MultiResolutionVoxelBlockGrid(
+            {"tsdf", "weight"}, {core::Float32, core::Float32}, {{1}, {1}},
+            3.0 / 512, {2.0, 1.0}));
+}
+
+TEST_P(MultiResolutionVoxelBlockGridPermuteDevices, Integrate) {
+    core::Device device = GetParam();
+    const camera::PinholeCameraIntrinsic intrinsic_legacy(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    const core::Tensor intrinsic = core::eigen_converter::EigenMatrixToTensor(
+            intrinsic_legacy.intrinsic_matrix_);
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    auto trajectory = io::CreatePinholeCameraTrajectoryFromFile(
+            redwood_data.GetOdometryLogPath());
+
+    MultiResolutionVoxelBlockGrid grid(
+            {"tsdf", "weight", "color"},
+            {core::Float32, core::Float32, core::Float32}, {{1}, {1}, {3}},
+            3.0 / 512, {1.5, 3.0}, 8, 10000, device);
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        Image depth =
+                t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                        ->To(device);
+        Image color =
+                t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                        ->To(device);
+        grid.Integrate(depth, color, intrinsic,
+                       core::eigen_converter::EigenMatrixToTensor(
+                               trajectory->parameters_[i].extrinsic_));
+    }
+    EXPECT_GT(grid.GetLevel(0).GetHashMap().Size(), 0);
+    EXPECT_GT(grid.GetLevel(1).GetHashMap().Size(), 0);
+
+    // Whether \p positions fall into blocks allocated at level 0.
+    auto InLevel0Blocks = [&](const core::Tensor& positions) {
+        const float block_size = grid.GetVoxelSize(0) * 8;
+        return grid.GetLevel(0)
+                .GetHashMap()
+                .Find((positions / block_size).Floor().To(core::Int32))
+                .second;
+    };
+
+    // The merged point cloud consists of the points of level 0 followed by
+    // the points of level 1 outside of the blocks of level 0.
+    const core::Tensor points =
+            grid.ExtractPointCloud(1.0).GetPointPositions();
+    const core::Tensor points_0 =
+            grid.GetLevel(0).ExtractPointCloud(1.0).GetPointPositions();
+    const int64_t num_points_0 = points_0.GetLength();
+    const int64_t num_points_1 =
+            grid.GetLevel(1).ExtractPointCloud(1.0).GetPointPositions()
+                    .GetLength();
+    EXPECT_GT(num_points_0, 0);
+    EXPECT_GT(num_points_1, 0);
+    EXPECT_GT(points.GetLength(), num_points_0);
+    EXPECT_LT(points.GetLength(), num_points_0 + num_points_1);
+    EXPECT_TRUE(points.Slice(0, 0, num_points_0).AllClose(points_0));
+    EXPECT_FALSE(InLevel0Blocks(points.Slice(0, num_points_0,
+                                             points.GetLength()))
+                         .Any()
+                         .Item<bool>());
+
+    // Likewise, no triangle of level 1 has a vertex in a block of level 0.
+    const TriangleMesh mesh = grid.ExtractTriangleMesh(1.0);
+    const int64_t num_triangles_0 = grid.GetLevel(0)
+                                            .ExtractTriangleMesh(1.0)
+                                            .GetTriangleIndices()
+                                            .GetLength();
+    const int64_t num_triangles = mesh.GetTriangleIndices().GetLength();
+    EXPECT_GT(num_triangles_0, 0);
+    EXPECT_GT(num_triangles, num_triangles_0);
+    EXPECT_TRUE(mesh.GetTriangleIndices()
+                        .Lt(mesh.GetVertexPositions().GetLength())
+                        .All()
+                        .Item<bool>());
+    const core::Tensor triangles_1 =
+            mesh.GetTriangleIndices()
+                    .Slice(0, num_triangles_0, num_triangles)
+                    .To(core::Int64)
+                    .Reshape({-1});
+    EXPECT_FALSE(InLevel0Blocks(mesh.GetVertexPositions().IndexGet(
+                                        {triangles_1}))
+                         .Any()
+                         .Item<bool>());
+
+    // Pixels with a surface at the finest level keep its depth.
+    const core::Tensor extrinsic = core::eigen_converter::EigenMatrixToTensor(
+            trajectory->parameters_[0].extrinsic_);
+    TensorMap rendering = grid.RayCast(intrinsic, extrinsic, 640, 480,
+                                       {"vertex", "depth"});
+    EXPECT_EQ(rendering["vertex"].GetShape(), core::SizeVector({480, 640, 3}));
+    core::HashMap hashmap = grid.GetLevel(0).GetHashMap();
+    const core::Tensor block_coords =
+            hashmap.GetKeyTensor()
+                    .IndexGet({hashmap.GetActiveIndices().To(core::Int64)})
+                    .T()
+                    .Contiguous();
+    TensorMap rendering_fine = grid.GetLevel(0).RayCast(
+            block_coords, intrinsic, extrinsic, 640, 480, {"depth"}, 1000.0,
+            0.1, 1.5);
+    const core::Tensor mask = rendering_fine["depth"].Gt(0);
+    EXPECT_GT(mask.To(core::Int64).Sum({0, 1, 2}).Item<int64_t>(), 0);
+    EXPECT_TRUE(rendering["depth"].IndexGet({mask}).AllClose(
+            rendering_fine["depth"].IndexGet({mask})));
+    EXPECT_ANY_THROW(
+            grid.RayCast(intrinsic, extrinsic, 640, 480, {"index"}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -17,8 +17,10 @@
 #include "open3d/data/Dataset.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Random.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -692,13 +694,6 @@ TEST_P(PointCloudPermuteDevices, CreateFromRGBDImage) {
 TEST_P(PointCloudPermuteDevices, CreateFromRGBDOrDepthImageWithNormals) {
     core::Device device = GetParam();
 
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.GetType() ==
-                core::Device::DeviceType::CPU) {  // FilterBilateral on CPU
-                                                  // needs IPPICV
-        return;
-    }
-
     core::Tensor extrinsics = core::Tensor::Eye(4, core::Float32, device);
     int stride = 1;
     float depth_scale = 10.f, depth_max = 2.5f;
@@ -902,6 +897,55 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
     auto pcd_small_down = pcd_small.VoxelDownSample(1);
     EXPECT_TRUE(pcd_small_down.GetPointPositions().AllClose(
             core::Tensor::Init<float>({{0.375, 0.375, 0.575}}, device)));
+
+    // Reductions, voxels are ordered by voxel coordinates.
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{1.9, 0.1, 0.1},
+                                                           {0.1, 0.2, 0.3},
+                                                           {1.5, 0.5, 0.5},
+                                                           {0.9, 0.9, 0.9},
+                                                           {0.4, 0.6, 0.5},
+                                                           {1.2, 0.2, 0.8}},
+                                                          device));
+    pcd.SetPointAttr("labels", core::Tensor::Init<int32_t>({3, 1, 2, 2, 1, 3},
+                                                           device));
+    pcd.SetPointNormals(core::Tensor::Init<float>({{0, 0, 1},
+                                                   {1, 0, 0},
+                                                   {0, 1, 0},
+                                                   {0, 0, 1},
+                                                   {0, 1, 0},
+                                                   {1, 0, 0}},
+                                                  device));
+
+    auto pcd_first = pcd.VoxelDownSample(1, "first");
+    EXPECT_TRUE(pcd_first.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.1, 0.2, 0.3}, {1.9, 0.1, 0.1}},
+                                      device)));
+    EXPECT_TRUE(pcd_first.GetPointAttr("labels").AllEqual(
+            core::Tensor::Init<int32_t>({1, 3}, device)));
+
+    auto pcd_center = pcd.VoxelDownSample(1, "center");
+    EXPECT_TRUE(pcd_center.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.4, 0.6, 0.5}, {1.5, 0.5, 0.5}},
+                                      device)));
+    EXPECT_TRUE(pcd_center.GetPointNormals().AllClose(
+            core::Tensor::Init<float>({{0, 1, 0}, {0, 1, 0}}, device)));
+
+    auto pcd_mode = pcd.VoxelDownSample(1, "mean", {{"labels", "mode"},
+                                                    {"normals", "first"}});
+    EXPECT_TRUE(pcd_mode.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.466667, 0.566667, 0.566667},
+                                       {1.533333, 0.266667, 0.466667}},
+                                      device)));
+    EXPECT_TRUE(pcd_mode.GetPointAttr("labels").AllEqual(
+            core::Tensor::Init<int32_t>({1, 3}, device)));
+    EXPECT_TRUE(pcd_mode.GetPointNormals().AllClose(
+            core::Tensor::Init<float>({{1, 0, 0}, {0, 0, 1}}, device)));
+
+    // "mode" is only valid for integer attributes.
+    EXPECT_ANY_THROW(pcd.VoxelDownSample(1, "mode"));
+    EXPECT_ANY_THROW(pcd.VoxelDownSample(1, "mean", {{"normals", "mode"}}));
+    EXPECT_ANY_THROW(pcd.VoxelDownSample(1, "mean", {{"colors", "first"}}));
+    EXPECT_ANY_THROW(pcd.VoxelDownSample(1, "median"));
 }
 
 TEST_P(PointCloudPermuteDevices, UniformDownSample) {
@@ -959,6 +1003,24 @@ TEST_P(PointCloudPermuteDevices, FarthestPointDownSample) {
             core::Tensor::Init<float>(
                     {{0, 2.0, 0}, {1.0, 1.0, 0}, {1.0, 0, 1.0}, {0, 1.0, 1.0}},
                     device)));
+
+    // All attributes are kept.
+    pcd_small.SetPointAttr("labels",
+                           core::Tensor::Arange(0, 8, 1, core::Int64, device));
+    pcd_small_down = pcd_small.FarthestPointDownSample(4);
+    EXPECT_TRUE(pcd_small_down.GetPointAttr("labels").AllEqual(
+            core::Tensor::Init<int64_t>({0, 3, 5, 6}, device)));
+
+    // Batches delimited by row splits are sampled independently, in sampling
+    // order.
+    const core::Tensor points = pcd_small.GetPointPositions().Append(
+            pcd_small.GetPointPositions(), 0);
+    const core::Tensor indices =
+            t::geometry::kernel::pointcloud::FarthestPointDownSample(
+                    points, core::Tensor::Init<int64_t>({0, 8, 16}), 4);
+    EXPECT_EQ(indices.GetDevice(), device);
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 5, 3, 6, 8, 13, 11, 14}));
 }
 
 TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
@@ -1136,6 +1198,11 @@ TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
     EXPECT_EQ(cluster_set.size(), 11);
     int cluster_sum = cluster.Sum({0}).Item<int>();
     EXPECT_EQ(cluster_sum, 398580);
+
+    // Same labels as the legacy implementation.
+    const std::vector<int> legacy_cluster =
+            pcd.ToLegacy().ClusterDBSCAN(0.02, 10, false);
+    EXPECT_EQ(cluster.ToFlatVector<int>(), legacy_cluster);
 }
 
 TEST_P(PointCloudPermuteDevices, SegmentPlane) {
@@ -1161,6 +1228,64 @@ TEST_P(PointCloudPermuteDevices, SegmentPlane) {
             0.1, 0.1));
 }
 
+TEST_P(PointCloudPermuteDevices, SegmentPlanes) {
+    core::Device device = GetParam();
+
+    // Two orthogonal planes z = 0 and y = 1 with a few outliers.
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform_gen(0.0, 1.0);
+    std::vector<Eigen::Vector3d> points;
+    for (int i = 0; i < 3000; ++i) {
+        points.emplace_back(4 * uniform_gen(), 4 * uniform_gen(), 0);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        points.emplace_back(4 * uniform_gen(), 1, 3 * uniform_gen());
+    }
+    for (int i = 0; i < 200; ++i) {
+        points.emplace_back(4 * uniform_gen(), 4 * uniform_gen(),
+                            0.5 + 2 * uniform_gen());
+    }
+    t::geometry::PointCloud pcd(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    points, core::Float64, device));
+
+    utility::random::Seed(1);
+    const auto planes = pcd.SegmentPlanes(0.01, 3, 1000, 0.99999999,
+                                          /*max_num_planes=*/5,
+                                          /*min_num_inliers=*/500);
+    ASSERT_EQ(planes.size(), 2u);
+
+    core::Tensor plane_model;
+    core::Tensor inliers;
+    std::tie(plane_model, inliers) = planes[0];
+    EXPECT_EQ(plane_model.GetDevice(), device);
+    EXPECT_EQ(inliers.GetDevice(), device);
+    EXPECT_NEAR(std::abs(plane_model[2].Item<double>()), 1.0, 1e-6);
+    EXPECT_GE(inliers.GetLength(), 3000);
+    std::tie(plane_model, inliers) = planes[1];
+    EXPECT_NEAR(std::abs(plane_model[1].Item<double>()), 1.0, 1e-6);
+    EXPECT_GE(inliers.GetLength(), 1950);
+
+    // Same planes as the legacy implementation.
+    utility::random::Seed(1);
+    const auto legacy_planes = pcd.ToLegacy().SegmentPlanes(
+            0.01, 3, 1000, 0.99999999, /*max_num_planes=*/5,
+            /*min_num_inliers=*/500);
+    ASSERT_EQ(legacy_planes.size(), planes.size());
+    for (size_t i = 0; i < planes.size(); ++i) {
+        const std::vector<size_t> &legacy_inliers =
+                std::get<1>(legacy_planes[i]);
+        EXPECT_EQ(std::get<1>(planes[i]).ToFlatVector<int64_t>(),
+                  std::vector<int64_t>(legacy_inliers.begin(),
+                                       legacy_inliers.end()));
+        EXPECT_TRUE(std::get<0>(planes[i]).AllClose(
+                core::eigen_converter::EigenMatrixToTensor(
+                        std::get<0>(legacy_planes[i]))
+                        .Flatten()
+                        .To(device)));
+    }
+}
+
 TEST_P(PointCloudPermuteDevices, ComputeConvexHull) {
     core::Device device = GetParam();
 
@@ -13,6 +13,8 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/t/geometry/LineSet.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -377,6 +379,250 @@ TEST_P(TriangleMeshPermuteDevices, ComputeVertexNormals) {
                     mesh->vertex_normals_, core::Dtype::Float64, device)));
 }
 
+TEST_P(TriangleMeshPermuteDevices, FilterSmooth) {
+    core::Device device = GetParam();
+
+    std::shared_ptr<open3d::geometry::TriangleMesh> mesh =
+            open3d::geometry::TriangleMesh::CreateSphere(1.0, 10);
+    mesh->ComputeVertexNormals();
+    mesh->PaintUniformColor({0.5, 0.2, 0.7});
+    for (size_t vidx = 0; vidx < mesh->vertices_.size(); vidx += 3) {
+        mesh->vertices_[vidx] *= 1.1;
+        mesh->vertex_colors_[vidx] = {1, 1, 1};
+    }
+    t::geometry::TriangleMesh t_mesh = t::geometry::TriangleMesh::FromLegacy(
+            *mesh, core::Float64, core::Int64, device);
+
+    auto expect_filtered = [&](const open3d::geometry::TriangleMesh &mesh_gt,
+                               const t::geometry::TriangleMesh &t_filtered) {
+        EXPECT_TRUE(t_filtered.GetVertexPositions().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        mesh_gt.vertices_, core::Float64, device)));
+        EXPECT_TRUE(t_filtered.GetVertexNormals().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        mesh_gt.vertex_normals_, core::Float64, device)));
+        EXPECT_TRUE(t_filtered.GetVertexColors().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        mesh_gt.vertex_colors_, core::Float64, device)));
+    };
+    expect_filtered(*mesh->FilterSharpen(2, 0.1), t_mesh.FilterSharpen(2, 0.1));
+    expect_filtered(*mesh->FilterSmoothSimple(3), t_mesh.FilterSmoothSimple(3));
+    expect_filtered(*mesh->FilterSmoothLaplacian(5, 0.5),
+                    t_mesh.FilterSmoothLaplacian(5, 0.5));
+    expect_filtered(*mesh->FilterSmoothTaubin(5, 0.5, -0.53),
+                    t_mesh.FilterSmoothTaubin(5, 0.5, -0.53));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePoints) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::CreateSphere(1.0, 20, core::Float32,
+                                                    core::Int64, device);
+    mesh.ComputeVertexNormals();
+
+    t::geometry::PointCloud pcd = mesh.SamplePointsUniformly(1000);
+    EXPECT_EQ(pcd.GetDevice(), device);
+    EXPECT_EQ(pcd.GetPointPositions().GetLength(), 1000);
+    EXPECT_EQ(pcd.GetPointNormals().GetLength(), 1000);
+    // Samples lie on the triangles inside the unit sphere.
+    core::Tensor radii =
+            (pcd.GetPointPositions() * pcd.GetPointPositions()).Sum({1}).Sqrt();
+    EXPECT_TRUE(radii.Le(1.0 + 1e-5).All().Item<bool>());
+    EXPECT_TRUE(radii.Ge(0.95).All().Item<bool>());
+
+    pcd = mesh.SamplePointsUniformly(500, true);
+    EXPECT_EQ(pcd.GetPointNormals().GetLength(), 500);
+
+    pcd = mesh.SamplePointsPoissonDisk(300);
+    EXPECT_EQ(pcd.GetDevice(), device);
+    EXPECT_EQ(pcd.GetPointPositions().GetLength(), 300);
+}
+
+TEST_P(TriangleMeshPermuteDevices, SubdivideLoop) {
+    core::Device device = GetParam();
+
+    std::shared_ptr<open3d::geometry::TriangleMesh> mesh =
+            open3d::geometry::TriangleMesh::CreateSphere(1.0, 10);
+    mesh->ComputeVertexNormals();
+    t::geometry::TriangleMesh t_mesh = t::geometry::TriangleMesh::FromLegacy(
+            *mesh, core::Float64, core::Int64, device);
+
+    std::shared_ptr<open3d::geometry::TriangleMesh> mesh_gt =
+            mesh->SubdivideLoop(1);
+    t::geometry::TriangleMesh t_subdivided = t_mesh.SubdivideLoop(1);
+    EXPECT_EQ(t_subdivided.GetVertexPositions().GetLength(),
+              int64_t(mesh_gt->vertices_.size()));
+    EXPECT_EQ(t_subdivided.GetTriangleIndices().GetLength(),
+              int64_t(mesh_gt->triangles_.size()));
+
+    // The old vertices keep their index, the order of the edge vertices
+    // differs from the legacy implementation.
+    const int64_t num_vertices = int64_t(mesh->vertices_.size());
+    mesh_gt->vertices_.resize(num_vertices);
+    mesh_gt->vertex_normals_.resize(num_vertices);
+    EXPECT_TRUE(t_subdivided.GetVertexPositions()
+                        .Slice(0, 0, num_vertices)
+                        .AllClose(core::eigen_converter::
+                                          EigenVector3dVectorToTensor(
+                                                  mesh_gt->vertices_,
+                                                  core::Float64, device)));
+    EXPECT_TRUE(t_subdivided.GetVertexNormals()
+                        .Slice(0, 0, num_vertices)
+                        .AllClose(core::eigen_converter::
+                                          EigenVector3dVectorToTensor(
+                                                  mesh_gt->vertex_normals_,
+                                                  core::Float64, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ClusterConnectedTriangles) {
+    core::Device device = GetParam();
+
+    std::shared_ptr<open3d::geometry::TriangleMesh> mesh =
+            open3d::geometry::TriangleMesh::CreateSphere(1.0, 10);
+    std::shared_ptr<open3d::geometry::TriangleMesh> box =
+            open3d::geometry::TriangleMesh::CreateBox();
+    box->Translate({3, 0, 0});
+    std::shared_ptr<open3d::geometry::TriangleMesh> tetrahedron =
+            open3d::geometry::TriangleMesh::CreateTetrahedron();
+    tetrahedron->Translate({-3, 0, 0});
+    *mesh += *box;
+    *mesh += *tetrahedron;
+    t::geometry::TriangleMesh t_mesh = t::geometry::TriangleMesh::FromLegacy(
+            *mesh, core::Float64, core::Int64, device);
+
+    std::vector<int> triangle_clusters_gt;
+    std::vector<size_t> cluster_n_triangles_gt;
+    std::vector<double> cluster_area_gt;
+    std::tie(triangle_clusters_gt, cluster_n_triangles_gt, cluster_area_gt) =
+            mesh->ClusterConnectedTriangles();
+
+    core::Tensor triangle_clusters, cluster_n_triangles, cluster_area;
+    std::tie(triangle_clusters, cluster_n_triangles, cluster_area) =
+            t_mesh.ClusterConnectedTriangles();
+    EXPECT_EQ(cluster_n_triangles.GetLength(), 3);
+    EXPECT_EQ(triangle_clusters.To(core::Int32).ToFlatVector<int>(),
+              triangle_clusters_gt);
+    EXPECT_EQ(cluster_n_triangles.ToFlatVector<int64_t>(),
+              std::vector<int64_t>(cluster_n_triangles_gt.begin(),
+                                   cluster_n_triangles_gt.end()));
+    EXPECT_TRUE(cluster_area.AllClose(
+            core::Tensor(cluster_area_gt, {3}, core::Float64, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, ClipPlane) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh box = t::geometry::TriangleMesh::FromLegacy(
+            *open3d::geometry::TriangleMesh::CreateBox(), core::Float64,
+            core::Int64, device);
+    box.SetTriangleAttr("labels", core::Tensor::Arange(0, 12, 1, core::Int64,
+                                                       device));
+    auto expect_all_vertices_referenced =
+            [](const t::geometry::TriangleMesh &mesh) {
+                std::vector<int64_t> triangles =
+                        mesh.GetTriangleIndices().ToFlatVector<int64_t>();
+                std::sort(triangles.begin(), triangles.end());
+                triangles.erase(std::unique(triangles.begin(), triangles.end()),
+                                triangles.end());
+                EXPECT_EQ(int64_t(triangles.size()),
+                          mesh.GetVertexPositions().GetLength());
+            };
+
+    t::geometry::TriangleMesh clipped =
+            box.ClipPlane(core::Tensor::Init<double>({0.5, 0, 0}),
+                          core::Tensor::Init<double>({1, 0, 0}));
+    EXPECT_EQ(clipped.GetDevice(), device);
+    EXPECT_EQ(clipped.GetVertexPositions().GetLength(), 12);
+    EXPECT_EQ(clipped.GetTriangleIndices().GetLength(), 14);
+    EXPECT_EQ(clipped.GetTriangleAttr("labels").GetLength(), 14);
+    EXPECT_TRUE(clipped.GetVertexPositions()
+                        .Slice(1, 0, 1)
+                        .Ge(0.5)
+                        .All()
+                        .Item<bool>());
+    EXPECT_NEAR(clipped.ToLegacy().GetSurfaceArea(), 3.0, 1e-9);
+    expect_all_vertices_referenced(clipped);
+
+    // Vertices on the plane are kept without new vertices.
+    clipped = box.ClipPlane(core::Tensor::Init<double>({1, 0, 0}),
+                            core::Tensor::Init<double>({1, 0, 0}));
+    EXPECT_EQ(clipped.GetVertexPositions().GetLength(), 4);
+    EXPECT_EQ(clipped.GetTriangleIndices().GetLength(), 2);
+    expect_all_vertices_referenced(clipped);
+
+    // Triangles that only touch the plane in a corner are dropped along with
+    // the corner.
+    clipped = box.ClipPlane(core::Tensor::Init<double>({1, 1, 1}),
+                            core::Tensor::Init<double>({1, 1, 1}));
+    EXPECT_EQ(clipped.GetVertexPositions().GetLength(), 0);
+    EXPECT_EQ(clipped.GetTriangleIndices().GetLength(), 0);
+    expect_all_vertices_referenced(clipped);
+}
+
+TEST_P(TriangleMeshPermuteDevices, SlicePlane) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh box = t::geometry::TriangleMesh::FromLegacy(
+            *open3d::geometry::TriangleMesh::CreateBox(), core::Float32,
+            core::Int64, device);
+
+    t::geometry::LineSet slices =
+            box.SlicePlane(core::Tensor::Init<double>({0, 0.5, 0}),
+                           core::Tensor::Init<double>({1, 1, 1}),
+                           {-0.1, 0, 0.1});
+    EXPECT_EQ(slices.GetDevice(), device);
+    EXPECT_EQ(slices.GetPointPositions().GetLength(), 9);
+    EXPECT_EQ(slices.GetLineIndices().GetLength(), 9);
+
+    // The slice crosses the 4 side edges and the 4 face diagonals.
+    slices = box.SlicePlane(core::Tensor::Init<double>({0, 0.5, 0}),
+                            core::Tensor::Init<double>({0, 1, 0}));
+    EXPECT_EQ(slices.GetPointPositions().GetLength(), 8);
+    EXPECT_EQ(slices.GetLineIndices().GetLength(), 8);
+    EXPECT_TRUE(slices.GetPointPositions().Slice(1, 1, 2).AllClose(
+            core::Tensor::Full({8, 1}, 0.5, core::Float32, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SimplifyQuadricDecimation) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh cube = t::geometry::TriangleMesh::FromLegacy(
+            *open3d::geometry::TriangleMesh::CreateBox()->SubdivideMidpoint(3),
+            core::Float64, core::Int64, device);
+    const double target_reduction =
+            1 - 12. / cube.GetTriangleIndices().GetLength();
+    for (bool preserve_volume : {true, false}) {
+        t::geometry::TriangleMesh simplified =
+                cube.SimplifyQuadricDecimation(target_reduction,
+                                               preserve_volume);
+        EXPECT_EQ(simplified.GetDevice(), device);
+        EXPECT_EQ(simplified.GetVertexPositions().GetLength(), 8);
+        EXPECT_EQ(simplified.GetTriangleIndices().GetLength(), 12);
+    }
+
+    // Volume preservation keeps the enclosed volume of a sphere.
+    std::shared_ptr<open3d::geometry::TriangleMesh> sphere =
+            open3d::geometry::TriangleMesh::CreateSphere(1.0, 40);
+    t::geometry::TriangleMesh simplified =
+            t::geometry::TriangleMesh::FromLegacy(*sphere, core::Float64,
+                                                  core::Int64, device)
+                    .SimplifyQuadricDecimation(0.9, true);
+    EXPECT_LE(simplified.GetTriangleIndices().GetLength(),
+              int64_t(sphere->triangles_.size() / 10));
+    auto volume = [](const open3d::geometry::TriangleMesh &mesh) {
+        double volume = 0;
+        for (const Eigen::Vector3i &triangle : mesh.triangles_) {
+            volume += mesh.vertices_[triangle(0)].dot(
+                              mesh.vertices_[triangle(1)].cross(
+                                      mesh.vertices_[triangle(2)])) /
+                      6;
+        }
+        return volume;
+    };
+    EXPECT_NEAR(volume(simplified.ToLegacy()), volume(*sphere), 1e-6);
+}
+
 TEST_P(TriangleMeshPermuteDevices, FromLegacy) {
     core::Device device = GetParam();
     geometry::TriangleMesh legacy_mesh;
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDPrefetchReader.h"
+
+#include <chrono>
+#include <thread>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static t::geometry::RGBDImage CreateFrame(int64_t index) {
+    const core::Tensor color =
+            core::Tensor::Full({4, 5, 3}, index % 256, core::UInt8);
+    const core::Tensor depth =
+            core::Tensor::Full({4, 5, 1}, 1000 + index, core::UInt16);
+    return t::geometry::RGBDImage(t::geometry::Image(color),
+                                  t::geometry::Image(depth));
+}
+
+TEST(RGBDPrefetchReader, FrameLoader) {
+    const int64_t num_frames = 20;
+    t::io::RGBDPrefetchReader reader(
+            [&](int64_t index, t::geometry::RGBDImage &frame) {
+                if (index >= num_frames) return false;
+                // Later frames finish first.
+                std::this_thread::sleep_for(
+                        std::chrono::milliseconds((num_frames - index) % 4));
+                frame = CreateFrame(index);
+                return true;
+            },
+            4, 3);
+
+    int64_t index = 0;
+    while (!reader.IsEOF()) {
+        const t::geometry::RGBDImage frame = reader.NextFrame();
+        EXPECT_EQ(frame.depth_.AsTensor()[0][0][0].Item<uint16_t>(),
+                  1000 + index);
+        ++index;
+    }
+    EXPECT_EQ(index, num_frames);
+    EXPECT_EQ(reader.GetFrameIndex(), num_frames);
+    EXPECT_TRUE(reader.NextFrame().IsEmpty());
+}
+
+TEST(RGBDPrefetchReader, FrameLoaderError) {
+    t::io::RGBDPrefetchReader reader(
+            [](int64_t index, t::geometry::RGBDImage &frame) {
+                if (index == 5) utility::LogError("Corrupted frame.");
+                frame = CreateFrame(index);
+                return true;
+            },
+            2, 4);
+
+    for (int64_t index = 0; index < 5; ++index) {
+        EXPECT_FALSE(reader.IsEOF());
+        reader.NextFrame();
+    }
+    EXPECT_FALSE(reader.IsEOF());
+    EXPECT_ANY_THROW(reader.NextFrame());
+    EXPECT_TRUE(reader.IsEOF());
+}
+
+TEST(RGBDPrefetchReader, ImageFiles) {
+    const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
+    std::vector<std::string> color_files, depth_files;
+    for (int64_t index = 0; index < 6; ++index) {
+        const t::geometry::RGBDImage frame = CreateFrame(index);
+        color_files.push_back(fmt::format(
+                "{}/test_prefetch_color_{}.png", tmp_path, index));
+        depth_files.push_back(fmt::format(
+                "{}/test_prefetch_depth_{}.png", tmp_path, index));
+        ASSERT_TRUE(t::io::WriteImage(color_files.back(), frame.color_));
+        ASSERT_TRUE(t::io::WriteImage(depth_files.back(), frame.depth_));
+    }
+    EXPECT_ANY_THROW(t::io::RGBDPrefetchReader(color_files, {}));
+
+    t::io::RGBDPrefetchReader reader(color_files, depth_files, 3, 2);
+    for (int64_t index = 0; index < 6; ++index) {
+        ASSERT_FALSE(reader.IsEOF());
+        const t::geometry::RGBDImage frame = reader.NextFrame();
+        const t::geometry::RGBDImage ref = CreateFrame(index);
+        EXPECT_TRUE(frame.color_.AsTensor().AllEqual(ref.color_.AsTensor()));
+        EXPECT_TRUE(frame.depth_.AsTensor().AllEqual(ref.depth_.AsTensor()));
+    }
+    EXPECT_TRUE(reader.IsEOF());
+
+    for (const auto &file : color_files) utility::filesystem::RemoveFile(file);
+    for (const auto &file : depth_files) utility::filesystem::RemoveFile(file);
+}
+
+}  // namespace tests
+}  // namespace open3d
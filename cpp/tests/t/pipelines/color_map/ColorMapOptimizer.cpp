@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/color_map/ColorMapOptimizer.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class ColorMapOptimizerPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ColorMapOptimizer,
+                         ColorMapOptimizerPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static const int64_t kRows = 240;
+static const int64_t kCols = 320;
+static const int64_t kGrid = 41;
+
+// Two crossing waves, so that image shifts in any direction are observable.
+static float Texture(int64_t u, int64_t v, int64_t channel) {
+    return 0.5f + 0.2f * std::sin(0.1f * u + 0.07f * v + channel) +
+           0.2f * std::sin(0.06f * u - 0.09f * v + 2 * channel);
+}
+
+// A textured plane at depth 1 seen by identical cameras. The vertices project
+// onto integer pixels.
+static void CreatePlaneScene(const core::Device& device,
+                             t::geometry::TriangleMesh& mesh,
+                             std::vector<t::geometry::RGBDImage>& images,
+                             core::Tensor& intrinsics,
+                             int n_images) {
+    std::vector<float> positions;
+    std::vector<int64_t> triangles;
+    for (int64_t j = 0; j < kGrid; ++j) {
+        for (int64_t i = 0; i < kGrid; ++i) {
+            positions.insert(positions.end(),
+                             {-0.4f + 0.02f * i, -0.25f + 0.0125f * j, 1.0f});
+            if (i + 1 < kGrid && j + 1 < kGrid) {
+                const int64_t k = j * kGrid + i;
+                triangles.insert(triangles.end(), {k, k + 1, k + kGrid, k + 1,
+                                                   k + kGrid + 1, k + kGrid});
+            }
+        }
+    }
+    mesh = t::geometry::TriangleMesh(device);
+    mesh.SetVertexPositions(
+            core::Tensor(positions, {kGrid * kGrid, 3}, core::Float32, device));
+    mesh.SetTriangleIndices(core::Tensor(
+            triangles, {int64_t(triangles.size()) / 3, 3}, core::Int64,
+            device));
+
+    std::vector<float> color(kRows * kCols * 3);
+    for (int64_t v = 0; v < kRows; ++v) {
+        for (int64_t u = 0; u < kCols; ++u) {
+            for (int64_t c = 0; c < 3; ++c) {
+                color[(v * kCols + u) * 3 + c] = Texture(u, v, c);
+            }
+        }
+    }
+    const core::Tensor color_t(color, {kRows, kCols, 3}, core::Float32,
+                               device);
+    const core::Tensor depth_t =
+            core::Tensor::Full({kRows, kCols, 1}, 1000, core::UInt16, device);
+    images.assign(n_images,
+                  t::geometry::RGBDImage(t::geometry::Image(color_t),
+                                         t::geometry::Image(depth_t)));
+    intrinsics = core::Tensor::Init<double>(
+            {{300, 0, 160}, {0, 400, 120}, {0, 0, 1}});
+}
+
+TEST_P(ColorMapOptimizerPermuteDevices, Rigid) {
+    const core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh;
+    std::vector<t::geometry::RGBDImage> images;
+    core::Tensor intrinsics;
+    CreatePlaneScene(device, mesh, images, intrinsics, 3);
+    const core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"))
+                    .Reshape({1, 4, 4})
+                    .Expand({3, 4, 4})
+                    .Contiguous();
+
+    t::pipelines::color_map::ColorMapOptimizationOption option;
+    option.iterations_ = {3, 3};
+    const auto result = t::pipelines::color_map::RunColorMapOptimization(
+            mesh, images, intrinsics, extrinsics, option);
+
+    // Consistent images leave the poses unchanged.
+    EXPECT_TRUE(result.extrinsics_.AllClose(extrinsics, 0, 1e-6));
+    EXPECT_EQ(result.warping_fields_.NumElements(), 0);
+    EXPECT_NEAR(result.residual_, 0, 1e-10);
+
+    ASSERT_TRUE(result.mesh_.HasVertexColors());
+    EXPECT_EQ(result.mesh_.GetDevice(), device);
+    const core::Tensor colors =
+            result.mesh_.GetVertexColors().To(core::Device("CPU:0"));
+    for (int64_t k : {int64_t(0), kGrid * kGrid / 2, kGrid * kGrid - 1}) {
+        const int64_t u = 40 + 6 * (k % kGrid);
+        const int64_t v = 20 + 5 * (k / kGrid);
+        for (int64_t c = 0; c < 3; ++c) {
+            EXPECT_NEAR(colors[k][c].Item<float>(), Texture(u, v, c), 1e-5);
+        }
+    }
+}
+
+TEST_P(ColorMapOptimizerPermuteDevices, RigidPerturbed) {
+    const core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh;
+    std::vector<t::geometry::RGBDImage> images;
+    core::Tensor intrinsics;
+    CreatePlaneScene(device, mesh, images, intrinsics, 3);
+
+    // The last camera is rotated about its axis and shifted by 1-2 pixels.
+    const double angle = 0.005;
+    Eigen::Matrix4d perturbation = Eigen::Matrix4d::Identity();
+    perturbation.block<2, 2>(0, 0) << std::cos(angle), -std::sin(angle),
+            std::sin(angle), std::cos(angle);
+    perturbation.block<3, 1>(0, 3) << 0.004, -0.003, 0;
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"))
+                    .Reshape({1, 4, 4})
+                    .Expand({3, 4, 4})
+                    .Contiguous();
+    extrinsics[2] = core::eigen_converter::EigenMatrixToTensor(perturbation);
+
+    // Pixel of the world point (x, y, 1) in the camera with \p extrinsic.
+    const Eigen::Matrix3d K =
+            core::eigen_converter::TensorToEigenMatrixXd(intrinsics);
+    auto project = [&](const core::Tensor& extrinsic, double x, double y) {
+        const Eigen::Matrix4d T =
+                core::eigen_converter::TensorToEigenMatrixXd(extrinsic);
+        const Eigen::Vector3d p =
+                K * (T * Eigen::Vector4d(x, y, 1, 1)).head<3>();
+        return Eigen::Vector2d(p(0) / p(2), p(1) / p(2));
+    };
+    // Largest pixel offset between the images of the plane in two cameras.
+    auto max_offset = [&](const core::Tensor& extrinsics, int c0, int c1) {
+        double offset = 0;
+        for (double x : {-0.4, 0.0, 0.4}) {
+            for (double y : {-0.25, 0.0, 0.25}) {
+                offset = std::max(offset,
+                                  (project(extrinsics[c0], x, y) -
+                                   project(extrinsics[c1], x, y))
+                                          .norm());
+            }
+        }
+        return offset;
+    };
+    ASSERT_GT(max_offset(extrinsics, 0, 2), 1.0);
+
+    t::pipelines::color_map::ColorMapOptimizationOption option;
+    option.iterations_ = {1};
+    const auto initial = t::pipelines::color_map::RunColorMapOptimization(
+            mesh, images, intrinsics, extrinsics, option);
+    option.iterations_ = {30};
+    const auto result = t::pipelines::color_map::RunColorMapOptimization(
+            mesh, images, intrinsics, extrinsics, option);
+
+    // The cameras converge to a consistent pose, which the optimization can
+    // only determine up to a common motion.
+    EXPECT_LT(max_offset(result.extrinsics_, 0, 2), 0.2);
+    EXPECT_LT(max_offset(result.extrinsics_, 1, 2), 0.2);
+    EXPECT_LT(max_offset(result.extrinsics_, 0, 1), 0.2);
+    EXPECT_GT(initial.residual_, 0);
+    EXPECT_LT(result.residual_, 0.1 * initial.residual_);
+}
+
+TEST_P(ColorMapOptimizerPermuteDevices, NonRigid) {
+    const core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh;
+    std::vector<t::geometry::RGBDImage> images;
+    core::Tensor intrinsics;
+    CreatePlaneScene(device, mesh, images, intrinsics, 2);
+    const core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"))
+                    .Reshape({1, 4, 4})
+                    .Expand({2, 4, 4})
+                    .Contiguous();
+
+    t::pipelines::color_map::ColorMapOptimizationOption option;
+    option.non_rigid_camera_coordinate_ = true;
+    option.iterations_ = {2};
+    const auto result = t::pipelines::color_map::RunColorMapOptimization(
+            mesh, images, intrinsics, extrinsics, option);
+
+    // 16 vertical anchors are 16 pixels apart.
+    EXPECT_EQ(result.warping_fields_.GetShape(),
+              core::SizeVector({2, 16, 21, 2}));
+    EXPECT_NEAR(result.warping_fields_[1][3][5][0].Item<double>(), 80, 1e-6);
+    EXPECT_NEAR(result.warping_fields_[1][3][5][1].Item<double>(), 48, 1e-6);
+    EXPECT_TRUE(result.extrinsics_.AllClose(extrinsics, 0, 1e-6));
+}
+
+TEST_P(ColorMapOptimizerPermuteDevices, InvalidInputs) {
+    const core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh;
+    std::vector<t::geometry::RGBDImage> images;
+    core::Tensor intrinsics;
+    CreatePlaneScene(device, mesh, images, intrinsics, 2);
+    const core::Tensor extrinsics =
+            core::Tensor::Zeros({3, 4, 4}, core::Float64);
+    EXPECT_ANY_THROW(t::pipelines::color_map::RunColorMapOptimization(
+            mesh, images, intrinsics, extrinsics));
+    EXPECT_ANY_THROW(t::pipelines::color_map::RunColorMapOptimization(
+            mesh, {}, intrinsics, extrinsics));
+}
+
+}  // namespace tests
+}  // namespace open3d
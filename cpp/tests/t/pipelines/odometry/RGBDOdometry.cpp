@@ -39,10 +39,6 @@ core::Tensor CreateIntrisicTensor() {
 
 TEST_P(OdometryPermuteDevices, ComputeOdometryResultPointToPlane) {
     core::Device device = GetParam();
-    if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-        return;
-    }
-
     const float depth_scale = 1000.0;
     const float depth_diff = 0.07;
 
@@ -106,10 +102,6 @@ TEST_P(OdometryPermuteDevices, ComputeOdometryResultPointToPlane) {
 
 TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScalePointToPlane) {
     core::Device device = GetParam();
-    if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-        return;
-    }
-
     const float depth_scale = 1000.0;
     const float depth_max = 3.0;
     const float depth_diff = 0.07;
@@ -173,10 +165,6 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScalePointToPlane) {
 
 TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleIntensity) {
     core::Device device = GetParam();
-    if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-        return;
-    }
-
     const float depth_scale = 1000.0;
     const float depth_max = 3.0;
     const float depth_diff = 0.07;
@@ -240,10 +228,6 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleIntensity) {
 
 TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleHybrid) {
     core::Device device = GetParam();
-    if (!t::geometry::Image::HAVE_IPPICV && device.IsCPU()) {
-        return;
-    }
-
     const float depth_scale = 1000.0;
     const float depth_max = 3.0;
     const float depth_diff = 0.07;
@@ -304,5 +288,57 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleHybrid) {
     core::Tensor Ttrans = Tdiff.Slice(0, 0, 3).Slice(1, 3, 4);
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
 }
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleFrames) {
+    core::Device device = GetParam();
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    std::vector<t::geometry::RGBDImage> rgbds;
+    for (size_t i = 0; i < 3; ++i) {
+        rgbds.emplace_back(
+                t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                        ->To(device),
+                t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                        ->To(device));
+    }
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    core::Tensor trans =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    const std::vector<t::pipelines::odometry::OdometryConvergenceCriteria>
+            criteria{10, 5, 3};
+    const t::pipelines::odometry::OdometryLossParams params(depth_diff);
+
+    for (auto method : {t::pipelines::odometry::Method::PointToPlane,
+                        t::pipelines::odometry::Method::Intensity,
+                        t::pipelines::odometry::Method::Hybrid}) {
+        // Each pyramid is created once and used as source and as target.
+        std::vector<t::pipelines::odometry::OdometryFrame> frames;
+        for (const auto& rgbd : rgbds) {
+            frames.emplace_back(rgbd, intrinsic_t, depth_scale, depth_max,
+                                int64_t(criteria.size()), method, params);
+        }
+        for (size_t i = 0; i + 1 < rgbds.size(); ++i) {
+            auto expected = t::pipelines::odometry::RGBDOdometryMultiScale(
+                    rgbds[i + 1], rgbds[i], intrinsic_t, trans, depth_scale,
+                    depth_max, criteria, method, params);
+            auto result = t::pipelines::odometry::RGBDOdometryMultiScale(
+                    frames[i + 1], frames[i], trans, criteria, params);
+            EXPECT_TRUE(result.transformation_.AllClose(
+                    expected.transformation_));
+            EXPECT_DOUBLE_EQ(result.fitness_, expected.fitness_);
+        }
+    }
+
+    // Frames must match the number of levels of the criteria list.
+    t::pipelines::odometry::OdometryFrame frame(
+            rgbds[0], intrinsic_t, depth_scale, depth_max, 2,
+            t::pipelines::odometry::Method::Hybrid, params);
+    EXPECT_ANY_THROW(t::pipelines::odometry::RGBDOdometryMultiScale(
+            frame, frame, trans, criteria, params));
+}
 }  // namespace tests
 }  // namespace open3d
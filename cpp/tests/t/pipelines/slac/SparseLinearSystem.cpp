@@ -0,0 +1,270 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slac/SparseLinearSystem.h"
+
+#include <Eigen/Geometry>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
+#include "open3d/t/pipelines/slac/ControlGrid.h"
+#include "open3d/t/pipelines/slac/SLACOptimizer.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class SparseLinearSystemPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SparseLinearSystem,
+                         SparseLinearSystemPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST(SparseLinearSystem, Solve) {
+    // 2 "poses" and 2 "grid points": 18 parameters in 6 blocks.
+    const int n_params = 18;
+    t::pipelines::slac::BlockSparseMatrix AtA(n_params);
+    EXPECT_ANY_THROW(t::pipelines::slac::BlockSparseMatrix(10));
+
+    for (int64_t k = 0; k < 6; ++k) {
+        AtA.AddBlock(k, k, Eigen::Matrix3f::Identity());
+    }
+    const float J[9] = {1, -2, 0.5, 0.3, 1, -1, 2, 0, 1};
+    const int idx[9] = {0, 1, 2, 9, 10, 11, 15, 16, 17};
+    AtA.AddJtJ(J, idx, 9);
+    EXPECT_EQ(AtA.GetNumNonZeroBlocks(), 6 + 6);
+
+    const core::Tensor dense = AtA.ToDense();
+    EXPECT_FLOAT_EQ(dense[0][0].Item<float>(), 2);
+    EXPECT_FLOAT_EQ(dense[0][9].Item<float>(), 0.3);
+    EXPECT_FLOAT_EQ(dense[17][1].Item<float>(), -2);
+    EXPECT_TRUE(dense.AllClose(dense.T()));
+
+    const core::Tensor b =
+            core::Tensor::Arange(0, n_params, 1, core::Float32).View({-1, 1});
+    const core::Tensor x = AtA.Solve(b, 100, 1e-7);
+    EXPECT_TRUE(x.AllClose(dense.Solve(b), 1e-4, 1e-4));
+}
+
+TEST_P(SparseLinearSystemPermuteDevices, FillInSLACRegularizerTerm) {
+    const core::Device device = GetParam();
+    t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
+
+    data::PCDPointCloud sample_pcd;
+    auto pcd = io::CreatePointCloudFromFile(sample_pcd.GetPath());
+    cgrid.Touch(t::geometry::PointCloud::FromLegacy(*pcd, core::Float32,
+                                                    device));
+    cgrid.Compactify();
+    core::Tensor curr = cgrid.GetCurrPositions();
+    curr[0][0] += 0.2;
+    curr[1][2] -= 0.2;
+    curr[2][1] += 0.2;
+
+    core::Tensor grid_idx, grid_nbs_idx, grid_nbs_mask;
+    std::tie(grid_idx, grid_nbs_idx, grid_nbs_mask) =
+            cgrid.GetNeighborGridMap();
+
+    const int n_frags = 2;
+    const int64_t n_params = 6 * n_frags + 3 * cgrid.Size();
+
+    core::Tensor AtA_dense =
+            core::Tensor::Zeros({n_params, n_params}, core::Float32, device);
+    core::Tensor Atb_dense =
+            core::Tensor::Zeros({n_params, 1}, core::Float32, device);
+    core::Tensor residual_dense =
+            core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::kernel::FillInSLACRegularizerTerm(
+            AtA_dense, Atb_dense, residual_dense, grid_idx, grid_nbs_idx,
+            grid_nbs_mask, cgrid.GetInitPositions(), curr, 2.0, n_frags,
+            cgrid.GetAnchorIdx());
+
+    t::pipelines::slac::BlockSparseMatrix AtA(n_params);
+    core::Tensor Atb = core::Tensor::Zeros({n_params, 1}, core::Float32);
+    core::Tensor residual = core::Tensor::Zeros({1}, core::Float32);
+    t::pipelines::slac::FillInSLACRegularizerTerm(
+            AtA, Atb, residual, grid_idx, grid_nbs_idx, grid_nbs_mask,
+            cgrid.GetInitPositions(), curr, 2.0, n_frags,
+            cgrid.GetAnchorIdx());
+
+    // At most 7 blocks per row: the grid point and its 6 neighbors.
+    EXPECT_LE(AtA.GetNumNonZeroBlocks(), 7 * cgrid.Size());
+    EXPECT_TRUE(AtA.ToDense().AllClose(AtA_dense.To(core::Device("CPU:0")),
+                                       1e-5, 1e-5));
+    EXPECT_TRUE(Atb.AllClose(Atb_dense.To(core::Device("CPU:0")), 1e-4,
+                             1e-4));
+    EXPECT_NEAR(residual[0].Item<float>(),
+                residual_dense[0].Item<float>(),
+                1e-4 * std::max(1.0f, residual_dense[0].Item<float>()));
+}
+
+TEST_P(SparseLinearSystemPermuteDevices, FillInSLACAlignmentTerm) {
+    const core::Device device = GetParam();
+    t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
+
+    data::PCDPointCloud sample_pcd;
+    auto pcd = io::CreatePointCloudFromFile(sample_pcd.GetPath());
+    t::geometry::PointCloud tpcd = t::geometry::PointCloud::FromLegacy(
+            *pcd->VoxelDownSample(0.05), core::Float32, device);
+    tpcd.EstimateNormals();
+    cgrid.Touch(tpcd);
+    cgrid.Compactify();
+    core::Tensor curr = cgrid.GetCurrPositions();
+    curr[0][0] += 0.02;
+    curr[1][2] -= 0.02;
+
+    // Correspondences between the deformed point cloud in fragment i and
+    // the same points in fragment j, which is slightly rotated and shifted.
+    const t::geometry::PointCloud tpcd_param = cgrid.Parameterize(tpcd);
+    const t::geometry::PointCloud tpcd_deformed = cgrid.Deform(tpcd_param);
+    const core::Tensor Cps = tpcd_deformed.GetPointPositions();
+    const core::Tensor Cnormal_ps = tpcd_deformed.GetPointNormals();
+    const float angle = 0.01f;
+    const core::Tensor Tj = core::Tensor::Init<float>(
+            {{std::cos(angle), -std::sin(angle), 0, 0.01},
+             {std::sin(angle), std::cos(angle), 0, -0.02},
+             {0, 0, 1, 0.01},
+             {0, 0, 0, 1}},
+            device);
+    const core::Tensor Rj = Tj.Slice(0, 0, 3).Slice(1, 0, 3);
+    const core::Tensor tj = Tj.Slice(0, 0, 3).Slice(1, 3, 4);
+    const core::Tensor Tj_Cqs = Rj.Matmul(Cps.T()).Add_(tj).T().Contiguous();
+    const core::Tensor RjT_Cnormal_ps =
+            Rj.T().Matmul(Cnormal_ps.T()).T().Contiguous();
+    const core::Tensor cgrid_idx = tpcd_param.GetPointAttr(
+            t::pipelines::slac::ControlGrid::kGrid8NbIndices);
+    const core::Tensor cgrid_ratio = tpcd_param.GetPointAttr(
+            t::pipelines::slac::ControlGrid::kGrid8NbVertexInterpRatios);
+
+    const int n_frags = 2;
+    const int64_t n_params = 6 * n_frags + 3 * cgrid.Size();
+
+    core::Tensor AtA_dense =
+            core::Tensor::Zeros({n_params, n_params}, core::Float32, device);
+    core::Tensor Atb_dense =
+            core::Tensor::Zeros({n_params, 1}, core::Float32, device);
+    core::Tensor residual_dense =
+            core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::kernel::FillInSLACAlignmentTerm(
+            AtA_dense, Atb_dense, residual_dense, Cps, Tj_Cqs, Cnormal_ps,
+            Cnormal_ps, RjT_Cnormal_ps, cgrid_idx, cgrid_idx, cgrid_ratio,
+            cgrid_ratio, 0, 1, n_frags, 0.07);
+
+    t::pipelines::slac::BlockSparseMatrix AtA(n_params);
+    core::Tensor Atb = core::Tensor::Zeros({n_params, 1}, core::Float32);
+    core::Tensor residual = core::Tensor::Zeros({1}, core::Float32);
+    t::pipelines::slac::FillInSLACAlignmentTerm(
+            AtA, Atb, residual, Cps, Tj_Cqs, Cnormal_ps, Cnormal_ps,
+            RjT_Cnormal_ps, cgrid_idx, cgrid_idx, cgrid_ratio, cgrid_ratio,
+            0, 1, n_frags, 0.07);
+
+    const core::Tensor AtA_expected = AtA_dense.To(core::Device("CPU:0"));
+    const float scale = AtA_expected.Abs().Max({0, 1}).Item<float>();
+    EXPECT_GT(scale, 0);
+    EXPECT_TRUE(AtA.ToDense().AllClose(AtA_expected, 1e-4, 1e-5 * scale));
+    EXPECT_TRUE(Atb.AllClose(Atb_dense.To(core::Device("CPU:0")), 1e-4,
+                             1e-5 * scale));
+    EXPECT_NEAR(residual[0].Item<float>(), residual_dense[0].Item<float>(),
+                1e-4 * std::max(1.0f, residual_dense[0].Item<float>()));
+}
+
+TEST_P(SparseLinearSystemPermuteDevices, RunSLACOptimizerForFragments) {
+    const core::Device device = GetParam();
+    const std::string tmp_path =
+            utility::filesystem::GetTempDirectoryPath() + "/slac_sparse";
+    utility::filesystem::DeleteDirectory(tmp_path);
+    utility::filesystem::MakeDirectoryHierarchy(tmp_path);
+
+    // Three fragments of the same scene, whose poses in the pose graph are
+    // slightly off.
+    data::PCDPointCloud sample_pcd;
+    auto pcd = io::CreatePointCloudFromFile(sample_pcd.GetPath());
+    const int n_frags = 3;
+    std::vector<Eigen::Matrix4d> poses;
+    std::vector<std::string> fnames;
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < n_frags; ++i) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose.block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(0.1 * i, Eigen::Vector3d::UnitZ())
+                        .toRotationMatrix();
+        pose.block<3, 1>(0, 3) = Eigen::Vector3d(0.2 * i, -0.1 * i, 0);
+        poses.push_back(pose);
+
+        geometry::PointCloud fragment = *pcd;
+        fragment.Transform(pose.inverse());
+        fnames.push_back(fmt::format("{}/fragment_{:03d}.ply", tmp_path, i));
+        io::WritePointCloud(fnames.back(), fragment);
+
+        pose(0, 3) += 0.01 * i;
+        pose(1, 3) -= 0.005 * i;
+        pose_graph.nodes_.emplace_back(pose);
+    }
+    for (const auto& ij : std::vector<std::pair<int, int>>{
+                 {0, 1}, {1, 2}, {0, 2}}) {
+        pose_graph.edges_.emplace_back(
+                ij.first, ij.second,
+                poses[ij.second].inverse() * poses[ij.first],
+                Eigen::Matrix6d::Identity(), ij.second != ij.first + 1);
+    }
+
+    auto params = t::pipelines::slac::SLACOptimizerParams();
+    params.voxel_size_ = 0.05;
+    params.regularizer_weight_ = 1;
+    params.distance_threshold_ = 0.07;
+    params.fitness_threshold_ = 0.3;
+    params.max_iterations_ = 3;
+    params.device_ = device;
+
+    params.slac_folder_ = tmp_path + "/dense";
+    pipelines::registration::PoseGraph dense_graph;
+    t::pipelines::slac::ControlGrid dense_grid;
+    std::tie(dense_graph, dense_grid) =
+            t::pipelines::slac::RunSLACOptimizerForFragments(
+                    fnames, pose_graph, params);
+
+    params.slac_folder_ = tmp_path + "/sparse";
+    params.use_sparse_solver_ = true;
+    pipelines::registration::PoseGraph sparse_graph;
+    t::pipelines::slac::ControlGrid sparse_grid;
+    std::tie(sparse_graph, sparse_grid) =
+            t::pipelines::slac::RunSLACOptimizerForFragments(
+                    fnames, pose_graph, params);
+
+    ASSERT_EQ(sparse_graph.nodes_.size(), dense_graph.nodes_.size());
+    for (size_t i = 0; i < dense_graph.nodes_.size(); ++i) {
+        EXPECT_LT((sparse_graph.nodes_[i].pose_ - dense_graph.nodes_[i].pose_)
+                          .cwiseAbs()
+                          .maxCoeff(),
+                  1e-3);
+    }
+
+    // Both solvers deform the same control grid points alike.
+    auto dense_hashmap = dense_grid.GetHashMap();
+    auto sparse_hashmap = sparse_grid.GetHashMap();
+    ASSERT_GT(dense_hashmap->Size(), 0);
+    EXPECT_EQ(sparse_hashmap->Size(), dense_hashmap->Size());
+    const core::Tensor dense_indices =
+            dense_hashmap->GetActiveIndices().To(core::Int64);
+    core::Tensor sparse_indices, masks;
+    std::tie(sparse_indices, masks) = sparse_hashmap->Find(
+            dense_hashmap->GetKeyTensor().IndexGet({dense_indices}));
+    EXPECT_TRUE(masks.All().Item<bool>());
+    EXPECT_TRUE(sparse_hashmap->GetValueTensor()
+                        .IndexGet({sparse_indices.To(core::Int64)})
+                        .AllClose(dense_hashmap->GetValueTensor().IndexGet(
+                                          {dense_indices}),
+                                  0, 1e-3));
+
+    utility::filesystem::DeleteDirectory(tmp_path);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/Backend.h"
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/Model.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class SLAMBackendPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SLAMBackend,
+                         SLAMBackendPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(SLAMBackendPermuteDevices, LoopClosure) {
+    core::Device device = GetParam();
+    const float voxel_size = 3.0f / 512;
+
+    // Walk through the sequence and back, so that the last frame closes a
+    // loop with the first one.
+    data::SampleRedwoodRGBDImages redwood_data;
+    std::vector<t::geometry::RGBDImage> rgbds;
+    const int64_t num_images = redwood_data.GetColorPaths().size();
+    for (int64_t i = 0; i < 2 * num_images - 1; ++i) {
+        const int64_t j = i < num_images ? i : 2 * num_images - 2 - i;
+        rgbds.emplace_back(
+                *t::io::CreateImageFromFile(redwood_data.GetColorPaths()[j]),
+                *t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[j]));
+    }
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+    const core::Tensor T_init =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    // Every even frame is passed to the back end and becomes a keyframe, the
+    // odd frames are only integrated. Keyframes are re-integrated whenever
+    // they move.
+    t::pipelines::slam::BackendParams params;
+    params.keyframe_translation_ = 0;
+    params.min_loop_interval_ = num_images - 1;
+    params.reintegration_threshold_ = 0;
+    t::pipelines::slam::Backend backend(intrinsic_t, params);
+
+    t::pipelines::slam::Model model(voxel_size, 16, 1000, T_init, device);
+    t::pipelines::slam::Frame input_frame(rgbds[0].depth_.GetRows(),
+                                          rgbds[0].depth_.GetCols(),
+                                          intrinsic_t, device);
+    t::pipelines::slam::Frame raycast_frame(rgbds[0].depth_.GetRows(),
+                                            rgbds[0].depth_.GetCols(),
+                                            intrinsic_t, device);
+    core::Tensor T_frame_to_model = T_init;
+    std::vector<core::Tensor> T_integrated;
+    for (size_t i = 0; i < rgbds.size(); ++i) {
+        input_frame.SetDataFromImage("depth", rgbds[i].depth_);
+        input_frame.SetDataFromImage("color", rgbds[i].color_);
+        if (i > 0) {
+            auto result = model.TrackFrameToModel(input_frame, raycast_frame);
+            T_frame_to_model = T_frame_to_model.Matmul(result.transformation_);
+        }
+        model.UpdateFramePose(i, T_frame_to_model);
+        model.Integrate(input_frame);
+        T_integrated.push_back(T_frame_to_model);
+        if (i % 2 == 0) {
+            EXPECT_TRUE(backend.AddFrame(i, rgbds[i], T_frame_to_model));
+        }
+        if (i + 1 == rgbds.size()) {
+            backend.WaitForIdle();
+        }
+        if (backend.Update(model)) {
+            T_frame_to_model = model.GetCurrentFramePose();
+        }
+        model.SynthesizeModelFrame(raycast_frame, 1000.0, 0.1, 3.0, 8.0,
+                                   false);
+    }
+
+    const std::vector<int64_t> keyframe_ids = backend.GetKeyframeIds();
+    EXPECT_EQ(keyframe_ids.size(), size_t(num_images));
+    EXPECT_GE(backend.GetNumLoopClosures(), 1);
+    auto pose_graph = backend.GetPoseGraph();
+    EXPECT_EQ(pose_graph.nodes_.size(), keyframe_ids.size());
+    EXPECT_FALSE(backend.Update(model));
+
+    // Keyframes are moved to their optimized poses, while the other frames
+    // keep their observations at the poses they were integrated at.
+    for (size_t k = 0; k < keyframe_ids.size(); ++k) {
+        T_integrated[keyframe_ids[k]] =
+                core::eigen_converter::EigenMatrixToTensor(
+                        pose_graph.nodes_[k].pose_);
+    }
+    t::pipelines::slam::Model expected(voxel_size, 16, 1000, T_init, device);
+    for (size_t i = 0; i < rgbds.size(); ++i) {
+        input_frame.SetDataFromImage("depth", rgbds[i].depth_);
+        input_frame.SetDataFromImage("color", rgbds[i].color_);
+        expected.UpdateFramePose(i, T_integrated[i]);
+        expected.Integrate(input_frame);
+    }
+    auto SumWeights = [](t::pipelines::slam::Model& m) {
+        return m.voxel_grid_.GetAttribute("weight")
+                .To(core::Float64)
+                .Sum({0, 1, 2, 3, 4})
+                .Item<double>();
+    };
+    const double expected_weight = SumWeights(expected);
+    EXPECT_GT(expected_weight, 0);
+    EXPECT_NEAR(SumWeights(model), expected_weight, 1e-3 * expected_weight);
+
+    // The last frame shows the same image as the first one.
+    core::Tensor translation =
+            (model.GetCurrentFramePose() - T_init).Slice(0, 0, 3).Slice(1, 3,
+                                                                        4);
+    EXPECT_LT((translation * translation).Sum({0, 1}).Item<double>(), 1e-3);
+    EXPECT_GT(model.ExtractPointCloud().GetPointPositions().GetLength(), 0);
+
+    backend.Stop();
+    EXPECT_FALSE(backend.AddFrame(int64_t(rgbds.size()), rgbds[0], T_init));
+}
+
+}  // namespace tests
+}  // namespace open3d
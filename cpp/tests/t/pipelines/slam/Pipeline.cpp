@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/Pipeline.h"
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/Model.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class SLAMPipelinePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SLAMPipeline,
+                         SLAMPipelinePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(SLAMPipelinePermuteDevices, Run) {
+    core::Device device = GetParam();
+    const float voxel_size = 3.0f / 512;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    std::vector<t::geometry::RGBDImage> rgbds;
+    for (size_t i = 0; i < redwood_data.GetColorPaths().size(); ++i) {
+        rgbds.emplace_back(
+                *t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i]),
+                *t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i]));
+    }
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+    const core::Tensor T_init =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    // Reference: the sequential loop of the examples.
+    t::pipelines::slam::Model model(voxel_size, 16, 1000, T_init, device);
+    t::pipelines::slam::Frame input_frame(rgbds[0].depth_.GetRows(),
+                                          rgbds[0].depth_.GetCols(),
+                                          intrinsic_t, device);
+    t::pipelines::slam::Frame raycast_frame(rgbds[0].depth_.GetRows(),
+                                            rgbds[0].depth_.GetCols(),
+                                            intrinsic_t, device);
+    std::vector<core::Tensor> expected_poses;
+    core::Tensor T_frame_to_model = T_init;
+    for (size_t i = 0; i < rgbds.size(); ++i) {
+        input_frame.SetDataFromImage("depth", rgbds[i].depth_);
+        input_frame.SetDataFromImage("color", rgbds[i].color_);
+        if (i > 0) {
+            auto result = model.TrackFrameToModel(input_frame, raycast_frame);
+            T_frame_to_model = T_frame_to_model.Matmul(result.transformation_);
+        }
+        model.UpdateFramePose(i, T_frame_to_model);
+        model.Integrate(input_frame);
+        model.SynthesizeModelFrame(raycast_frame, 1000.0, 0.1, 3.0, 8.0,
+                                   false);
+        expected_poses.push_back(T_frame_to_model);
+    }
+
+    auto loader = [&](int64_t index) {
+        return index < int64_t(rgbds.size()) ? rgbds[index]
+                                             : t::geometry::RGBDImage();
+    };
+
+    // Without model lag the pipeline reproduces the sequential loop.
+    t::pipelines::slam::PipelineParams params;
+    params.max_model_lag_ = 0;
+    t::pipelines::slam::Model model_sync(voxel_size, 16, 1000, T_init, device);
+    t::pipelines::slam::Pipeline pipeline_sync(model_sync, intrinsic_t,
+                                               params);
+    int64_t num_callbacks = 0;
+    auto poses = pipeline_sync.Run(
+            loader, [&](int64_t frame_id, const core::Tensor&) {
+                EXPECT_EQ(frame_id, num_callbacks++);
+            });
+    ASSERT_EQ(poses.size(), expected_poses.size());
+    EXPECT_EQ(num_callbacks, int64_t(rgbds.size()));
+    for (size_t i = 0; i < poses.size(); ++i) {
+        EXPECT_TRUE(poses[i].AllClose(expected_poses[i], 1e-5, 1e-5));
+    }
+    EXPECT_EQ(pipeline_sync.GetStatistics().num_frames_,
+              int64_t(rgbds.size()));
+
+    // Tracking against a model lagging one frame behind stays close.
+    params.max_model_lag_ = 1;
+    t::pipelines::slam::Model model_async(voxel_size, 16, 1000, T_init,
+                                          device);
+    t::pipelines::slam::Pipeline pipeline_async(model_async, intrinsic_t,
+                                                params);
+    poses = pipeline_async.Run(loader);
+    ASSERT_EQ(poses.size(), expected_poses.size());
+    for (size_t i = 0; i < poses.size(); ++i) {
+        core::Tensor translation =
+                (poses[i] - expected_poses[i]).Slice(0, 0, 3).Slice(1, 3, 4);
+        EXPECT_LT((translation * translation).Sum({0, 1}).Item<double>(),
+                  1e-3);
+    }
+
+    // Errors in the loader are rethrown.
+    t::pipelines::slam::Pipeline pipeline_error(model_async, intrinsic_t,
+                                                params);
+    EXPECT_ANY_THROW(pipeline_error.Run([](int64_t) -> t::geometry::RGBDImage {
+        utility::LogError("Loader failed.");
+    }));
+}
+
+TEST_P(SLAMPipelinePermuteDevices, RunFreshModelDefaultParams) {
+    core::Device device = GetParam();
+    const float voxel_size = 3.0f / 512;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    std::vector<t::geometry::RGBDImage> rgbds;
+    for (size_t i = 0; i < redwood_data.GetColorPaths().size(); ++i) {
+        rgbds.emplace_back(
+                *t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i]),
+                *t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i]));
+    }
+    auto loader = [&](int64_t index) {
+        return index < int64_t(rgbds.size()) ? rgbds[index]
+                                             : t::geometry::RGBDImage();
+    };
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+    const core::Tensor T_init =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    // Tracking of frame 1 must wait for the first model frame, however the
+    // threads are scheduled.
+    for (int run = 0; run < 5; ++run) {
+        t::pipelines::slam::Model model(voxel_size, 16, 1000, T_init, device);
+        t::pipelines::slam::Pipeline pipeline(model, intrinsic_t);
+        std::vector<core::Tensor> poses;
+        EXPECT_NO_THROW(poses = pipeline.Run(loader));
+        ASSERT_EQ(poses.size(), rgbds.size());
+        EXPECT_EQ(pipeline.GetStatistics().num_tracking_failures_, 0);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,6 +26,8 @@ void PrintHelp() {
     utility::LogInfo("    --trunc_voxel_multiplier [=8.0]");
     utility::LogInfo("    --block_count [=10000]");
     utility::LogInfo("    --device [CPU:0]");
+    utility::LogInfo("    --pipeline [overlap loading, tracking and integration on separate threads]");
+    utility::LogInfo("    --loop_closure [correct drift with keyframe loop closures, without --pipeline]");
     utility::LogInfo("    --pointcloud [file path to save the extracted pointcloud]");
     utility::LogInfo("    --mesh [file path to save the extracted mesh]");
     utility::LogInfo("    --vis [whether to visualize the result]");
@@ -138,50 +140,95 @@ int main(int argc, char* argv[]) {
     t::pipelines::slam::Frame raycast_frame(
             ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
 
-    // Iterate over frames
-    for (size_t i = 0; i < iterations; ++i) {
-        utility::LogInfo("Processing {}/{}...", i, iterations);
-        // Load image into frame
-        Image input_depth = *t::io::CreateImageFromFile(depth_filenames[i]);
-        Image input_color = *t::io::CreateImageFromFile(color_filenames[i]);
-        input_frame.SetDataFromImage("depth", input_depth);
-        input_frame.SetDataFromImage("color", input_color);
-
-        bool tracking_success = true;
-        if (i > 0) {
-            auto result =
-                    model.TrackFrameToModel(input_frame, raycast_frame,
-                                            depth_scale, depth_max, depth_diff);
-
-            core::Tensor translation =
-                    result.transformation_.Slice(0, 0, 3).Slice(1, 3, 4);
-            double translation_norm = std::sqrt(
-                    (translation * translation).Sum({0, 1}).Item<double>());
-
-            // TODO(wei): more systematical failure check.
-            // If the overlap is too small or translation is too high between
-            // two consecutive frames, it is likely that the tracking failed.
-            if (result.fitness_ >= 0.1 && translation_norm < 0.15) {
-                T_frame_to_model =
-                        T_frame_to_model.Matmul(result.transformation_);
-            } else {  // Don't update
-                tracking_success = false;
-                utility::LogWarning(
-                        "Tracking failed for frame {}, fitness: {:.3f}, "
-                        "translation: {:.3f}. Using previous frame's "
-                        "pose.",
-                        i, result.fitness_, translation_norm);
-            }
+    if (utility::ProgramOptionExists(argc, argv, "--pipeline")) {
+        t::pipelines::slam::PipelineParams params(
+                depth_scale, depth_max, depth_diff, trunc_voxel_multiplier);
+        t::pipelines::slam::Pipeline pipeline(model, intrinsic_t, params);
+        pipeline.Run([&](int64_t i) {
+            if (size_t(i) >= iterations) return t::geometry::RGBDImage();
+            utility::LogInfo("Processing {}/{}...", i, iterations);
+            return t::geometry::RGBDImage(
+                    *t::io::CreateImageFromFile(color_filenames[i]),
+                    *t::io::CreateImageFromFile(depth_filenames[i]));
+        });
+        auto statistics = pipeline.GetStatistics();
+        utility::LogInfo(
+                "{:.2f} fps, mean time load {:.2f} ms, track {:.2f} ms, "
+                "map {:.2f} ms, mean latency {:.2f} ms",
+                statistics.fps_, statistics.load_time_,
+                statistics.track_time_, statistics.map_time_,
+                statistics.mean_latency_);
+    } else {
+        std::unique_ptr<t::pipelines::slam::Backend> backend;
+        if (utility::ProgramOptionExists(argc, argv, "--loop_closure")) {
+            backend = std::make_unique<t::pipelines::slam::Backend>(
+                    intrinsic_t, t::pipelines::slam::BackendParams(
+                                         depth_scale, depth_max,
+                                         trunc_voxel_multiplier));
         }
 
-        // Integrate
-        model.UpdateFramePose(i, T_frame_to_model);
-        if (tracking_success) {
-            model.Integrate(input_frame, depth_scale, depth_max,
-                            trunc_voxel_multiplier);
+        // Iterate over frames
+        for (size_t i = 0; i < iterations; ++i) {
+            utility::LogInfo("Processing {}/{}...", i, iterations);
+            // Load image into frame
+            Image input_depth =
+                    *t::io::CreateImageFromFile(depth_filenames[i]);
+            Image input_color =
+                    *t::io::CreateImageFromFile(color_filenames[i]);
+            input_frame.SetDataFromImage("depth", input_depth);
+            input_frame.SetDataFromImage("color", input_color);
+
+            bool tracking_success = true;
+            if (i > 0) {
+                auto result = model.TrackFrameToModel(
+                        input_frame, raycast_frame, depth_scale, depth_max,
+                        depth_diff);
+
+                core::Tensor translation =
+                        result.transformation_.Slice(0, 0, 3).Slice(1, 3, 4);
+                double translation_norm = std::sqrt(
+                        (translation * translation).Sum({0, 1}).Item<double>());
+
+                // TODO(wei): more systematical failure check.
+                // If the overlap is too small or translation is too high
+                // between two consecutive frames, it is likely that the
+                // tracking failed.
+                if (result.fitness_ >= 0.1 && translation_norm < 0.15) {
+                    T_frame_to_model =
+                            T_frame_to_model.Matmul(result.transformation_);
+                } else {  // Don't update
+                    tracking_success = false;
+                    utility::LogWarning(
+                            "Tracking failed for frame {}, fitness: {:.3f}, "
+                            "translation: {:.3f}. Using previous frame's "
+                            "pose.",
+                            i, result.fitness_, translation_norm);
+                }
+            }
+
+            // Integrate
+            model.UpdateFramePose(i, T_frame_to_model);
+            if (tracking_success) {
+                model.Integrate(input_frame, depth_scale, depth_max,
+                                trunc_voxel_multiplier);
+                if (backend) {
+                    backend->AddFrame(i,
+                                      t::geometry::RGBDImage(input_color,
+                                                             input_depth),
+                                      T_frame_to_model);
+                }
+            }
+            if (backend && backend->Update(model)) {
+                T_frame_to_model = model.GetCurrentFramePose();
+            }
+            model.SynthesizeModelFrame(raycast_frame, depth_scale, 0.1,
+                                       depth_max, trunc_voxel_multiplier,
+                                       false);
+        }
+        if (backend) {
+            utility::LogInfo("{} loop closures.",
+                             backend->GetNumLoopClosures());
         }
-        model.SynthesizeModelFrame(raycast_frame, depth_scale, 0.1, depth_max,
-                                   trunc_voxel_multiplier, false);
     }
 
     if (utility::ProgramOptionExists(argc, argv, "--pointcloud")) {
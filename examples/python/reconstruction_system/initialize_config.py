@@ -72,6 +72,7 @@ def initialize_config(config):
     set_default_value(config, "distance_threshold", 0.07)
     set_default_value(config, "fitness_threshold", 0.3)
     set_default_value(config, "regularizer_weight", 1)
+    set_default_value(config, "slac_sparse_solver", False)
     set_default_value(config, "method", "slac")
     set_default_value(config, "device", "CPU:0")
     set_default_value(config, "save_output_as", "pointcloud")
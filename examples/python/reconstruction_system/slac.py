@@ -45,6 +45,7 @@ def run(config):
         regularizer_weight=config["regularizer_weight"],
         device=o3d.core.Device(str(config["device"])),
         slac_folder=join(path_dataset, config["folder_slac"]))
+    slac_params.use_sparse_solver = config["slac_sparse_solver"]
 
     # SLAC debug option.
     debug_option = o3d.t.pipelines.slac.slac_debug_option(False, 0)
@@ -360,3 +360,192 @@ def test_sphere_wrong_occupancy():
     # we should get the same result with more samples
     occupancy_3samples = scene.compute_occupancy(query_points, nsamples=3)
     np.testing.assert_equal(occupancy_3samples.numpy(), expected)
+
+
+def test_instances():
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    prototype_id = scene.add_prototype(vertices, triangles)
+    transform = np.eye(4, dtype=np.float32)
+    transform[:3, 3] = [10, 0, 0]
+    instance_ids = [
+        scene.add_instance(prototype_id, o3d.core.Tensor(np.eye(4))),
+        scene.add_instance(prototype_id, o3d.core.Tensor(transform)),
+    ]
+
+    rays = o3d.core.Tensor(
+        [[0.2, 0.1, 1, 0, 0, -1], [10.2, 0.1, 1, 0, 0, -1],
+         [5, 0.1, 1, 0, 0, -1]],
+        dtype=o3d.core.float32)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_equal(
+        ans['geometry_ids'].numpy(),
+        instance_ids + [o3d.t.geometry.RaycastingScene.INVALID_ID])
+    np.testing.assert_equal(ans['primitive_ids'].numpy()[:2], [0, 0])
+    np.testing.assert_allclose(ans['t_hit'].numpy()[:2], [1, 1])
+    np.testing.assert_allclose(ans['primitive_normals'].numpy()[:2],
+                               [[0, 0, 1], [0, 0, 1]])
+    np.testing.assert_equal(scene.count_intersections(rays).numpy(), [1, 1, 0])
+
+    # Flip and move the second instance. Normals are returned in world space.
+    transform = np.diag([1, -1, -1, 1]).astype(np.float32)
+    transform[:3, 3] = [10, 0.2, 0.5]
+    scene.set_instance_transform(instance_ids[1], o3d.core.Tensor(transform))
+    ans = scene.cast_rays(rays)
+    np.testing.assert_allclose(ans['t_hit'].numpy()[:2], [1, 0.5])
+    np.testing.assert_allclose(ans['primitive_normals'].numpy()[1], [0, 0, -1],
+                               atol=1e-6)
+
+    query_points = o3d.core.Tensor([[10.5, 0, 2], [10.5, 0, 2.5]],
+                                   dtype=o3d.core.float32)
+    ans = scene.compute_closest_points(query_points)
+    np.testing.assert_equal(ans['geometry_ids'].numpy(), instance_ids[1])
+    np.testing.assert_allclose(ans['points'].numpy(),
+                               [[10.5, 0, 0.5], [10.5, 0, 0.5]],
+                               atol=1e-6)
+    np.testing.assert_allclose(scene.compute_distance(query_points).numpy(),
+                               [1.5, 2],
+                               atol=1e-6)
+
+
+def test_geometry_mask():
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    lower_id = scene.add_triangles(vertices, triangles)
+    upper_id = scene.add_triangles(
+        vertices + o3d.core.Tensor([0, 0, 0.5], dtype=o3d.core.float32),
+        triangles)
+    scene.set_geometry_mask(upper_id, 0b10)
+
+    rays = o3d.core.Tensor([[0.2, 0.1, 1, 0, 0, -1]], dtype=o3d.core.float32)
+    assert scene.cast_rays(rays)['geometry_ids'][0] == upper_id
+    assert scene.cast_rays(rays, ray_mask=0b01)['geometry_ids'][0] == lower_id
+    assert scene.count_intersections(rays, ray_mask=0b10)[0] == 1
+    assert scene.list_intersections(rays, ray_mask=0b01)['geometry_ids'][0] == (
+        lower_id)
+    assert not scene.test_occlusions(rays, tfar=0.8, ray_mask=0b01)[0]
+    assert scene.test_occlusions(rays, tfar=0.8)[0]
+
+
+def test_cast_rays_packets_and_preallocated_result():
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_box())
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(cube)
+
+    # Odd image sizes to test partial ray packets at the tile borders.
+    rays = scene.create_rays_pinhole(fov_deg=60,
+                                     center=[0.5, 0.5, 0.5],
+                                     eye=[-1, -1, -1],
+                                     up=[0, 0, 1],
+                                     width_px=37,
+                                     height_px=23)
+    ans = scene.cast_rays(rays)
+    ans_flat = scene.cast_rays(rays.reshape((-1, 6)))
+    for k, v in ans_flat.items():
+        np.testing.assert_equal(ans[k].numpy().reshape(v.shape), v.numpy())
+    np.testing.assert_equal(
+        scene.test_occlusions(rays).numpy(),
+        ans['geometry_ids'].numpy() != o3d.t.geometry.RaycastingScene.INVALID_ID)
+
+    def data_ptr(tensor):
+        return tensor.numpy().__array_interface__['data'][0]
+
+    result = scene.cast_rays(rays, {})
+    t_hit_ptr = data_ptr(result['t_hit'])
+    result = scene.cast_rays(rays, result)
+    assert data_ptr(result['t_hit']) == t_hit_ptr
+    np.testing.assert_equal(result['t_hit'].numpy(), ans['t_hit'].numpy())
+
+    occluded = o3d.core.Tensor.zeros(rays.shape[:-1], dtype=o3d.core.bool)
+    occluded_ptr = data_ptr(occluded)
+    occluded = scene.test_occlusions(rays, occluded)
+    assert data_ptr(occluded) == occluded_ptr
+    assert occluded.numpy().any()
+
+
+def test_compute_signed_distance_grid():
+    mesh = o3d.geometry.TriangleMesh.create_sphere(0.8)
+    mesh = o3d.t.geometry.TriangleMesh.from_legacy(mesh)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(mesh)
+
+    origin = np.array([-1.0, -1.1, -0.9], dtype=np.float32)
+    voxel_size = 0.1
+    grid_size = [21, 22, 17]
+    idx = np.stack(np.meshgrid(*[np.arange(n) for n in grid_size],
+                               indexing='ij'),
+                   axis=-1)
+    query_points = (origin + voxel_size * idx).astype(np.float32)
+    expected = scene.compute_signed_distance(query_points).numpy()
+
+    sdf = scene.compute_signed_distance_grid(origin, voxel_size, grid_size)
+    assert list(sdf.shape) == grid_size
+    np.testing.assert_equal(np.sign(sdf.numpy()), np.sign(expected))
+    np.testing.assert_allclose(sdf.numpy(), expected, atol=0.05 * voxel_size)
+
+    udf = scene.compute_distance_grid(origin, voxel_size, grid_size)
+    np.testing.assert_allclose(udf.numpy(), np.abs(sdf.numpy()))
+
+    # Distances in the band are exact.
+    sdf = scene.compute_signed_distance_grid(origin,
+                                             voxel_size,
+                                             grid_size,
+                                             band_width=0.25,
+                                             nsamples=3)
+    np.testing.assert_allclose(sdf.numpy(),
+                               np.clip(expected, -0.25, 0.25),
+                               atol=1e-5)
+
+
+def test_lidar_multi_hit():
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_box())
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(cube)
+
+    # Sensor at (-2, 0.5, 0.5) looking at the cube along the x axis.
+    extrinsic = np.eye(4)
+    extrinsic[:3, 3] = [2, -0.5, -0.5]
+    elevations = o3d.core.Tensor([-5, 0, 5], dtype=o3d.core.float32)
+    rays = o3d.t.geometry.RaycastingScene.create_rays_lidar(
+        elevations, 1.0, o3d.core.Tensor(extrinsic))
+    assert list(rays.shape) == [3, 360, 6]
+    np.testing.assert_allclose(rays[1, 0].numpy(), [-2, 0.5, 0.5, 1, 0, 0])
+    np.testing.assert_allclose(np.linalg.norm(rays[..., 3:].numpy(), axis=-1),
+                               1,
+                               rtol=1e-6)
+
+    ans = scene.cast_rays_multi_hit(rays, max_hits=3)
+    assert list(ans['t_hit'].shape) == [3, 360, 3]
+    assert list(ans['primitive_normals'].shape) == [3, 360, 3, 3]
+    # The ray crosses the diagonal edges shared by the two triangles of the
+    # faces x = 0 and x = 1, each face is hit once.
+    assert ans['num_hits'][1, 0].item() == 2
+    np.testing.assert_allclose(ans['t_hit'][1, 0].numpy(), [2, 3, np.inf])
+    invalid_id = o3d.t.geometry.RaycastingScene.INVALID_ID
+    assert ans['geometry_ids'][1, 0, 2].item() == invalid_id
+    np.testing.assert_equal(ans['num_hits'].numpy(),
+                            scene.count_intersections(rays).numpy())
+    t_hit = ans['t_hit'].numpy()
+    assert np.all(np.diff(t_hit, axis=-1)[np.isfinite(t_hit[..., 1:])] >= 0)
+
+    # The first hit is the hit of cast_rays.
+    closest = scene.cast_rays(rays)
+    for k in ('t_hit', 'geometry_ids', 'primitive_ids'):
+        np.testing.assert_equal(ans[k][..., 0].numpy(), closest[k].numpy())
+
+    # The pose is interpolated over the sweep for moving sensors.
+    extrinsic_end = extrinsic.copy()
+    extrinsic_end[1, 3] = -1.5
+    rays = o3d.t.geometry.RaycastingScene.create_rays_lidar(
+        elevations, 90.0, o3d.core.Tensor(extrinsic),
+        o3d.core.Tensor(extrinsic_end))
+    np.testing.assert_allclose(rays[1, :, 1].numpy(), [0.5, 0.75, 1.0, 1.25])